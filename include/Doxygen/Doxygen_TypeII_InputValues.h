@@ -100,8 +100,10 @@ RMLPositionFlags can be used to determine and obtain a certain behavior.
 The following flags may be used:\n\n
 
  - RMLPositionFlags::SynchronizationBehavior,\n\n
- - RMLPositionFlags::EnableTheCalculationOfTheExtremumMotionStates, and\n\n
- - RMLPositionFlags::KeepCurrentVelocityInCaseOfFallbackStrategy.\n\n
+ - RMLPositionFlags::EnableTheCalculationOfTheExtremumMotionStates,\n\n
+ - RMLPositionFlags::KeepCurrentVelocityInCaseOfFallbackStrategy,\n\n
+ - RMLPositionFlags::EnableDeterministicTiming, and\n\n
+ - RMLPositionFlags::NumberOfRecomputationCycles.\n\n
 
 A first and simple example that shows, how the position-based input values 
 are commonly set-up, please refer to the
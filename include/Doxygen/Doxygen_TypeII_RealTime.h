@@ -62,5 +62,39 @@ List of all constructors:
 <li>RMLVector::RMLVector()</li>
 </ul>
 
+\n
+
+\section sec_PreparationForRealTime Preparation for Real-Time Execution
+
+Even if all objects are created during the start-up phase, the first
+calls of ReflexxesAPI::RMLPosition() and ReflexxesAPI::RMLVelocity() may
+take significantly longer than all subsequent ones due to page faults and
+cache misses. To avoid this, all Reflexxes objects can be allocated from
+one contiguous memory region (RMLMemoryRegion), which is optionally backed
+by huge pages and which can be locked into physical memory, and a warm-up
+calculation can be executed by ReflexxesAPI::PrepareForRealTime()
+(cf. the example in the description of the class RMLMemoryRegion).
+
+Applications that create and delete objects at run-time, for instance,
+one generator per short-lived task, can pass a memory pool
+(RMLMemoryPool) or an own memory resource (RMLMemoryResource) to the
+constructors of ReflexxesAPI and of the parameter classes, such that
+these objects reuse pre-reserved memory instead of the heap.
+
+Machines that switch between kinematic configurations with a different
+number of degrees of freedom or a different cycle time do not need to
+create new objects either: If a maximum number of degrees of freedom is
+passed to the constructor of ReflexxesAPI, the method
+ReflexxesAPI::Reconfigure() changes both values in real-time, and the
+parameter classes are adapted by RMLInputParameters::SetNumberOfDOFs()
+and RMLOutputParameters::SetNumberOfDOFs(). ReflexxesAPI::Reset()
+discards the current trajectories, for instance, after an emergency stop.
+
+A trajectory cache for motions that are executed repeatedly (cf.
+ReflexxesAPI::SetTrajectoryCache()) has to be set up during the start-up
+phase, too; afterwards, it does not allocate memory. The same holds for
+mapping a trajectory cache file (cf. ReflexxesAPI::MapTrajectoryCacheFile()),
+which reads all pages of the file once to validate its records.
+
 */
 
@@ -75,5 +75,17 @@ were added.
  - Minor changes and improvements
  - Doxygen documentation files openly available
 
+\section sec_Version128 development version 1.2.8 (October 2026, not released)
+
+ - Real-time extensions: binary logs and replay, a flat C interface,
+   memory resources and regions, deterministic timing, amortized and
+   incremental recomputation, trajectory caches, feed override, and
+   batched and candidate-target queries. Files added for these
+   extensions carry the version 1.2.8.
+ - \b Bug fixed: Step 1 could select a profile without a
+   constant-velocity phase, although the maximum velocity is reached,
+   such that the maximum velocity was exceeded (cf.
+   TypeIIRMLMath::Decision_1A__005()).
+
 */
 
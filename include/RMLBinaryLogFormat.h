@@ -0,0 +1,329 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLBinaryLogFormat.h
+//!
+//! \brief
+//! Definition of the memory-mappable binary log file format
+//!
+//! \details
+//! A log file consists of a fixed-size RMLBinaryLogHeader followed by a
+//! fixed number of equally sized records. Each record contains the input
+//! values, the flags, the output values, and the return value of one call
+//! of ReflexxesAPI::RMLPosition() or ReflexxesAPI::RMLVelocity().
+//!
+//! \sa RMLBinaryLogWriter
+//! \sa RMLBinaryLogReader
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLBinaryLogFormat__
+#define __RMLBinaryLogFormat__
+
+
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_BINARY_LOG_MAGIC_NUMBER
+//!
+//! \brief
+//! Eight-byte identifier at the beginning of every binary log file
+//  ----------------------------------------------------------
+#define RML_BINARY_LOG_MAGIC_NUMBER                 "RMLIILOG"
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_BINARY_LOG_FORMAT_VERSION
+//!
+//! \brief
+//! Version of the binary log format
+//!
+//! \details
+//! This value has to be increased whenever the layout of
+//! RMLBinaryLogHeader or RMLBinaryLogRecordHeader or the order of the
+//! data blocks of a record (cf. RMLBinaryLogDataBlock) changes. Readers
+//! reject files with a different format version.\n
+//! \n
+//! Version 2 added RMLBinaryLogRecordHeader::ElapsedTime, and version 3
+//! added the feed override values of RMLBinaryLogRecordHeader.
+//  ----------------------------------------------------------
+#define RML_BINARY_LOG_FORMAT_VERSION               3
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_BINARY_LOG_ENDIANNESS_TAG
+//!
+//! \brief
+//! Value written into RMLBinaryLogHeader::EndiannessTag to detect files
+//! that were written on a machine with a different byte order
+//  ----------------------------------------------------------
+#define RML_BINARY_LOG_ENDIANNESS_TAG               0x01020304
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_BINARY_LOG_ALIGNMENT
+//!
+//! \brief
+//! Size of the header and alignment of all records in bytes
+//!
+//! \details
+//! Each record starts at a cache line boundary, such that concurrent
+//! writers never share a cache line.
+//  ----------------------------------------------------------
+#define RML_BINARY_LOG_ALIGNMENT                    128
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_BINARY_LOG_LIBRARY_VERSION
+//!
+//! \brief
+//! Version string of the library that is written into every log file
+//  ----------------------------------------------------------
+#define RML_BINARY_LOG_LIBRARY_VERSION              "1.2.7"
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum RMLBinaryLogDataBlock
+//!
+//! \brief
+//! Indices of the \c double data blocks of a log record
+//!
+//! \details
+//! Each record consists of an RMLBinaryLogRecordHeader, followed by
+//! RML_BINARY_LOG_NUMBER_OF_DATA_BLOCKS arrays of \c double values with
+//! one element per degree of freedom, followed by the selection vector
+//! (one byte per degree of freedom). Blocks that do not exist for the
+//! respective interface (e.g., RML_BINARY_LOG_TARGET_POSITION for the
+//! velocity-based algorithm) are filled with zeros.
+//!
+//! \sa RMLBinaryLogReader::GetDataBlock()
+//  ----------------------------------------------------------
+enum RMLBinaryLogDataBlock
+{
+    //! \brief RMLInputParameters::CurrentPositionVector
+    RML_BINARY_LOG_CURRENT_POSITION                 =   0,
+    //! \brief RMLInputParameters::CurrentVelocityVector
+    RML_BINARY_LOG_CURRENT_VELOCITY                 =   1,
+    //! \brief RMLInputParameters::CurrentAccelerationVector
+    RML_BINARY_LOG_CURRENT_ACCELERATION             =   2,
+    //! \brief RMLPositionInputParameters::MaxVelocityVector
+    RML_BINARY_LOG_MAX_VELOCITY                     =   3,
+    //! \brief RMLInputParameters::MaxAccelerationVector
+    RML_BINARY_LOG_MAX_ACCELERATION                 =   4,
+    //! \brief RMLInputParameters::MaxJerkVector
+    RML_BINARY_LOG_MAX_JERK                         =   5,
+    //! \brief RMLPositionInputParameters::TargetPositionVector
+    RML_BINARY_LOG_TARGET_POSITION                  =   6,
+    //! \brief RMLInputParameters::TargetVelocityVector
+    RML_BINARY_LOG_TARGET_VELOCITY                  =   7,
+    //! \brief RMLPositionInputParameters::AlternativeTargetVelocityVector
+    RML_BINARY_LOG_ALTERNATIVE_TARGET_VELOCITY      =   8,
+    //! \brief RMLOutputParameters::NewPositionVector
+    RML_BINARY_LOG_NEW_POSITION                     =   9,
+    //! \brief RMLOutputParameters::NewVelocityVector
+    RML_BINARY_LOG_NEW_VELOCITY                     =   10,
+    //! \brief RMLOutputParameters::NewAccelerationVector
+    RML_BINARY_LOG_NEW_ACCELERATION                 =   11,
+    //! \brief RMLOutputParameters::ExecutionTimes
+    RML_BINARY_LOG_EXECUTION_TIMES                  =   12,
+    //! \brief RMLVelocityOutputParameters::PositionValuesAtTargetVelocity
+    RML_BINARY_LOG_POSITION_VALUES_AT_TARGET_VELOCITY   =   13,
+    //! \brief Number of data blocks per record
+    RML_BINARY_LOG_NUMBER_OF_DATA_BLOCKS            =   14
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum RMLBinaryLogStatusBit
+//!
+//! \brief
+//! Bits of RMLBinaryLogRecordHeader::StatusBits
+//  ----------------------------------------------------------
+enum RMLBinaryLogStatusBit
+{
+    //! \brief The record was written by the velocity-based algorithm
+    RML_BINARY_LOG_VELOCITY_INTERFACE               =   0x01,
+    //! \brief RMLOutputParameters::ANewCalculationWasPerformed
+    RML_BINARY_LOG_NEW_CALCULATION_WAS_PERFORMED    =   0x02,
+    //! \brief RMLOutputParameters::TrajectoryIsPhaseSynchronized
+    RML_BINARY_LOG_TRAJECTORY_IS_PHASE_SYNCHRONIZED =   0x04
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum RMLBinaryLogFileFlag
+//!
+//! \brief
+//! Bits of RMLBinaryLogHeader::FileFlags
+//  ----------------------------------------------------------
+enum RMLBinaryLogFileFlag
+{
+    //! \brief The file is a ring buffer, and the oldest records become overwritten
+    RML_BINARY_LOG_RING_BUFFER                      =   0x01
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLBinaryLogHeader
+//!
+//! \brief
+//! Fixed-size header at the beginning of a binary log file
+//!
+//! \details
+//! The header occupies the first RML_BINARY_LOG_ALIGNMENT bytes of the
+//! file. All values are stored in the native byte order of the writing
+//! machine; RMLBinaryLogHeader::EndiannessTag lets readers detect a
+//! mismatch.
+//!
+//! \sa RMLBinaryLogWriter
+//! \sa RMLBinaryLogReader
+//  ----------------------------------------------------------
+struct RMLBinaryLogHeader
+{
+    //! \brief Contains RML_BINARY_LOG_MAGIC_NUMBER (without terminating zero)
+    char                            MagicNumber[8]          ;
+    //! \brief RML_BINARY_LOG_FORMAT_VERSION of the writer
+    unsigned int                    FormatVersion           ;
+    //! \brief RML_BINARY_LOG_ENDIANNESS_TAG in the byte order of the writer
+    unsigned int                    EndiannessTag           ;
+    //! \brief Size of the header in bytes
+    unsigned int                    HeaderSize              ;
+    //! \brief Size of one record in bytes (multiple of RML_BINARY_LOG_ALIGNMENT)
+    unsigned int                    RecordSize              ;
+    //! \brief Number of degrees of freedom of all records
+    unsigned int                    NumberOfDOFs            ;
+    //! \brief Combination of RMLBinaryLogFileFlag values
+    unsigned int                    FileFlags               ;
+    //! \brief Number of record slots in the file
+    unsigned long long              Capacity                ;
+    //! \brief Number of records that have been reserved by writers so far
+    //! (may exceed the capacity); incremented atomically
+    volatile unsigned long long     NumberOfReservedRecords ;
+    //! \brief Cycle time of the logged algorithm in seconds
+    double                          CycleTime               ;
+    //! \brief Zero-terminated RML_BINARY_LOG_LIBRARY_VERSION of the writer
+    char                            LibraryVersion[16]      ;
+    //! \brief Unused, set to zero
+    unsigned char                   Reserved[56]            ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLBinaryLogRecordHeader
+//!
+//! \brief
+//! Fixed-size part at the beginning of each record of a binary log file
+//!
+//! \details
+//! A record is complete, if RMLBinaryLogRecordHeader::SequenceNumber
+//! equals the (zero-based) number of the record plus one. Writers set
+//! this value after all other data of the record have been written.
+//  ----------------------------------------------------------
+struct RMLBinaryLogRecordHeader
+{
+    //! \brief One-based sequence number of the record; zero while the
+    //! record is being written
+    volatile unsigned long long     SequenceNumber                                  ;
+    //! \brief Time stamp provided by the application (e.g., in nanoseconds)
+    unsigned long long              TimeStamp                                       ;
+    //! \brief Return value of the logged call (ReflexxesAPI::RMLResultValue)
+    int                             ResultValue                                     ;
+    //! \brief Combination of RMLBinaryLogStatusBit values
+    unsigned int                    StatusBits                                      ;
+    //! \brief RMLFlags::SynchronizationBehavior
+    unsigned char                   SynchronizationBehavior                         ;
+    //! \brief RMLFlags::EnableTheCalculationOfTheExtremumMotionStates
+    unsigned char                   EnableTheCalculationOfTheExtremumMotionStates   ;
+    //! \brief RMLPositionFlags::BehaviorAfterFinalStateOfMotionIsReached
+    unsigned char                   BehaviorAfterFinalStateOfMotionIsReached        ;
+    //! \brief RMLPositionFlags::KeepCurrentVelocityInCaseOfFallbackStrategy
+    unsigned char                   KeepCurrentVelocityInCaseOfFallbackStrategy     ;
+    //! \brief RMLOutputParameters::DOFWithTheGreatestExecutionTime
+    unsigned int                    DOFWithTheGreatestExecutionTime                 ;
+    //! \brief RMLInputParameters::MinimumSynchronizationTime
+    double                          MinimumSynchronizationTime                      ;
+    //! \brief RMLOutputParameters::SynchronizationTime
+    double                          SynchronizationTime                             ;
+    //! \brief RMLPositionFlags::EnableDeterministicTiming
+    unsigned char                   EnableDeterministicTiming                       ;
+    //! \brief RMLPositionFlags::NumberOfRecomputationCycles (limited to 255)
+    unsigned char                   NumberOfRecomputationCycles                     ;
+    //! \brief Unused, set to zero
+    unsigned char                   Reserved[6]                                     ;
+    //! \brief Time in seconds that elapsed since the previous call, that
+    //! is, the \c ElapsedTimeInSeconds argument of ReflexxesAPI::RMLPosition()
+    //! or ReflexxesAPI::RMLVelocity(), or the nominal cycle time
+    double                          ElapsedTime                                     ;
+    //! \brief Feed override factor that was set by
+    //! ReflexxesAPI::SetFeedOverride() (zero for the velocity-based
+    //! algorithm)
+    double                          FeedOverride                                    ;
+    //! \brief Feed override factor that was applied at the end of the cycle,
+    //! cf. ReflexxesAPI::GetFeedOverride() (zero for the velocity-based
+    //! algorithm)
+    double                          AppliedFeedOverride                             ;
+    //! \brief Value that was set by ReflexxesAPI::SetMaxFeedOverrideRate()
+    //! (zero for the velocity-based algorithm)
+    double                          MaxFeedOverrideRate                             ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline size_t RMLBinaryLogRecordSize(const unsigned int &NumberOfDOFs)
+//!
+//! \brief
+//! Calculates the size of one record in bytes
+//!
+//! \param NumberOfDOFs
+//! Number of degrees of freedom
+//!
+//! \return
+//! The size of one record including padding to RML_BINARY_LOG_ALIGNMENT
+//  ----------------------------------------------------------
+inline size_t RMLBinaryLogRecordSize(const unsigned int &NumberOfDOFs)
+{
+    size_t      Size    =       sizeof(RMLBinaryLogRecordHeader)
+                            +   RML_BINARY_LOG_NUMBER_OF_DATA_BLOCKS * NumberOfDOFs * sizeof(double)
+                            +   NumberOfDOFs * sizeof(unsigned char);
+
+    return(     ((Size + RML_BINARY_LOG_ALIGNMENT - 1) / RML_BINARY_LOG_ALIGNMENT)
+            *   RML_BINARY_LOG_ALIGNMENT    );
+}
+
+
+// Compile-time checks of the file layout
+typedef char RMLBinaryLogHeaderSizeCheck        [(sizeof(RMLBinaryLogHeader)        == RML_BINARY_LOG_ALIGNMENT)    ?   1   :   -1];
+typedef char RMLBinaryLogRecordHeaderSizeCheck  [(sizeof(RMLBinaryLogRecordHeader)  == 88)                          ?   1   :   -1];
+
+
+#endif
@@ -0,0 +1,423 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLBinaryLogReader.h
+//!
+//! \brief
+//! Header file for the class RMLBinaryLogReader
+//!
+//! \details
+//! Zero-copy reader for binary log files (cf. RMLBinaryLogFormat.h).
+//!
+//! \sa RMLBinaryLogWriter
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLBinaryLogReader__
+#define __RMLBinaryLogReader__
+
+
+#include <RMLBinaryLogFormat.h>
+#include <TypeIIRMLPlatform.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLVelocityFlags.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLBinaryLogReader
+//!
+//! \brief
+//! Zero-copy reader for binary log files written by RMLBinaryLogWriter
+//!
+//! \details
+//! The file is mapped read-only into memory, and all accessor methods
+//! return pointers into the mapped file, such that no data is copied.
+//! Records are addressed by their chronological index, which also holds
+//! for ring-buffer logs, whose oldest records may have been overwritten.
+//! Records that were still being written when the file was mapped (or
+//! when the writing application terminated) are reported as invalid.\n
+//! \n
+//! Pointers returned by RMLBinaryLogReader::GetRecord() refer to memory
+//! the writer may overwrite at any time. They may only be used for logs
+//! that are not written anymore (e.g., after the writing application
+//! terminated). Records of a live ring-buffer log have to be copied with
+//! RMLBinaryLogReader::CopyRecord(), which detects records that were
+//! overwritten during the copy.\n
+//! \n
+//! The methods RMLBinaryLogReader::GetPositionInputValues(),
+//! RMLBinaryLogReader::GetVelocityInputValues(), and the corresponding
+//! methods for output values copy a record into the regular parameter
+//! classes, for instance, to replay a log.
+//!
+//! \sa RMLBinaryLogWriter
+//! \sa RMLBinaryLogFormat.h
+//  ----------------------------------------------------------
+class RMLBinaryLogReader
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum ReturnValue
+//!
+//! \brief
+//! Return values for the methods of the class RMLBinaryLogReader
+//  ----------------------------------------------------------
+    enum ReturnValue
+    {
+        RETURN_SUCCESS                  =   0,
+        RETURN_ERROR                    =   -1,
+        //! \brief The file is not a binary log file
+        RETURN_INVALID_FILE             =   -2,
+        //! \brief The file was written with a different format version or
+        //! on a machine with a different byte order
+        RETURN_INCOMPATIBLE_FORMAT      =   -3
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLBinaryLogReader(void)
+//!
+//! \brief
+//! Constructor of the class RMLBinaryLogReader
+//  ----------------------------------------------------------
+    RMLBinaryLogReader(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLBinaryLogReader(void)
+//!
+//! \brief
+//! Destructor of the class RMLBinaryLogReader
+//  ----------------------------------------------------------
+    ~RMLBinaryLogReader(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Open(const char *FileName)
+//!
+//! \brief
+//! Maps a log file read-only into memory and validates its header
+//!
+//! \param FileName
+//! Name of the log file
+//!
+//! \return
+//! A value of RMLBinaryLogReader::ReturnValue
+//  ----------------------------------------------------------
+    int Open(const char *FileName);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Close(void)
+//!
+//! \brief
+//! Unmaps the log file. All pointers returned before become invalid.
+//  ----------------------------------------------------------
+    void Close(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline const RMLBinaryLogHeader *GetHeader(void) const
+//!
+//! \brief
+//! Returns a pointer to the header of the mapped file or \c NULL
+//  ----------------------------------------------------------
+    inline const RMLBinaryLogHeader *GetHeader(void) const
+    {
+        return(this->Header);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the number of degrees of freedom of the log
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfDOFs(void) const
+    {
+        return((this->Header == NULL)?(0):(this->Header->NumberOfDOFs));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline double GetCycleTime(void) const
+//!
+//! \brief
+//! Returns the cycle time in seconds that is stored in the log
+//  ----------------------------------------------------------
+    inline double GetCycleTime(void) const
+    {
+        return((this->Header == NULL)?(0.0):(this->Header->CycleTime));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned long long GetNumberOfRecords(void) const
+//!
+//! \brief
+//! Returns the number of records that are contained in the file
+//!
+//! \details
+//! For ring-buffer logs, this is the number of records that have not been
+//! overwritten yet.
+//  ----------------------------------------------------------
+    unsigned long long GetNumberOfRecords(void) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned long long GetNumberOfOverwrittenRecords(void) const
+//!
+//! \brief
+//! Returns the number of records that were overwritten (ring buffer) or
+//! dropped (full log) by the writer
+//  ----------------------------------------------------------
+    unsigned long long GetNumberOfOverwrittenRecords(void) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const RMLBinaryLogRecordHeader *GetRecord(const unsigned long long &Index) const
+//!
+//! \brief
+//! Returns a pointer to a record in the mapped file
+//!
+//! \param Index
+//! Chronological index of the record, \f$ 0 \f$ is the oldest record
+//! contained in the file.
+//!
+//! \return
+//! Pointer to the record or \c NULL, if \c Index is out of range or if
+//! the record has not been completely written.
+//!
+//! \note
+//! The record is only checked once, when this method is called. If the
+//! writer is still active, the record may be overwritten while it is
+//! being read, and this cannot be detected by the caller. For live logs,
+//! RMLBinaryLogReader::CopyRecord() has to be used instead.
+//!
+//! \sa RMLBinaryLogReader::CopyRecord()
+//  ----------------------------------------------------------
+    const RMLBinaryLogRecordHeader *GetRecord(const unsigned long long &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const RMLBinaryLogRecordHeader *CopyRecord(const unsigned long long &Index, void *Buffer, const size_t &BufferSize) const
+//!
+//! \brief
+//! Copies a record of a log that may still be written into a buffer of
+//! the caller
+//!
+//! \details
+//! The sequence number of the record is checked before and after the
+//! copy. If the writer reserved the slot of the record in the meantime,
+//! the copy is discarded. The returned pointer can be passed to all other
+//! accessor methods of this class.
+//!
+//! \param Index
+//! Chronological index of the record, \f$ 0 \f$ is the oldest record
+//! contained in the file.
+//!
+//! \param Buffer
+//! Buffer of at least RMLBinaryLogReader::GetRecordSize() bytes that is
+//! aligned to eight bytes
+//!
+//! \param BufferSize
+//! Size of \c Buffer in bytes
+//!
+//! \return
+//! \c Buffer as pointer to the copied record or \c NULL, if \c Index is
+//! out of range, if \c Buffer is too small, or if the record was not
+//! completely written or overwritten during the copy.
+//  ----------------------------------------------------------
+    const RMLBinaryLogRecordHeader *CopyRecord(     const unsigned long long    &Index
+                                                ,   void                        *Buffer
+                                                ,   const size_t                &BufferSize ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline size_t GetRecordSize(void) const
+//!
+//! \brief
+//! Returns the size of a record in bytes
+//  ----------------------------------------------------------
+    inline size_t GetRecordSize(void) const
+    {
+        return((this->Header == NULL)?(0):((size_t)this->Header->RecordSize));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const double *GetDataBlock(const RMLBinaryLogRecordHeader *Record, const RMLBinaryLogDataBlock &Block) const
+//!
+//! \brief
+//! Returns a pointer to a data block of a record
+//!
+//! \param Record
+//! Record returned by RMLBinaryLogReader::GetRecord() or
+//! RMLBinaryLogReader::CopyRecord()
+//!
+//! \param Block
+//! Data block to be accessed
+//!
+//! \return
+//! Pointer to an array of RMLBinaryLogReader::GetNumberOfDOFs() values
+//  ----------------------------------------------------------
+    const double *GetDataBlock(     const RMLBinaryLogRecordHeader  *Record
+                                ,   const RMLBinaryLogDataBlock     &Block  ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const unsigned char *GetSelectionVector(const RMLBinaryLogRecordHeader *Record) const
+//!
+//! \brief
+//! Returns a pointer to the selection vector of a record (one byte per
+//! degree of freedom, either zero or one)
+//  ----------------------------------------------------------
+    const unsigned char *GetSelectionVector(const RMLBinaryLogRecordHeader *Record) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool GetPositionInputValues(const RMLBinaryLogRecordHeader *Record, RMLPositionInputParameters *InputValues, RMLPositionFlags *Flags) const
+//!
+//! \brief
+//! Copies the input values and flags of a position record into the
+//! given objects
+//!
+//! \return
+//! \c false, if the record was not written by the position-based
+//! algorithm or if the number of degrees of freedom does not match
+//  ----------------------------------------------------------
+    bool GetPositionInputValues(        const RMLBinaryLogRecordHeader  *Record
+                                    ,   RMLPositionInputParameters      *InputValues
+                                    ,   RMLPositionFlags                *Flags      ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool GetPositionOutputValues(const RMLBinaryLogRecordHeader *Record, RMLPositionOutputParameters *OutputValues) const
+//!
+//! \brief
+//! Copies the logged output values of a position record into the given
+//! object
+//!
+//! \details
+//! The positional extremum values are not part of the log and remain
+//! unchanged.
+//  ----------------------------------------------------------
+    bool GetPositionOutputValues(       const RMLBinaryLogRecordHeader  *Record
+                                    ,   RMLPositionOutputParameters     *OutputValues) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool GetVelocityInputValues(const RMLBinaryLogRecordHeader *Record, RMLVelocityInputParameters *InputValues, RMLVelocityFlags *Flags) const
+//!
+//! \brief
+//! Copies the input values and flags of a velocity record into the
+//! given objects
+//!
+//! \return
+//! \c false, if the record was not written by the velocity-based
+//! algorithm or if the number of degrees of freedom does not match
+//  ----------------------------------------------------------
+    bool GetVelocityInputValues(        const RMLBinaryLogRecordHeader  *Record
+                                    ,   RMLVelocityInputParameters      *InputValues
+                                    ,   RMLVelocityFlags                *Flags      ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool GetVelocityOutputValues(const RMLBinaryLogRecordHeader *Record, RMLVelocityOutputParameters *OutputValues) const
+//!
+//! \brief
+//! Copies the logged output values of a velocity record into the given
+//! object
+//  ----------------------------------------------------------
+    bool GetVelocityOutputValues(       const RMLBinaryLogRecordHeader  *Record
+                                    ,   RMLVelocityOutputParameters     *OutputValues) const;
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ReadInputValues(const RMLBinaryLogRecordHeader *Record, RMLInputParameters *InputValues) const
+//!
+//! \brief
+//! Copies the input values that are common for both algorithms
+//  ----------------------------------------------------------
+    void ReadInputValues(       const RMLBinaryLogRecordHeader  *Record
+                            ,   RMLInputParameters              *InputValues) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ReadOutputValues(const RMLBinaryLogRecordHeader *Record, RMLOutputParameters *OutputValues) const
+//!
+//! \brief
+//! Copies the output values that are common for both algorithms
+//  ----------------------------------------------------------
+    void ReadOutputValues(      const RMLBinaryLogRecordHeader  *Record
+                            ,   RMLOutputParameters             *OutputValues) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var const RMLBinaryLogHeader *Header
+//!
+//! \brief
+//! Pointer to the header of the mapped file; \c NULL if no file is open
+//  ----------------------------------------------------------
+    const RMLBinaryLogHeader            *Header;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var const unsigned char *Records
+//!
+//! \brief
+//! Pointer to the first record slot of the mapped file
+//  ----------------------------------------------------------
+    const unsigned char                 *Records;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPlatform::MappedFile File
+//!
+//! \brief
+//! Descriptor of the mapped file
+//  ----------------------------------------------------------
+    TypeIIRMLPlatform::MappedFile       File;
+
+};  // class RMLBinaryLogReader
+
+
+#endif
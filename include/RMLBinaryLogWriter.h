@@ -0,0 +1,461 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLBinaryLogWriter.h
+//!
+//! \brief
+//! Header file for the class RMLBinaryLogWriter
+//!
+//! \details
+//! Real-time capable writer for binary log files (cf. RMLBinaryLogFormat.h).
+//!
+//! \sa RMLBinaryLogReader
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLBinaryLogWriter__
+#define __RMLBinaryLogWriter__
+
+
+#include <RMLBinaryLogFormat.h>
+#include <TypeIIRMLPlatform.h>
+#include <TypeIIRMLMath.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLVelocityFlags.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLBinaryLogWriter
+//!
+//! \brief
+//! Appends the input values, flags, output values, and return values of
+//! the Reflexxes algorithms to a memory-mapped binary log file
+//!
+//! \details
+//! The file is created, resized, and mapped into memory by
+//! RMLBinaryLogWriter::Open(), which also touches all pages of the file,
+//! such that no page faults occur afterwards. The methods
+//! RMLBinaryLogWriter::AppendPosition() and
+//! RMLBinaryLogWriter::AppendVelocity() are real-time capable: they
+//! neither allocate memory nor call the operating system, but reserve a
+//! record slot with a single atomic increment and copy the data into the
+//! mapped memory. Several threads may append to the same log
+//! concurrently.\n
+//! \n
+//! Because the file is shared with the operating system, all records that
+//! have been appended before a crash of the application are contained in
+//! the file. The file format is described in RMLBinaryLogFormat.h, and
+//! files can be read with the class RMLBinaryLogReader.\n
+//! \n
+//! <b>Example</b>
+//! \code
+//! RMLBinaryLogWriter  *Log    =   new RMLBinaryLogWriter(NumberOfDOFs, CycleTime, 100000, true);
+//!
+//! if (Log->Open("trajectory.rmllog") != RMLBinaryLogWriter::RETURN_SUCCESS) { ... }
+//!
+//! // real-time loop
+//! ResultValue =   RML->RMLPosition(*IP, OP, Flags);
+//! Log->AppendPosition(*IP, Flags, *OP, ResultValue);
+//! \endcode
+//!
+//! \sa RMLBinaryLogReader
+//! \sa RMLBinaryLogFormat.h
+//  ----------------------------------------------------------
+class RMLBinaryLogWriter
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum ReturnValue
+//!
+//! \brief
+//! Return values for the methods of the class RMLBinaryLogWriter
+//  ----------------------------------------------------------
+    enum ReturnValue
+    {
+        RETURN_SUCCESS              =   0,
+        RETURN_ERROR                =   -1,
+        //! \brief The log is not a ring buffer, and all record slots are used
+        RETURN_LOG_FULL             =   -2,
+        //! \brief The number of degrees of freedom of the parameters does not
+        //! match the one of the log
+        RETURN_NUMBER_OF_DOFS       =   -3
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLBinaryLogWriter(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds, const unsigned long long &MaximumNumberOfRecords, const bool &RingBuffer = false)
+//!
+//! \brief
+//! Constructor of the class RMLBinaryLogWriter
+//!
+//! \param DegreesOfFreedom
+//! Number of degrees of freedom of all records
+//!
+//! \param CycleTimeInSeconds
+//! Cycle time of the logged algorithm, which is stored in the file header
+//!
+//! \param MaximumNumberOfRecords
+//! Number of record slots of the file. The file size is
+//! RML_BINARY_LOG_ALIGNMENT + \c MaximumNumberOfRecords *
+//! RMLBinaryLogRecordSize(\c DegreesOfFreedom) bytes.
+//!
+//! \param RingBuffer
+//! If \c true, the oldest records are overwritten once all slots are
+//! used. Otherwise, further records are dropped.
+//  ----------------------------------------------------------
+    RMLBinaryLogWriter(     const unsigned int          &DegreesOfFreedom
+                        ,   const double                &CycleTimeInSeconds
+                        ,   const unsigned long long    &MaximumNumberOfRecords
+                        ,   const bool                  &RingBuffer             =   false);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLBinaryLogWriter(void)
+//!
+//! \brief
+//! Destructor of the class RMLBinaryLogWriter
+//!
+//! \details
+//! Closes the log file (cf. RMLBinaryLogWriter::Close()).
+//  ----------------------------------------------------------
+    ~RMLBinaryLogWriter(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Open(const char *FileName)
+//!
+//! \brief
+//! Creates the log file, maps it into memory, and writes the file header
+//!
+//! \param FileName
+//! Name of the file. An existing file is overwritten.
+//!
+//! \return
+//! RMLBinaryLogWriter::RETURN_SUCCESS or RMLBinaryLogWriter::RETURN_ERROR
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//  ----------------------------------------------------------
+    int Open(const char *FileName);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Close(void)
+//!
+//! \brief
+//! Writes all records to the storage device and closes the log file
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//  ----------------------------------------------------------
+    void Close(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Flush(const bool &Synchronous = false) const
+//!
+//! \brief
+//! Writes all records appended so far to the storage device
+//!
+//! \param Synchronous
+//! If \c true, the method blocks until all data have been written.
+//!
+//! \return
+//! RMLBinaryLogWriter::RETURN_SUCCESS or RMLBinaryLogWriter::RETURN_ERROR
+//!
+//! \warning
+//! This method is \b not real-time capable and should be called from a
+//! non-real-time thread.
+//  ----------------------------------------------------------
+    int Flush(const bool &Synchronous = false) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int AppendPosition(const RMLPositionInputParameters &InputValues, const RMLPositionFlags &Flags, const RMLPositionOutputParameters &OutputValues, const int &ResultValue, const unsigned long long &TimeStamp = 0, const double &ElapsedTimeInSeconds = 0.0, const double &FeedOverride = 1.0, const double &AppliedFeedOverride = 1.0, const double &MaxFeedOverrideRate = RML_DEFAULT_MAX_FEED_OVERRIDE_RATE)
+//!
+//! \brief
+//! Appends one cycle of the position-based algorithm to the log
+//!
+//! \param InputValues
+//! Input values that were passed to ReflexxesAPI::RMLPosition()
+//!
+//! \param Flags
+//! Flags that were passed to ReflexxesAPI::RMLPosition()
+//!
+//! \param OutputValues
+//! Output values that were returned by ReflexxesAPI::RMLPosition()
+//!
+//! \param ResultValue
+//! Return value of ReflexxesAPI::RMLPosition()
+//!
+//! \param TimeStamp
+//! Optional time stamp provided by the application
+//!
+//! \param ElapsedTimeInSeconds
+//! The \c ElapsedTimeInSeconds argument, if the call of
+//! ReflexxesAPI::RMLPosition() with an elapsed cycle time was used, or
+//! zero for the call with the nominal cycle time. RMLReplay samples the
+//! replayed trajectory with the same time.
+//!
+//! \param FeedOverride
+//! Feed override factor that was set by ReflexxesAPI::SetFeedOverride()
+//! for this call
+//!
+//! \param AppliedFeedOverride
+//! Return value of ReflexxesAPI::GetFeedOverride() after the call
+//!
+//! \param MaxFeedOverrideRate
+//! Value that was set by ReflexxesAPI::SetMaxFeedOverrideRate()
+//!
+//! \return
+//!  - RMLBinaryLogWriter::RETURN_SUCCESS
+//!  - RMLBinaryLogWriter::RETURN_LOG_FULL
+//!  - RMLBinaryLogWriter::RETURN_NUMBER_OF_DOFS
+//!  - RMLBinaryLogWriter::RETURN_ERROR, if the log has not been opened
+//!
+//! \note
+//! This method is real-time capable.
+//  ----------------------------------------------------------
+    int AppendPosition(     const RMLPositionInputParameters    &InputValues
+                        ,   const RMLPositionFlags              &Flags
+                        ,   const RMLPositionOutputParameters   &OutputValues
+                        ,   const int                           &ResultValue
+                        ,   const unsigned long long            &TimeStamp              =   0
+                        ,   const double                        &ElapsedTimeInSeconds   =   0.0
+                        ,   const double                        &FeedOverride           =   1.0
+                        ,   const double                        &AppliedFeedOverride    =   1.0
+                        ,   const double                        &MaxFeedOverrideRate    =   RML_DEFAULT_MAX_FEED_OVERRIDE_RATE);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int AppendVelocity(const RMLVelocityInputParameters &InputValues, const RMLVelocityFlags &Flags, const RMLVelocityOutputParameters &OutputValues, const int &ResultValue, const unsigned long long &TimeStamp = 0, const double &ElapsedTimeInSeconds = 0.0)
+//!
+//! \brief
+//! Appends one cycle of the velocity-based algorithm to the log
+//!
+//! \details
+//! The parameters and return values correspond to the ones of
+//! RMLBinaryLogWriter::AppendPosition().
+//!
+//! \note
+//! This method is real-time capable.
+//  ----------------------------------------------------------
+    int AppendVelocity(     const RMLVelocityInputParameters    &InputValues
+                        ,   const RMLVelocityFlags              &Flags
+                        ,   const RMLVelocityOutputParameters   &OutputValues
+                        ,   const int                           &ResultValue
+                        ,   const unsigned long long            &TimeStamp              =   0
+                        ,   const double                        &ElapsedTimeInSeconds   =   0.0);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsOpen(void) const
+//!
+//! \brief
+//! Indicates whether the log file is open
+//  ----------------------------------------------------------
+    inline bool IsOpen(void) const
+    {
+        return(this->Header != NULL);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned long long GetNumberOfDroppedRecords(void) const
+//!
+//! \brief
+//! Returns the number of records that could not be appended because all
+//! slots of a non-ring-buffer log were used
+//  ----------------------------------------------------------
+    inline unsigned long long GetNumberOfDroppedRecords(void) const
+    {
+        return(this->NumberOfDroppedRecords);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned char *ReserveRecord(unsigned long long *SequenceNumber)
+//!
+//! \brief
+//! Atomically reserves the next record slot and invalidates it
+//!
+//! \param SequenceNumber
+//! Pointer to a value, to which the one-based sequence number of the
+//! reserved record is written
+//!
+//! \return
+//! Pointer to the beginning of the reserved record or \c NULL, if the log
+//! is full
+//  ----------------------------------------------------------
+    unsigned char *ReserveRecord(unsigned long long *SequenceNumber);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void WriteInputValues(unsigned char *Record, const RMLInputParameters &InputValues) const
+//!
+//! \brief
+//! Writes the input values that are common for both algorithms into a
+//! reserved record
+//  ----------------------------------------------------------
+    void WriteInputValues(      unsigned char               *Record
+                            ,   const RMLInputParameters    &InputValues) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void WriteOutputValues(unsigned char *Record, const RMLOutputParameters &OutputValues, const int &ResultValue) const
+//!
+//! \brief
+//! Writes the output values that are common for both algorithms into a
+//! reserved record
+//  ----------------------------------------------------------
+    void WriteOutputValues(     unsigned char               *Record
+                            ,   const RMLOutputParameters   &OutputValues
+                            ,   const int                   &ResultValue) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void PublishRecord(unsigned char *Record, const unsigned long long &SequenceNumber) const
+//!
+//! \brief
+//! Marks a completely written record as valid
+//  ----------------------------------------------------------
+    void PublishRecord(     unsigned char               *Record
+                        ,   const unsigned long long    &SequenceNumber) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline double *DataBlock(unsigned char *Record, const unsigned int &Block) const
+//!
+//! \brief
+//! Returns a pointer to a data block (cf. RMLBinaryLogDataBlock) of a
+//! record
+//  ----------------------------------------------------------
+    inline double *DataBlock(       unsigned char       *Record
+                                ,   const unsigned int  &Block) const
+    {
+        return(((double*)(Record + sizeof(RMLBinaryLogRecordHeader))) + Block * this->NumberOfDOFs);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfDOFs
+//!
+//! \brief
+//! Number of degrees of freedom of all records
+//  ----------------------------------------------------------
+    unsigned int                        NumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool RingBuffer
+//!
+//! \brief
+//! Indicates whether the oldest records become overwritten
+//  ----------------------------------------------------------
+    bool                                RingBuffer;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CycleTime
+//!
+//! \brief
+//! Cycle time of the logged algorithm in seconds
+//  ----------------------------------------------------------
+    double                              CycleTime;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long Capacity
+//!
+//! \brief
+//! Number of record slots of the log file
+//  ----------------------------------------------------------
+    unsigned long long                  Capacity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var size_t RecordSize
+//!
+//! \brief
+//! Size of one record in bytes, cf. RMLBinaryLogRecordSize()
+//  ----------------------------------------------------------
+    size_t                              RecordSize;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile unsigned long long NumberOfDroppedRecords
+//!
+//! \brief
+//! Number of records that could not be appended
+//  ----------------------------------------------------------
+    volatile unsigned long long         NumberOfDroppedRecords;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBinaryLogHeader *Header
+//!
+//! \brief
+//! Pointer to the header of the mapped log file; \c NULL if no file is open
+//  ----------------------------------------------------------
+    RMLBinaryLogHeader                  *Header;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned char *Records
+//!
+//! \brief
+//! Pointer to the first record slot of the mapped log file
+//  ----------------------------------------------------------
+    unsigned char                       *Records;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPlatform::MappedFile File
+//!
+//! \brief
+//! Descriptor of the mapped log file
+//  ----------------------------------------------------------
+    TypeIIRMLPlatform::MappedFile       File;
+
+};  // class RMLBinaryLogWriter
+
+
+#endif
@@ -0,0 +1,364 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLEncoderOutputStage.h
+//!
+//! \brief
+//! Header file for the class RMLEncoderOutputStage
+//!
+//! \details
+//! Conversion of the new position values of the position-based algorithm
+//! into integer encoder counts that are directly written into a
+//! caller-owned buffer, for instance, the process image of a fieldbus.
+//!
+//! \sa RMLPositionOutputParameters.h
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLEncoderOutputStage__
+#define __RMLEncoderOutputStage__
+
+
+#include <RMLMemoryResource.h>
+#include <RMLVector.h>
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLEncoderOutputStage
+//!
+//! \brief
+//! Converts position values into scaled and rounded integer encoder
+//! counts and writes them into a caller-owned buffer
+//!
+//! \details
+//! For each degree of freedom \f$ k \f$, the count
+//!
+//! \f$ c_k\ =\ \left[ p_k\,s_k\ +\ o_k \right] \bmod m_k \f$
+//!
+//! is written, where \f$ p_k \f$ is the position value,
+//! \f$ s_k \f$ the number of counts per position unit, \f$ o_k \f$ an
+//! offset in counts, and \f$ [\cdot] \f$ denotes rounding to the nearest
+//! integer (ties to even). If the modulo value \f$ m_k \f$ is positive,
+//! the counts of this degree of freedom are wrapped into the interval
+//! \f$ [0,\,m_k) \f$ (e.g., for rotary axes); if it is zero, the counts
+//! are not wrapped. Values that do not fit into 32-bit counts wrap around
+//! modulo \f$ 2^{32} \f$ like the multi-turn counters of drives.
+//! Absolute values of more than \f$ 2^{51} \f$ counts are saturated.\n
+//! \n
+//! The scale factors, offsets, modulo values, and the buffer are
+//! configured once. The buffer consists of one 32-bit or 64-bit count per
+//! degree of freedom, and the distance between two counts can be
+//! specified in bytes, such that the counts can be written directly into
+//! the process data objects of several drives. The counts do not have to
+//! be aligned.\n
+//! \n
+//! Once attached to an RMLPositionOutputParameters object (cf.
+//! RMLPositionOutputParameters::SetEncoderOutputStage()),
+//! ReflexxesAPI::RMLPosition() writes the counts right after the new state
+//! of motion has been calculated. The conversion processes two degrees of
+//! freedom at once, if SSE2 is available.
+//!
+//! \code
+//! RMLEncoderOutputStage   Stage(NumberOfDOFs);
+//!
+//! for (i = 0; i < NumberOfDOFs; i++)
+//! {
+//!     Stage.SetAxis(i, CountsPerMeter, HomeOffsetInCounts);
+//! }
+//!
+//! Stage.SetProcessImage(      &(ProcessImage->Drive[0].TargetPosition)
+//!                         ,   RMLEncoderOutputStage::INT32_COUNTS
+//!                         ,   sizeof(ProcessImage->Drive[0])          );
+//!
+//! OP->SetEncoderOutputStage(&Stage);
+//! \endcode
+//!
+//! \sa RMLPositionOutputParameters
+//  ----------------------------------------------------------
+class RMLEncoderOutputStage : public RMLMemoryObject
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum ReturnValue
+//!
+//! \brief
+//! Return values for the methods of the class RMLEncoderOutputStage
+//  ----------------------------------------------------------
+    enum ReturnValue
+    {
+        RETURN_SUCCESS                  =   0,
+        //! \brief At least one argument is invalid, and the configuration
+        //! remains unchanged
+        RETURN_ERROR                    =   -1
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum CountType
+//!
+//! \brief
+//! Data type of the counts in the buffer
+//  ----------------------------------------------------------
+    enum CountType
+    {
+        //! \brief 32-bit signed integer values (\c int)
+        INT32_COUNTS                    =   4,
+        //! \brief 64-bit signed integer values (\c long \c long)
+        INT64_COUNTS                    =   8
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLEncoderOutputStage(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Constructor of the class RMLEncoderOutputStage
+//!
+//! \details
+//! Initially, all scale factors are one, all offsets and modulo values
+//! are zero, and no buffer is specified.
+//!
+//! \warning
+//! The constructor is \b not real-time capable as heap memory has to be
+//! allocated.
+//!
+//! \param DegreesOfFreedom
+//! Specifies the number of degrees of freedom
+//  ----------------------------------------------------------
+    RMLEncoderOutputStage(const unsigned int &DegreesOfFreedom);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLEncoderOutputStage(void)
+//!
+//! \brief
+//! Destructor of the class RMLEncoderOutputStage
+//  ----------------------------------------------------------
+    ~RMLEncoderOutputStage(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetAxis(const unsigned int &DOF, const double &CountsPerUnit, const double &OffsetInCounts = 0.0, const double &Modulo = 0.0)
+//!
+//! \brief
+//! Configures the conversion of one degree of freedom
+//!
+//! \param DOF
+//! Index of the degree of freedom
+//!
+//! \param CountsPerUnit
+//! Number of counts per position unit (finite, non-zero). A negative
+//! value inverts the counting direction.
+//!
+//! \param OffsetInCounts
+//! Count value of the position zero
+//!
+//! \param Modulo
+//! Number of counts, after which the counts wrap around to zero, or zero
+//! to disable the wrapping. Positive values have to be integers below
+//! \f$ 2^{51} \f$.
+//!
+//! \return
+//! A value of RMLEncoderOutputStage::ReturnValue
+//  ----------------------------------------------------------
+    int SetAxis(        const unsigned int  &DOF
+                    ,   const double        &CountsPerUnit
+                    ,   const double        &OffsetInCounts     =   0.0
+                    ,   const double        &Modulo             =   0.0);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetProcessImage(void *FirstCount, const CountType &Type, const size_t &StrideInBytes = 0)
+//!
+//! \brief
+//! Specifies the buffer, into which the counts are written
+//!
+//! \param FirstCount
+//! Address of the count of the first degree of freedom, or \c NULL to
+//! detach the buffer. The buffer is owned by the caller and has to remain
+//! valid as long as it is specified.
+//!
+//! \param Type
+//! Data type of the counts (cf. RMLEncoderOutputStage::CountType)
+//!
+//! \param StrideInBytes
+//! Distance in bytes between the counts of two consecutive degrees of
+//! freedom. Zero specifies a densely packed array.
+//!
+//! \return
+//! A value of RMLEncoderOutputStage::ReturnValue
+//  ----------------------------------------------------------
+    int SetProcessImage(        void                *FirstCount
+                            ,   const CountType     &Type
+                            ,   const size_t        &StrideInBytes  =   0);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void WriteCounts(const RMLDoubleVector &PositionVector) const
+//!
+//! \brief
+//! Converts the position values and writes the counts into the buffer
+//!
+//! \details
+//! Nothing is written, if no buffer is specified or if the number of
+//! degrees of freedom of \c PositionVector does not match. This method
+//! is real-time capable.
+//!
+//! \param PositionVector
+//! Position values, usually
+//! RMLPositionOutputParameters::NewPositionVector
+//  ----------------------------------------------------------
+    void WriteCounts(const RMLDoubleVector &PositionVector) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the number of degrees of freedom
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfDOFs(void) const
+    {
+        return(this->NumberOfDOFs);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void *GetProcessImage(void) const
+//!
+//! \brief
+//! Returns the address of the count of the first degree of freedom or
+//! \c NULL, if no buffer is specified
+//  ----------------------------------------------------------
+    inline void *GetProcessImage(void) const
+    {
+        return(this->ProcessImage);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfDOFs
+//!
+//! \brief
+//! Number of degrees of freedom
+//  ----------------------------------------------------------
+    unsigned int                    NumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var CountType Type
+//!
+//! \brief
+//! Data type of the counts in the buffer
+//  ----------------------------------------------------------
+    CountType                       Type;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var size_t Stride
+//!
+//! \brief
+//! Distance in bytes between the counts of two consecutive degrees of
+//! freedom
+//  ----------------------------------------------------------
+    size_t                          Stride;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned char *ProcessImage
+//!
+//! \brief
+//! Address of the count of the first degree of freedom or \c NULL
+//  ----------------------------------------------------------
+    unsigned char                   *ProcessImage;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *CountsPerUnit
+//!
+//! \brief
+//! Number of counts per position unit for each degree of freedom
+//  ----------------------------------------------------------
+    RMLDoubleVector                 *CountsPerUnit;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *OffsetInCounts
+//!
+//! \brief
+//! Count value of the position zero for each degree of freedom
+//  ----------------------------------------------------------
+    RMLDoubleVector                 *OffsetInCounts;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *Modulo
+//!
+//! \brief
+//! Modulo value for each degree of freedom; zero disables the wrapping
+//  ----------------------------------------------------------
+    RMLDoubleVector                 *Modulo;
+
+
+private:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLEncoderOutputStage(const RMLEncoderOutputStage &Stage)
+//!
+//! \brief
+//! Copy constructor (not implemented, the buffer is owned by the caller
+//! and must not be written by two objects)
+//  ----------------------------------------------------------
+    RMLEncoderOutputStage(const RMLEncoderOutputStage &Stage);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLEncoderOutputStage &operator = (const RMLEncoderOutputStage &Stage)
+//!
+//! \brief
+//! Copy operator (not implemented, cf.
+//! RMLEncoderOutputStage::RMLEncoderOutputStage(const RMLEncoderOutputStage &Stage))
+//  ----------------------------------------------------------
+    RMLEncoderOutputStage &operator = (const RMLEncoderOutputStage &Stage);
+
+};  // class RMLEncoderOutputStage
+
+
+
+#endif
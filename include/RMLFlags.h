@@ -159,7 +159,10 @@ public:
         ONLY_PHASE_SYNCHRONIZATION          =   2   ,
         //! \brief
         //! No synchronization will be performed, and all selected degrees
-        //! of freedom are treated independently.
+        //! of freedom are treated independently. If the input values of
+        //! only some degrees of freedom change, the position-based
+        //! algorithm only recalculates the trajectories of these degrees
+        //! of freedom.
         NO_SYNCHRONIZATION                  =   3
     };
 
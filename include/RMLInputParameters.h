@@ -75,13 +75,13 @@
 //! \sa RMLOutputParameters
 //! \sa \ref page_InputValues
 //  ----------------------------------------------------------
-class RMLInputParameters
+class RMLInputParameters : public RMLMemoryObject
 {
 
 protected:
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLInputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLInputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource)
 //!
 //! \brief
 //! Constructor of class RMLInputParameters
@@ -93,6 +93,11 @@ protected:
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
 //!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
+//!
 //! \note
 //! This is only the base class for the classes\n\n
 //! <ul>
@@ -101,8 +106,11 @@ protected:
 //! </ul>
 //! such that the constructor is declared \c protected.
 //  ----------------------------------------------------------
-    RMLInputParameters(const unsigned int DegreesOfFreedom)
+    RMLInputParameters(     const unsigned int  DegreesOfFreedom
+                        ,   RMLMemoryResource   *MemoryResource)
     {
+        RMLMemoryResourceScope  Scope(MemoryResource);
+
         this->NumberOfDOFs                  =   DegreesOfFreedom                        ;
         this->MinimumSynchronizationTime    =   0.0                                     ;
         this->SelectionVector               =   new RMLBoolVector   (DegreesOfFreedom)  ;
@@ -152,6 +160,39 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLInputParameters(RMLInputParameters &&IP)
+//!
+//! \brief
+//! Move constructor
+//!
+//! \details
+//! The vector objects of \c IP are transferred without allocating
+//! memory or copying values. Afterwards, \c IP has zero degrees of
+//! freedom and may only be destroyed, assigned by the move assignment
+//! operator, or swapped.
+//!
+//! \param IP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLInputParameters(RMLInputParameters &&IP) RML_NOEXCEPT
+    {
+        this->NumberOfDOFs                  =   0       ;
+        this->MinimumSynchronizationTime    =   0.0     ;
+        this->SelectionVector               =   NULL    ;
+        this->CurrentPositionVector         =   NULL    ;
+        this->CurrentVelocityVector         =   NULL    ;
+        this->CurrentAccelerationVector     =   NULL    ;
+        this->MaxAccelerationVector         =   NULL    ;
+        this->MaxJerkVector                 =   NULL    ;
+        this->TargetVelocityVector          =   NULL    ;
+
+        this->Swap(IP);
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn ~RMLInputParameters(void)
 //!
@@ -204,6 +245,54 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLInputParameters &operator = (RMLInputParameters &&IP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLInputParameters::Swap())
+//!
+//! \param IP
+//! RMLInputParameters object to be moved
+//  ----------------------------------------------------------
+    RMLInputParameters &operator = (RMLInputParameters &&IP) RML_NOEXCEPT
+    {
+        this->Swap(IP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Swap(RMLInputParameters &IP)
+//!
+//! \brief
+//! Exchanges the contents of two objects
+//!
+//! \details
+//! Only the pointers to the vector objects are exchanged, that is, no
+//! memory is allocated and no values are copied. Both objects may have
+//! different numbers of degrees of freedom.
+//!
+//! \param IP
+//! RMLInputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    void Swap(RMLInputParameters &IP) RML_NOEXCEPT
+    {
+        RMLSwap(this->NumberOfDOFs                  , IP.NumberOfDOFs                   );
+        RMLSwap(this->MinimumSynchronizationTime    , IP.MinimumSynchronizationTime     );
+        RMLSwap(this->SelectionVector               , IP.SelectionVector                );
+        RMLSwap(this->CurrentPositionVector         , IP.CurrentPositionVector          );
+        RMLSwap(this->CurrentVelocityVector         , IP.CurrentVelocityVector          );
+        RMLSwap(this->CurrentAccelerationVector     , IP.CurrentAccelerationVector      );
+        RMLSwap(this->MaxAccelerationVector         , IP.MaxAccelerationVector          );
+        RMLSwap(this->MaxJerkVector                 , IP.MaxJerkVector                  );
+        RMLSwap(this->TargetVelocityVector          , IP.TargetVelocityVector           );
+    }
+
+
 // #############################################################################
 
 
@@ -1557,6 +1646,62 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetMaxNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the maximum number of degrees of freedom, that is, the number
+//! passed to the constructor
+//!
+//! \sa RMLInputParameters::SetNumberOfDOFs()
+//  ----------------------------------------------------------
+    inline unsigned int GetMaxNumberOfDOFs(void) const
+    {
+        return(this->SelectionVector->GetVecCapacity());
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Changes the number of degrees of freedom without reallocating memory
+//!
+//! \details
+//! All vectors keep their memory (cf. RMLVector::SetVecDim()), such that
+//! this method is real-time capable, for instance, to switch between
+//! different kinematic configurations of a machine together with
+//! ReflexxesAPI::Reconfigure().
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom
+//!
+//! \return
+//! \c false, if \c DegreesOfFreedom exceeds
+//! RMLInputParameters::GetMaxNumberOfDOFs(); the object remains unchanged
+//! in this case.
+//  ----------------------------------------------------------
+    bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+    {
+        if (DegreesOfFreedom > this->GetMaxNumberOfDOFs())
+        {
+            return(false);
+        }
+
+        this->SelectionVector->SetVecDim            (DegreesOfFreedom);
+        this->CurrentPositionVector->SetVecDim      (DegreesOfFreedom);
+        this->CurrentVelocityVector->SetVecDim      (DegreesOfFreedom);
+        this->CurrentAccelerationVector->SetVecDim  (DegreesOfFreedom);
+        this->MaxAccelerationVector->SetVecDim      (DegreesOfFreedom);
+        this->MaxJerkVector->SetVecDim              (DegreesOfFreedom);
+        this->TargetVelocityVector->SetVecDim       (DegreesOfFreedom);
+
+        this->NumberOfDOFs  =   DegreesOfFreedom;
+
+        return(true);
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn inline double GetMinimumSynchronizationTime(void) const
 //!
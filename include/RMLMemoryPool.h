@@ -0,0 +1,215 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryPool.h
+//!
+//! \brief
+//! Header file for the class RMLMemoryPool
+//!
+//! \details
+//! Memory resource that reuses released memory blocks
+//!
+//! \sa RMLMemoryResource
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#ifndef __RMLMemoryPool__
+#define __RMLMemoryPool__
+
+
+#include <RMLMemoryRegion.h>
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES
+//!
+//! \brief
+//! Number of size classes of an RMLMemoryPool object
+//!
+//! \details
+//! The size class \f$ k \f$ contains blocks of
+//! \f$ \mathrm{RML\_CACHE\_LINE\_SIZE} \cdot 2^k \f$ bytes, that is, the
+//! largest block that can be allocated from a pool has 32 MB.
+//  ----------------------------------------------------------
+#define RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES      20
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLMemoryPool
+//!
+//! \brief
+//! Memory resource with a pre-reserved region, which reuses released
+//! memory blocks
+//!
+//! \details
+//! All blocks are taken from one RMLMemoryRegion. Their sizes are rounded
+//! up to the next power of two times RML_CACHE_LINE_SIZE, and released
+//! blocks are kept in one free list per size class. Blocks of the same
+//! size class are therefore reused without fragmentation, such that
+//! applications that create and delete many short-lived generators, for
+//! instance, for a fleet of robots, do not allocate any memory from the
+//! operating system after the first objects have been created:
+//!
+//! \code
+//! RMLMemoryPool       Pool(4 * 1024 * 1024);
+//!
+//! for (;;)
+//! {
+//!     ReflexxesAPI    *RML    =   new (&Pool) ReflexxesAPI(NUMBER_OF_DOFS, CYCLE_TIME_IN_SECONDS, 0, &Pool);
+//!     ...
+//!     delete RML;
+//! }
+//! \endcode
+//!
+//! Allocations and deallocations are real-time capable and protected by
+//! a spin lock, which is held for a few instructions only.
+//!
+//! \sa RMLMemoryResource
+//! \sa RMLMemoryRegion
+//  ----------------------------------------------------------
+class RMLMemoryPool : public RMLMemoryRegion
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryPool(const size_t &SizeInBytes, const bool &UseHugePages = false)
+//!
+//! \brief
+//! Constructor of the class RMLMemoryPool, reserves the memory of the pool
+//!
+//! \param SizeInBytes
+//! Size of the pool in bytes
+//!
+//! \param UseHugePages
+//! If \c true, the pool is backed by huge pages, if the operating system
+//! provides them (cf. RMLMemoryRegion::RMLMemoryRegion()).
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//  ----------------------------------------------------------
+    RMLMemoryPool(      const size_t    &SizeInBytes
+                    ,   const bool      &UseHugePages   = false );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLMemoryPool(void)
+//!
+//! \brief
+//! Destructor of the class RMLMemoryPool
+//  ----------------------------------------------------------
+    ~RMLMemoryPool(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void *Allocate(const size_t &SizeInBytes)
+//!
+//! \brief
+//! Allocates a memory block, which is aligned to RML_CACHE_LINE_SIZE,
+//! from the free list of its size class or, if the list is empty, from
+//! the unused part of the pool
+//!
+//! \return
+//! Pointer to the memory block or \c NULL, if the pool is exhausted
+//!
+//! \sa RMLMemoryResource::Allocate()
+//  ----------------------------------------------------------
+    void *Allocate(const size_t &SizeInBytes);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Deallocate(void *Pointer, const size_t &SizeInBytes)
+//!
+//! \brief
+//! Returns a memory block to the free list of its size class
+//!
+//! \sa RMLMemoryResource::Deallocate()
+//  ----------------------------------------------------------
+    void Deallocate(        void            *Pointer
+                        ,   const size_t    &SizeInBytes);
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static unsigned int GetSizeClass(const size_t &SizeInBytes)
+//!
+//! \brief
+//! Returns the size class of a block or
+//! RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES, if the block is too large
+//  ----------------------------------------------------------
+    static unsigned int GetSizeClass(const size_t &SizeInBytes);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void LockFreeLists(void)
+//!
+//! \brief
+//! Acquires the spin lock RMLMemoryPool::FreeListLock
+//  ----------------------------------------------------------
+    void LockFreeLists(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void UnlockFreeLists(void)
+//!
+//! \brief
+//! Releases the spin lock RMLMemoryPool::FreeListLock
+//  ----------------------------------------------------------
+    void UnlockFreeLists(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var void *FreeLists[RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES]
+//!
+//! \brief
+//! First released block of each size class; the first bytes of a
+//! released block point to the next released block of its class.
+//  ----------------------------------------------------------
+    void                            *FreeLists[RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES];
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile unsigned long long FreeListLock
+//!
+//! \brief
+//! Spin lock that protects RMLMemoryPool::FreeLists
+//  ----------------------------------------------------------
+    volatile unsigned long long     FreeListLock;
+
+};  // class RMLMemoryPool
+
+
+#endif
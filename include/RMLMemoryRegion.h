@@ -0,0 +1,362 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryRegion.h
+//!
+//! \brief
+//! Header file for the class RMLMemoryRegion
+//!
+//! \details
+//! Contiguous memory region for the real-time preparation of the library
+//!
+//! \sa RMLMemoryResource
+//! \sa ReflexxesAPI::PrepareForRealTime()
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#ifndef __RMLMemoryRegion__
+#define __RMLMemoryRegion__
+
+
+#include <RMLMemoryResource.h>
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_HUGE_PAGE_SIZE
+//!
+//! \brief
+//! Size in bytes of a huge page; regions backed by huge pages are
+//! rounded up to a multiple of this value
+//  ----------------------------------------------------------
+#define RML_HUGE_PAGE_SIZE              (2 * 1024 * 1024)
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLMemoryRegion
+//!
+//! \brief
+//! Contiguous region of memory, from which all objects of the library
+//! can be allocated, for instance, to prepare an application for
+//! real-time execution
+//!
+//! \details
+//! The objects of the library consist of many small memory blocks (e.g.,
+//! every RMLVector object allocates its elements separately). When
+//! allocated from the heap, these blocks are scattered across the address
+//! space, and the first trajectory calculation after the start-up of an
+//! application suffers from page faults and cache misses.\n
+//! \n
+//! A region is allocated as a whole directly from the operating system,
+//! optionally backed by huge pages. While a region is \em active for a
+//! thread (cf. RMLMemoryResource::Activate()), all objects of the library
+//! that are created by this thread (ReflexxesAPI, the input and output
+//! parameter classes, RMLVector, and all internal objects of the
+//! algorithms) are allocated from the region, and all memory blocks are
+//! aligned to cache lines (RML_CACHE_LINE_SIZE). Afterwards, the region
+//! can be locked into physical memory (RMLMemoryRegion::Lock()), and a
+//! warm-up calculation can be executed
+//! (ReflexxesAPI::PrepareForRealTime()):
+//!
+//! \code
+//! RMLMemoryRegion     Region(256 * 1024, true);
+//!
+//! Region.Activate();
+//!
+//! ReflexxesAPI                    *RML    =   new ReflexxesAPI(NUMBER_OF_DOFS, CYCLE_TIME_IN_SECONDS);
+//! RMLPositionInputParameters      *IP     =   new RMLPositionInputParameters(NUMBER_OF_DOFS);
+//! RMLPositionOutputParameters     *OP     =   new RMLPositionOutputParameters(NUMBER_OF_DOFS);
+//!
+//! Region.Lock();
+//! RML->PrepareForRealTime(Flags);
+//!
+//! RMLMemoryResource::Deactivate();
+//! \endcode
+//!
+//! A region is an arena: memory that is released by objects of the region
+//! is not reused; it becomes available again when the region is reset
+//! (cf. RMLMemoryRegion::Reset()) or destroyed. To reuse released memory, for instance, when generators are
+//! created and deleted frequently, an RMLMemoryPool can be used.
+//!
+//! \sa RMLMemoryResource
+//! \sa RMLMemoryPool
+//! \sa ReflexxesAPI::PrepareForRealTime()
+//  ----------------------------------------------------------
+class RMLMemoryRegion : public RMLMemoryResource
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum ReturnValue
+//!
+//! \brief
+//! Return values for the methods of the class RMLMemoryRegion
+//  ----------------------------------------------------------
+    enum ReturnValue
+    {
+        RETURN_SUCCESS                  =   0,
+        //! \brief The memory could not be locked (e.g., because the limit
+        //! \c RLIMIT_MEMLOCK of the process is too low)
+        RETURN_ERROR                    =   -1
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryRegion(const size_t &SizeInBytes, const bool &UseHugePages = false)
+//!
+//! \brief
+//! Constructor of the class RMLMemoryRegion, allocates the region
+//!
+//! \param SizeInBytes
+//! Size of the region in bytes
+//!
+//! \param UseHugePages
+//! If \c true, the region is backed by huge pages, if the operating
+//! system provides them (cf. TypeIIRMLPlatform::AllocateMemoryRegion()),
+//! and its size is rounded up to a multiple of RML_HUGE_PAGE_SIZE.
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//!
+//! \sa RMLMemoryRegion::IsValid()
+//  ----------------------------------------------------------
+    RMLMemoryRegion(        const size_t    &SizeInBytes
+                        ,   const bool      &UseHugePages   = false );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLMemoryRegion(void)
+//!
+//! \brief
+//! Destructor of the class RMLMemoryRegion, releases the region
+//  ----------------------------------------------------------
+    ~RMLMemoryRegion(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void *Allocate(const size_t &SizeInBytes)
+//!
+//! \brief
+//! Allocates a memory block, which is aligned to RML_CACHE_LINE_SIZE,
+//! from the region
+//!
+//! \details
+//! This method is thread-safe and real-time capable.
+//!
+//! \return
+//! Pointer to the memory block or \c NULL, if the region is exhausted
+//!
+//! \sa RMLMemoryResource::Allocate()
+//  ----------------------------------------------------------
+    void *Allocate(const size_t &SizeInBytes);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Deallocate(void *Pointer, const size_t &SizeInBytes)
+//!
+//! \brief
+//! Does nothing, as a region frees all of its memory at once in
+//! RMLMemoryRegion::Reset()
+//!
+//! \sa RMLMemoryResource::Deallocate()
+//  ----------------------------------------------------------
+    void Deallocate(        void            *
+                        ,   const size_t    &               );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Reset(void)
+//!
+//! \brief
+//! Frees all memory blocks of the region at once
+//!
+//! \details
+//! Afterwards, the complete region is available again. All objects that
+//! were allocated from the region have to be deleted before, and no other
+//! thread may allocate from the region during the call. The pages of the
+//! region remain mapped and, if applicable, locked.
+//  ----------------------------------------------------------
+    void Reset(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Lock(void)
+//!
+//! \brief
+//! Touches all pages of the region and locks them into physical memory
+//!
+//! \details
+//! Afterwards, no accesses to the region cause page faults. This method
+//! has to be called during the initialization of an application, while
+//! no other thread uses objects of the region.
+//!
+//! \return
+//! A value of RMLMemoryRegion::ReturnValue. All pages are touched also
+//! if the region cannot be locked.
+//  ----------------------------------------------------------
+    int Lock(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsValid(void) const
+//!
+//! \brief
+//! Returns \c true, if the region could be allocated
+//  ----------------------------------------------------------
+    inline bool IsValid(void) const
+    {
+        return(this->Base != NULL);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline size_t GetSize(void) const
+//!
+//! \brief
+//! Returns the size of the region in bytes
+//  ----------------------------------------------------------
+    inline size_t GetSize(void) const
+    {
+        return(this->Size);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn size_t GetUsedSize(void) const
+//!
+//! \brief
+//! Returns the number of bytes of the region that are allocated
+//  ----------------------------------------------------------
+    size_t GetUsedSize(void) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsBackedByHugePages(void) const
+//!
+//! \brief
+//! Returns \c true, if the region is backed by huge pages
+//  ----------------------------------------------------------
+    inline bool IsBackedByHugePages(void) const
+    {
+        return(this->HugePagesUsed);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsLocked(void) const
+//!
+//! \brief
+//! Returns \c true, if the region is locked into physical memory
+//  ----------------------------------------------------------
+    inline bool IsLocked(void) const
+    {
+        return(this->Locked);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned char *Base
+//!
+//! \brief
+//! Pointer to the first byte of the region; \c NULL if the region could
+//! not be allocated
+//  ----------------------------------------------------------
+    unsigned char                   *Base;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var size_t Size
+//!
+//! \brief
+//! Size of the region in bytes
+//  ----------------------------------------------------------
+    size_t                          Size;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile unsigned long long UsedSize
+//!
+//! \brief
+//! Number of bytes that were reserved by RMLMemoryRegion::Allocate();
+//! incremented atomically and may exceed RMLMemoryRegion::Size
+//  ----------------------------------------------------------
+    volatile unsigned long long     UsedSize;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool HugePagesUsed
+//!
+//! \brief
+//! Indicates, whether the region is backed by huge pages
+//  ----------------------------------------------------------
+    bool                            HugePagesUsed;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool Locked
+//!
+//! \brief
+//! Indicates, whether the region is locked into physical memory
+//  ----------------------------------------------------------
+    bool                            Locked;
+
+
+private:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryRegion(const RMLMemoryRegion &Region)
+//!
+//! \brief
+//! Copy constructor (not implemented, regions cannot be copied)
+//  ----------------------------------------------------------
+    RMLMemoryRegion(const RMLMemoryRegion &Region);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryRegion &operator = (const RMLMemoryRegion &Region)
+//!
+//! \brief
+//! Copy operator (not implemented, regions cannot be copied)
+//  ----------------------------------------------------------
+    RMLMemoryRegion &operator = (const RMLMemoryRegion &Region);
+
+};  // class RMLMemoryRegion
+
+
+
+#endif
@@ -0,0 +1,435 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryResource.h
+//!
+//! \brief
+//! Header file for the classes RMLMemoryResource, RMLMemoryResourceScope,
+//! and RMLMemoryObject
+//!
+//! \details
+//! Interface for user-supplied memory resources, from which all objects
+//! of the library can be allocated.
+//!
+//! \sa RMLMemoryRegion
+//! \sa RMLMemoryPool
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#ifndef __RMLMemoryResource__
+#define __RMLMemoryResource__
+
+
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_CACHE_LINE_SIZE
+//!
+//! \brief
+//! Alignment in bytes of all memory blocks that are allocated from an
+//! RMLMemoryResource object
+//  ----------------------------------------------------------
+#define RML_CACHE_LINE_SIZE             64
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLMemoryResource
+//!
+//! \brief
+//! Abstract memory resource, from which all objects of the library can
+//! be allocated
+//!
+//! \details
+//! By default, all objects of the library are allocated from the heap.
+//! While a memory resource is \em active for a thread (cf.
+//! RMLMemoryResource::Activate() and RMLMemoryResourceScope), all objects
+//! of the library that are created by this thread (ReflexxesAPI, the input
+//! and output parameter classes, RMLVector, and all internal objects of the
+//! algorithms) are allocated from the resource instead. The constructors
+//! of ReflexxesAPI and of the parameter classes also accept a resource
+//! directly, and the operator \c new of all classes accepts a resource as
+//! placement argument:
+//!
+//! \code
+//! RMLMemoryPool                   Pool(1024 * 1024);
+//!
+//! ReflexxesAPI                    *RML    =   new (&Pool) ReflexxesAPI(NUMBER_OF_DOFS, CYCLE_TIME_IN_SECONDS, 0, &Pool);
+//! RMLPositionInputParameters      *IP     =   new (&Pool) RMLPositionInputParameters(NUMBER_OF_DOFS, &Pool);
+//! \endcode
+//!
+//! The library provides two resources: the arena RMLMemoryRegion, which
+//! releases its memory only as a whole, and the pool RMLMemoryPool, which
+//! reuses released blocks. Applications can derive own resources from
+//! this class, for instance, to use a memory pool of an existing
+//! framework.\n
+//! \n
+//! Every object remembers the resource it was allocated from, such that
+//! it can be deleted as usual, at any time, and by any thread. All objects
+//! of a resource have to be deleted before the resource itself. If a
+//! resource cannot provide the requested memory, the memory is allocated
+//! from the heap, which can be checked by
+//! RMLMemoryResource::GetNumberOfHeapAllocations().
+//!
+//! \sa RMLMemoryRegion
+//! \sa RMLMemoryPool
+//! \sa RMLMemoryResourceScope
+//! \sa RMLMemoryObject
+//  ----------------------------------------------------------
+class RMLMemoryResource
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryResource(void)
+//!
+//! \brief
+//! Constructor of the class RMLMemoryResource
+//  ----------------------------------------------------------
+    RMLMemoryResource(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn virtual ~RMLMemoryResource(void)
+//!
+//! \brief
+//! Destructor of the class RMLMemoryResource
+//!
+//! \details
+//! If the resource is active for the calling thread, it is deactivated.
+//  ----------------------------------------------------------
+    virtual ~RMLMemoryResource(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn virtual void *Allocate(const size_t &SizeInBytes)
+//!
+//! \brief
+//! Allocates a memory block from the resource
+//!
+//! \details
+//! Implementations have to be thread-safe and should return blocks that
+//! are aligned to RML_CACHE_LINE_SIZE; blocks have to be aligned to at
+//! least \c sizeof(double).
+//!
+//! \param SizeInBytes
+//! Size of the block in bytes
+//!
+//! \return
+//! Pointer to the memory block or \c NULL, if the resource is exhausted
+//  ----------------------------------------------------------
+    virtual void *Allocate(const size_t &SizeInBytes) = 0;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn virtual void Deallocate(void *Pointer, const size_t &SizeInBytes)
+//!
+//! \brief
+//! Releases a memory block of the resource
+//!
+//! \details
+//! Implementations have to be thread-safe.
+//!
+//! \param Pointer
+//! Pointer returned by RMLMemoryResource::Allocate()
+//!
+//! \param SizeInBytes
+//! Size that was passed to RMLMemoryResource::Allocate()
+//  ----------------------------------------------------------
+    virtual void Deallocate(        void            *Pointer
+                                ,   const size_t    &SizeInBytes) = 0;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Activate(void)
+//!
+//! \brief
+//! Makes this resource the active resource of the calling thread
+//!
+//! \details
+//! Until RMLMemoryResource::Deactivate() is called, all objects of the
+//! library that are created by the calling thread are allocated from
+//! this resource. Other threads are not affected.
+//!
+//! \sa RMLMemoryResourceScope
+//  ----------------------------------------------------------
+    void Activate(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static void Deactivate(void)
+//!
+//! \brief
+//! Resets the active resource of the calling thread, such that objects of
+//! the library are allocated from the heap again
+//  ----------------------------------------------------------
+    static void Deactivate(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static RMLMemoryResource *GetActiveResource(void)
+//!
+//! \brief
+//! Returns the active resource of the calling thread or \c NULL
+//  ----------------------------------------------------------
+    static RMLMemoryResource *GetActiveResource(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static void SetActiveResource(RMLMemoryResource *Resource)
+//!
+//! \brief
+//! Sets the active resource of the calling thread
+//!
+//! \param Resource
+//! The new active resource; \c NULL selects the heap.
+//  ----------------------------------------------------------
+    static void SetActiveResource(RMLMemoryResource *Resource);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static void *AllocateObject(const size_t &SizeInBytes, RMLMemoryResource *Resource)
+//!
+//! \brief
+//! Allocates memory for an object of the library
+//!
+//! \details
+//! The memory is allocated from \c Resource. If \c Resource is \c NULL or
+//! cannot provide the memory, it is allocated from the heap. A header
+//! in front of the returned block stores the origin of the memory, such
+//! that RMLMemoryResource::FreeObject() can return it.
+//!
+//! \param SizeInBytes
+//! Size of the object in bytes
+//!
+//! \param Resource
+//! Memory resource or \c NULL
+//!
+//! \sa RMLMemoryObject
+//  ----------------------------------------------------------
+    static void *AllocateObject(        const size_t        &SizeInBytes
+                                    ,   RMLMemoryResource   *Resource   );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static inline void *AllocateObject(const size_t &SizeInBytes)
+//!
+//! \brief
+//! Allocates memory for an object of the library from the active
+//! resource of the calling thread
+//  ----------------------------------------------------------
+    static inline void *AllocateObject(const size_t &SizeInBytes)
+    {
+        return(RMLMemoryResource::AllocateObject(       SizeInBytes
+                                                    ,   RMLMemoryResource::GetActiveResource()  ));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static void FreeObject(void *Pointer)
+//!
+//! \brief
+//! Releases memory allocated by RMLMemoryResource::AllocateObject()
+//!
+//! \details
+//! The memory is returned to the resource it was allocated from or to
+//! the heap. \c NULL pointers are ignored.
+//  ----------------------------------------------------------
+    static void FreeObject(void *Pointer);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned long long GetNumberOfHeapAllocations(void) const
+//!
+//! \brief
+//! Returns the number of objects that were allocated from the heap,
+//! because this resource could not provide the memory
+//  ----------------------------------------------------------
+    inline unsigned long long GetNumberOfHeapAllocations(void) const
+    {
+        return(this->NumberOfHeapAllocations);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile unsigned long long NumberOfHeapAllocations
+//!
+//! \brief
+//! Number of objects that were allocated from the heap, because this
+//! resource could not provide the memory
+//  ----------------------------------------------------------
+    volatile unsigned long long     NumberOfHeapAllocations;
+
+
+private:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryResource(const RMLMemoryResource &Resource)
+//!
+//! \brief
+//! Copy constructor (not implemented, resources cannot be copied)
+//  ----------------------------------------------------------
+    RMLMemoryResource(const RMLMemoryResource &Resource);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLMemoryResource &operator = (const RMLMemoryResource &Resource)
+//!
+//! \brief
+//! Copy operator (not implemented, resources cannot be copied)
+//  ----------------------------------------------------------
+    RMLMemoryResource &operator = (const RMLMemoryResource &Resource);
+
+};  // class RMLMemoryResource
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLMemoryResourceScope
+//!
+//! \brief
+//! Activates a memory resource for the calling thread during the lifetime
+//! of an object of this class
+//!
+//! \details
+//! The constructor activates the given resource, and the destructor
+//! restores the resource that was active before. If the given resource
+//! is \c NULL, the active resource remains unchanged. The constructors of
+//! ReflexxesAPI and of the parameter classes use this class to allocate
+//! all of their members from a resource.
+//!
+//! \sa RMLMemoryResource::Activate()
+//  ----------------------------------------------------------
+class RMLMemoryResourceScope
+{
+public:
+
+    RMLMemoryResourceScope(RMLMemoryResource *Resource)
+    {
+        this->PreviousResource  =   RMLMemoryResource::GetActiveResource();
+
+        if (Resource != NULL)
+        {
+            RMLMemoryResource::SetActiveResource(Resource);
+        }
+    }
+
+    ~RMLMemoryResourceScope(void)
+    {
+        RMLMemoryResource::SetActiveResource(this->PreviousResource);
+    }
+
+protected:
+
+    RMLMemoryResource   *PreviousResource;
+
+};  // class RMLMemoryResourceScope
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLMemoryObject
+//!
+//! \brief
+//! Base class of all classes of the library, whose objects are allocated
+//! by RMLMemoryResource::AllocateObject()
+//!
+//! \details
+//! The class does not contain any data; it only provides the operators
+//! \c new and \c delete, such that objects are allocated from the active
+//! memory resource of the calling thread (cf.
+//! RMLMemoryResource::Activate()) or from the resource given as placement
+//! argument (e.g., <c>new (&Pool) RMLDoubleVector(6)</c>).
+//!
+//! \sa RMLMemoryResource
+//  ----------------------------------------------------------
+class RMLMemoryObject
+{
+public:
+
+    static inline void *operator new(size_t SizeInBytes)
+    {
+        return(RMLMemoryResource::AllocateObject(SizeInBytes));
+    }
+
+    static inline void *operator new[](size_t SizeInBytes)
+    {
+        return(RMLMemoryResource::AllocateObject(SizeInBytes));
+    }
+
+    static inline void *operator new(size_t SizeInBytes, RMLMemoryResource *Resource)
+    {
+        return(RMLMemoryResource::AllocateObject(SizeInBytes, Resource));
+    }
+
+    static inline void *operator new[](size_t SizeInBytes, RMLMemoryResource *Resource)
+    {
+        return(RMLMemoryResource::AllocateObject(SizeInBytes, Resource));
+    }
+
+    static inline void *operator new(size_t, void *Pointer)
+    {
+        return(Pointer);
+    }
+
+    static inline void operator delete(void *Pointer)
+    {
+        RMLMemoryResource::FreeObject(Pointer);
+    }
+
+    static inline void operator delete[](void *Pointer)
+    {
+        RMLMemoryResource::FreeObject(Pointer);
+    }
+
+    static inline void operator delete(void *Pointer, RMLMemoryResource *)
+    {
+        RMLMemoryResource::FreeObject(Pointer);
+    }
+
+    static inline void operator delete[](void *Pointer, RMLMemoryResource *)
+    {
+        RMLMemoryResource::FreeObject(Pointer);
+    }
+
+    static inline void operator delete(void *, void *)
+    {
+    }
+
+};  // class RMLMemoryObject
+
+
+#endif
@@ -72,7 +72,7 @@
 //! \sa RMLInputParameters
 //! \sa \ref page_OutputValues
 //  ----------------------------------------------------------
-class RMLOutputParameters
+class RMLOutputParameters : public RMLMemoryObject
 {
 public:
 
@@ -93,7 +93,7 @@ public:
 protected:
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLOutputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLOutputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource)
 //!
 //! \brief
 //! Constructor of class RMLOutputParameters
@@ -105,6 +105,11 @@ protected:
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
 //!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
+//!
 //! \note
 //! This is only the base class for the classes\n\n
 //! <ul>
@@ -113,9 +118,12 @@ protected:
 //! </ul>
 //! such that the constructor is declared \c protected.
 //  ----------------------------------------------------------
-    RMLOutputParameters(const unsigned int DegreesOfFreedom)
+    RMLOutputParameters(     const unsigned int  DegreesOfFreedom
+                         ,   RMLMemoryResource   *MemoryResource)
     {
-        unsigned int    i                           =   0                                       ;
+        unsigned int            i                   =   0                                       ;
+
+        RMLMemoryResourceScope  Scope(MemoryResource);
 
         this->TrajectoryIsPhaseSynchronized         =   false                                   ;
 
@@ -127,6 +135,8 @@ protected:
 
         this->DOFWithTheGreatestExecutionTime       =   0                                       ;
 
+        this->PosExtremaVectorArraysAreZero         =   true                                    ;
+
         this->NewPositionVector                     =   new RMLDoubleVector(DegreesOfFreedom)   ;
         this->NewVelocityVector                     =   new RMLDoubleVector(DegreesOfFreedom)   ;
         this->NewAccelerationVector                 =   new RMLDoubleVector(DegreesOfFreedom)   ;
@@ -145,12 +155,12 @@ protected:
         memset(this->MaxPosExtremaPositionVectorOnly->VecData   ,   0x0 ,       DegreesOfFreedom * sizeof(double))  ;
         memset(this->ExecutionTimes->VecData                    ,   0x0 ,       DegreesOfFreedom * sizeof(double))  ;
 
-        this->MinPosExtremaPositionVectorArray      =   new RMLDoubleVector*[DegreesOfFreedom]  ;
-        this->MinPosExtremaVelocityVectorArray      =   new RMLDoubleVector*[DegreesOfFreedom]  ;
-        this->MinPosExtremaAccelerationVectorArray  =   new RMLDoubleVector*[DegreesOfFreedom]  ;
-        this->MaxPosExtremaPositionVectorArray      =   new RMLDoubleVector*[DegreesOfFreedom]  ;
-        this->MaxPosExtremaVelocityVectorArray      =   new RMLDoubleVector*[DegreesOfFreedom]  ;
-        this->MaxPosExtremaAccelerationVectorArray  =   new RMLDoubleVector*[DegreesOfFreedom]  ;
+        this->MinPosExtremaPositionVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
+        this->MinPosExtremaVelocityVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
+        this->MinPosExtremaAccelerationVectorArray  =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
+        this->MaxPosExtremaPositionVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
+        this->MaxPosExtremaVelocityVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
+        this->MaxPosExtremaAccelerationVectorArray  =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(DegreesOfFreedom * sizeof(RMLDoubleVector*))   ;
 
         for (i = 0; i < DegreesOfFreedom; i++)
         {
@@ -216,12 +226,12 @@ protected:
         this->MaxPosExtremaPositionVectorOnly       =   new RMLDoubleVector(this->NumberOfDOFs)                 ;
         this->ExecutionTimes                        =   new RMLDoubleVector(this->NumberOfDOFs)                 ;
 
-        this->MinPosExtremaPositionVectorArray      =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
-        this->MinPosExtremaVelocityVectorArray      =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
-        this->MinPosExtremaAccelerationVectorArray  =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
-        this->MaxPosExtremaPositionVectorArray      =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
-        this->MaxPosExtremaVelocityVectorArray      =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
-        this->MaxPosExtremaAccelerationVectorArray  =   new RMLDoubleVector *[this->NumberOfDOFs]               ;
+        this->MinPosExtremaPositionVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
+        this->MinPosExtremaVelocityVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
+        this->MinPosExtremaAccelerationVectorArray  =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
+        this->MaxPosExtremaPositionVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
+        this->MaxPosExtremaVelocityVectorArray      =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
+        this->MaxPosExtremaAccelerationVectorArray  =   (RMLDoubleVector**)RMLMemoryResource::AllocateObject(this->NumberOfDOFs * sizeof(RMLDoubleVector*))  ;
 
         for (i = 0; i < this->NumberOfDOFs; i++)
         {
@@ -233,10 +243,58 @@ protected:
             (this->MaxPosExtremaAccelerationVectorArray)    [i] =   new RMLDoubleVector(this->NumberOfDOFs)     ;
         }
 
+        this->PosExtremaVectorArraysAreZero         =   false                                                   ;
+
         *this               =   OP                                                                              ;
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLOutputParameters(RMLOutputParameters &&OP)
+//!
+//! \brief
+//! Move constructor
+//!
+//! \details
+//! All vector objects of \c OP, including the \f$ N \times N \f$ arrays
+//! of the motion states at the positional extrema, are transferred
+//! without allocating memory or copying values. Afterwards, \c OP has
+//! zero degrees of freedom and may only be destroyed, assigned by the
+//! move assignment operator, or swapped.
+//!
+//! \param OP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLOutputParameters(RMLOutputParameters &&OP) RML_NOEXCEPT
+    {
+        this->TrajectoryIsPhaseSynchronized           =   false   ;
+        this->NumberOfDOFs                            =   0       ;
+        this->SynchronizationTime                     =   0.0     ;
+        this->ANewCalculationWasPerformed             =   false   ;
+        this->DOFWithTheGreatestExecutionTime         =   0       ;
+        this->PosExtremaVectorArraysAreZero           =   true    ;
+
+        this->NewPositionVector                       =   NULL    ;
+        this->NewVelocityVector                       =   NULL    ;
+        this->NewAccelerationVector                   =   NULL    ;
+        this->MinExtremaTimesVector                   =   NULL    ;
+        this->MaxExtremaTimesVector                   =   NULL    ;
+        this->MinPosExtremaPositionVectorOnly         =   NULL    ;
+        this->MaxPosExtremaPositionVectorOnly         =   NULL    ;
+        this->ExecutionTimes                          =   NULL    ;
+        this->MinPosExtremaPositionVectorArray        =   NULL    ;
+        this->MinPosExtremaVelocityVectorArray        =   NULL    ;
+        this->MinPosExtremaAccelerationVectorArray    =   NULL    ;
+        this->MaxPosExtremaPositionVectorArray        =   NULL    ;
+        this->MaxPosExtremaVelocityVectorArray        =   NULL    ;
+        this->MaxPosExtremaAccelerationVectorArray    =   NULL    ;
+
+        this->Swap(OP);
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void Echo(FILE* FileHandler = stdout) const
 //!
@@ -288,9 +346,10 @@ public:
 //  ----------------------------------------------------------
     ~RMLOutputParameters(void)
     {
-        unsigned int        i   =   0;
+        unsigned int        i                   =   0
+                        ,   NumberOfVectors     =   this->GetMaxNumberOfDOFs()  ;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (i = 0; i < NumberOfVectors; i++)
         {
             delete ((this->MinPosExtremaPositionVectorArray)        [i])    ;
             delete ((this->MinPosExtremaVelocityVectorArray)        [i])    ;
@@ -303,12 +362,12 @@ public:
         delete this->NewPositionVector                                      ;
         delete this->NewVelocityVector                                      ;
         delete this->NewAccelerationVector                                  ;
-        delete this->MinPosExtremaPositionVectorArray                       ;
-        delete this->MinPosExtremaVelocityVectorArray                       ;
-        delete this->MinPosExtremaAccelerationVectorArray                   ;
-        delete this->MaxPosExtremaPositionVectorArray                       ;
-        delete this->MaxPosExtremaVelocityVectorArray                       ;
-        delete this->MaxPosExtremaAccelerationVectorArray                   ;
+        RMLMemoryResource::FreeObject(this->MinPosExtremaPositionVectorArray)     ;
+        RMLMemoryResource::FreeObject(this->MinPosExtremaVelocityVectorArray)     ;
+        RMLMemoryResource::FreeObject(this->MinPosExtremaAccelerationVectorArray) ;
+        RMLMemoryResource::FreeObject(this->MaxPosExtremaPositionVectorArray)     ;
+        RMLMemoryResource::FreeObject(this->MaxPosExtremaVelocityVectorArray)     ;
+        RMLMemoryResource::FreeObject(this->MaxPosExtremaAccelerationVectorArray) ;
         delete this->MinExtremaTimesVector                                  ;
         delete this->MaxExtremaTimesVector                                  ;
         delete this->MinPosExtremaPositionVectorOnly                        ;
@@ -363,6 +422,15 @@ public:
         OP.GetPositionalExtrema(    this->MinPosExtremaPositionVectorOnly
                                 ,   this->MaxPosExtremaPositionVectorOnly       )       ;
 
+        // The arrays of the motion states at the positional extrema are
+        // not copied if they are zero in both objects.
+        if ((this->PosExtremaVectorArraysAreZero) && (OP.PosExtremaVectorArraysAreZero))
+        {
+            return(*this);
+        }
+
+        this->PosExtremaVectorArraysAreZero     =   OP.PosExtremaVectorArraysAreZero    ;
+
         for (i = 0; i < this->NumberOfDOFs; i++)
         {
             OP.GetMotionStateAtMinPosForOneDOF(     i
@@ -380,6 +448,66 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLOutputParameters &operator = (RMLOutputParameters &&OP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLOutputParameters::Swap())
+//!
+//! \param OP
+//! RMLOutputParameters object to be moved
+//  ----------------------------------------------------------
+    RMLOutputParameters &operator = (RMLOutputParameters &&OP) RML_NOEXCEPT
+    {
+        this->Swap(OP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Swap(RMLOutputParameters &OP)
+//!
+//! \brief
+//! Exchanges the contents of two objects
+//!
+//! \details
+//! Only the pointers to the vector objects and to the arrays of the
+//! motion states at the positional extrema are exchanged, that is, the
+//! effort is independent of the number of degrees of freedom, no memory
+//! is allocated, and no values are copied.
+//!
+//! \param OP
+//! RMLOutputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    void Swap(RMLOutputParameters &OP) RML_NOEXCEPT
+    {
+        RMLSwap(this->TrajectoryIsPhaseSynchronized           , OP.TrajectoryIsPhaseSynchronized           );
+        RMLSwap(this->NumberOfDOFs                            , OP.NumberOfDOFs                            );
+        RMLSwap(this->SynchronizationTime                     , OP.SynchronizationTime                     );
+        RMLSwap(this->ANewCalculationWasPerformed             , OP.ANewCalculationWasPerformed             );
+        RMLSwap(this->DOFWithTheGreatestExecutionTime         , OP.DOFWithTheGreatestExecutionTime         );
+        RMLSwap(this->PosExtremaVectorArraysAreZero           , OP.PosExtremaVectorArraysAreZero           );
+        RMLSwap(this->NewPositionVector                       , OP.NewPositionVector                       );
+        RMLSwap(this->NewVelocityVector                       , OP.NewVelocityVector                       );
+        RMLSwap(this->NewAccelerationVector                   , OP.NewAccelerationVector                   );
+        RMLSwap(this->MinExtremaTimesVector                   , OP.MinExtremaTimesVector                   );
+        RMLSwap(this->MaxExtremaTimesVector                   , OP.MaxExtremaTimesVector                   );
+        RMLSwap(this->MinPosExtremaPositionVectorOnly         , OP.MinPosExtremaPositionVectorOnly         );
+        RMLSwap(this->MaxPosExtremaPositionVectorOnly         , OP.MaxPosExtremaPositionVectorOnly         );
+        RMLSwap(this->ExecutionTimes                          , OP.ExecutionTimes                          );
+        RMLSwap(this->MinPosExtremaPositionVectorArray        , OP.MinPosExtremaPositionVectorArray        );
+        RMLSwap(this->MinPosExtremaVelocityVectorArray        , OP.MinPosExtremaVelocityVectorArray        );
+        RMLSwap(this->MinPosExtremaAccelerationVectorArray    , OP.MinPosExtremaAccelerationVectorArray    );
+        RMLSwap(this->MaxPosExtremaPositionVectorArray        , OP.MaxPosExtremaPositionVectorArray        );
+        RMLSwap(this->MaxPosExtremaVelocityVectorArray        , OP.MaxPosExtremaVelocityVectorArray        );
+        RMLSwap(this->MaxPosExtremaAccelerationVectorArray    , OP.MaxPosExtremaAccelerationVectorArray    );
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn inline void GetNewPositionVector(RMLDoubleVector *OutputVector) const
 //!
@@ -1196,6 +1324,172 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetMaxNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the maximum number of degrees of freedom, that is, the number
+//! passed to the constructor
+//!
+//! \sa RMLOutputParameters::SetNumberOfDOFs()
+//  ----------------------------------------------------------
+    inline unsigned int GetMaxNumberOfDOFs(void) const
+    {
+        return((this->NewPositionVector == NULL)?(0):(this->NewPositionVector->GetVecCapacity()));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Changes the number of degrees of freedom without reallocating memory
+//!
+//! \details
+//! All vectors keep their memory (cf. RMLVector::SetVecDim()), such that
+//! this method is real-time capable.
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom
+//!
+//! \return
+//! \c false, if \c DegreesOfFreedom exceeds
+//! RMLOutputParameters::GetMaxNumberOfDOFs(); the object remains unchanged
+//! in this case.
+//!
+//! \sa RMLInputParameters::SetNumberOfDOFs()
+//  ----------------------------------------------------------
+    bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+    {
+        unsigned int        i   =   0;
+
+        if (DegreesOfFreedom > this->GetMaxNumberOfDOFs())
+        {
+            return(false);
+        }
+
+        this->NewPositionVector->SetVecDim                  (DegreesOfFreedom);
+        this->NewVelocityVector->SetVecDim                  (DegreesOfFreedom);
+        this->NewAccelerationVector->SetVecDim              (DegreesOfFreedom);
+        this->MinExtremaTimesVector->SetVecDim              (DegreesOfFreedom);
+        this->MaxExtremaTimesVector->SetVecDim              (DegreesOfFreedom);
+        this->MinPosExtremaPositionVectorOnly->SetVecDim    (DegreesOfFreedom);
+        this->MaxPosExtremaPositionVectorOnly->SetVecDim    (DegreesOfFreedom);
+        this->ExecutionTimes->SetVecDim                     (DegreesOfFreedom);
+
+        for (i = 0; i < this->GetMaxNumberOfDOFs(); i++)
+        {
+            ((this->MinPosExtremaPositionVectorArray)       [i])->SetVecDim(DegreesOfFreedom);
+            ((this->MinPosExtremaVelocityVectorArray)       [i])->SetVecDim(DegreesOfFreedom);
+            ((this->MinPosExtremaAccelerationVectorArray)   [i])->SetVecDim(DegreesOfFreedom);
+            ((this->MaxPosExtremaPositionVectorArray)       [i])->SetVecDim(DegreesOfFreedom);
+            ((this->MaxPosExtremaVelocityVectorArray)       [i])->SetVecDim(DegreesOfFreedom);
+            ((this->MaxPosExtremaAccelerationVectorArray)   [i])->SetVecDim(DegreesOfFreedom);
+        }
+
+        // The elements that become part of the arrays of the motion states
+        // at the positional extrema again may contain previous values.
+        if (DegreesOfFreedom > this->NumberOfDOFs)
+        {
+            this->PosExtremaVectorArraysAreZero =   false;
+        }
+
+        this->NumberOfDOFs  =   DegreesOfFreedom;
+
+        if (this->DOFWithTheGreatestExecutionTime >= DegreesOfFreedom)
+        {
+            this->DOFWithTheGreatestExecutionTime   =   0;
+        }
+
+        return(true);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool ArePosExtremaVectorArraysZero(void) const
+//!
+//! \brief
+//! Indicates, whether all elements of the six arrays of the motion states
+//! at the positional extrema are known to be zero
+//!
+//! \sa RMLOutputParameters::PosExtremaVectorArraysAreZero
+//  ----------------------------------------------------------
+    inline bool ArePosExtremaVectorArraysZero(void) const
+    {
+        return(this->PosExtremaVectorArraysAreZero);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetPosExtremaVectorArraysToZero(void)
+//!
+//! \brief
+//! Sets all elements of the six arrays of the motion states at the
+//! positional extrema to zero
+//!
+//! \details
+//! The arrays are only zeroed if they are not known to be zero already,
+//! such that repeated calls do not depend on the square of the number of
+//! degrees of freedom. This method is real-time capable.
+//!
+//! \sa RMLOutputParameters::PosExtremaVectorArraysAreZero
+//  ----------------------------------------------------------
+    void SetPosExtremaVectorArraysToZero(void)
+    {
+        unsigned int        i   =   0
+                        ,   k   =   0;
+
+        if (this->PosExtremaVectorArraysAreZero)
+        {
+            return;
+        }
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            for (k = 0; k < this->NumberOfDOFs; k++)
+            {
+                (((this->MinPosExtremaPositionVectorArray)[i])->VecData)[k]
+                =   0.0;
+                (((this->MinPosExtremaVelocityVectorArray)[i])->VecData)[k]
+                =   0.0;
+                (((this->MinPosExtremaAccelerationVectorArray)[i])->VecData)[k]
+                =   0.0;
+
+                (((this->MaxPosExtremaPositionVectorArray)[i])->VecData)[k]
+                =   0.0;
+                (((this->MaxPosExtremaVelocityVectorArray)[i])->VecData)[k]
+                =   0.0;
+                (((this->MaxPosExtremaAccelerationVectorArray)[i])->VecData)[k]
+                =   0.0;
+            }
+        }
+
+        this->PosExtremaVectorArraysAreZero =   true;
+
+        return;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void SetPosExtremaVectorArraysModified(void)
+//!
+//! \brief
+//! Declares that elements of the six arrays of the motion states at the
+//! positional extrema may be non-zero
+//!
+//! \details
+//! This method has to be called after writing to the arrays
+//! RMLOutputParameters::MinPosExtremaPositionVectorArray,
+//! RMLOutputParameters::MaxPosExtremaPositionVectorArray, etc. directly.
+//!
+//! \sa RMLOutputParameters::PosExtremaVectorArraysAreZero
+//  ----------------------------------------------------------
+    inline void SetPosExtremaVectorArraysModified(void)
+    {
+        this->PosExtremaVectorArraysAreZero =   false;
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn inline bool WasACompleteComputationPerformedDuringTheLastCycle(void) const
 //!
@@ -1765,6 +2059,33 @@ public:
 //  ----------------------------------------------------------
     RMLDoubleVector         **MaxPosExtremaAccelerationVectorArray  ;
 
+
+private:
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool PosExtremaVectorArraysAreZero
+//!
+//! \brief
+//! Indicates, whether all elements of the six arrays of the motion states
+//! at the positional extrema are zero
+//!
+//! \details
+//! This flag is maintained by the library, such that the
+//! \f$ K \times K \f$ arrays do not have to be zeroed or copied in every
+//! control cycle, if the calculation of the extremum motion states is
+//! disabled (cf.
+//! RMLFlags::EnableTheCalculationOfTheExtremumMotionStates). It is
+//! cleared whenever the number of degrees of freedom grows (cf.
+//! RMLOutputParameters::SetNumberOfDOFs()). Applications that write to
+//! the arrays RMLOutputParameters::MinPosExtremaPositionVectorArray,
+//! RMLOutputParameters::MaxPosExtremaPositionVectorArray, etc. directly
+//! have to call RMLOutputParameters::SetPosExtremaVectorArraysModified().
+//!
+//! \sa RMLOutputParameters::ArePosExtremaVectorArraysZero()
+//! \sa RMLOutputParameters::SetPosExtremaVectorArraysToZero()
+//  ----------------------------------------------------------
+    bool                    PosExtremaVectorArraysAreZero;
+
 };// class RMLOutputParameters
 
 
@@ -0,0 +1,613 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLParallelExecutor.h
+//!
+//! \brief
+//! Header file for the class RMLParallelExecutor
+//!
+//! \details
+//! Parallel execution of a large number of independent On-Line
+//! Trajectory Generation instances within one control cycle.
+//!
+//! \sa ReflexxesAPI
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLParallelExecutor__
+#define __RMLParallelExecutor__
+
+
+#include <ReflexxesAPI.h>
+#include <TypeIIRMLPlatform.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLVelocityFlags.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLParallelExecutor
+//!
+//! \brief
+//! Executes one cycle of many independent ReflexxesAPI instances on a
+//! pool of worker threads
+//!
+//! \details
+//! Cell controllers often step hundreds of generator instances (one per
+//! tool or axis group) per control cycle. Most instances only sample an
+//! existing trajectory, but some of them have to compute a new one, which
+//! takes considerably more time. A static partition of the instances
+//! among the processors would therefore leave processors idle, while
+//! others are still busy.\n
+//! \n
+//! This class owns a set of position-based and velocity-based instances
+//! including their input, output, and flag objects. At the beginning of
+//! each call of RMLParallelExecutor::ExecuteCycle(), the instances are
+//! distributed among the workers, whereby the instances that computed a
+//! new trajectory in the previous cycle are dealt first and round-robin,
+//! such that recomputation spikes are spread across all workers. Each
+//! worker first executes its own instances and subsequently steals
+//! instances from the other workers, until all instances have been
+//! executed. Instances are claimed by atomic increments only, such that
+//! no locks are used during a cycle. The calling thread acts as the
+//! first worker, and the cycle ends with a single barrier.\n
+//! \n
+//! The worker threads are created by the constructor and optionally
+//! pinned to processors. All instances have to be added before the first
+//! call of RMLParallelExecutor::ExecuteCycle(). Between two calls of
+//! RMLParallelExecutor::ExecuteCycle(), the calling thread may access all
+//! input, output, and flag objects. For each instance, the latency of its
+//! last execution and the index of the executing worker are reported.
+//!
+//! \sa ReflexxesAPI
+//! \sa TypeIIRMLPlatform::StartThread()
+//  ----------------------------------------------------------
+class RMLParallelExecutor
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum ReturnValue
+//!
+//! \brief
+//! Return values for the methods of the class RMLParallelExecutor
+//  ----------------------------------------------------------
+    enum ReturnValue
+    {
+        RETURN_SUCCESS                  =   0,
+        RETURN_ERROR                    =   -1,
+        //! \brief The maximum number of instances was reached
+        RETURN_NO_MORE_INSTANCES        =   -2
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum InstanceType
+//!
+//! \brief
+//! Type of an instance owned by the executor
+//  ----------------------------------------------------------
+    enum InstanceType
+    {
+        //! \brief Position-based instance, executed by
+        //! ReflexxesAPI::RMLPosition()
+        POSITION_BASED                  =   0,
+        //! \brief Velocity-based instance, executed by
+        //! ReflexxesAPI::RMLVelocity()
+        VELOCITY_BASED                  =   1
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLParallelExecutor(const unsigned int &MaxNumberOfInstances, const unsigned int &NumberOfWorkers = 0, const bool &PinWorkersToProcessors = true)
+//!
+//! \brief
+//! Constructor of the class RMLParallelExecutor
+//!
+//! \details
+//! Allocates the memory for all instances and starts the worker threads.
+//!
+//! \param MaxNumberOfInstances
+//! Maximum number of instances that can be added
+//!
+//! \param NumberOfWorkers
+//! Number of workers including the calling thread of
+//! RMLParallelExecutor::ExecuteCycle(); zero uses one worker per
+//! processor.
+//!
+//! \param PinWorkersToProcessors
+//! If \c true, the worker thread \c k is pinned to the processor
+//! \c k modulo the number of processors. The calling thread is not
+//! pinned.
+//!
+//! \warning
+//! The constructor is \b not real-time capable.
+//  ----------------------------------------------------------
+    RMLParallelExecutor(        const unsigned int  &MaxNumberOfInstances
+                            ,   const unsigned int  &NumberOfWorkers            =   0
+                            ,   const bool          &PinWorkersToProcessors     =   true);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLParallelExecutor(void)
+//!
+//! \brief
+//! Destructor of the class RMLParallelExecutor
+//!
+//! \details
+//! Terminates all worker threads and deletes all instances.
+//  ----------------------------------------------------------
+    ~RMLParallelExecutor(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int AddPositionInstance(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Creates a position-based instance and its input, output, and flag
+//! objects
+//!
+//! \return
+//! Index of the new instance or an element of
+//! RMLParallelExecutor::ReturnValue in case of an error
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//  ----------------------------------------------------------
+    int AddPositionInstance(        const unsigned int  &DegreesOfFreedom
+                                ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int AddVelocityInstance(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Creates a velocity-based instance and its input, output, and flag
+//! objects
+//!
+//! \return
+//! Index of the new instance or an element of
+//! RMLParallelExecutor::ReturnValue in case of an error
+//!
+//! \warning
+//! This method is \b not real-time capable.
+//  ----------------------------------------------------------
+    int AddVelocityInstance(        const unsigned int  &DegreesOfFreedom
+                                ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int ExecuteCycle(void)
+//!
+//! \brief
+//! Executes one cycle of all instances and returns after all of them
+//! have been executed
+//!
+//! \return
+//!  - RMLParallelExecutor::RETURN_SUCCESS if no instance returned an
+//!    error value
+//!  - RMLParallelExecutor::RETURN_ERROR otherwise; the result of each
+//!    instance can be queried by
+//!    RMLParallelExecutor::GetResultValue()
+//  ----------------------------------------------------------
+    int ExecuteCycle(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfInstances(void) const
+//!
+//! \brief
+//! Returns the number of instances
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfInstances(void) const
+    {
+        return(this->NumberOfInstances);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfWorkers(void) const
+//!
+//! \brief
+//! Returns the number of workers including the calling thread
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfWorkers(void) const
+    {
+        return(this->NumberOfWorkers);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionInputParameters *GetPositionInputParameters(const unsigned int &Index)
+//!
+//! \brief
+//! Returns the input values of a position-based instance or \c NULL, if
+//! \c Index does not refer to a position-based instance
+//  ----------------------------------------------------------
+    RMLPositionInputParameters *GetPositionInputParameters(const unsigned int &Index);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionFlags *GetPositionFlags(const unsigned int &Index)
+//!
+//! \brief
+//! Returns the flags of a position-based instance or \c NULL
+//  ----------------------------------------------------------
+    RMLPositionFlags *GetPositionFlags(const unsigned int &Index);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const RMLPositionOutputParameters *GetPositionOutputParameters(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the output values of a position-based instance or \c NULL
+//  ----------------------------------------------------------
+    const RMLPositionOutputParameters *GetPositionOutputParameters(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVelocityInputParameters *GetVelocityInputParameters(const unsigned int &Index)
+//!
+//! \brief
+//! Returns the input values of a velocity-based instance or \c NULL, if
+//! \c Index does not refer to a velocity-based instance
+//  ----------------------------------------------------------
+    RMLVelocityInputParameters *GetVelocityInputParameters(const unsigned int &Index);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVelocityFlags *GetVelocityFlags(const unsigned int &Index)
+//!
+//! \brief
+//! Returns the flags of a velocity-based instance or \c NULL
+//  ----------------------------------------------------------
+    RMLVelocityFlags *GetVelocityFlags(const unsigned int &Index);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn const RMLVelocityOutputParameters *GetVelocityOutputParameters(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the output values of a velocity-based instance or \c NULL
+//  ----------------------------------------------------------
+    const RMLVelocityOutputParameters *GetVelocityOutputParameters(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetResultValue(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the value that was returned by ReflexxesAPI::RMLPosition()
+//! or ReflexxesAPI::RMLVelocity() in the last cycle
+//  ----------------------------------------------------------
+    int GetResultValue(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double GetLatency(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the execution time of an instance in the last cycle in
+//! seconds
+//  ----------------------------------------------------------
+    double GetLatency(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double GetMaximumLatency(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the greatest execution time of an instance of all cycles in
+//! seconds
+//  ----------------------------------------------------------
+    double GetMaximumLatency(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned int GetWorkerOfInstance(const unsigned int &Index) const
+//!
+//! \brief
+//! Returns the index of the worker that executed an instance in the last
+//! cycle; zero refers to the calling thread
+//  ----------------------------------------------------------
+    unsigned int GetWorkerOfInstance(const unsigned int &Index) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfStolenInstances(void) const
+//!
+//! \brief
+//! Returns the number of instances that were executed by another worker
+//! than the one they were assigned to in the last cycle
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfStolenInstances(void) const
+    {
+        return(this->NumberOfStolenInstances);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline double GetCycleDuration(void) const
+//!
+//! \brief
+//! Returns the duration of the last call of
+//! RMLParallelExecutor::ExecuteCycle() in seconds
+//  ----------------------------------------------------------
+    inline double GetCycleDuration(void) const
+    {
+        return(this->CycleDuration);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct Instance
+//!
+//! \brief
+//! One generator instance and its input, output, and flag objects
+//  ----------------------------------------------------------
+    struct Instance
+    {
+        InstanceType                    Type                        ;
+        ReflexxesAPI                    *RML                        ;
+        RMLPositionInputParameters      *PositionInputParameters    ;
+        RMLPositionOutputParameters     *PositionOutputParameters   ;
+        RMLPositionFlags                *PositionFlags              ;
+        RMLVelocityInputParameters      *VelocityInputParameters    ;
+        RMLVelocityOutputParameters     *VelocityOutputParameters   ;
+        RMLVelocityFlags                *VelocityFlags              ;
+        int                             ResultValue                 ;
+        bool                            NewCalculationWasPerformed  ;
+        unsigned int                    Worker                      ;
+        double                          Latency                     ;
+        double                          MaximumLatency              ;
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct Worker
+//!
+//! \brief
+//! Queue and thread of one worker
+//!
+//! \details
+//! The worker owns the elements \c Begin to \c End - 1 of
+//! RMLParallelExecutor::Order. The owner and all other workers claim
+//! elements by atomically incrementing \c NextIndex, such that each
+//! instance is executed exactly once. The padding keeps the frequently
+//! modified counters of different workers in different cache lines.
+//  ----------------------------------------------------------
+    struct Worker
+    {
+        volatile unsigned long long     NextIndex                   ;
+        unsigned int                    Begin                       ;
+        unsigned int                    End                         ;
+        unsigned int                    StolenInstances             ;
+        unsigned int                    Index                       ;
+        RMLParallelExecutor             *Executor                   ;
+        TypeIIRMLPlatform::Semaphore    StartSemaphore              ;
+        TypeIIRMLPlatform::Thread       WorkerThread                ;
+        unsigned char                   Padding[64]                 ;
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static void WorkerFunction(void *Argument)
+//!
+//! \brief
+//! Main function of the worker threads
+//!
+//! \param Argument
+//! Pointer to the RMLParallelExecutor::Worker object of the thread
+//  ----------------------------------------------------------
+    static void WorkerFunction(void *Argument);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int AddInstance(const InstanceType &Type, const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Creates an instance of the given type
+//  ----------------------------------------------------------
+    int AddInstance(        const InstanceType  &Type
+                        ,   const unsigned int  &DegreesOfFreedom
+                        ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void DistributeInstances(void)
+//!
+//! \brief
+//! Assigns all instances to the workers for the next cycle
+//!
+//! \details
+//! The instances that performed a new calculation in the last cycle are
+//! dealt first and round-robin among all workers, the remaining
+//! instances afterwards. Each worker thus starts with the instances
+//! that are most likely to be expensive.
+//  ----------------------------------------------------------
+    void DistributeInstances(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ProcessInstances(const unsigned int &WorkerIndex)
+//!
+//! \brief
+//! Executes the instances of one worker and steals instances from all
+//! other workers afterwards
+//  ----------------------------------------------------------
+    void ProcessInstances(const unsigned int &WorkerIndex);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool ClaimInstance(const unsigned int &WorkerIndex, unsigned int *InstanceIndex)
+//!
+//! \brief
+//! Atomically claims the next unprocessed instance of a worker
+//!
+//! \return
+//! \c false, if all instances of the worker have been claimed
+//  ----------------------------------------------------------
+    bool ClaimInstance(     const unsigned int  &WorkerIndex
+                        ,   unsigned int        *InstanceIndex);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ExecuteInstance(const unsigned int &InstanceIndex, const unsigned int &WorkerIndex)
+//!
+//! \brief
+//! Executes one cycle of one instance and measures its latency
+//  ----------------------------------------------------------
+    void ExecuteInstance(       const unsigned int  &InstanceIndex
+                            ,   const unsigned int  &WorkerIndex);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool FinishWork(void)
+//!
+//! \brief
+//! Signals that a worker has finished the current cycle
+//!
+//! \return
+//! \c true for the last worker that finished the cycle
+//  ----------------------------------------------------------
+    bool FinishWork(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int MaxNumberOfInstances
+//!
+//! \brief
+//! Maximum number of instances as specified by the constructor
+//  ----------------------------------------------------------
+    unsigned int                        MaxNumberOfInstances;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfInstances
+//!
+//! \brief
+//! Number of instances that were added
+//  ----------------------------------------------------------
+    unsigned int                        NumberOfInstances;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfWorkers
+//!
+//! \brief
+//! Number of workers including the calling thread
+//  ----------------------------------------------------------
+    unsigned int                        NumberOfWorkers;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfStolenInstances
+//!
+//! \brief
+//! Number of stolen instances in the last cycle
+//  ----------------------------------------------------------
+    unsigned int                        NumberOfStolenInstances;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CycleDuration
+//!
+//! \brief
+//! Duration of the last cycle in seconds
+//  ----------------------------------------------------------
+    double                              CycleDuration;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile bool TerminateWorkers
+//!
+//! \brief
+//! Set by the destructor to terminate all worker threads
+//  ----------------------------------------------------------
+    volatile bool                       TerminateWorkers;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var volatile unsigned long long FinishedWorkers
+//!
+//! \brief
+//! Number of workers that finished the current cycle
+//  ----------------------------------------------------------
+    volatile unsigned long long         FinishedWorkers;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPlatform::Semaphore CycleFinishedSemaphore
+//!
+//! \brief
+//! Posted by the last worker that finishes a cycle
+//  ----------------------------------------------------------
+    TypeIIRMLPlatform::Semaphore        CycleFinishedSemaphore;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var Instance *Instances
+//!
+//! \brief
+//! Array of RMLParallelExecutor::MaxNumberOfInstances instances
+//  ----------------------------------------------------------
+    Instance                            *Instances;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var Worker *Workers
+//!
+//! \brief
+//! Array of RMLParallelExecutor::NumberOfWorkers workers
+//  ----------------------------------------------------------
+    Worker                              *Workers;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int *Order
+//!
+//! \brief
+//! Instance indices of all workers in the order of their execution
+//  ----------------------------------------------------------
+    unsigned int                        *Order;
+
+};  // class RMLParallelExecutor
+
+
+#endif
@@ -0,0 +1,113 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLPositionCandidates.h
+//!
+//! \brief
+//! Header file for the structures RMLPositionCandidateTargets and
+//! RMLPositionCandidateResults
+//!
+//! \details
+//! Candidate target states of motion for
+//! TypeIIRMLPosition::GetMinimumExecutionTimes().
+//!
+//! \sa TypeIIRMLPosition
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLPositionCandidates__
+#define __RMLPositionCandidates__
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLPositionCandidateTargets
+//!
+//! \brief
+//! Candidate target states of motion for
+//! TypeIIRMLPosition::GetMinimumExecutionTimes() as a structure of arrays
+//!
+//! \details
+//! All candidates share the current state of motion, the kinematic
+//! limits, and the selection vector of one RMLPositionInputParameters
+//! object. The arrays are owned by the caller and contain
+//! \c NumberOfDOFs times \c NumberOfCandidates elements each. The values
+//! of one degree of freedom are stored contiguously, that is, the target
+//! position of the degree of freedom \c j of the candidate \c k is
+//! \c TargetPosition[j * NumberOfCandidates + k].
+//!
+//! \sa RMLPositionCandidateResults
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTimes()
+//  ----------------------------------------------------------
+struct RMLPositionCandidateTargets
+{
+    //! \brief Number of candidates \f$ K \f$
+    unsigned int            NumberOfCandidates;
+    //! \brief Target positions of all candidates
+    const double            *TargetPosition;
+    //! \brief Target velocities of all candidates; \c NULL uses the
+    //! target velocity vector of the input values for all candidates
+    const double            *TargetVelocity;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLPositionCandidateResults
+//!
+//! \brief
+//! Results of TypeIIRMLPosition::GetMinimumExecutionTimes() with one
+//! element per candidate
+//!
+//! \details
+//! The arrays are owned by the caller. The members \c ResultValues and
+//! \c IsPhaseSynchronized are optional and may be \c NULL.
+//!
+//! \sa RMLPositionCandidateTargets
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTimes()
+//  ----------------------------------------------------------
+struct RMLPositionCandidateResults
+{
+    //! \brief Execution time of each candidate in seconds;
+    //! RML_INFINITY for candidates that cannot be reached
+    double                  *ExecutionTimes;
+    //! \brief Result of each candidate as an element of
+    //! ReflexxesAPI::RMLResultValue
+    int                     *ResultValues;
+    //! \brief Information, whether the motion to each candidate would be
+    //! phase-synchronized
+    bool                    *IsPhaseSynchronized;
+    //! \brief Index of the candidate with the smallest execution time;
+    //! equals \c NumberOfCandidates if no candidate can be reached
+    unsigned int            IndexOfFastestCandidate;
+};
+
+
+#endif
@@ -78,6 +78,8 @@ public:
 //!  - Behavior after the target state of motion is reached: keep target velocity (RMLPositionFlags::KEEP_TARGET_VELOCITY)
 //!  - Calculation of extremum motion states enabled
 //!  - In case the fall back strategy becomes active: velocity to predefined values (default: zero)
+//!  - Deterministic timing disabled
+//!  - New trajectories are calculated within one cycle
 //  ----------------------------------------------------------
     RMLPositionFlags(void)
     {
@@ -85,6 +87,8 @@ public:
         this->BehaviorAfterFinalStateOfMotionIsReached      =   RMLPositionFlags::KEEP_TARGET_VELOCITY      ;
         this->EnableTheCalculationOfTheExtremumMotionStates =   true                                        ;
         this->KeepCurrentVelocityInCaseOfFallbackStrategy   =   false                                       ;
+        this->EnableDeterministicTiming                     =   false                                       ;
+        this->NumberOfRecomputationCycles                   =   1                                           ;
     }
 
 
@@ -114,7 +118,11 @@ public:
                 &&  (this->BehaviorAfterFinalStateOfMotionIsReached
                         ==  Flags.BehaviorAfterFinalStateOfMotionIsReached)
                 &&  (this->KeepCurrentVelocityInCaseOfFallbackStrategy
-                        ==  Flags.KeepCurrentVelocityInCaseOfFallbackStrategy));
+                        ==  Flags.KeepCurrentVelocityInCaseOfFallbackStrategy)
+                &&  (this->EnableDeterministicTiming
+                        ==  Flags.EnableDeterministicTiming)
+                &&  (this->NumberOfRecomputationCycles
+                        ==  Flags.NumberOfRecomputationCycles));
     }
 
 
@@ -205,6 +213,112 @@ public:
     bool                KeepCurrentVelocityInCaseOfFallbackStrategy;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var bool EnableDeterministicTiming
+//!
+//! \brief
+//! If true, every call of TypeIIRMLPosition::GetNextStateOfMotion()
+//! executes the path of a complete trajectory calculation
+//!
+//! \details
+//! The execution time of the position-based algorithm depends strongly on
+//! whether a new trajectory has to be calculated (Steps 1 and 2) or
+//! whether only the existing one is sampled (Step 3). For applications,
+//! for which a bounded and predictable execution time is more important
+//! than a low average one, this flag makes every cycle execute Steps 1,
+//! 2, and 3:
+//!
+//!  - If no new trajectory is calculated, or if the fall-back strategy
+//!    becomes active, Steps 1 and 2 are executed by an internal second
+//!    instance for fixed input values, whose calculation passes through
+//!    the expensive branches of both steps for all degrees of freedom
+//!    (cf. TypeIIRMLPosition::ExecuteDeterministicTimingPath()). The
+//!    result is discarded.
+//!  - The search for the synchronization time that considers
+//!    RMLPositionInputParameters::MinimumSynchronizationTime always scans
+//!    all sorted candidate times and evaluates all inoperative time
+//!    intervals, also if it is not required.
+//!
+//! The output values are identical to the ones without this flag, only
+//! the execution time changes. The fixed input values make Steps 1 and 2
+//! at least as expensive as for most input values of an application, but
+//! not as expensive as for all of them, and a cycle with a new trajectory
+//! additionally compares the input values and sets up the new
+//! trajectory. Cycles without a new calculation therefore still take
+//! somewhat less time than cycles with one: the execution time is raised
+//! to a data-independent lower bound, and its spread becomes smaller, but
+//! it is not removed.
+//!
+//! \note
+//! The internal second instance is allocated by the first call with this
+//! flag. Real-time applications should therefore call
+//! TypeIIRMLPosition::GetNextStateOfMotion() once with this flag during
+//! their initialization.
+//!
+//! \sa TypeIIRMLPosition::ExecuteDeterministicTimingPath()
+//  ----------------------------------------------------------
+    bool                EnableDeterministicTiming;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfRecomputationCycles
+//!
+//! \brief
+//! Number of cycles \f$ K \f$, over which the calculation of a new
+//! trajectory is distributed
+//!
+//! \details
+//! By default (\f$ K\,=\,1 \f$), a new trajectory is calculated within
+//! the cycle, in which new input values are received. For a large number
+//! of degrees of freedom on slow processors, this calculation may not fit
+//! into a single control cycle. For \f$ K\,>\,1 \f$, the calculation is
+//! distributed over \f$ K \f$ cycles:
+//!
+//!  - Cycles \f$ 1,\,\dots,\,K-1 \f$ calculate the minimum execution
+//!    times of equally sized portions of the degrees of freedom. Cycle
+//!    \f$ K-1 \f$ additionally determines the synchronization time.
+//!  - Cycle \f$ K \f$ executes Step 2 and switches to the new trajectory.
+//!
+//! During cycles \f$ 1,\,\dots,\,K-1 \f$, the trajectory of the last
+//! cycle is continued, and all output values refer to this trajectory
+//! (RMLPositionOutputParameters::ANewCalculationWasPerformed is \c false).
+//! The new trajectory starts at the state of motion of the end of cycle
+//! \f$ K-1 \f$, such that the switch in cycle \f$ K \f$ is state-consistent.
+//! Input values that change while a calculation is pending are considered
+//! by another calculation that starts after the switch.\n
+//! \n
+//! If the output values are fed back, the output values equal bit by bit
+//! the ones that are obtained with \f$ K\,=\,1 \f$, if the changed input
+//! values are applied \f$ K-1 \f$ cycles later. Without synchronization
+//! (RMLFlags::NO_SYNCHRONIZATION), this only holds for a complete
+//! calculation: with \f$ K\,=\,1 \f$, only the changed degrees of freedom
+//! are recalculated (cf. TypeIIRMLPosition::RecomputeChangedDOFs()), and
+//! positions and velocities may differ in the last bits and in the sign
+//! of zero values. The tool RMLAmortizedRecomputationCheck compares both
+//! variants.\n
+//! \n
+//! A new trajectory is still calculated within a single cycle,
+//!
+//!  - if the last cycle did not provide a valid trajectory (e.g., at the
+//!    first call or after an error),
+//!  - if the flags or the selection vector changed,
+//!  - if the current state of motion does not equal the output values of
+//!    the last cycle, or
+//!  - if Step 1 does not lead to a valid trajectory (in this case, the
+//!    error is reported as without this flag).
+//!
+//! The calculation is executed by an internal second instance, which is
+//! allocated by the first call with \f$ K\,>\,1 \f$. Real-time applications
+//! should therefore call TypeIIRMLPosition::GetNextStateOfMotion() once
+//! with this value during their initialization. As
+//! RMLPositionFlags::EnableDeterministicTiming pads each cycle to a
+//! complete calculation, both options should not be combined.
+//!
+//! \sa TypeIIRMLPosition::StartAmortizedRecomputation()
+//  ----------------------------------------------------------
+    unsigned int        NumberOfRecomputationCycles;
+
+
 };// class RMLPositionFlags
 
 
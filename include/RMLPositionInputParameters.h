@@ -51,6 +51,7 @@
 
 
 #include <RMLInputParameters.h>
+#include <RMLValidityMask.h>
 #include <RMLVector.h>
 #include <string.h>
 #include <math.h>
@@ -82,7 +83,7 @@ public:
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLPositionInputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLPositionInputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource = NULL)
 //!
 //! \brief
 //! Constructor of class RMLPositionInputParameters
@@ -93,9 +94,17 @@ public:
 //!
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
+//!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
 //  ----------------------------------------------------------
-    RMLPositionInputParameters(const unsigned int DegreesOfFreedom) : RMLInputParameters(DegreesOfFreedom)
+    RMLPositionInputParameters(     const unsigned int  DegreesOfFreedom
+                                ,   RMLMemoryResource   *MemoryResource =   NULL) : RMLInputParameters(DegreesOfFreedom, MemoryResource)
     {
+        RMLMemoryResourceScope  Scope(MemoryResource);
+
         this->MaxVelocityVector                 =   new RMLDoubleVector (DegreesOfFreedom)  ;
         this->TargetPositionVector              =   new RMLDoubleVector (DegreesOfFreedom)  ;
         this->AlternativeTargetVelocityVector   =   new RMLDoubleVector (DegreesOfFreedom)  ;
@@ -131,6 +140,30 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionInputParameters(RMLPositionInputParameters &&IP)
+//!
+//! \brief
+//! Move constructor, transfers the vector objects of \c IP without
+//! allocating memory (cf. RMLInputParameters::RMLInputParameters(RMLInputParameters &&IP))
+//!
+//! \param IP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLPositionInputParameters(RMLPositionInputParameters &&IP) RML_NOEXCEPT : RMLInputParameters(static_cast<RMLInputParameters&&>(IP))
+    {
+        this->MaxVelocityVector                     =   IP.MaxVelocityVector                ;
+        this->TargetPositionVector                  =   IP.TargetPositionVector             ;
+        this->AlternativeTargetVelocityVector       =   IP.AlternativeTargetVelocityVector  ;
+
+        IP.MaxVelocityVector                        =   NULL                                ;
+        IP.TargetPositionVector                     =   NULL                                ;
+        IP.AlternativeTargetVelocityVector          =   NULL                                ;
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn ~RMLPositionInputParameters(void)
 //!
@@ -170,6 +203,46 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionInputParameters &operator = (RMLPositionInputParameters &&IP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLPositionInputParameters::Swap())
+//!
+//! \param IP
+//! RMLPositionInputParameters object to be moved
+//  ----------------------------------------------------------
+    RMLPositionInputParameters &operator = (RMLPositionInputParameters &&IP) RML_NOEXCEPT
+    {
+        this->Swap(IP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Swap(RMLPositionInputParameters &IP)
+//!
+//! \brief
+//! Exchanges the contents of two objects without allocating memory or
+//! copying values (cf. RMLInputParameters::Swap())
+//!
+//! \param IP
+//! RMLPositionInputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    void Swap(RMLPositionInputParameters &IP) RML_NOEXCEPT
+    {
+        RMLInputParameters::Swap(IP);
+
+        RMLSwap(this->MaxVelocityVector                 , IP.MaxVelocityVector                  );
+        RMLSwap(this->TargetPositionVector              , IP.TargetPositionVector               );
+        RMLSwap(this->AlternativeTargetVelocityVector   , IP.AlternativeTargetVelocityVector    );
+    }
+
+
 // #############################################################################
 
 
@@ -771,6 +844,30 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! \copybrief RMLInputParameters::SetNumberOfDOFs()
+//!
+//! \details
+//! \copydetails RMLInputParameters::SetNumberOfDOFs()
+//  ----------------------------------------------------------
+    bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+    {
+        if (!RMLInputParameters::SetNumberOfDOFs(DegreesOfFreedom))
+        {
+            return(false);
+        }
+
+        this->MaxVelocityVector->SetVecDim                  (DegreesOfFreedom);
+        this->TargetPositionVector->SetVecDim               (DegreesOfFreedom);
+        this->AlternativeTargetVelocityVector->SetVecDim    (DegreesOfFreedom);
+
+        return(true);
+    }
+
+
 // #############################################################################
 
 
@@ -791,7 +888,8 @@ public:
 //! (cf. RMLPositionInputParameters::MAXIMUM_MAGNITUDE_RANGE), the kinematic
 //! motion constraints, that is, the maximum values for velocity, and
 //! acceleration, have to be positive, and the target velocity
-//! must not be greater than the maximum velocity.
+//! must not be greater than the maximum velocity. NaN values of these
+//! three vectors are invalid.
 //!
 //! \return
 //!  - \c true, if all requirements for input parameters are met
@@ -831,10 +929,12 @@ public:
         {
             if ((this->SelectionVector->VecData)[i])
             {
-                if (    (this->MaxVelocityVector->VecData               [i] <=  0.0 )
-                    ||  (this->MaxAccelerationVector->VecData           [i] <=  0.0 )
-                    ||  (   fabs(this->TargetVelocityVector->VecData    [i]         )
-                        >   (this->MaxVelocityVector->VecData)          [i]         )   )
+                // The comparisons are negated, such that NaN values are
+                // invalid.
+                if (    (!(this->MaxVelocityVector->VecData             [i] >   0.0 ))
+                    ||  (!(this->MaxAccelerationVector->VecData         [i] >   0.0 ))
+                    ||  (!(     fabs(this->TargetVelocityVector->VecData[i]         )
+                            <=  (this->MaxVelocityVector->VecData)      [i]         ))  )
                 {
                     return(false);
                 }
@@ -912,6 +1012,44 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned int CheckForValidity(RMLValidityMask *Mask) const
+//!
+//! \brief
+//! Checks the input parameters of all degrees of freedom for validity and
+//! reports the failure reasons per degree of freedom
+//!
+//! \details
+//! Unlike RMLPositionInputParameters::CheckForValidity(void), all selected
+//! degrees of freedom are checked (two at a time with SSE2 instructions
+//! if available), and the result contains every failure reason that was
+//! detected. The conditions are the ones of
+//! RMLPositionInputParameters::CheckForValidity(void), such that the
+//! result is zero if and only if RMLPositionInputParameters::CheckForValidity(void)
+//! returns \c true. As the order of magnitude is only meaningful for
+//! positive kinematic motion constraints, the flag
+//! RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED is only set for degrees of
+//! freedom that fulfill the other requirements.\n
+//! \n
+//! The method does not allocate memory and may be called in every control
+//! cycle.
+//!
+//! \param Mask
+//! Pointer to an RMLValidityMask object, whose bits are set according to
+//! the detected failures. If \c Mask is \c NULL or if its number of
+//! degrees of freedom differs, only the return value is computed.
+//!
+//! \return
+//! Combination of all detected failure reasons
+//! (cf. RMLValidityMask::FailureReasonEnum); zero, if all input values
+//! are valid.
+//!
+//! \sa RMLValidityMask
+//! \sa RMLPositionInputParameters::CheckForValidity(void) const
+//  ----------------------------------------------------------
+    unsigned int CheckForValidity(RMLValidityMask *Mask) const;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void Echo(FILE* FileHandler = stdout) const
 //!
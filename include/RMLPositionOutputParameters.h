@@ -51,6 +51,7 @@
 
 
 #include <RMLOutputParameters.h>
+#include <RMLEncoderOutputStage.h>
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -63,7 +64,11 @@
 //! \details
 //! The class RMLPositionOutputParameters is derived from the class
 //! RMLOutputParameters and constitutes a part of the interface for the
-//! position-based On-Line Trajectory Generation algorithm.
+//! position-based On-Line Trajectory Generation algorithm.\n
+//! \n
+//! Optionally, an RMLEncoderOutputStage can be attached, which writes the
+//! new position values as integer encoder counts into a caller-owned
+//! buffer (cf. RMLPositionOutputParameters::SetEncoderOutputStage()).
 //!
 //! \sa ReflexxesAPI
 //! \sa RMLOutputParameters
@@ -76,7 +81,7 @@ class RMLPositionOutputParameters : public RMLOutputParameters
 public:
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLPositionOutputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLPositionOutputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource = NULL)
 //!
 //! \brief
 //! Constructor of class RMLPositionOutputParameters
@@ -87,9 +92,16 @@ public:
 //!
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
+//!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
 //  ----------------------------------------------------------
-    RMLPositionOutputParameters(const unsigned int DegreesOfFreedom) : RMLOutputParameters(DegreesOfFreedom)
+    RMLPositionOutputParameters(     const unsigned int  DegreesOfFreedom
+                                 ,   RMLMemoryResource   *MemoryResource =   NULL) : RMLOutputParameters(DegreesOfFreedom, MemoryResource)
     {
+        this->EncoderOutputStage    =   NULL;
     }
 
 
@@ -105,12 +117,35 @@ public:
 //!
 //! \param OP
 //! Object to be copied
+//!
+//! \note
+//! The encoder output stage of \c OP is not attached to the new object
+//! (cf. RMLPositionOutputParameters::SetEncoderOutputStage()).
 //  ----------------------------------------------------------
     RMLPositionOutputParameters(const RMLPositionOutputParameters &OP) : RMLOutputParameters(OP)
     {
+        this->EncoderOutputStage    =   NULL;
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionOutputParameters(RMLPositionOutputParameters &&OP)
+//!
+//! \brief
+//! Move constructor, transfers the vector objects of \c OP without
+//! allocating memory (cf. RMLOutputParameters::RMLOutputParameters(RMLOutputParameters &&OP))
+//!
+//! \param OP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLPositionOutputParameters(RMLPositionOutputParameters &&OP) RML_NOEXCEPT : RMLOutputParameters(static_cast<RMLOutputParameters&&>(OP))
+    {
+        this->EncoderOutputStage    =   NULL;
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn ~RMLPositionOutputParameters(void)
 //!
@@ -122,6 +157,65 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionOutputParameters &operator = (const RMLPositionOutputParameters &OP)
+//!
+//! \brief
+//! Copy operator
+//!
+//! \details
+//! The attached encoder output stages of both objects remain unchanged.
+//!
+//! \param OP
+//! RMLPositionOutputParameters object to be copied
+//  ----------------------------------------------------------
+    RMLPositionOutputParameters &operator = (const RMLPositionOutputParameters &OP)
+    {
+        RMLOutputParameters::operator=(OP);
+
+        return(*this);
+    }
+
+
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLPositionOutputParameters &operator = (RMLPositionOutputParameters &&OP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLPositionOutputParameters::Swap())
+//!
+//! \param OP
+//! RMLPositionOutputParameters object to be moved
+//  ----------------------------------------------------------
+    RMLPositionOutputParameters &operator = (RMLPositionOutputParameters &&OP) RML_NOEXCEPT
+    {
+        this->Swap(OP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Swap(RMLPositionOutputParameters &OP)
+//!
+//! \brief
+//! Exchanges the contents of two objects without allocating memory or
+//! copying values (cf. RMLOutputParameters::Swap())
+//!
+//! \details
+//! The attached encoder output stages are not exchanged.
+//!
+//! \param OP
+//! RMLPositionOutputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    void Swap(RMLPositionOutputParameters &OP) RML_NOEXCEPT
+    {
+        RMLOutputParameters::Swap(OP);
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void Echo(FILE* FileHandler = stdout) const
 //!
@@ -144,6 +238,74 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void SetEncoderOutputStage(RMLEncoderOutputStage *Stage)
+//!
+//! \brief
+//! Attaches an encoder output stage to this object
+//!
+//! \details
+//! ReflexxesAPI::RMLPosition() calls
+//! RMLPositionOutputParameters::WriteEncoderCounts() right after it has
+//! written the new state of motion into this object, such that the
+//! counts are written into the buffer of the stage in the same call. The
+//! stage is owned by the caller and is only attached to this object; it
+//! is neither copied nor exchanged with other objects.
+//!
+//! \param Stage
+//! Encoder output stage with the same number of degrees of freedom or
+//! \c NULL to detach the current stage
+//!
+//! \sa RMLEncoderOutputStage
+//  ----------------------------------------------------------
+    inline void SetEncoderOutputStage(RMLEncoderOutputStage *Stage)
+    {
+        this->EncoderOutputStage    =   Stage;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline RMLEncoderOutputStage *GetEncoderOutputStage(void) const
+//!
+//! \brief
+//! Returns the attached encoder output stage or \c NULL
+//  ----------------------------------------------------------
+    inline RMLEncoderOutputStage *GetEncoderOutputStage(void) const
+    {
+        return(this->EncoderOutputStage);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void WriteEncoderCounts(void) const
+//!
+//! \brief
+//! Writes the new position values as encoder counts into the buffer of
+//! the attached encoder output stage, if any
+//!
+//! \sa RMLEncoderOutputStage::WriteCounts()
+//  ----------------------------------------------------------
+    inline void WriteEncoderCounts(void) const
+    {
+        if (this->EncoderOutputStage != NULL)
+        {
+            this->EncoderOutputStage->WriteCounts(*(this->NewPositionVector));
+        }
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLEncoderOutputStage *EncoderOutputStage
+//!
+//! \brief
+//! Attached encoder output stage or \c NULL
+//  ----------------------------------------------------------
+    RMLEncoderOutputStage       *EncoderOutputStage;
+
+
 };// class RMLPositionOutputParameters
 
 
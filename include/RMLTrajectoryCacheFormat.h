@@ -0,0 +1,275 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLTrajectoryCacheFormat.h
+//!
+//! \brief
+//! Definition of the memory-mappable trajectory cache file format
+//!
+//! \details
+//! A trajectory cache file consists of a fixed-size
+//! RMLTrajectoryCacheHeader followed by equally sized records. Each
+//! record contains one trajectory of the position-based algorithm
+//! together with the quantized input values it was calculated for (cf.
+//! TypeIIRMLMath::TrajectoryCacheEntry). The records are sorted by their
+//! hash values, such that they can be looked up by a binary search
+//! directly in the mapped file.
+//!
+//! \sa TypeIIRMLPosition::WriteTrajectoryCacheFile()
+//! \sa TypeIIRMLPosition::MapTrajectoryCacheFile()
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLTrajectoryCacheFormat__
+#define __RMLTrajectoryCacheFormat__
+
+
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_MAGIC_NUMBER
+//!
+//! \brief
+//! Eight-byte identifier at the beginning of every trajectory cache file
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_MAGIC_NUMBER           "RMLIITRC"
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_FORMAT_VERSION
+//!
+//! \brief
+//! Version of the trajectory cache file format
+//!
+//! \details
+//! This value has to be increased whenever the layout of
+//! RMLTrajectoryCacheHeader or RMLTrajectoryCacheRecordHeader, the
+//! order of the data blocks of a record (cf.
+//! RMLTrajectoryCacheRecordSize()), or the meaning of the key values
+//! changes.
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_FORMAT_VERSION         2
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_ENDIANNESS_TAG
+//!
+//! \brief
+//! Value written into RMLTrajectoryCacheHeader::EndiannessTag to detect
+//! files that were written on a machine with a different byte order
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_ENDIANNESS_TAG         0x01020304
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_ALIGNMENT
+//!
+//! \brief
+//! Size of the header and alignment of all records in bytes
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_ALIGNMENT              128
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_LIBRARY_VERSION
+//!
+//! \brief
+//! Version string of the library that is written into every trajectory
+//! cache file
+//!
+//! \details
+//! Files of other library versions are rejected, because their
+//! trajectories may differ from the ones this version calculates.
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_LIBRARY_VERSION        "1.2.7"
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_TEMPORARY_SUFFIX
+//!
+//! \brief
+//! Suffix of the name of the temporary file, which
+//! TypeIIRMLPosition::WriteTrajectoryCacheFile() writes before it is
+//! renamed
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_TEMPORARY_SUFFIX       ".tmp"
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL
+//!
+//! \brief
+//! Number of \c double values per polynomial segment of a record
+//!
+//! \details
+//! The end time of the segment (cf.
+//! TypeIIRMLMath::MotionPolynomials::PolynomialTimes) followed by the
+//! coefficients \f$ a_2,\,a_1,\,a_0 \f$ and the time shift \f$ \Delta T \f$
+//! of the position, velocity, and acceleration polynomial.
+//  ----------------------------------------------------------
+#define RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL  13
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLTrajectoryCacheHeader
+//!
+//! \brief
+//! Fixed-size header at the beginning of a trajectory cache file
+//!
+//! \details
+//! The header occupies the first RML_TRAJECTORY_CACHE_ALIGNMENT bytes of
+//! the file. All values are stored in the native byte order of the
+//! writing machine; RMLTrajectoryCacheHeader::EndiannessTag lets readers
+//! detect a mismatch.
+//  ----------------------------------------------------------
+struct RMLTrajectoryCacheHeader
+{
+    //! \brief Contains RML_TRAJECTORY_CACHE_MAGIC_NUMBER (without terminating zero)
+    char                            MagicNumber[8]              ;
+    //! \brief RML_TRAJECTORY_CACHE_FORMAT_VERSION of the writer
+    unsigned int                    FormatVersion               ;
+    //! \brief RML_TRAJECTORY_CACHE_ENDIANNESS_TAG in the byte order of the writer
+    unsigned int                    EndiannessTag               ;
+    //! \brief Size of the header in bytes
+    unsigned int                    HeaderSize                  ;
+    //! \brief Size of one record in bytes (multiple of RML_TRAJECTORY_CACHE_ALIGNMENT)
+    unsigned int                    RecordSize                  ;
+    //! \brief Maximum number of degrees of freedom of a record
+    unsigned int                    NumberOfDOFs                ;
+    //! \brief Maximum number of polynomial segments per degree of freedom
+    //! (cf. MAXIMAL_NO_OF_POLYNOMIALS)
+    unsigned int                    MaximalNumberOfPolynomials  ;
+    //! \brief Number of records in the file
+    unsigned long long              NumberOfRecords             ;
+    //! \brief Resolution of the key values (cf.
+    //! TypeIIRMLPosition::SetTrajectoryCache())
+    double                          Resolution                  ;
+    //! \brief Zero-terminated RML_TRAJECTORY_CACHE_LIBRARY_VERSION of the writer
+    char                            LibraryVersion[16]          ;
+    //! \brief Unused, set to zero
+    unsigned char                   Reserved[64]                ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLTrajectoryCacheRecordHeader
+//!
+//! \brief
+//! Fixed-size part at the beginning of each record of a trajectory cache
+//! file
+//!
+//! \details
+//! The record header is followed by the data blocks (cf.
+//! RMLTrajectoryCacheRecordSize()). RMLTrajectoryCacheRecordHeader::Checksum
+//! is calculated over RML_TRAJECTORY_CACHE_LIBRARY_VERSION and all
+//! remaining bytes of the record, such that records of another library
+//! version or damaged records are detected.
+//  ----------------------------------------------------------
+struct RMLTrajectoryCacheRecordHeader
+{
+    //! \brief Checksum of the library version and the record
+    unsigned long long              Checksum                            ;
+    //! \brief Hash value of the key values (cf.
+    //! TypeIIRMLMath::TrajectoryCacheEntry::HashValue); records are sorted
+    //! by this value
+    unsigned int                    HashValue                           ;
+    //! \brief Number of degrees of freedom of the trajectory
+    unsigned int                    NumberOfDOFs                        ;
+    //! \brief RMLFlags::SynchronizationBehavior
+    int                             SynchronizationBehavior             ;
+    //! \brief TypeIIRMLPosition::GreatestDOFForPhaseSynchronization
+    unsigned int                    GreatestDOFForPhaseSynchronization  ;
+    //! \brief Cycle time, for which the trajectory was calculated
+    double                          CycleTime                           ;
+    //! \brief Quantized RMLInputParameters::MinimumSynchronizationTime
+    double                          MinimumSynchronizationTime          ;
+    //! \brief TypeIIRMLPosition::SynchronizationTime
+    double                          SynchronizationTime                 ;
+    //! \brief TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized
+    unsigned char                   IsPhaseSynchronized                 ;
+    //! \brief Unused, set to zero
+    unsigned char                   Reserved[15]                        ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline size_t RMLTrajectoryCacheRecordSize(const unsigned int &NumberOfDOFs, const unsigned int &MaximalNumberOfPolynomials)
+//!
+//! \brief
+//! Calculates the size of one record in bytes
+//!
+//! \details
+//! With \f$ K \f$ degrees of freedom and \f$ L \f$ polynomial segments
+//! per degree of freedom, the record header is followed by
+//!
+//!  - \f$ 5\,K \f$ quantized key values (cf.
+//!    TRAJECTORY_CACHE_KEY_VALUES_PER_DOF),
+//!  - \f$ K \f$ current position values, for which the position
+//!    polynomials were calculated,
+//!  - \f$ K \f$ minimum execution times,
+//!  - \f$ 13\,K\,L \f$ polynomial values (cf.
+//!    RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL),
+//!  - \f$ K \f$ bytes for the selection vector,
+//!  - \f$ K \f$ bytes for the modified selection vector,
+//!  - \f$ K \f$ bytes for the numbers of valid polynomials, and
+//!  - \f$ K \f$ bytes for the Step 1A profiles.
+//!
+//! \param NumberOfDOFs
+//! Maximum number of degrees of freedom of a record
+//!
+//! \param MaximalNumberOfPolynomials
+//! Maximum number of polynomial segments per degree of freedom
+//!
+//! \return
+//! The size of one record including padding to
+//! RML_TRAJECTORY_CACHE_ALIGNMENT
+//  ----------------------------------------------------------
+inline size_t RMLTrajectoryCacheRecordSize(     const unsigned int  &NumberOfDOFs
+                                            ,   const unsigned int  &MaximalNumberOfPolynomials )
+{
+    size_t      Size    =       sizeof(RMLTrajectoryCacheRecordHeader)
+                            +   (size_t)NumberOfDOFs * (    5 + 1 + 1
+                                                        +   RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL * MaximalNumberOfPolynomials ) * sizeof(double)
+                            +   (size_t)NumberOfDOFs * 4 * sizeof(unsigned char);
+
+    return(     ((Size + RML_TRAJECTORY_CACHE_ALIGNMENT - 1) / RML_TRAJECTORY_CACHE_ALIGNMENT)
+            *   RML_TRAJECTORY_CACHE_ALIGNMENT  );
+}
+
+
+// Compile-time checks of the file layout
+typedef char RMLTrajectoryCacheHeaderSizeCheck          [(sizeof(RMLTrajectoryCacheHeader)          == RML_TRAJECTORY_CACHE_ALIGNMENT)  ?   1   :   -1];
+typedef char RMLTrajectoryCacheRecordHeaderSizeCheck    [(sizeof(RMLTrajectoryCacheRecordHeader)    == 64)                              ?   1   :   -1];
+
+
+#endif
@@ -0,0 +1,393 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLValidityMask.h
+//!
+//! \brief
+//! Header file for the class RMLValidityMask
+//!
+//! \details
+//! Per-degree-of-freedom result of the validity check of input values
+//! (cf. RMLPositionInputParameters::CheckForValidity() and
+//! RMLVelocityInputParameters::CheckForValidity()).
+//!
+//! \sa RMLPositionInputParameters.h
+//! \sa RMLVelocityInputParameters.h
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __RMLValidityMask__
+#define __RMLValidityMask__
+
+
+#include <RMLMemoryResource.h>
+#include <string.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class RMLValidityMask
+//!
+//! \brief
+//! Result of the methods RMLPositionInputParameters::CheckForValidity(RMLValidityMask*) const
+//! and RMLVelocityInputParameters::CheckForValidity(RMLValidityMask*) const
+//!
+//! \details
+//! For each failure reason (cf. RMLValidityMask::FailureReasonEnum), an
+//! object of this class contains one bit per degree of freedom, which is
+//! set if the respective input values of this degree of freedom violate
+//! the requirement. The bits are stored in words of 32 bits, that is,
+//! degree of freedom \f$ k \f$ is represented by bit \f$ k \bmod 32 \f$ of
+//! word \f$ \lfloor k / 32 \rfloor \f$. A supervising application can
+//! thus determine the faulty degrees of freedom without checking the
+//! input values again.\n
+//! \n
+//! Memory is only allocated by the constructor, such that an object can be
+//! created once and reused in every control cycle.
+//!
+//! \sa RMLPositionInputParameters::CheckForValidity(RMLValidityMask*) const
+//! \sa RMLVelocityInputParameters::CheckForValidity(RMLValidityMask*) const
+//  ----------------------------------------------------------
+class RMLValidityMask : public RMLMemoryObject
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum FailureReasonEnum
+//!
+//! \brief
+//! Failure reasons reported by the validity check; the values can be
+//! combined bitwise
+//  ----------------------------------------------------------
+    enum FailureReasonEnum
+    {
+        //! \brief The maximum velocity is not positive (position-based
+        //! algorithm only)
+        MAX_VELOCITY_NOT_POSITIVE               =   0x01,
+        //! \brief The maximum acceleration is not positive
+        MAX_ACCELERATION_NOT_POSITIVE           =   0x02,
+        //! \brief The absolute value of the target velocity is greater than
+        //! the maximum velocity (position-based algorithm only)
+        TARGET_VELOCITY_EXCEEDS_MAX_VELOCITY    =   0x04,
+        //! \brief The input values of a degree of freedom span more orders of
+        //! magnitude than permitted by
+        //! RMLPositionInputParameters::MAXIMUM_MAGNITUDE_RANGE or
+        //! RMLVelocityInputParameters::MAXIMUM_MAGNITUDE_RANGE
+        MAGNITUDE_RANGE_EXCEEDED                =   0x08,
+        //! \brief The minimum synchronization time is greater than
+        //! \f$ 10^{10} \f$ seconds; this reason does not refer to a
+        //! particular degree of freedom
+        MIN_SYNCHRONIZATION_TIME_TOO_BIG        =   0x10
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum MaskProperties
+//!
+//! \brief
+//! Layout of the masks
+//  ----------------------------------------------------------
+    enum MaskProperties
+    {
+        //! \brief Number of degrees of freedom represented by one word
+        BITS_PER_WORD                           =   32,
+        //! \brief Number of failure reasons that refer to particular degrees
+        //! of freedom
+        NUMBER_OF_DOF_FAILURE_REASONS           =   4
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLValidityMask(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Constructor of the class RMLValidityMask
+//!
+//! \warning
+//! The constructor is \b not real-time capable as heap memory has to be
+//! allocated.
+//!
+//! \param DegreesOfFreedom
+//! Specifies the number of degrees of freedom
+//  ----------------------------------------------------------
+    RMLValidityMask(const unsigned int &DegreesOfFreedom)
+    {
+        this->NumberOfDOFs      =   DegreesOfFreedom;
+        this->NumberOfWords     =   (DegreesOfFreedom + RMLValidityMask::BITS_PER_WORD - 1) / RMLValidityMask::BITS_PER_WORD;
+        this->Masks             =   (unsigned int*)RMLMemoryResource::AllocateObject((RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS * this->NumberOfWords + 1) * sizeof(unsigned int));
+
+        this->Clear();
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLValidityMask(const RMLValidityMask &Mask)
+//!
+//! \brief
+//! Copy constructor of class RMLValidityMask
+//!
+//! \warning
+//! The constructor is \b not real-time capable as heap memory has to be
+//! allocated.
+//!
+//! \param Mask
+//! Object to be copied
+//  ----------------------------------------------------------
+    RMLValidityMask(const RMLValidityMask &Mask)
+    {
+        this->NumberOfDOFs      =   Mask.NumberOfDOFs;
+        this->NumberOfWords     =   Mask.NumberOfWords;
+        this->FailureReasons    =   Mask.FailureReasons;
+        this->Masks             =   (unsigned int*)RMLMemoryResource::AllocateObject((RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS * this->NumberOfWords + 1) * sizeof(unsigned int));
+
+        memcpy(     this->Masks
+                ,   Mask.Masks
+                ,   (RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS * this->NumberOfWords + 1) * sizeof(unsigned int));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~RMLValidityMask(void)
+//!
+//! \brief
+//! Destructor of class RMLValidityMask
+//  ----------------------------------------------------------
+    ~RMLValidityMask(void)
+    {
+        RMLMemoryResource::FreeObject(this->Masks);
+
+        this->Masks =   NULL;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLValidityMask &operator = (const RMLValidityMask &Mask)
+//!
+//! \brief
+//! Copy operator, the number of degrees of freedom of both objects has to
+//! be equal
+//!
+//! \param Mask
+//! Object to be copied
+//  ----------------------------------------------------------
+    RMLValidityMask &operator = (const RMLValidityMask &Mask)
+    {
+        if (this->NumberOfWords == Mask.NumberOfWords)
+        {
+            this->FailureReasons    =   Mask.FailureReasons;
+
+            memcpy(     this->Masks
+                    ,   Mask.Masks
+                    ,   (RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS * this->NumberOfWords + 1) * sizeof(unsigned int));
+        }
+
+        return(*this);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Clear(void)
+//!
+//! \brief
+//! Resets all bits
+//  ----------------------------------------------------------
+    inline void Clear(void)
+    {
+        this->FailureReasons    =   0;
+
+        memset(     this->Masks
+                ,   0x0
+                ,   (RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS * this->NumberOfWords + 1) * sizeof(unsigned int));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsValid(void) const
+//!
+//! \brief
+//! Returns \c true if no failure was detected
+//  ----------------------------------------------------------
+    inline bool IsValid(void) const
+    {
+        return(this->FailureReasons == 0);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetFailureReasons(void) const
+//!
+//! \brief
+//! Returns the combination of all failure reasons that were detected for
+//! at least one degree of freedom (cf. RMLValidityMask::FailureReasonEnum)
+//  ----------------------------------------------------------
+    inline unsigned int GetFailureReasons(void) const
+    {
+        return(this->FailureReasons);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetFailureReasons(const unsigned int &DOF) const
+//!
+//! \brief
+//! Returns the combination of all failure reasons that were detected for
+//! the degree of freedom \c DOF
+//  ----------------------------------------------------------
+    inline unsigned int GetFailureReasons(const unsigned int &DOF) const
+    {
+        unsigned int    i               =   0
+                    ,   Result          =   0;
+
+        if (DOF >= this->NumberOfDOFs)
+        {
+            return(0);
+        }
+
+        for (i = 0; i < RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS; i++)
+        {
+            if ((this->Masks[i * this->NumberOfWords + DOF / RMLValidityMask::BITS_PER_WORD] >> (DOF % RMLValidityMask::BITS_PER_WORD)) & 0x1)
+            {
+                Result  |=  (0x1 << i);
+            }
+        }
+
+        return(Result);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline const unsigned int *GetMask(const FailureReasonEnum &Reason) const
+//!
+//! \brief
+//! Returns a pointer to the RMLValidityMask::GetNumberOfWords() words that
+//! contain one bit per degree of freedom for the failure reason
+//! \c Reason
+//!
+//! \return
+//! \c NULL, if \c Reason does not refer to particular degrees of freedom
+//  ----------------------------------------------------------
+    inline const unsigned int *GetMask(const FailureReasonEnum &Reason) const
+    {
+        unsigned int    i   =   0;
+
+        for (i = 0; i < RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS; i++)
+        {
+            if ((unsigned int)Reason == (0x1u << i))
+            {
+                return(this->Masks + i * this->NumberOfWords);
+            }
+        }
+
+        return(NULL);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int *GetMask(const FailureReasonEnum &Reason)
+//!
+//! \brief
+//! \copybrief GetMask(const FailureReasonEnum &Reason) const
+//  ----------------------------------------------------------
+    inline unsigned int *GetMask(const FailureReasonEnum &Reason)
+    {
+        return(const_cast<unsigned int*>(static_cast<const RMLValidityMask*>(this)->GetMask(Reason)));
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfWords(void) const
+//!
+//! \brief
+//! Returns the number of words per failure reason
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfWords(void) const
+    {
+        return(this->NumberOfWords);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the number of degrees of freedom
+//  ----------------------------------------------------------
+    inline unsigned int GetNumberOfDOFs(void) const
+    {
+        return(this->NumberOfDOFs);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int FailureReasons
+//!
+//! \brief
+//! Combination of all detected failure reasons
+//  ----------------------------------------------------------
+    unsigned int        FailureReasons;
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfDOFs
+//!
+//! \brief
+//! Number of degrees of freedom
+//  ----------------------------------------------------------
+    unsigned int        NumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfWords
+//!
+//! \brief
+//! Number of words per failure reason
+//  ----------------------------------------------------------
+    unsigned int        NumberOfWords;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int *Masks
+//!
+//! \brief
+//! RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS consecutive masks of
+//! RMLValidityMask::NumberOfWords words each (plus one word, such that
+//! the array is never empty)
+//  ----------------------------------------------------------
+    unsigned int        *Masks;
+
+};  // class RMLValidityMask
+
+
+#endif
@@ -53,8 +53,61 @@
 #define __RMLVector__
 
 
+#include <RMLMemoryResource.h>
 #include <string.h>
 
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_HAS_MOVE_SEMANTICS
+//!
+//! \brief
+//! Defined if the compiler supports rvalue references, in which case the
+//! classes RMLVector, RMLInputParameters, RMLOutputParameters, and their
+//! derived classes provide move constructors and move assignment
+//! operators
+//!
+//! \details
+//! The library itself only requires C++98, and all classes provide the
+//! method \c Swap(), which exchanges the contents of two objects
+//! in \f$ O(1) \f$ without allocating memory, for all compilers.
+//  ----------------------------------------------------------
+#if !defined(RML_HAS_MOVE_SEMANTICS)
+#if (defined(__cplusplus) && (__cplusplus >= 201103L)) || (defined(_MSC_VER) && (_MSC_VER >= 1600))
+#define RML_HAS_MOVE_SEMANTICS
+#endif
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_NOEXCEPT
+//!
+//! \brief
+//! Exception specification of the move and swap operations, such that
+//! standard containers move instead of copy their elements
+//  ----------------------------------------------------------
+#if (defined(__cplusplus) && (__cplusplus >= 201103L)) || (defined(_MSC_VER) && (_MSC_VER >= 1900))
+#define RML_NOEXCEPT    noexcept
+#else
+#define RML_NOEXCEPT    throw()
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn template <class T> inline void RMLSwap(T &A, T &B)
+//!
+//! \brief
+//! Exchanges two values of a built-in type (e.g., two pointers); used by
+//! the \c Swap() methods of the parameter classes
+//  ----------------------------------------------------------
+template <class T>
+inline void RMLSwap(T &A, T &B)
+{
+    T   Temp    =   A       ;
+
+    A           =   B       ;
+    B           =   Temp    ;
+}
+
 //  ---------------------- Doxygen info ----------------------
 //! \class RMLVector
 //!
@@ -69,12 +122,18 @@
 //! RMLVector objects are of the same size. Ensure that only
 //! RMLVector objects of equal size are used.
 //!
+//! \note
+//! A vector may also be a non-owning \em view on external memory, for
+//! instance, on the process image of a fieldbus. In this case, all
+//! methods directly operate on this memory, and no values are copied
+//! between the external memory and the vector (cf. RMLVector::Attach()).
+//!
 //! \sa RMLDoubleVector
 //! \sa RMLIntVector
 //! \sa RMLBoolVector
 //  ----------------------------------------------------------
 template <class T = double>
-class RMLVector
+class RMLVector : public RMLMemoryObject
 {
 public:
 
@@ -94,11 +153,44 @@ public:
     RMLVector(const RMLVector<T> &Vector)
     {
         this->VectorDimension       =   Vector.GetVecDim()              ;
-        this->VecData               =   new T[this->VectorDimension]    ;
+        this->VectorCapacity        =   this->VectorDimension           ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                 ;
         *this                       =   Vector                          ;
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVector(RMLVector<T> &&Vector)
+//!
+//! \brief
+//! Move constructor of class RMLVector
+//!
+//! \details
+//! The memory of \c Vector is transferred without allocating memory
+//! or copying values. Afterwards, \c Vector has a dimension of zero and
+//! may only be destroyed, assigned by the move assignment operator, or
+//! swapped.
+//!
+//! \param Vector
+//! Original object reference
+//  ----------------------------------------------------------
+    RMLVector(RMLVector<T> &&Vector) RML_NOEXCEPT
+    {
+        this->VectorDimension       =   Vector.VectorDimension          ;
+        this->VectorCapacity        =   Vector.VectorCapacity           ;
+        this->OwnedData             =   Vector.OwnedData                ;
+        this->VecData               =   Vector.VecData                  ;
+
+        Vector.VectorDimension      =   0                               ;
+        Vector.VectorCapacity       =   0                               ;
+        Vector.OwnedData            =   NULL                            ;
+        Vector.VecData              =   NULL                            ;
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn RMLVector(const unsigned int Size)
 //!
@@ -117,7 +209,9 @@ public:
     {
 
         this->VectorDimension       =   Size                            ;
-        this->VecData               =   new T[this->VectorDimension]    ;
+        this->VectorCapacity        =   this->VectorDimension           ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                 ;
 
         memset(     this->VecData
                 ,   0x0
@@ -125,6 +219,39 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVector(T *ExternalData, const unsigned int Size)
+//!
+//! \brief
+//! Constructor of class RMLVector, creates a \em view on an existing
+//! array of \c Size elements
+//!
+//! \details
+//! The vector does not allocate any memory and does not own
+//! \c ExternalData, that is, all read and write accesses (including the
+//! copy operator) directly operate on the external memory, which has
+//! to remain valid during the lifetime of the vector (e.g., the process
+//! image of a fieldbus or a shared memory segment).
+//!
+//! \param ExternalData
+//! Pointer to an array of at least \c Size elements
+//!
+//! \param Size
+//! Determines the number of vector elements
+//!
+//! \sa RMLVector::Attach()
+//! \sa RMLVector::IsView()
+//  ----------------------------------------------------------
+    RMLVector(      T                   *ExternalData
+                ,   const unsigned int  Size            )
+    {
+        this->VectorDimension       =   Size                            ;
+        this->VectorCapacity        =   this->VectorDimension           ;
+        this->OwnedData             =   NULL                            ;
+        this->VecData               =   ExternalData                    ;
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn RMLVector(const T &Component0, const T &Component1)
 //!
@@ -145,7 +272,9 @@ public:
                 ,   const T &Component1 )
     {
         this->VectorDimension       =   2                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -176,7 +305,9 @@ public:
                 ,   const T &Component2 )
     {
         this->VectorDimension       =   3                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -212,7 +343,9 @@ public:
                 ,   const T &Component3 )
     {
         this->VectorDimension       =   4                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -252,7 +385,9 @@ public:
                 ,   const T &Component4 )
     {
         this->VectorDimension       =   5                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -298,7 +433,9 @@ public:
                 ,   const T &Component5 )
     {
         this->VectorDimension       =   6                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -349,7 +486,9 @@ public:
                 ,   const T &Component6 )
     {
         this->VectorDimension       =   7                                   ;
-        this->VecData               =   (T*) new T[this->VectorDimension]   ;
+        this->VectorCapacity        =   this->VectorDimension               ;
+        this->OwnedData             =   (T*)RMLMemoryResource::AllocateObject(this->VectorDimension * sizeof(T))  ;
+        this->VecData               =   this->OwnedData                     ;
 
         this->VecData[0]            =   Component0                          ;
         this->VecData[1]            =   Component1                          ;
@@ -369,7 +508,73 @@ public:
 //  ----------------------------------------------------------
     ~RMLVector(void)
     {
-        delete[] this->VecData;
+        RMLMemoryResource::FreeObject(this->OwnedData);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Attach(T *ExternalData)
+//!
+//! \brief
+//! Binds the vector to an existing array, such that the vector becomes a
+//! \em view on external memory
+//!
+//! \details
+//! No memory is allocated or released, and no values are copied, so this
+//! method is real-time capable. Subsequent read and write accesses
+//! directly operate on \c ExternalData, which has to contain at least
+//! RMLVector::GetVecDim() elements and has to remain valid until the
+//! vector is detached or destroyed. The memory that is owned by the
+//! vector is kept, such that RMLVector::Detach() can restore it.
+//!
+//! \param ExternalData
+//! Pointer to an array of at least RMLVector::GetVecDim() elements
+//!
+//! \sa RMLVector::Detach()
+//! \sa RMLVector::IsView()
+//  ----------------------------------------------------------
+    inline void Attach(T *ExternalData)
+    {
+        this->VecData   =   ExternalData;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Detach(void)
+//!
+//! \brief
+//! Binds the vector back to its own memory after a call of
+//! RMLVector::Attach()
+//!
+//! \details
+//! The values of the external array are \em not copied. Vectors that were
+//! created by the constructor RMLVector(T *ExternalData, const unsigned int Size)
+//! do not own any memory, and for them, this method has no effect.
+//!
+//! \sa RMLVector::Attach()
+//  ----------------------------------------------------------
+    inline void Detach(void)
+    {
+        if (this->OwnedData != NULL)
+        {
+            this->VecData   =   this->OwnedData;
+        }
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool IsView(void) const
+//!
+//! \brief
+//! Indicates whether the vector operates on external memory
+//!
+//! \return
+//! \c true if the vector data is located in external memory and \c false
+//! if the vector uses its own memory
+//  ----------------------------------------------------------
+    inline bool IsView(void) const
+    {
+        return(this->VecData != this->OwnedData);
     }
 
 
@@ -398,11 +603,21 @@ public:
 //! \brief
 //! Copy operator
 //!
+//! \details
+//! The values are copied into the memory the vector currently refers to,
+//! which is external memory in case of a view (cf. RMLVector::Attach()).
+//! If both vectors refer to the same memory, nothing is copied.
+//!
 //! \param Vector
 //! Vector object to be copied
 //  ----------------------------------------------------------
     inline RMLVector &operator = (const RMLVector<T>& Vector)
     {
+        if (this->VecData == Vector.VecData)
+        {
+            return(*this);
+        }
+
         memcpy(     (void*)(this->VecData)
                 ,   (void*)(Vector.VecData)
                 ,   (this->VectorDimension * sizeof(T)) );
@@ -411,6 +626,51 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline RMLVector &operator = (RMLVector<T> &&Vector)
+//!
+//! \brief
+//! Move assignment operator
+//!
+//! \details
+//! Unlike the copy operator, this operator does not copy any values,
+//! but exchanges the memory of both objects (cf. RMLVector::Swap()).
+//!
+//! \param Vector
+//! Vector object to be moved
+//  ----------------------------------------------------------
+    inline RMLVector &operator = (RMLVector<T> &&Vector) RML_NOEXCEPT
+    {
+        this->Swap(Vector);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Swap(RMLVector<T> &Vector)
+//!
+//! \brief
+//! Exchanges the memory and the dimensions of two vectors
+//!
+//! \details
+//! No memory is allocated, and no values are copied. Views (cf.
+//! RMLVector::Attach()) remain views on the same external memory.
+//!
+//! \param Vector
+//! Vector object to be exchanged with this one
+//  ----------------------------------------------------------
+    inline void Swap(RMLVector<T> &Vector) RML_NOEXCEPT
+    {
+        RMLSwap(this->VectorDimension   , Vector.VectorDimension    );
+        RMLSwap(this->VectorCapacity    , Vector.VectorCapacity     );
+        RMLSwap(this->OwnedData         , Vector.OwnedData          );
+        RMLSwap(this->VecData           , Vector.VecData            );
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn inline T& operator [] (const int Index)
 //!
@@ -499,6 +759,54 @@ public:
         return(this->VectorDimension);
     }
 
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetVecCapacity(void) const
+//!
+//! \brief
+//! Returns the number of elements, for which memory is available
+//!
+//! \return
+//! The dimension passed to the constructor
+//!
+//! \sa RMLVector::SetVecDim()
+//  ----------------------------------------------------------
+    inline unsigned int GetVecCapacity(void) const
+    {
+        return(this->VectorCapacity);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool SetVecDim(const unsigned int &Dimension)
+//!
+//! \brief
+//! Changes the dimension of the vector without reallocating memory
+//!
+//! \details
+//! The elements that remain part of the vector keep their values, and
+//! elements that are added again keep the values they had before. This
+//! method is real-time capable.
+//!
+//! \param Dimension
+//! New dimension of the vector
+//!
+//! \return
+//! \c false, if \c Dimension exceeds RMLVector::GetVecCapacity(); the
+//! vector remains unchanged in this case.
+//  ----------------------------------------------------------
+    inline bool SetVecDim(const unsigned int &Dimension)
+    {
+        if (Dimension > this->VectorCapacity)
+        {
+            return(false);
+        }
+
+        this->VectorDimension   =   Dimension;
+
+        return(true);
+    }
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn inline T* GetReference(void) const
 //!
@@ -520,6 +828,10 @@ public:
 //! \brief
 //! Pointer to the actual vector data, that is, an array of type \c T
 //! objects
+//!
+//! \details
+//! This pointer either equals RMLVector::OwnedData or refers to external
+//! memory (cf. RMLVector::Attach()).
 //  ----------------------------------------------------------
     T               *VecData;
 
@@ -533,6 +845,29 @@ public:
     unsigned int    VectorDimension;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int VectorCapacity
+//!
+//! \brief
+//! Contains the number of vector elements, for which memory is available
+//!
+//! \sa RMLVector::SetVecDim()
+//  ----------------------------------------------------------
+    unsigned int    VectorCapacity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var T *OwnedData
+//!
+//! \brief
+//! Pointer to the array that was allocated by the vector itself and that
+//! is released by the destructor; \c NULL for vectors created as views
+//!
+//! \sa RMLVector::Attach()
+//  ----------------------------------------------------------
+    T               *OwnedData;
+
+
 
 };  // class RMLVector
 
@@ -51,6 +51,7 @@
 
 
 #include <RMLInputParameters.h>
+#include <RMLValidityMask.h>
 #include <math.h>
 
 
@@ -80,7 +81,7 @@ public:
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLVelocityInputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLVelocityInputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource = NULL)
 //!
 //! \brief
 //! Constructor of class RMLVelocityInputParameters
@@ -91,8 +92,14 @@ public:
 //!
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
+//!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
 //  ----------------------------------------------------------
-    RMLVelocityInputParameters(const unsigned int DegreesOfFreedom) : RMLInputParameters(DegreesOfFreedom)
+    RMLVelocityInputParameters(     const unsigned int  DegreesOfFreedom
+                                ,   RMLMemoryResource   *MemoryResource =   NULL) : RMLInputParameters(DegreesOfFreedom, MemoryResource)
     {
     }
 
@@ -115,6 +122,23 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVelocityInputParameters(RMLVelocityInputParameters &&IP)
+//!
+//! \brief
+//! Move constructor, transfers the vector objects of \c IP without
+//! allocating memory (cf. RMLInputParameters::RMLInputParameters(RMLInputParameters &&IP))
+//!
+//! \param IP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLVelocityInputParameters(RMLVelocityInputParameters &&IP) RML_NOEXCEPT : RMLInputParameters(static_cast<RMLInputParameters&&>(IP))
+    {
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn ~RMLVelocityInputParameters(void)
 //!
@@ -143,6 +167,42 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline RMLVelocityInputParameters &operator = (RMLVelocityInputParameters &&IP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLVelocityInputParameters::Swap())
+//!
+//! \param IP
+//! RMLVelocityInputParameters object to be moved
+//  ----------------------------------------------------------
+    inline RMLVelocityInputParameters &operator = (RMLVelocityInputParameters &&IP) RML_NOEXCEPT
+    {
+        this->Swap(IP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Swap(RMLVelocityInputParameters &IP)
+//!
+//! \brief
+//! Exchanges the contents of two objects without allocating memory or
+//! copying values (cf. RMLInputParameters::Swap())
+//!
+//! \param IP
+//! RMLVelocityInputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    inline void Swap(RMLVelocityInputParameters &IP) RML_NOEXCEPT
+    {
+        RMLInputParameters::Swap(IP);
+    }
+
+
 
 // #############################################################################
 
@@ -235,6 +295,44 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned int CheckForValidity(RMLValidityMask *Mask) const
+//!
+//! \brief
+//! Checks the input parameters of all degrees of freedom for validity and
+//! reports the failure reasons per degree of freedom
+//!
+//! \details
+//! Unlike RMLVelocityInputParameters::CheckForValidity(void), all selected
+//! degrees of freedom are checked (two at a time with SSE2 instructions
+//! if available), and the result contains every failure reason that was
+//! detected. In addition to the conditions of
+//! RMLVelocityInputParameters::CheckForValidity(void), the maximum
+//! acceleration has to be positive (cf.
+//! RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE), as the velocity-based
+//! algorithm returns ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES
+//! otherwise. The flag RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED is only
+//! set for degrees of freedom with a positive maximum acceleration.\n
+//! \n
+//! The method does not allocate memory and may be called in every control
+//! cycle.
+//!
+//! \param Mask
+//! Pointer to an RMLValidityMask object, whose bits are set according to
+//! the detected failures. If \c Mask is \c NULL or if its number of
+//! degrees of freedom differs, only the return value is computed.
+//!
+//! \return
+//! Combination of all detected failure reasons
+//! (cf. RMLValidityMask::FailureReasonEnum); zero, if all input values
+//! are valid.
+//!
+//! \sa RMLValidityMask
+//! \sa RMLVelocityInputParameters::CheckForValidity(void) const
+//  ----------------------------------------------------------
+    unsigned int CheckForValidity(RMLValidityMask *Mask) const;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void Echo(FILE* FileHandler = stdout) const
 //!
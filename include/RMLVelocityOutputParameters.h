@@ -76,7 +76,7 @@ class RMLVelocityOutputParameters : public RMLOutputParameters
 public:
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn RMLVelocityOutputParameters(const unsigned int DegreesOfFreedom)
+//! \fn RMLVelocityOutputParameters(const unsigned int DegreesOfFreedom, RMLMemoryResource *MemoryResource = NULL)
 //!
 //! \brief
 //! Constructor of class RMLVelocityOutputParameters
@@ -87,9 +87,17 @@ public:
 //!
 //! \param DegreesOfFreedom
 //! Specifies the number of degrees of freedom
+//!
+//! \param MemoryResource
+//! Memory resource, from which all members are allocated (cf.
+//! RMLMemoryResource). If \c NULL, the members are allocated from the
+//! active resource of the calling thread or from the heap.
 //  ----------------------------------------------------------
-    RMLVelocityOutputParameters(const unsigned int DegreesOfFreedom) : RMLOutputParameters(DegreesOfFreedom)
+    RMLVelocityOutputParameters(     const unsigned int  DegreesOfFreedom
+                                 ,   RMLMemoryResource   *MemoryResource =   NULL) : RMLOutputParameters(DegreesOfFreedom, MemoryResource)
     {
+        RMLMemoryResourceScope  Scope(MemoryResource);
+
         this->PositionValuesAtTargetVelocity    =   new RMLDoubleVector (DegreesOfFreedom)  ;
 
         memset(this->PositionValuesAtTargetVelocity->VecData    ,   0x0 ,       DegreesOfFreedom * sizeof(double))  ;
@@ -117,6 +125,25 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVelocityOutputParameters(RMLVelocityOutputParameters &&OP)
+//!
+//! \brief
+//! Move constructor, transfers the vector objects of \c OP without
+//! allocating memory (cf. RMLOutputParameters::RMLOutputParameters(RMLOutputParameters &&OP))
+//!
+//! \param OP
+//! Object to be moved
+//  ----------------------------------------------------------
+    RMLVelocityOutputParameters(RMLVelocityOutputParameters &&OP) RML_NOEXCEPT : RMLOutputParameters(static_cast<RMLOutputParameters&&>(OP))
+    {
+        this->PositionValuesAtTargetVelocity        =   OP.PositionValuesAtTargetVelocity   ;
+        OP.PositionValuesAtTargetVelocity           =   NULL                                ;
+    }
+#endif
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn ~RMLVelocityOutputParameters(void)
 //!
@@ -150,6 +177,44 @@ public:
     }
 
 
+#if defined(RML_HAS_MOVE_SEMANTICS)
+//  ---------------------- Doxygen info ----------------------
+//! \fn RMLVelocityOutputParameters &operator = (RMLVelocityOutputParameters &&OP)
+//!
+//! \brief
+//! Move assignment operator, exchanges the contents of both objects
+//! (cf. RMLVelocityOutputParameters::Swap())
+//!
+//! \param OP
+//! RMLVelocityOutputParameters object to be moved
+//  ----------------------------------------------------------
+    RMLVelocityOutputParameters &operator = (RMLVelocityOutputParameters &&OP) RML_NOEXCEPT
+    {
+        this->Swap(OP);
+
+        return(*this);
+    }
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Swap(RMLVelocityOutputParameters &OP)
+//!
+//! \brief
+//! Exchanges the contents of two objects without allocating memory or
+//! copying values (cf. RMLOutputParameters::Swap())
+//!
+//! \param OP
+//! RMLVelocityOutputParameters object to be exchanged with this one
+//  ----------------------------------------------------------
+    void Swap(RMLVelocityOutputParameters &OP) RML_NOEXCEPT
+    {
+        RMLOutputParameters::Swap(OP);
+
+        RMLSwap(this->PositionValuesAtTargetVelocity, OP.PositionValuesAtTargetVelocity);
+    }
+
+
 // #############################################################################
 
 
@@ -273,6 +338,28 @@ public:
     }
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! \copybrief RMLOutputParameters::SetNumberOfDOFs()
+//!
+//! \details
+//! \copydetails RMLOutputParameters::SetNumberOfDOFs()
+//  ----------------------------------------------------------
+    bool SetNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+    {
+        if (!RMLOutputParameters::SetNumberOfDOFs(DegreesOfFreedom))
+        {
+            return(false);
+        }
+
+        this->PositionValuesAtTargetVelocity->SetVecDim(DegreesOfFreedom);
+
+        return(true);
+    }
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void Echo(FILE* FileHandler = stdout) const
 //!
@@ -46,10 +46,12 @@
 #include <RMLPositionInputParameters.h>
 #include <RMLPositionOutputParameters.h>
 #include <RMLPositionFlags.h>
+#include <RMLPositionCandidates.h>
 #include <RMLVelocityInputParameters.h>
 #include <RMLVelocityOutputParameters.h>
 #include <RMLVelocityFlags.h>
 #include <RMLVector.h>
+#include <RMLMemoryResource.h>
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -120,12 +122,12 @@
 //! \sa \ref page_TypeIIAndIVOverview
 //! \sa \ref page_ErrorHandling
 //  ----------------------------------------------------------
-class ReflexxesAPI
+class ReflexxesAPI : public RMLMemoryObject
 {
 public:
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn ReflexxesAPI(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds, const unsigned int &NumberOfAdditionalThreads = 0)
+//! \fn ReflexxesAPI(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds, const unsigned int &NumberOfAdditionalThreads = 0, RMLMemoryResource *MemoryResource = NULL, const unsigned int &MaxNumberOfDOFs = 0)
 //!
 //! \brief
 //! Constructor of the API class ReflexxesAPI (API of the Reflexxes Motion
@@ -165,6 +167,23 @@ public:
 //! Library.
 //! \endif
 //!
+//! \param MemoryResource
+//! Memory resource, from which both algorithm objects and all of their
+//! internal objects are allocated (cf. RMLMemoryResource), also those
+//! that are allocated after the construction. If \c NULL, the objects are
+//! allocated from the active resource of the calling thread or from the
+//! heap. To allocate the ReflexxesAPI object itself from the resource, the
+//! resource can be passed to the operator \c new, too
+//! (cf. RMLMemoryObject).
+//!
+//! \param MaxNumberOfDOFs
+//! Specifies the number of degrees of freedom, for which all internal
+//! objects reserve memory, such that the number of degrees of freedom can
+//! be changed later on without reallocating memory
+//! (cf. ReflexxesAPI::Reconfigure()). Values smaller than
+//! \c DegreesOfFreedom (e.g., the default value of zero) are replaced by
+//! \c DegreesOfFreedom.
+//!
 //! \if CUSTOMER
 //! \note
 //! The automatic creation of additional thread is disabled by default. In
@@ -189,7 +208,9 @@ public:
 //  ----------------------------------------------------------
     ReflexxesAPI(       const unsigned int  &DegreesOfFreedom
                     ,   const double        &CycleTimeInSeconds
-                    ,   const unsigned int  &NumberOfAdditionalThreads = 0);
+                    ,   const unsigned int  &NumberOfAdditionalThreads  = 0
+                    ,   RMLMemoryResource   *MemoryResource             = NULL
+                    ,   const unsigned int  &MaxNumberOfDOFs            = 0);
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -406,6 +427,43 @@ public:
                     ,   const RMLPositionFlags              &Flags);
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int RMLPosition(const RMLPositionInputParameters &InputValues, RMLPositionOutputParameters *OutputValues, const RMLPositionFlags &Flags, const double &ElapsedTimeInSeconds)
+//!
+//! \brief
+//! Variant of ReflexxesAPI::RMLPosition() for a cycle, whose duration
+//! differs from ReflexxesAPI::CycleTime
+//!
+//! \details
+//! The trajectory is sampled \c ElapsedTimeInSeconds after the previous
+//! call, for instance, if the period of the communication system is
+//! jittered or temporarily changed. If the input values did not change,
+//! the trajectory is \em not recalculated. Further details are described
+//! at TypeIIRMLPosition::GetNextStateOfMotion().
+//!
+//! \param InputValues
+//! Input values as for ReflexxesAPI::RMLPosition()
+//!
+//! \param OutputValues
+//! Output values as for ReflexxesAPI::RMLPosition()
+//!
+//! \param Flags
+//! Flags as for ReflexxesAPI::RMLPosition()
+//!
+//! \param ElapsedTimeInSeconds
+//! Positive time in seconds, which elapsed since the previous call
+//!
+//! \return
+//! The same values as ReflexxesAPI::RMLPosition(), or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if
+//! \c ElapsedTimeInSeconds is not positive
+//  ----------------------------------------------------------
+    int RMLPosition(    const RMLPositionInputParameters    &InputValues
+                    ,   RMLPositionOutputParameters         *OutputValues
+                    ,   const RMLPositionFlags              &Flags
+                    ,   const double                        &ElapsedTimeInSeconds);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn int RMLPositionAtAGivenSampleTime(const double &TimeValueInSeconds, RMLPositionOutputParameters *OutputValues)
 //!
@@ -463,6 +521,91 @@ public:
                                         ,   RMLPositionOutputParameters         *OutputValues);
 
 
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int RMLPositionMinimumExecutionTime(const RMLPositionInputParameters &InputValues, const RMLPositionFlags &Flags, double *ExecutionTime, bool *IsPhaseSynchronized = NULL)
+//!
+//! \brief
+//! Returns only the execution time of the trajectory that
+//! ReflexxesAPI::RMLPosition() would generate for the given input values
+//!
+//! \details
+//! Only the first step of the position-based algorithm is executed, and
+//! no polynomials are set up. This is useful for planners that evaluate
+//! many candidate target states of motion. The trajectory that was
+//! computed by the last call of ReflexxesAPI::RMLPosition() becomes
+//! invalid, and the next call of ReflexxesAPI::RMLPosition() starts a
+//! new calculation; for queries running in parallel to an
+//! On-Line Trajectory Generation, a separate object of this class should
+//! be used. For details, please refer to
+//! TypeIIRMLPosition::GetMinimumExecutionTime().
+//!
+//! \param InputValues
+//! Input values of the position-based algorithm (cf.
+//! RMLPositionInputParameters)
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \param ExecutionTime
+//! A pointer to a \c double value, to which the execution time in seconds
+//! will be written.
+//!
+//! \param IsPhaseSynchronized
+//! An optional pointer to a \c bool value, to which the information,
+//! whether the motion would be phase-synchronized, will be written.
+//!
+//! \return
+//! An integer value as specified in ReflexxesAPI::RMLResultValue
+//!
+//! \sa ReflexxesAPI::RMLPosition()
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTime()
+//  ----------------------------------------------------------
+    int RMLPositionMinimumExecutionTime(        const RMLPositionInputParameters    &InputValues
+                                            ,   const RMLPositionFlags              &Flags
+                                            ,   double                              *ExecutionTime
+                                            ,   bool                                *IsPhaseSynchronized    =   NULL);
+
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int RMLPositionMinimumExecutionTimes(const RMLPositionInputParameters &InputValues, const RMLPositionFlags &Flags, const RMLPositionCandidateTargets &Candidates, RMLPositionCandidateResults *Results)
+//!
+//! \brief
+//! Returns the execution times for a set of candidate target states of
+//! motion and the index of the fastest candidate
+//!
+//! \details
+//! All candidates share the current state of motion and the kinematic
+//! limits of \c InputValues. For details, please refer to
+//! TypeIIRMLPosition::GetMinimumExecutionTimes().
+//!
+//! \param InputValues
+//! Input values of the position-based algorithm (cf.
+//! RMLPositionInputParameters); the target position vector is ignored.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \param Candidates
+//! Target states of motion of all candidates (cf.
+//! RMLPositionCandidateTargets)
+//!
+//! \param Results
+//! Results of all candidates (cf. RMLPositionCandidateResults)
+//!
+//! \return
+//! An integer value as specified in ReflexxesAPI::RMLResultValue
+//!
+//! \sa ReflexxesAPI::RMLPositionMinimumExecutionTime()
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTimes()
+//  ----------------------------------------------------------
+    int RMLPositionMinimumExecutionTimes(       const RMLPositionInputParameters    &InputValues
+                                            ,   const RMLPositionFlags              &Flags
+                                            ,   const RMLPositionCandidateTargets   &Candidates
+                                            ,   RMLPositionCandidateResults         *Results);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn int RMLVelocity(const RMLVelocityInputParameters &InputValues, RMLVelocityOutputParameters *OutputValues, const RMLVelocityFlags &Flags)
 //!
@@ -548,6 +691,43 @@ public:
                     ,   const RMLVelocityFlags              &Flags);
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int RMLVelocity(const RMLVelocityInputParameters &InputValues, RMLVelocityOutputParameters *OutputValues, const RMLVelocityFlags &Flags, const double &ElapsedTimeInSeconds)
+//!
+//! \brief
+//! Variant of ReflexxesAPI::RMLVelocity() for a cycle, whose duration
+//! differs from ReflexxesAPI::CycleTime
+//!
+//! \details
+//! The trajectory is sampled \c ElapsedTimeInSeconds after the previous
+//! call, for instance, if the period of the communication system is
+//! jittered or temporarily changed. If the input values did not change,
+//! the trajectory is \em not recalculated. Further details are described
+//! at TypeIIRMLVelocity::GetNextStateOfMotion().
+//!
+//! \param InputValues
+//! Input values as for ReflexxesAPI::RMLVelocity()
+//!
+//! \param OutputValues
+//! Output values as for ReflexxesAPI::RMLVelocity()
+//!
+//! \param Flags
+//! Flags as for ReflexxesAPI::RMLVelocity()
+//!
+//! \param ElapsedTimeInSeconds
+//! Positive time in seconds, which elapsed since the previous call
+//!
+//! \return
+//! The same values as ReflexxesAPI::RMLVelocity(), or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if
+//! \c ElapsedTimeInSeconds is not positive
+//  ----------------------------------------------------------
+    int RMLVelocity(    const RMLVelocityInputParameters    &InputValues
+                    ,   RMLVelocityOutputParameters         *OutputValues
+                    ,   const RMLVelocityFlags              &Flags
+                    ,   const double                        &ElapsedTimeInSeconds);
+
+
 
 //  ---------------------- Doxygen info ----------------------
 //! \fn int RMLVelocityAtAGivenSampleTime(const double &TimeValueInSeconds, RMLVelocityOutputParameters *OutputValues)
@@ -602,6 +782,310 @@ public:
     int RMLVelocityAtAGivenSampleTime(      const double                        &TimeValueInSeconds
                                         ,   RMLVelocityOutputParameters         *OutputValues);
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int PrepareForRealTime(const RMLPositionFlags &PositionFlags = RMLPositionFlags(), const RMLVelocityFlags &VelocityFlags = RMLVelocityFlags())
+//!
+//! \brief
+//! Prepares the algorithms for real-time execution by a warm-up
+//! calculation
+//!
+//! \details
+//! The first calculation of a trajectory usually takes significantly
+//! longer than all subsequent ones, because the code and the data of the
+//! algorithms are not cached yet, and because some internal objects are
+//! allocated by the first call that requires them (e.g., for the
+//! flags RMLPositionFlags::EnableDeterministicTiming and
+//! RMLPositionFlags::NumberOfRecomputationCycles). This method executes
+//! both algorithms for a few cycles with synthetic input values and the
+//! given flags, such that all of this happens before the real-time
+//! execution starts.\n
+//! \n
+//! Afterwards, the internal state of the algorithms is reset, that is, the
+//! next call of ReflexxesAPI::RMLPosition() or ReflexxesAPI::RMLVelocity()
+//! starts a new calculation with the input values of the user. The
+//! trajectory cache and the feed override are not used during the
+//! warm-up, such that their state remains unchanged. Objects
+//! that are allocated by this method are allocated from the memory
+//! resource of the algorithms (cf. RMLMemoryResource).
+//!
+//! \warning
+//! This method is \b not real-time capable. It is intended to be called
+//! once during the initialization of an application, after the region has
+//! been locked (cf. RMLMemoryRegion::Lock()).
+//!
+//! \param PositionFlags
+//! The flags that will be used for ReflexxesAPI::RMLPosition()
+//!
+//! \param VelocityFlags
+//! The flags that will be used for ReflexxesAPI::RMLVelocity()
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success, or the error value of the warm-up
+//! calculation of one of the algorithms
+//!
+//! \sa RMLMemoryRegion
+//! \sa \ref page_RealTimeBehavior
+//  ----------------------------------------------------------
+    int PrepareForRealTime(     const RMLPositionFlags  &PositionFlags  =   RMLPositionFlags()
+                            ,   const RMLVelocityFlags  &VelocityFlags  =   RMLVelocityFlags()  );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Reset(void)
+//!
+//! \brief
+//! Discards the current trajectories of both algorithms
+//!
+//! \details
+//! The next call of ReflexxesAPI::RMLPosition() or
+//! ReflexxesAPI::RMLVelocity() starts a new calculation, even if the
+//! input values did not change, for instance, after an emergency stop or
+//! after the controller was disabled. This method is real-time capable;
+//! no memory is allocated or freed.
+//!
+//! \sa ReflexxesAPI::Reconfigure()
+//  ----------------------------------------------------------
+    void Reset(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Reconfigure(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Changes the number of degrees of freedom and the cycle time of both
+//! algorithms without reallocating memory
+//!
+//! \details
+//! Instead of deleting and constructing a new ReflexxesAPI object, for
+//! instance, when switching between different kinematic configurations
+//! of a machine, the existing object can be reconfigured. All internal
+//! objects keep the memory, which was reserved for the number of degrees
+//! of freedom specified by the constructor (cf. ReflexxesAPI::ReflexxesAPI()),
+//! such that this method is real-time capable. Afterwards,
+//! ReflexxesAPI::Reset() is called.\n
+//! \n
+//! The input and output parameter objects of the user can be adapted
+//! without reallocation in the same way (cf.
+//! RMLInputParameters::SetNumberOfDOFs() and
+//! RMLOutputParameters::SetNumberOfDOFs()), if they were constructed
+//! with a sufficient number of degrees of freedom.
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom
+//!
+//! \param CycleTimeInSeconds
+//! New cycle time in seconds
+//!
+//! \return
+//!  - ReflexxesAPI::RML_WORKING on success
+//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS, if \c DegreesOfFreedom is
+//!    zero or greater than ReflexxesAPI::GetMaxNumberOfDOFs()
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if
+//!    \c CycleTimeInSeconds is not positive
+//!
+//! In case of an error, the object remains unchanged.
+//!
+//! \sa \ref page_RealTimeBehavior
+//  ----------------------------------------------------------
+    int Reconfigure(        const unsigned int  &DegreesOfFreedom
+                        ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned int GetMaxNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns the maximum number of degrees of freedom that can be set by
+//! ReflexxesAPI::Reconfigure()
+//  ----------------------------------------------------------
+    unsigned int GetMaxNumberOfDOFs(void) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetFeedOverride(const double &Factor)
+//!
+//! \brief
+//! Sets the feed override factor for ReflexxesAPI::RMLPosition()
+//!
+//! \details
+//! The trajectory is not recalculated; instead, it is executed slower or
+//! faster, and all degrees of freedom remain synchronized. A factor of
+//! zero pauses the motion. For details, please refer to
+//! TypeIIRMLPosition::SetFeedOverride().
+//!
+//! \param Factor
+//! Non-negative feed override factor
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Factor is negative
+//! or not finite
+//!
+//! \sa ReflexxesAPI::SetMaxFeedOverrideRate()
+//! \sa ReflexxesAPI::GetScaledKinematicLimits()
+//  ----------------------------------------------------------
+    int SetFeedOverride(const double &Factor);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetMaxFeedOverrideRate(const double &Rate)
+//!
+//! \brief
+//! Sets the maximum rate of change of the feed override factor in
+//! \f$ \frac{1}{s} \f$
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Rate is not
+//! positive
+//!
+//! \sa TypeIIRMLPosition::SetMaxFeedOverrideRate()
+//  ----------------------------------------------------------
+    int SetMaxFeedOverrideRate(const double &Rate);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double GetFeedOverride(void) const
+//!
+//! \brief
+//! Returns the feed override factor that was applied at the end of the
+//! last call of ReflexxesAPI::RMLPosition()
+//  ----------------------------------------------------------
+    double GetFeedOverride(void) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void GetScaledKinematicLimits(const RMLPositionInputParameters &InputValues, RMLDoubleVector *MaxVelocityVector, RMLDoubleVector *MaxAccelerationVector, RMLDoubleVector *MaxJerkVector) const
+//!
+//! \brief
+//! Provides the kinematic motion constraints of the output values of
+//! ReflexxesAPI::RMLPosition() for the applied feed override factor
+//!
+//! \details
+//! Each of the vector pointers may be \c NULL.
+//!
+//! \sa TypeIIRMLPosition::GetScaledKinematicLimits()
+//  ----------------------------------------------------------
+    void GetScaledKinematicLimits(      const RMLPositionInputParameters    &InputValues
+                                    ,   RMLDoubleVector                     *MaxVelocityVector
+                                    ,   RMLDoubleVector                     *MaxAccelerationVector
+                                    ,   RMLDoubleVector                     *MaxJerkVector          ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetTrajectoryCache(const size_t &MemoryBudgetInBytes, const double &Resolution = 0.0)
+//!
+//! \brief
+//! Sets up a cache for trajectories of ReflexxesAPI::RMLPosition() that
+//! are calculated repeatedly
+//!
+//! \details
+//! If the input values of a new calculation match a stored trajectory,
+//! the stored trajectory is used instead of calculating it again; it is
+//! translated to the current position. The least recently used
+//! trajectory is replaced if the cache is full. This method is not
+//! real-time capable. For details, please refer to
+//! TypeIIRMLPosition::SetTrajectoryCache().
+//!
+//! \param MemoryBudgetInBytes
+//! Maximum number of bytes that may be occupied by the cache; zero
+//! disables the cache.
+//!
+//! \param Resolution
+//! Non-negative resolution, to which all input values are rounded before
+//! they are compared. For a value of zero, the input values including
+//! the current positions have to match bit by bit, and the output values
+//! equal the ones of a new calculation bit by bit; otherwise, they may
+//! deviate slightly.
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Resolution is
+//! negative or not finite
+//!
+//! \sa ReflexxesAPI::GetTrajectoryCacheStatistics()
+//  ----------------------------------------------------------
+    int SetTrajectoryCache(     const size_t    &MemoryBudgetInBytes
+                            ,   const double    &Resolution             =   0.0 );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void GetTrajectoryCacheStatistics(unsigned long long *NumberOfHits, unsigned long long *NumberOfMisses, unsigned int *NumberOfEntries) const
+//!
+//! \brief
+//! Provides the number of hits and misses of the trajectory cache and
+//! its number of entries
+//!
+//! \details
+//! Each of the pointers may be \c NULL.
+//!
+//! \sa TypeIIRMLPosition::GetTrajectoryCacheStatistics()
+//  ----------------------------------------------------------
+    void GetTrajectoryCacheStatistics(      unsigned long long  *NumberOfHits
+                                        ,   unsigned long long  *NumberOfMisses
+                                        ,   unsigned int        *NumberOfEntries    ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int WriteTrajectoryCacheFile(const char *FileName) const
+//!
+//! \brief
+//! Writes all trajectories of the trajectory cache into a file, which
+//! can be mapped by ReflexxesAPI::MapTrajectoryCacheFile()
+//!
+//! \details
+//! This method is not real-time capable. For details, please refer to
+//! TypeIIRMLPosition::WriteTrajectoryCacheFile().
+//!
+//! \param FileName
+//! Name of the file to be written; an existing file is replaced.
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or ReflexxesAPI::RML_ERROR
+//!
+//! \sa ReflexxesAPI::SetTrajectoryCache()
+//  ----------------------------------------------------------
+    int WriteTrajectoryCacheFile(const char *FileName) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int MapTrajectoryCacheFile(const char *FileName)
+//!
+//! \brief
+//! Maps a trajectory cache file read-only into memory, such that
+//! ReflexxesAPI::RMLPosition() can use its trajectories immediately
+//!
+//! \details
+//! The file has to be written by ReflexxesAPI::WriteTrajectoryCacheFile()
+//! of the same library version with the same resolution as set by
+//! ReflexxesAPI::SetTrajectoryCache(). This method is not real-time
+//! capable. For details, please refer to
+//! TypeIIRMLPosition::MapTrajectoryCacheFile().
+//!
+//! \param FileName
+//! Name of the file to be mapped
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success, ReflexxesAPI::RML_ERROR, if the
+//! file could not be mapped, or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if the file was rejected
+//!
+//! \sa ReflexxesAPI::UnmapTrajectoryCacheFile()
+//  ----------------------------------------------------------
+    int MapTrajectoryCacheFile(const char *FileName);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void UnmapTrajectoryCacheFile(void)
+//!
+//! \brief
+//! Unmaps the file mapped by ReflexxesAPI::MapTrajectoryCacheFile()
+//!
+//! \sa TypeIIRMLPosition::UnmapTrajectoryCacheFile()
+//  ----------------------------------------------------------
+    void UnmapTrajectoryCacheFile(void);
+
+
 protected:
 
 //  ---------------------- Doxygen info ----------------------
@@ -0,0 +1,332 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file ReflexxesCAPI.h
+//!
+//! \brief
+//! Header file of the C interface of the Type II Reflexxes Motion Library
+//!
+//! \details
+//! Flat C interface, whose input and output values are described by
+//! pointer and stride views into caller-owned memory.
+//!
+//! \sa TypeIIRMLPosition
+//! \sa TypeIIRMLVelocity
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __ReflexxesCAPI__
+#define __ReflexxesCAPI__
+
+
+#include <stddef.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Return values of the functions rml_position_step() and
+//! rml_velocity_step()
+//!
+//! \details
+//! The values equal the elements of ReflexxesAPI::RMLResultValue.
+//!
+//! \sa ReflexxesAPI::RMLResultValue
+//  ----------------------------------------------------------
+enum rml_result
+{
+    RML_RESULT_WORKING                          =   0,
+    RML_RESULT_FINAL_STATE_REACHED              =   1,
+    RML_RESULT_ERROR                            =   -1,
+    RML_RESULT_ERROR_INVALID_INPUT_VALUES       =   -100,
+    RML_RESULT_ERROR_EXECUTION_TIME_CALCULATION =   -101,
+    RML_RESULT_ERROR_SYNCHRONIZATION            =   -102,
+    RML_RESULT_ERROR_NUMBER_OF_DOFS             =   -103,
+    RML_RESULT_ERROR_NO_PHASE_SYNCHRONIZATION   =   -104,
+    RML_RESULT_ERROR_NULL_POINTER               =   -105,
+    RML_RESULT_ERROR_EXECUTION_TIME_TOO_BIG     =   -106,
+    RML_RESULT_ERROR_USER_TIME_OUT_OF_RANGE     =   -107
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Read-only view of \c NumberOfDOFs values of type \c double in caller
+//! memory
+//!
+//! \details
+//! The value of the degree of freedom \c i is located at the address
+//! <tt>(const char*)data + i * stride</tt>, that is, \c stride is given
+//! in bytes. Contiguous arrays use <tt>stride = sizeof(double)</tt>, and
+//! a stride of zero applies a single value to all degrees of freedom.
+//! If \c data is \c NULL, all values are considered to be zero.
+//  ----------------------------------------------------------
+typedef struct rml_const_array
+{
+    const double    *data;
+    ptrdiff_t       stride;
+} rml_const_array;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Writable view of \c NumberOfDOFs values of type \c double in caller
+//! memory
+//!
+//! \details
+//! The addressing equals the one of rml_const_array. If \c data is
+//! \c NULL, the respective output values are not written.
+//  ----------------------------------------------------------
+typedef struct rml_array
+{
+    double          *data;
+    ptrdiff_t       stride;
+} rml_array;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Input values of rml_position_step() and rml_velocity_step()
+//!
+//! \details
+//! The members correspond to the ones of RMLPositionInputParameters.
+//! The velocity-based algorithm ignores the members \c max_velocity,
+//! \c target_position, and \c alternative_target_velocity.\n
+//! \n
+//! The selection vector consists of one byte per degree of freedom
+//! (non-zero means selected) at the address
+//! <tt>selection + i * selection_stride</tt>. If \c selection is \c NULL,
+//! all degrees of freedom are selected.
+//!
+//! \sa RMLPositionInputParameters
+//! \sa RMLVelocityInputParameters
+//  ----------------------------------------------------------
+typedef struct rml_in_view
+{
+    rml_const_array         current_position;
+    rml_const_array         current_velocity;
+    rml_const_array         current_acceleration;
+    rml_const_array         max_velocity;
+    rml_const_array         max_acceleration;
+    rml_const_array         max_jerk;
+    rml_const_array         target_position;
+    rml_const_array         target_velocity;
+    rml_const_array         alternative_target_velocity;
+    const unsigned char     *selection;
+    ptrdiff_t               selection_stride;
+    double                  minimum_synchronization_time;
+} rml_in_view;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Output values of rml_position_step() and rml_velocity_step()
+//!
+//! \details
+//! The members correspond to the ones of RMLPositionOutputParameters and
+//! RMLVelocityOutputParameters. The member
+//! \c position_values_at_target_velocity is only written by the
+//! velocity-based algorithm. The scalar members are always written. The
+//! motion states at the positional extrema (i.e., the \f$ N \times N \f$
+//! arrays of RMLOutputParameters) are not part of this interface.
+//!
+//! \sa RMLPositionOutputParameters
+//! \sa RMLVelocityOutputParameters
+//  ----------------------------------------------------------
+typedef struct rml_out_view
+{
+    rml_array               new_position;
+    rml_array               new_velocity;
+    rml_array               new_acceleration;
+    rml_array               execution_times;
+    rml_array               min_position_extrema;
+    rml_array               max_position_extrema;
+    rml_array               min_extrema_times;
+    rml_array               max_extrema_times;
+    rml_array               position_values_at_target_velocity;
+    double                  synchronization_time;
+    int                     a_new_calculation_was_performed;
+    int                     trajectory_is_phase_synchronized;
+    unsigned int            dof_with_the_greatest_execution_time;
+} rml_out_view;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Flags of rml_position_step() and rml_velocity_step()
+//!
+//! \details
+//! The members correspond to the ones of RMLPositionFlags and take the
+//! same values (e.g., RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE). The
+//! velocity-based algorithm ignores the members
+//! \c behavior_after_final_state_of_motion_is_reached,
+//! \c keep_current_velocity_in_case_of_fallback_strategy,
+//! \c enable_deterministic_timing, and
+//! \c number_of_recomputation_cycles. Use rml_flags_init() to obtain the
+//! default values.
+//!
+//! \sa RMLPositionFlags
+//! \sa RMLVelocityFlags
+//  ----------------------------------------------------------
+typedef struct rml_flags
+{
+    int                     synchronization_behavior;
+    int                     enable_the_calculation_of_the_extremum_motion_states;
+    int                     behavior_after_final_state_of_motion_is_reached;
+    int                     keep_current_velocity_in_case_of_fallback_strategy;
+    int                     enable_deterministic_timing;
+    unsigned int            number_of_recomputation_cycles;
+} rml_flags;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Opaque handle of an instance of the position-based algorithm
+//  ----------------------------------------------------------
+typedef struct rml_position rml_position;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Opaque handle of an instance of the velocity-based algorithm
+//  ----------------------------------------------------------
+typedef struct rml_velocity rml_velocity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Sets \c flags to the default values of RMLPositionFlags
+//  ----------------------------------------------------------
+void rml_flags_init(rml_flags *flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Creates an instance of the position-based algorithm
+//!
+//! \details
+//! All memory is allocated here, including the internal instances that
+//! are required by the members \c enable_deterministic_timing and
+//! \c number_of_recomputation_cycles of rml_flags. These instances are
+//! allocated by a warm-up calculation (cf.
+//! TypeIIRMLPosition::PrepareForRealTime()), such that
+//! rml_position_step() does not allocate memory for any flags.
+//!
+//! \return
+//! Handle of the instance or \c NULL, if memory could not be allocated
+//! or if \c number_of_dofs is zero
+//  ----------------------------------------------------------
+rml_position *rml_position_create(      unsigned int    number_of_dofs
+                                    ,   double          cycle_time_in_seconds   );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Deletes an instance created by rml_position_create()
+//  ----------------------------------------------------------
+void rml_position_destroy(rml_position *handle);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Sets the flags used by subsequent calls of rml_position_step()
+//  ----------------------------------------------------------
+void rml_position_set_flags(        rml_position        *handle
+                                ,   const rml_flags     *flags  );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Executes one cycle of the position-based algorithm
+//!
+//! \details
+//! Equals TypeIIRMLPosition::GetNextStateOfMotion(), but the input
+//! values are read from and the output values are written to the
+//! caller-owned arrays described by \c input and \c output. This
+//! function does not allocate memory (cf. rml_position_create()), and no
+//! exception leaves it.
+//!
+//! \return
+//! An element of rml_result; \c RML_RESULT_ERROR, if an exception
+//! occurred
+//  ----------------------------------------------------------
+int rml_position_step(      rml_position        *handle
+                        ,   const rml_in_view   *input
+                        ,   rml_out_view        *output );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Creates an instance of the velocity-based algorithm
+//!
+//! \sa rml_position_create()
+//  ----------------------------------------------------------
+rml_velocity *rml_velocity_create(      unsigned int    number_of_dofs
+                                    ,   double          cycle_time_in_seconds   );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Deletes an instance created by rml_velocity_create()
+//  ----------------------------------------------------------
+void rml_velocity_destroy(rml_velocity *handle);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Sets the flags used by subsequent calls of rml_velocity_step()
+//  ----------------------------------------------------------
+void rml_velocity_set_flags(        rml_velocity        *handle
+                                ,   const rml_flags     *flags  );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Executes one cycle of the velocity-based algorithm
+//!
+//! \sa rml_position_step()
+//  ----------------------------------------------------------
+int rml_velocity_step(      rml_velocity        *handle
+                        ,   const rml_in_view   *input
+                        ,   rml_out_view        *output );
+
+
+#ifdef __cplusplus
+}   // extern "C"
+#endif
+
+
+#endif
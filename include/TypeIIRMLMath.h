@@ -130,6 +130,19 @@ namespace TypeIIRMLMath
 #define RML_MAX_EXECUTION_TIME ((double)1e10)
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \def RML_DEFAULT_MAX_FEED_OVERRIDE_RATE
+//!
+//! \brief
+//! Default value for the maximum rate of change of the feed override
+//! factor in \f$ \frac{1}{s} \f$, that is, a change from 100% to 0%
+//! takes one second
+//!
+//! \sa TypeIIRMLPosition::SetMaxFeedOverrideRate()
+//  ----------------------------------------------------------
+#define RML_DEFAULT_MAX_FEED_OVERRIDE_RATE ((double)1.0)
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \def RML_ADDITIONAL_RELATIVE_POSITION_ERROR_IN_CASE_OF_EQUALITY
 //!
@@ -0,0 +1,490 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLPlatform.h
+//!
+//! \brief
+//! Header file for operating-system-dependent helper functions
+//!
+//! \details
+//! Memory-mapped files, atomic operations, memory barriers, a monotonic
+//! clock, threads, and semaphores, which are required by the logging,
+//! caching, and parallel execution facilities of the library. All
+//! functions are available for Linux, Mac OS X, and Windows.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __TypeIIRMLPlatform__
+#define __TypeIIRMLPlatform__
+
+
+#include <stddef.h>
+
+
+namespace TypeIIRMLPlatform
+{
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct MappedFile
+//!
+//! \brief
+//! Descriptor of a file that is mapped into the address space of the
+//! calling process
+//!
+//! \details
+//! The descriptor is filled by TypeIIRMLPlatform::MapFile() and released
+//! by TypeIIRMLPlatform::UnmapFile(). The attributes \c FileHandle and
+//! \c MappingHandle are only used on Windows systems; on POSIX systems,
+//! only \c FileDescriptor is used.
+//!
+//! \sa TypeIIRMLPlatform::MapFile()
+//! \sa TypeIIRMLPlatform::UnmapFile()
+//  ----------------------------------------------------------
+struct MappedFile
+{
+    void            *Data           ;
+    size_t          Size            ;
+    bool            Writable        ;
+    int             FileDescriptor  ;
+    void            *FileHandle     ;
+    void            *MappingHandle  ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void InitializeMappedFile(MappedFile *File)
+//!
+//! \brief
+//! Sets all attributes of a mapped file descriptor to their unmapped
+//! default values
+//!
+//! \param File
+//! Pointer to the descriptor to be initialized
+//  ----------------------------------------------------------
+void InitializeMappedFile(MappedFile *File);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool MapFile(const char *FileName, const size_t &Size, const bool &Writable, MappedFile *File)
+//!
+//! \brief
+//! Maps a file into the address space of the calling process
+//!
+//! \param FileName
+//! Name of the file to be mapped
+//!
+//! \param Size
+//! If \c Writable is \c true, the file is created (or truncated) and
+//! resized to \c Size bytes. If \c Writable is \c false, this value is
+//! ignored, and the entire existing file is mapped.
+//!
+//! \param Writable
+//! If \c true, the file is mapped for reading and writing and shared with
+//! all other processes that map the same file. Otherwise, the file is
+//! mapped read-only.
+//!
+//! \param File
+//! Pointer to the descriptor that receives the mapping
+//!
+//! \return
+//! \c true if the file was mapped successfully, \c false otherwise
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//!
+//! \sa TypeIIRMLPlatform::UnmapFile()
+//  ----------------------------------------------------------
+bool MapFile(       const char      *FileName
+                ,   const size_t    &Size
+                ,   const bool      &Writable
+                ,   MappedFile      *File);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool FlushMappedFile(const MappedFile &File, const bool &Synchronous)
+//!
+//! \brief
+//! Writes all modified pages of a mapped file back to the storage device
+//!
+//! \param File
+//! Descriptor of the mapped file
+//!
+//! \param Synchronous
+//! If \c true, the function blocks until all pages have been written;
+//! otherwise, the write-back is only scheduled.
+//!
+//! \return
+//! \c true on success, \c false otherwise
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+bool FlushMappedFile(       const MappedFile    &File
+                        ,   const bool          &Synchronous);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void UnmapFile(MappedFile *File)
+//!
+//! \brief
+//! Unmaps and closes a file that was mapped by
+//! TypeIIRMLPlatform::MapFile()
+//!
+//! \param File
+//! Pointer to the descriptor of the mapped file. After the call, the
+//! descriptor is reset to its unmapped default values.
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+void UnmapFile(MappedFile *File);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool RenameFile(const char *OldFileName, const char *NewFileName)
+//!
+//! \brief
+//! Renames a file and replaces an existing file of the new name
+//!
+//! \details
+//! On POSIX systems, the replacement is atomic: Other processes open
+//! either the previous or the new file, and processes that have mapped
+//! the previous file keep their mapping. On Windows systems, the function
+//! fails if the existing file is mapped by any process.
+//!
+//! \param OldFileName
+//! Name of the file to be renamed
+//!
+//! \param NewFileName
+//! New name of the file
+//!
+//! \return
+//! \c true on success, \c false otherwise
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+bool RenameFile(        const char      *OldFileName
+                    ,   const char      *NewFileName);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned long long AtomicFetchAndAdd(volatile unsigned long long *Value, const unsigned long long &Increment)
+//!
+//! \brief
+//! Atomically adds \c Increment to \c *Value
+//!
+//! \details
+//! The operation is lock-free and acts as a full memory barrier. \c Value
+//! has to be aligned to eight bytes.
+//!
+//! \param Value
+//! Pointer to the value to be incremented
+//!
+//! \param Increment
+//! Increment value
+//!
+//! \return
+//! The value of \c *Value \em before the addition
+//  ----------------------------------------------------------
+unsigned long long AtomicFetchAndAdd(       volatile unsigned long long     *Value
+                                        ,   const unsigned long long        &Increment);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool AtomicCompareAndSwap(volatile unsigned long long *Value, const unsigned long long &ExpectedValue, const unsigned long long &NewValue)
+//!
+//! \brief
+//! Atomically replaces \c *Value by \c NewValue, if it equals
+//! \c ExpectedValue
+//!
+//! \details
+//! The operation is lock-free and acts as a full memory barrier. \c Value
+//! has to be aligned to eight bytes.
+//!
+//! \return
+//! \c true, if \c *Value was replaced
+//  ----------------------------------------------------------
+bool AtomicCompareAndSwap(      volatile unsigned long long     *Value
+                            ,   const unsigned long long        &ExpectedValue
+                            ,   const unsigned long long        &NewValue       );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void FullMemoryBarrier(void)
+//!
+//! \brief
+//! Issues a full hardware and compiler memory barrier
+//!
+//! \details
+//! All memory accesses before the barrier become visible to other
+//! threads and processes before any memory access after the barrier.
+//  ----------------------------------------------------------
+void FullMemoryBarrier(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double GetMonotonicTimeInSeconds(void)
+//!
+//! \brief
+//! Returns the value of a monotonic high-resolution clock
+//!
+//! \details
+//! The origin of the clock is unspecified, such that only differences of
+//! two values are meaningful.
+//!
+//! \return
+//! Time value in seconds
+//  ----------------------------------------------------------
+double GetMonotonicTimeInSeconds(void);
+
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \typedef void (*ThreadFunction)(void *Argument)
+//!
+//! \brief
+//! Signature of functions executed by TypeIIRMLPlatform::StartThread()
+//  ----------------------------------------------------------
+typedef void (*ThreadFunction)(void *Argument);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct Thread
+//!
+//! \brief
+//! Descriptor of a thread started by TypeIIRMLPlatform::StartThread()
+//!
+//! \sa TypeIIRMLPlatform::StartThread()
+//! \sa TypeIIRMLPlatform::JoinThread()
+//  ----------------------------------------------------------
+struct Thread
+{
+    void            *Handle         ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct Semaphore
+//!
+//! \brief
+//! Descriptor of a counting semaphore for the synchronization of the
+//! threads of one process
+//!
+//! \sa TypeIIRMLPlatform::InitializeSemaphore()
+//  ----------------------------------------------------------
+struct Semaphore
+{
+    void            *Handle         ;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn unsigned int GetNumberOfProcessors(void)
+//!
+//! \brief
+//! Returns the number of processors that are online
+//!
+//! \return
+//! Number of processors; at least one
+//  ----------------------------------------------------------
+unsigned int GetNumberOfProcessors(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool StartThread(ThreadFunction Function, void *Argument, const int &Processor, Thread *NewThread)
+//!
+//! \brief
+//! Starts a new thread of the calling process
+//!
+//! \param Function
+//! Function to be executed by the new thread
+//!
+//! \param Argument
+//! Argument passed to \c Function
+//!
+//! \param Processor
+//! Index of the processor, to which the new thread is pinned. For
+//! negative values, the thread is not pinned. Pinning is not supported
+//! on Mac OS X, where this value is ignored.
+//!
+//! \param NewThread
+//! Pointer to the descriptor of the new thread
+//!
+//! \return
+//! \c true on success, \c false otherwise
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+bool StartThread(       ThreadFunction      Function
+                    ,   void                *Argument
+                    ,   const int           &Processor
+                    ,   Thread              *NewThread  );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void JoinThread(Thread *ThreadToJoin)
+//!
+//! \brief
+//! Waits until a thread started by TypeIIRMLPlatform::StartThread()
+//! terminates and releases its descriptor
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+void JoinThread(Thread *ThreadToJoin);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool InitializeSemaphore(Semaphore *NewSemaphore)
+//!
+//! \brief
+//! Initializes a counting semaphore with a value of zero
+//!
+//! \return
+//! \c true on success, \c false otherwise
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+bool InitializeSemaphore(Semaphore *NewSemaphore);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void DestroySemaphore(Semaphore *SemaphoreToDestroy)
+//!
+//! \brief
+//! Releases a semaphore initialized by
+//! TypeIIRMLPlatform::InitializeSemaphore()
+//  ----------------------------------------------------------
+void DestroySemaphore(Semaphore *SemaphoreToDestroy);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void PostSemaphore(Semaphore *SemaphoreToPost)
+//!
+//! \brief
+//! Increments the value of a semaphore and wakes up one waiting thread
+//  ----------------------------------------------------------
+void PostSemaphore(Semaphore *SemaphoreToPost);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void WaitForSemaphore(Semaphore *SemaphoreToWaitFor)
+//!
+//! \brief
+//! Waits until the value of a semaphore is greater than zero and
+//! decrements it
+//  ----------------------------------------------------------
+void WaitForSemaphore(Semaphore *SemaphoreToWaitFor);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn size_t GetPageSize(void)
+//!
+//! \brief
+//! Returns the size of a regular memory page in bytes
+//  ----------------------------------------------------------
+size_t GetPageSize(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void *AllocateMemoryRegion(const size_t &Size, const bool &UseHugePages, bool *HugePagesUsed)
+//!
+//! \brief
+//! Allocates a page-aligned region of memory directly from the operating
+//! system
+//!
+//! \param Size
+//! Size of the region in bytes; if huge pages are used, the size has to
+//! be a multiple of the huge page size.
+//!
+//! \param UseHugePages
+//! If \c true, the region is backed by huge pages (Linux: 2 MB pages of
+//! the hugetlb pool; Windows: large pages, which require the privilege
+//! \c SeLockMemoryPrivilege). If no huge pages are available, regular
+//! pages are used.
+//!
+//! \param HugePagesUsed
+//! Pointer to a \c bool value, which is set to \c true, if the region is
+//! backed by huge pages; may be \c NULL
+//!
+//! \return
+//! Pointer to the region or \c NULL, if no memory could be allocated
+//!
+//! \warning
+//! This function is \b not real-time capable.
+//  ----------------------------------------------------------
+void *AllocateMemoryRegion(     const size_t    &Size
+                            ,   const bool      &UseHugePages
+                            ,   bool            *HugePagesUsed  );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void FreeMemoryRegion(void *Region, const size_t &Size)
+//!
+//! \brief
+//! Releases a region allocated by TypeIIRMLPlatform::AllocateMemoryRegion()
+//  ----------------------------------------------------------
+void FreeMemoryRegion(      void            *Region
+                        ,   const size_t    &Size   );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool LockMemory(void *Address, const size_t &Size)
+//!
+//! \brief
+//! Locks a range of memory into physical memory, such that accesses never
+//! cause page faults
+//!
+//! \return
+//! \c true on success, \c false otherwise (e.g., if the limit for locked
+//! memory of the process, \c RLIMIT_MEMLOCK, is exceeded)
+//  ----------------------------------------------------------
+bool LockMemory(        void            *Address
+                    ,   const size_t    &Size       );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void UnlockMemory(void *Address, const size_t &Size)
+//!
+//! \brief
+//! Unlocks a range of memory locked by TypeIIRMLPlatform::LockMemory()
+//  ----------------------------------------------------------
+void UnlockMemory(      void            *Address
+                    ,   const size_t    &Size       );
+
+
+}   // namespace TypeIIRMLPlatform
+
+#endif
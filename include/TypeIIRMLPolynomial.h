@@ -48,6 +48,7 @@
 
 
 #include <TypeIIRMLMath.h>
+#include <RMLMemoryResource.h>
 
 namespace TypeIIRMLMath
 {
@@ -257,7 +258,7 @@ public:
 //!
 //! \sa TypeIIRMLPolynomial
 //  ----------------------------------------------------------
-struct MotionPolynomials
+struct MotionPolynomials : public RMLMemoryObject
 {
 //  ---------------------- Doxygen info ----------------------
 //! \var double PolynomialTimes [MAXIMAL_NO_OF_POLYNOMIALS]
@@ -52,10 +52,16 @@
 #include <RMLPositionInputParameters.h>
 #include <RMLPositionOutputParameters.h>
 #include <RMLPositionFlags.h>
+#include <RMLPositionCandidates.h>
 #include <RMLVelocityFlags.h>
 #include <RMLVector.h>
+#include <ReflexxesCAPI.h>
 #include <TypeIIRMLPolynomial.h>
 #include <TypeIIRMLStep1Profiles.h>
+#include <TypeIIRMLStep1Cache.h>
+#include <TypeIIRMLTrajectoryCache.h>
+#include <TypeIIRMLPlatform.h>
+#include <RMLTrajectoryCacheFormat.h>
 #include <TypeIIRMLVelocity.h>
 
 
@@ -142,13 +148,13 @@ using namespace TypeIIRMLMath;
 //! \sa ReflexxesAPI
 //! \sa TypeIIRMLMath
 //  ----------------------------------------------------------
-class TypeIIRMLPosition
+class TypeIIRMLPosition : public RMLMemoryObject
 {
 public:
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn TypeIIRMLPosition(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//! \fn TypeIIRMLPosition(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds, const unsigned int &MaxNumberOfDOFs = 0)
 //!
 //! \brief
 //! Constructor of the class TypeIIRMLPosition
@@ -169,10 +175,17 @@ public:
 //! \param CycleTimeInSeconds
 //! Specifies the cycle time in seconds
 //!
+//! \param MaxNumberOfDOFs
+//! Specifies the number of degrees of freedom, for which memory is
+//! reserved (cf. TypeIIRMLPosition::Reconfigure()). Values smaller than
+//! \c DegreesOfFreedom (e.g., the default value of zero) are replaced by
+//! \c DegreesOfFreedom.
+//!
 //! \sa TypeIIRMLPosition::~TypeIIRMLPosition()
 //  ----------------------------------------------------------
     TypeIIRMLPosition(      const unsigned int  &DegreesOfFreedom
-                        ,   const double        &CycleTimeInSeconds);
+                        ,   const double        &CycleTimeInSeconds
+                        ,   const unsigned int  &MaxNumberOfDOFs    = 0);
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -267,199 +280,1409 @@ public:
 //! \sa TypeIIRMLMath
 //! \sa \ref page_SynchronizationBehavior
 //  ----------------------------------------------------------
-    int GetNextStateOfMotion(       const RMLPositionInputParameters    &InputValues
-                                ,   RMLPositionOutputParameters         *OutputValues
-                                ,   const RMLPositionFlags              &Flags);
+    int GetNextStateOfMotion(       const RMLPositionInputParameters    &InputValues
+                                ,   RMLPositionOutputParameters         *OutputValues
+                                ,   const RMLPositionFlags              &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStateOfMotion(const RMLPositionInputParameters &InputValues, RMLPositionOutputParameters *OutputValues, const RMLPositionFlags &Flags, const double &ElapsedTimeInSeconds)
+//!
+//! \brief
+//! Variant of TypeIIRMLPosition::GetNextStateOfMotion() for cycles, whose
+//! duration differs from the nominal cycle time
+//!
+//! \details
+//! Instead of the cycle time passed to the constructor, the internal
+//! clock is advanced by \c ElapsedTimeInSeconds, and the current
+//! trajectory is sampled at this instant. This is useful for
+//! communication systems with jittered or deliberately changed periods.
+//! A changed duration alone does \em not lead to a new calculation of the
+//! trajectory: if the input values did not change, the result equals the
+//! one of TypeIIRMLPosition::GetNextStateOfMotionAtTime() for
+//! \c ElapsedTimeInSeconds, and the trajectory is continued from that
+//! instant on.\n
+//! \n
+//! A pending amortized recomputation
+//! (cf. RMLPositionFlags::NumberOfRecomputationCycles) assumes cycles of
+//! the nominal duration. It is therefore discarded in a cycle with a
+//! different duration, that is, the new trajectory is calculated
+//! completely within this cycle, and no amortized recomputation is
+//! started in such a cycle.\n
+//! \n
+//! The next call of TypeIIRMLPosition::GetNextStateOfMotion() without this
+//! parameter uses the nominal cycle time again.
+//!
+//! \param InputValues
+//! Input values of the algorithm
+//!
+//! \param OutputValues
+//! Output values of the algorithm
+//!
+//! \param Flags
+//! Flags of the algorithm
+//!
+//! \param ElapsedTimeInSeconds
+//! Time in seconds, which elapsed since the previous call. This value
+//! has to be positive.
+//!
+//! \return
+//! The same values as TypeIIRMLPosition::GetNextStateOfMotion(); if
+//! \c ElapsedTimeInSeconds is not positive,
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES is returned, and the
+//! output values remain unchanged.
+//!
+//! \sa ReflexxesAPI::RMLPosition()
+//  ----------------------------------------------------------
+    int GetNextStateOfMotion(       const RMLPositionInputParameters    &InputValues
+                                ,   RMLPositionOutputParameters         *OutputValues
+                                ,   const RMLPositionFlags              &Flags
+                                ,   const double                        &ElapsedTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStateOfMotion(const rml_in_view &InputValues, rml_out_view *OutputValues, const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Variant of TypeIIRMLPosition::GetNextStateOfMotion(), whose input and output
+//! values are located in caller-owned memory
+//!
+//! \details
+//! The input values are directly read from the arrays described by
+//! \c InputValues, and the output values are directly written to the
+//! arrays described by \c OutputValues (cf. ReflexxesCAPI.h), such that
+//! no objects of the classes RMLPositionInputParameters and
+//! RMLPositionOutputParameters have to be set up by the caller. This
+//! method does not allocate memory.
+//!
+//! \param InputValues
+//! Views of the input values, the number of degrees of freedom equals the
+//! one specified at the constructor.
+//!
+//! \param OutputValues
+//! Views of the output values; arrays with a \c NULL pointer are not
+//! written.
+//!
+//! \param Flags
+//! A set of boolean values to configure the behavior of the algorithm
+//! (cf. RMLPositionFlags).
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue
+//!
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//! \sa rml_position_step()
+//  ----------------------------------------------------------
+    int GetNextStateOfMotion(       const rml_in_view                   &InputValues
+                                ,   rml_out_view                        *OutputValues
+                                ,   const RMLPositionFlags              &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStateOfMotionAtTime(const double &TimeValueInSeconds, RMLPositionOutputParameters *OutputValues) const
+//!
+//! \brief
+//! Once the method of TypeIIRMLPosition::GetNextStateOfMotion() was
+//! \em successfully called to compute a trajectory, this method can be
+//! used to compute a state of motion on this trajectory at a given time
+//! instant.
+//!
+//! \details
+//! After the method GetNextStateOfMotion() was called and no error value
+//! was returned (i.e., ReflexxesAPI::RML_WORKING or
+//! ReflexxesAPI::RML_FINAL_STATE_REACHED was returned), a trajectory was
+//! successfully generated. In order to compute a state of motion of this
+//! trajectory at a given time instant, this method can be used.
+//! No new calculations are started by calling this method; only the
+//! existing result of the method GetNextStateOfMotion() is used.
+//! \c TimeValueInSeconds specifies the time of the desired state of
+//! motion, which is copied to OutputValues (cf.
+//! RMLPositionOutputParameters).\n
+//! \n
+//! If the method TypeIIRMLPosition::GetNextStateOfMotion() returned an
+//! error, the same error will be returned by this method. The value of
+//! \c TimeValueInSeconds has to be positive and below the values of
+//! RML_MAX_EXECUTION_TIME (\f$ 10^{10} \f$ seconds).\n
+//! \n
+//! For further information, please refer to the documentation of
+//! TypeIIRMLPosition::GetNextStateOfMotion().
+//!
+//! \param TimeValueInSeconds
+//! Time value in seconds, at which the desired state of motion is
+//! calculated.
+//!
+//! \param OutputValues
+//! Output values of the position-based Type II On-Line Trajectory
+//! Generation algorithm. For detailed information, please refer to the
+//! class RMLPositionOutputParameters and to the page
+//! \ref page_OutputValues.
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue:\n\n
+//!  - ReflexxesAPI::RML_WORKING: \copydoc ReflexxesAPI::RML_WORKING\n\n
+//!  - ReflexxesAPI::RML_FINAL_STATE_REACHED: \copydoc ReflexxesAPI::RML_FINAL_STATE_REACHED\n\n
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES: \copydoc ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES\n\n
+//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS: \copydoc ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS\n\n
+//!  - ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION: \copydoc ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION\n\n
+//!  - ReflexxesAPI::RML_ERROR_NULL_POINTER: \copydoc ReflexxesAPI::RML_ERROR_NULL_POINTER\n\n
+//!  - ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG: \copydoc ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG\n\n
+//!  - ReflexxesAPI::RML_ERROR_USER_TIME_OUT_OF_RANGE: \copydoc ReflexxesAPI::RML_ERROR_USER_TIME_OUT_OF_RANGE\n\n
+//!
+//! \sa TypeIIRMLPosition
+//! \sa RMLPositionOutputParameters
+//! \sa RMLPositionFlags
+//! \sa ReflexxesAPI
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//! \sa TypeIIRMLVelocity::GetNextStateOfMotionAtTime()
+//  ----------------------------------------------------------
+    int GetNextStateOfMotionAtTime(     const double                        &TimeValueInSeconds
+                                    ,   RMLPositionOutputParameters         *OutputValues       ) const;
+
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetMinimumExecutionTime(const RMLPositionInputParameters &InputValues, const RMLPositionFlags &Flags, double *ExecutionTime, bool *IsPhaseSynchronized = NULL)
+//!
+//! \brief
+//! Computes only the execution time of the trajectory that
+//! TypeIIRMLPosition::GetNextStateOfMotion() would generate for the given
+//! input values
+//!
+//! \details
+//! Only Step 1 of the algorithm is executed (cf.
+//! TypeIIRMLPosition::Step1()), that is, the minimum execution times of
+//! all selected degrees of freedom, the inoperative time intervals, and
+//! the synchronization time \f$ t_i^{\,sync} \f$ are calculated, but no
+//! polynomials are set up, and no state of motion is computed. This is
+//! intended for planners that evaluate a large number of candidate
+//! target states of motion and only need to know, how long it would take
+//! to reach each of them.\n
+//! \n
+//! The synchronization behavior of \c Flags and the value of
+//! RMLPositionInputParameters::MinimumSynchronizationTime are taken into
+//! account in the same way as by TypeIIRMLPosition::GetNextStateOfMotion().
+//! In case of phase-synchronized motions, Step 2 may adapt the
+//! synchronization time by a numerical error in the range of
+//! RML_ADDITIONAL_RELATIVE_EPSILON; the value returned by this method is
+//! the exact result of Step 1. If \c Flags specifies
+//! RMLFlags::NO_SYNCHRONIZATION, the greatest minimum execution time of
+//! all selected degrees of freedom is returned.\n
+//! \n
+//! The input values are classified by
+//! RMLPositionInputParameters::CheckForValidity() in the same way as by
+//! TypeIIRMLPosition::GetNextStateOfMotion(), such that both methods
+//! return the same error code for the same input values: invalid
+//! kinematic motion constraints and target velocities lead to
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, and if Step 1 fails,
+//! this value is also returned instead of
+//! ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION or
+//! ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG, if the input values
+//! exceed the order of magnitude given by
+//! RMLPositionInputParameters::MAXIMUM_MAGNITUDE_RANGE.\n
+//! \n
+//! \b Note: This method uses the same internal memory as
+//! TypeIIRMLPosition::GetNextStateOfMotion(). The trajectory that was
+//! computed before becomes invalid, and the next call of
+//! TypeIIRMLPosition::GetNextStateOfMotion() will always start a new
+//! calculation. Planners should therefore use a separate object of
+//! this class for their queries.
+//!
+//! \param InputValues
+//! Input values of the position-based Type II On-Line Trajectory
+//! Generation algorithm (cf. RMLPositionInputParameters)
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags); only the
+//! synchronization behavior is relevant for this method.
+//!
+//! \param ExecutionTime
+//! A pointer to a \c double value, to which the execution time in seconds
+//! will be written.
+//!
+//! \param IsPhaseSynchronized
+//! An optional pointer to a \c bool value, to which the information,
+//! whether the motion would be phase-synchronized, will be written.
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue:\n\n
+//!  - ReflexxesAPI::RML_WORKING: \copydoc ReflexxesAPI::RML_WORKING\n\n
+//!  - ReflexxesAPI::RML_FINAL_STATE_REACHED: \copydoc ReflexxesAPI::RML_FINAL_STATE_REACHED\n\n
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES: \copydoc ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES\n\n
+//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS: \copydoc ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS\n\n
+//!  - ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION: \copydoc ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION\n\n
+//!  - ReflexxesAPI::RML_ERROR_NULL_POINTER: \copydoc ReflexxesAPI::RML_ERROR_NULL_POINTER\n\n
+//!  - ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG: \copydoc ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG\n\n
+//!
+//! In case of an error, the value pointed to by \c ExecutionTime is set
+//! to zero.
+//!
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//! \sa TypeIIRMLPosition::Step1()
+//! \sa ReflexxesAPI::RMLPositionMinimumExecutionTime()
+//  ----------------------------------------------------------
+    int GetMinimumExecutionTime(        const RMLPositionInputParameters    &InputValues
+                                    ,   const RMLPositionFlags              &Flags
+                                    ,   double                              *ExecutionTime
+                                    ,   bool                                *IsPhaseSynchronized    =   NULL);
+
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetMinimumExecutionTimes(const RMLPositionInputParameters &InputValues, const RMLPositionFlags &Flags, const RMLPositionCandidateTargets &Candidates, RMLPositionCandidateResults *Results)
+//!
+//! \brief
+//! Computes the execution times for a set of candidate target states of
+//! motion and selects the fastest candidate
+//!
+//! \details
+//! All candidates start from the current state of motion given by
+//! \c InputValues and use its kinematic limits, its selection vector, and
+//! its minimum synchronization time. The target position vector of
+//! \c InputValues is ignored, and its target velocity vector is only used
+//! if RMLPositionCandidateTargets::TargetVelocity is \c NULL. For each
+//! candidate, the same value as by
+//! TypeIIRMLPosition::GetMinimumExecutionTime() is calculated, but the
+//! input values are copied and the kinematic limits are checked only
+//! once for all candidates.\n
+//! \n
+//! Candidates that cannot be reached (e.g., because phase-synchronization
+//! is required but not possible) obtain an execution time of
+//! RML_INFINITY and are not considered for the selection of the fastest
+//! candidate. If several candidates have the same execution time, the
+//! one with the smallest index is selected.\n
+//! \n
+//! \b Note: As for TypeIIRMLPosition::GetMinimumExecutionTime(), the
+//! trajectory that was computed before becomes invalid.
+//!
+//! \param InputValues
+//! Input values of the position-based Type II On-Line Trajectory
+//! Generation algorithm (cf. RMLPositionInputParameters)
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags); only the
+//! synchronization behavior is relevant for this method.
+//!
+//! \param Candidates
+//! Target states of motion of all candidates (cf.
+//! RMLPositionCandidateTargets)
+//!
+//! \param Results
+//! A pointer to an RMLPositionCandidateResults object, whose arrays
+//! receive the results of all candidates, and whose member
+//! RMLPositionCandidateResults::IndexOfFastestCandidate receives the
+//! index of the fastest candidate.
+//!
+//! \return
+//! The result value of the fastest candidate (ReflexxesAPI::RML_WORKING or
+//! ReflexxesAPI::RML_FINAL_STATE_REACHED). If no candidate can be
+//! reached, the error value of the first candidate is returned, and
+//! ReflexxesAPI::RML_ERROR, if there is no candidate. Errors that apply
+//! to all candidates (ReflexxesAPI::RML_ERROR_NULL_POINTER,
+//! ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS, and
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES for invalid kinematic
+//! limits) are returned directly.
+//!
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTime()
+//! \sa RMLPositionCandidateTargets
+//! \sa RMLPositionCandidateResults
+//  ----------------------------------------------------------
+    int GetMinimumExecutionTimes(       const RMLPositionInputParameters    &InputValues
+                                    ,   const RMLPositionFlags              &Flags
+                                    ,   const RMLPositionCandidateTargets   &Candidates
+                                    ,   RMLPositionCandidateResults         *Results);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int PrepareForRealTime(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Executes a warm-up calculation with synthetic input values
+//!
+//! \details
+//! All degrees of freedom are moved towards one target state of motion,
+//! which is changed during the motion, and the algorithm is executed for
+//! RMLPositionFlags::NumberOfRecomputationCycles more cycles, such that
+//! also the internal objects for deterministic timing and for amortized
+//! recomputations are allocated. The velocity-based algorithm used by the
+//! fall-back strategy is prepared, too. The trajectory cache (cf.
+//! TypeIIRMLPosition::SetTrajectoryCache()) and the feed override (cf.
+//! TypeIIRMLPosition::SetFeedOverride()) are not used during the warm-up,
+//! such that their contents, statistics, and factors remain unchanged.
+//! Afterwards, TypeIIRMLPosition::Reset() is called, such that the next
+//! call of TypeIIRMLPosition::GetNextStateOfMotion() starts a new
+//! calculation, and the Step 1 cache does not contain results of the
+//! warm-up.
+//!
+//! \param Flags
+//! The flags that will be used during the real-time execution
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or the error value of the warm-up
+//! calculation
+//!
+//! \sa ReflexxesAPI::PrepareForRealTime()
+//  ----------------------------------------------------------
+    int PrepareForRealTime(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Reset(void)
+//!
+//! \brief
+//! Discards the current trajectory, such that the next call of
+//! TypeIIRMLPosition::GetNextStateOfMotion() starts a new calculation
+//!
+//! \details
+//! A pending amortized recomputation is discarded, too, and the
+//! velocity-based algorithm used by the fall-back strategy is reset. No
+//! memory is allocated or freed, that is, this method is real-time
+//! capable, for instance, to restart after an emergency stop.
+//!
+//! \sa TypeIIRMLPosition::Reconfigure()
+//! \sa ReflexxesAPI::Reset()
+//  ----------------------------------------------------------
+    void Reset(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Reconfigure(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Changes the number of degrees of freedom and the cycle time without
+//! reallocating memory
+//!
+//! \details
+//! All internal vectors and objects keep their memory, which was reserved
+//! for TypeIIRMLPosition::MaxNumberOfDOFs degrees of freedom by the
+//! constructor, such that this method is real-time capable. Afterwards,
+//! TypeIIRMLPosition::Reset() is called.
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom
+//!
+//! \param CycleTimeInSeconds
+//! New cycle time in seconds
+//!
+//! \return
+//!  - ReflexxesAPI::RML_WORKING on success
+//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS, if \c DegreesOfFreedom is
+//!    zero or greater than TypeIIRMLPosition::MaxNumberOfDOFs
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if
+//!    \c CycleTimeInSeconds is not positive
+//!
+//! In case of an error, the object remains unchanged.
+//!
+//! \sa TypeIIRMLVelocity::Reconfigure()
+//! \sa ReflexxesAPI::Reconfigure()
+//  ----------------------------------------------------------
+    int Reconfigure(        const unsigned int  &DegreesOfFreedom
+                        ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetMaxNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns TypeIIRMLPosition::MaxNumberOfDOFs
+//  ----------------------------------------------------------
+    inline unsigned int GetMaxNumberOfDOFs(void) const
+    {
+        return(this->MaxNumberOfDOFs);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetFeedOverride(const double &Factor)
+//!
+//! \brief
+//! Sets the desired feed override factor \f$ s^{\,trgt} \f$
+//!
+//! \details
+//! Instead of recalculating the trajectory with scaled kinematic motion
+//! constraints, the calculated trajectory is sampled with a monotone
+//! time warp: the trajectory time \f$ \tau \f$ advances by
+//! \f$ \dot{\tau}(t)\,=\,s(t) \f$ per second, where the applied factor
+//! \f$ s(t) \f$ approaches \f$ s^{\,trgt} \f$ with the rate
+//! TypeIIRMLPosition::MaxFeedOverrideRate. The output values of
+//! TypeIIRMLPosition::GetNextStateOfMotion() are
+//!
+//! \f[
+//! \vec{P}_{i+1}\,=\,\vec{P}(\tau_{i+1}),\quad
+//! \vec{V}_{i+1}\,=\,s\,\vec{V}(\tau_{i+1}),\quad
+//! \vec{A}_{i+1}\,=\,s^2\,\vec{A}(\tau_{i+1})\,+\,\dot{s}\,\vec{V}(\tau_{i+1})
+//! \f]
+//!
+//! that is, changes of the factor, as well as pausing (\f$ s^{\,trgt}\,=\,0 \f$)
+//! and resuming, do not require a new calculation, and all degrees of
+//! freedom remain synchronized. The resulting kinematic motion
+//! constraints are provided by
+//! TypeIIRMLPosition::GetScaledKinematicLimits(). The output values are
+//! fed back as usual; the algorithm recognizes them and continues the
+//! trajectory. All other input values (e.g., a current velocity that was
+//! not calculated by this object) are divided by the applied factor
+//! before a new trajectory is calculated.\n
+//! \n
+//! Execution times, the synchronization time, and the times and values
+//! of the positional extremes refer to the trajectory time
+//! \f$ \tau \f$, that is, to a factor of one. The time warp is applied
+//! by TypeIIRMLPosition::GetNextStateOfMotion() with input and output
+//! parameter objects only, not by the variant with views and not by
+//! TypeIIRMLPosition::GetNextStateOfMotionAtTime().
+//!
+//! \param Factor
+//! Non-negative feed override factor (e.g., 0.5 for 50%). Factors greater
+//! than one are allowed, but the kinematic motion constraints are
+//! exceeded in this case.
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Factor is negative
+//! or not finite
+//!
+//! \sa ReflexxesAPI::SetFeedOverride()
+//  ----------------------------------------------------------
+    int SetFeedOverride(const double &Factor);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetMaxFeedOverrideRate(const double &Rate)
+//!
+//! \brief
+//! Sets the maximum rate of change of the applied feed override factor
+//! TypeIIRMLPosition::MaxFeedOverrideRate
+//!
+//! \details
+//! The applied factor changes linearly, such that the output
+//! acceleration changes by at most
+//! \f$ \dot{s}^{\,max}\,\left|\vec{V}(\tau)\right| \f$ when a change starts
+//! or ends.
+//!
+//! \param Rate
+//! Positive rate in \f$ \frac{1}{s} \f$ (cf.
+//! RML_DEFAULT_MAX_FEED_OVERRIDE_RATE)
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Rate is not
+//! positive
+//!
+//! \sa TypeIIRMLPosition::SetFeedOverride()
+//  ----------------------------------------------------------
+    int SetMaxFeedOverrideRate(const double &Rate);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline double GetFeedOverride(void) const
+//!
+//! \brief
+//! Returns the feed override factor \f$ s \f$ that was applied at the
+//! end of the last cycle
+//!
+//! \sa TypeIIRMLPosition::SetFeedOverride()
+//  ----------------------------------------------------------
+    inline double GetFeedOverride(void) const
+    {
+        return(this->AppliedFeedOverride);
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void GetScaledKinematicLimits(const RMLPositionInputParameters &InputValues, RMLDoubleVector *MaxVelocityVector, RMLDoubleVector *MaxAccelerationVector, RMLDoubleVector *MaxJerkVector) const
+//!
+//! \brief
+//! Provides the kinematic motion constraints of the output values for the
+//! applied feed override factor
+//!
+//! \details
+//! For the factor \f$ s \f$ and its rate of change \f$ \dot{s} \f$ of
+//! the last cycle, the bounds are
+//! \f$ s\,V_i^{\,max} \f$, \f$ s^2\,A_i^{\,max}\,+\,|\dot{s}|\,V_i^{\,max} \f$,
+//! and \f$ s^3\,J_i^{\,max}\,+\,3\,s\,|\dot{s}|\,A_i^{\,max} \f$ (the
+//! latter except for the instants, at which a change of the factor
+//! starts or ends).
+//!
+//! \param InputValues
+//! Input values, whose kinematic motion constraints are scaled
+//!
+//! \param MaxVelocityVector
+//! Pointer to a vector for the scaled maximum velocities
+//!
+//! \param MaxAccelerationVector
+//! Pointer to a vector for the scaled maximum accelerations
+//!
+//! \param MaxJerkVector
+//! Pointer to a vector for the scaled maximum jerks
+//!
+//! \sa TypeIIRMLPosition::SetFeedOverride()
+//  ----------------------------------------------------------
+    void GetScaledKinematicLimits(      const RMLPositionInputParameters    &InputValues
+                                    ,   RMLDoubleVector                     *MaxVelocityVector
+                                    ,   RMLDoubleVector                     *MaxAccelerationVector
+                                    ,   RMLDoubleVector                     *MaxJerkVector          ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int SetTrajectoryCache(const size_t &MemoryBudgetInBytes, const double &Resolution)
+//!
+//! \brief
+//! Sets up a cache for trajectories that are calculated repeatedly
+//!
+//! \details
+//! Many applications execute the same motions again and again, for
+//! instance, from rest to rest between fixed stations with the same
+//! kinematic motion constraints. With the cache, the results of Steps 1
+//! and 2 of all new calculations are stored, and if the input values of a
+//! later calculation match a stored trajectory, Steps 1 and 2 are
+//! skipped entirely.\n
+//! \n
+//! The key of a trajectory consists of the position differences
+//! \f$ \vec{P}_{i}^{\,trgt}\,-\,\vec{P}_{i} \f$, the current and target
+//! velocity vectors, the kinematic motion constraints, the selection
+//! vector, the minimum synchronization time, the cycle time, and
+//! RMLFlags::SynchronizationBehavior. All values except the cycle time
+//! are rounded to integer multiples of \c Resolution before they are
+//! compared. As positions are only contained relatively, the position
+//! polynomials of a stored trajectory are translated to the current
+//! position. Because of this and because of the rounding, the output
+//! values of a cached trajectory may differ slightly from the ones of a
+//! new calculation: the difference of the final positions is bounded
+//! by \c Resolution, and the translation adds rounding errors of a few
+//! units in the last place (e.g., about \f$ 10^{-15} \f$ for positions
+//! in the order of one).\n
+//! \n
+//! If \c Resolution is zero, the target positions instead of the
+//! position differences are part of the key, and a stored trajectory is
+//! only used if the current positions of all selected degrees of
+//! freedom are equal, too. All values have to match bit by bit, no
+//! translation takes place, and the output values of a cached
+//! trajectory are bit-identical to the ones of a new calculation. Such
+//! a cache is only useful if motions start at exactly the same
+//! positions, for instance, if the current state of motion is not fed
+//! back but set by the application.\n
+//! \n
+//! If all entries are used, the least recently used one is replaced. The
+//! cache is not used with RMLPositionFlags::EnableDeterministicTiming,
+//! by TypeIIRMLPosition::GetMinimumExecutionTime(), and by the
+//! calculations distributed over several cycles (cf.
+//! RMLPositionFlags::NumberOfRecomputationCycles).\n
+//! \n
+//! This method allocates memory and is not real-time capable; all
+//! entries and statistics are discarded, and a trajectory cache file
+//! that was mapped by TypeIIRMLPosition::MapTrajectoryCacheFile() is
+//! unmapped. A trajectory cache is not set up by default.
+//!
+//! \param MemoryBudgetInBytes
+//! Maximum number of bytes that may be occupied by the cache. The number
+//! of entries is the budget divided by the size of one entry, which is
+//! proportional to TypeIIRMLPosition::MaxNumberOfDOFs. A value that is
+//! smaller than the size of one entry disables the cache.
+//!
+//! \param Resolution
+//! Non-negative resolution of the key values. If it is zero, all values
+//! including the current positions have to match bit by bit.
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if \c Resolution is
+//! negative or not finite. In case of an error, the cache remains
+//! unchanged.
+//!
+//! \sa ReflexxesAPI::SetTrajectoryCache()
+//! \sa TypeIIRMLPosition::GetTrajectoryCacheStatistics()
+//  ----------------------------------------------------------
+    int SetTrajectoryCache(     const size_t    &MemoryBudgetInBytes
+                            ,   const double    &Resolution         );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void GetTrajectoryCacheStatistics(unsigned long long *NumberOfHits, unsigned long long *NumberOfMisses, unsigned int *NumberOfEntries) const
+//!
+//! \brief
+//! Provides the statistics of the trajectory cache since the last call
+//! of TypeIIRMLPosition::SetTrajectoryCache()
+//!
+//! \details
+//! Each of the pointers may be \c NULL.
+//!
+//! \param NumberOfHits
+//! Pointer to a value for the number of calculations that used a stored
+//! trajectory
+//!
+//! \param NumberOfMisses
+//! Pointer to a value for the number of calculations that executed
+//! Steps 1 and 2
+//!
+//! \param NumberOfEntries
+//! Pointer to a value for the maximum number of stored trajectories
+//!
+//! \sa TypeIIRMLPosition::SetTrajectoryCache()
+//  ----------------------------------------------------------
+    void GetTrajectoryCacheStatistics(      unsigned long long  *NumberOfHits
+                                        ,   unsigned long long  *NumberOfMisses
+                                        ,   unsigned int        *NumberOfEntries    ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int WriteTrajectoryCacheFile(const char *FileName) const
+//!
+//! \brief
+//! Writes all trajectories of the trajectory cache into a file
+//!
+//! \details
+//! A controller process that maps this file by
+//! TypeIIRMLPosition::MapTrajectoryCacheFile() right after its start-up
+//! can use the contained trajectories immediately. This way, a set of
+//! frequently executed motions can be declared once: A process with a
+//! trajectory cache that is large enough for all of them calculates each
+//! motion once (e.g., by one call of ReflexxesAPI::RMLPosition() per
+//! motion) and writes the file afterwards.\n
+//! \n
+//! The file format is described in RMLTrajectoryCacheFormat.h. The file
+//! is written under the name \c FileName with the suffix
+//! RML_TRAJECTORY_CACHE_TEMPORARY_SUFFIX first and then renamed to
+//! \c FileName, which replaces an existing file. On POSIX systems,
+//! processes that have mapped the existing file keep using its previous
+//! contents until they map the file again; on Windows systems, the
+//! replacement fails while any process maps the existing file. Only one
+//! process may write the same file at a time. This method is not
+//! real-time capable.
+//!
+//! \param FileName
+//! Name of the file to be written
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or ReflexxesAPI::RML_ERROR, if
+//! the file could not be written or replaced or if no trajectory cache
+//! is set up. In case of an error, an existing file remains unchanged.
+//!
+//! \sa TypeIIRMLPosition::SetTrajectoryCache()
+//! \sa TypeIIRMLPosition::MapTrajectoryCacheFile()
+//  ----------------------------------------------------------
+    int WriteTrajectoryCacheFile(const char *FileName) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int MapTrajectoryCacheFile(const char *FileName)
+//!
+//! \brief
+//! Maps a file written by TypeIIRMLPosition::WriteTrajectoryCacheFile()
+//! read-only into memory, such that its trajectories can be used without
+//! calculating them
+//!
+//! \details
+//! The trajectories of the file are used by the same rules as the ones of
+//! the trajectory cache in memory (cf.
+//! TypeIIRMLPosition::SetTrajectoryCache()), but they are neither
+//! copied nor replaced. Only trajectories that are not contained in the
+//! memory are looked up in the file, which is done by a binary search
+//! over the hash values of its records. All processes that map the same
+//! file share its physical memory.\n
+//! \n
+//! Files of another format version or library version, files of a
+//! machine with another byte order, and files that were written with
+//! another resolution of the key values are rejected, as well as files
+//! with a record whose checksum or hash value does not match. Except for
+//! this validation, no calculations are performed, such that many
+//! controllers can be started at the same time.\n
+//! \n
+//! A previously mapped file is unmapped first. The file remains mapped
+//! until TypeIIRMLPosition::UnmapTrajectoryCacheFile() or
+//! TypeIIRMLPosition::SetTrajectoryCache() are called or until this
+//! object is destroyed. This method is not real-time capable.
+//!
+//! \param FileName
+//! Name of the file to be mapped
+//!
+//! \return
+//!  - ReflexxesAPI::RML_WORKING on success,
+//!  - ReflexxesAPI::RML_ERROR, if the file could not be mapped, or
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if the file was
+//!    rejected.
+//!
+//! \sa TypeIIRMLPosition::WriteTrajectoryCacheFile()
+//! \sa RMLTrajectoryCacheFormat.h
+//  ----------------------------------------------------------
+    int MapTrajectoryCacheFile(const char *FileName);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void UnmapTrajectoryCacheFile(void)
+//!
+//! \brief
+//! Unmaps the file mapped by TypeIIRMLPosition::MapTrajectoryCacheFile()
+//!
+//! \details
+//! The current trajectory remains valid, even if it was taken from the
+//! file. This method is not real-time capable.
+//  ----------------------------------------------------------
+    void UnmapTrajectoryCacheFile(void);
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int ComputeNextStateOfMotion(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Executes the algorithm for the input values stored in
+//! TypeIIRMLPosition::CurrentInputParameters
+//!
+//! \details
+//! This method contains the algorithm of
+//! TypeIIRMLPosition::GetNextStateOfMotion(). It expects that the number of
+//! degrees of freedom has been checked, and the result is stored in
+//! TypeIIRMLPosition::OutputParameters, from where the public methods copy it
+//! into the respective output data structure of the user.
+//!
+//! \param Flags
+//! A set of boolean values to configure the behavior of the algorithm.
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue, which is also stored in
+//! TypeIIRMLPosition::ReturnValue
+//!
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//  ----------------------------------------------------------
+    int ComputeNextStateOfMotion(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum FunctionResults
+//!
+//! \brief
+//! For class-internal use only: return values of boolean methods
+//  ----------------------------------------------------------
+    enum FunctionResults
+    {
+        //! \brief The method was executed without any error
+        FUNC_SUCCESS        =   false,
+        //! \brief The method was executed, and an error occurred
+        FUNC_ERROR_OCCURRED =   true
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \enum DominatValueForPhaseSync
+//!
+//! \brief
+//! Set of input vector identifiers that can determine the normalized
+//! vector for phase-synchronization.
+//!
+//! \details
+//! In order to assure numerical stability, the input vector with the
+//! greatest magnitude is used to compute the normalized reference
+//! direction vector for phase-synchronized trajectories. The attribute
+//! TypeIIRMLPosition::PhaseSynchronizationMagnitude is set-up by the
+//! method TypeIIRMLPosition::IsPhaseSynchronizationPossible(),
+//! which checks, whether all conditions for the generation of a
+//! phase-synchronized trajectory are fulfilled.
+//!
+//! \sa TypeIIRMLPosition::PhaseSynchronizationMagnitude
+//! \sa TypeIIRMLPosition::IsPhaseSynchronizationPossible()
+//! \sa \ref page_SynchronizationBehavior
+//  ----------------------------------------------------------
+    enum DominatValueForPhaseSync
+    {
+        //! \brief No value has been assigned yet.
+        UNDEFINED           =   0,
+        //! \brief The position difference vector
+        //! \f$ \left( \vec{P}_i^{\,trgt}\ -\ \vec{P}_i\right) \f$
+        //! was to the dominant value to determine the reference vector
+        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
+        POSITION            =   1,
+        //! \brief The current acceleration vector \f$ \vec{A}_i \f$
+        //! was to the dominant value to determine the reference vector
+        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
+        CURRENT_VELOCITY    =   3,
+        //! \brief The target velocity vector \f$ \vec{V}_i^{\,trgt} \f$
+        //! was to the dominant value to determine the reference vector
+        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
+        TARGET_VELOCITY     =   4
+    };
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void CompareInitialAndTargetStateofMotion(void)
+//!
+//! \brief
+//! If the initial state of motion \em exactly equals the target state of
+//! motion, an adaptation is performed
+//!
+//! \details
+//! If the initial state of motion \em exactly equals the target state
+//! of motion, we add a negligible error to the input state of motion in
+//! order to let the decision trees run deterministically. Otherwise, these
+//! values would be a singularity for the decision trees as
+//!
+//! - either <em>no trajectory</em> is required (i.e., an execution time
+//!   of zero seconds), or
+//! - the current motion is continued until the same state of motion is
+//!   reached again (time-optimally).
+//!
+//! As this case can only occur, if the input values change, \em and if
+//! the output values of the last cycle are not directly fed back to the
+//! input parameters of this cycle, we need to calculate the trajectory to
+//! reach the desired state of motion. Otherwise, no trajectory would be
+//! required at all and it would not make sense to the On-Line
+//! Trajectory Generation algorithm.
+//!
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//  ----------------------------------------------------------
+    void CompareInitialAndTargetStateofMotion(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Step1(void)
+//!
+//! \brief
+//! Step 1 of the On-Line Trajectory Generation algorithm: Calculate
+//! the synchronization time \f$ t_i^{\,sync} \f$
+//!
+//! \details
+//! The only result of this method is a value for the synchronization time
+//! \f$ t_i^{\,sync} \f$ (cf. TypeIIRMLPosition::SynchronizationTime) and
+//! the information, whether the motion is phase-synchronized or
+//! time-synchronized (cf.
+//! TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized).\n
+//! \n
+//! To achieve this, a set of other functionalities is used:
+//! <ul>
+//!   <li>TypeIIRMLMath::TypeIIRMLDecisionTree1A() to calculate
+//!       \f$ \vec{t}_i^{\,min} \f$ (cf.
+//!       TypeIIRMLPosition::MinimumExecutionTimes)</li>
+//!   <li>TypeIIRMLPosition::IsPhaseSynchronizationPossible() to check, whether
+//!       phase-synchronization is possible</li>
+//!   <li><ul>
+//!         <li>TypeIIRMLMath::TypeIIRMLDecisionTree1B(), and</li>
+//!         <li>TypeIIRMLMath::TypeIIRMLDecisionTree1C()\n</li>
+//!       </ul>
+//!       to calculate all inoperative time intervals
+//!       \f$ _k{\cal Z}_i\ \forall\ k\ \in\ \left\{1,\,\dots,\,K\right\} \f$
+//!   <li>TypeIIRMLMath::Quicksort() to sort all calculated times and to
+//!       finally determine the synchronization time \f$ t_i^{\,sync} \f$.
+//! </ul>
+//! \n
+//! A brief overview about the interrelations among the different steps
+//! and decision trees can be found in section \ref page_TypeIIAndIVOverview.
+//!
+//! \sa TypeIIRMLPosition::Step2()
+//! \sa TypeIIRMLPosition::Step3()
+//! \sa TypeIIRMLPosition::SynchronizationTime
+//! \sa TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized
+//! \sa \ref page_TypeIIAndIVOverview
+//  ----------------------------------------------------------
+    void Step1(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Step1MinimumExecutionTimes(const unsigned int &FirstDOF, const unsigned int &LastDOF)
+//!
+//! \brief
+//! First part of Step 1: Calculates the minimum execution times
+//! \f$ \vec{t}_i^{\,min} \f$ of a range of degrees of freedom by means of
+//! TypeIIRMLMath::TypeIIRMLDecisionTree1A()
+//!
+//! \param FirstDOF
+//! Index of the first degree of freedom of the range
+//!
+//! \param LastDOF
+//! Index of the first degree of freedom behind the range
+//!
+//! \sa TypeIIRMLPosition::Step1()
+//! \sa TypeIIRMLPosition::ExecuteAmortizedRecomputationStage()
+//  ----------------------------------------------------------
+    void Step1MinimumExecutionTimes(        const unsigned int  &FirstDOF
+                                        ,   const unsigned int  &LastDOF    );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Step1SynchronizationTime(void)
+//!
+//! \brief
+//! Second part of Step 1: Determines the synchronization time
+//! \f$ t_i^{\,sync} \f$ based on the minimum execution times of all
+//! degrees of freedom
+//!
+//! \details
+//! The minimum execution times have to be calculated by
+//! TypeIIRMLPosition::Step1MinimumExecutionTimes() for all selected
+//! degrees of freedom before.
+//!
+//! \sa TypeIIRMLPosition::Step1()
+//  ----------------------------------------------------------
+    void Step1SynchronizationTime(void);
+
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ApplyMinimumSynchronizationTime(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Increases the synchronization time calculated by
+//! TypeIIRMLPosition::Step1() to the value of
+//! RMLPositionInputParameters::MinimumSynchronizationTime
+//!
+//! \details
+//! If the desired minimum synchronization time lies within an
+//! inoperative time interval, the next possible synchronization time
+//! is used. For non-synchronized motions, the method does nothing.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \sa TypeIIRMLPosition::Step1()
+//! \sa TypeIIRMLPosition::IsWithinAnInoperativeTimeInterval()
+//  ----------------------------------------------------------
+    void ApplyMinimumSynchronizationTime(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void ExecuteDeterministicTimingPath(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Completes a cycle with the execution path of a trajectory calculation,
+//! if RMLPositionFlags::EnableDeterministicTiming is set
+//!
+//! \details
+//! This method is called after TypeIIRMLPosition::ComputeNextStateOfMotion().
+//! If the cycle did not execute Steps 1 and 2 (i.e., the existing
+//! trajectory was only sampled, or the fall-back strategy became active),
+//! Steps 1 and 2 are executed by
+//! TypeIIRMLPosition::DeterministicTimingInstance for fixed input values
+//! of the same number of degrees of freedom. These values are chosen,
+//! such that all degrees of freedom have to be modified, the check for
+//! phase-synchronization passes all degrees of freedom before it fails,
+//! and inoperative time intervals and the minimum synchronization time
+//! have to be considered. Without synchronization, the target velocities
+//! are zero, such that all degrees of freedom overshoot their target
+//! positions. Step 3 and the calculation of the positional
+//! extremes were already executed by this object. The result of the
+//! instance is discarded, such that the output values of this object
+//! remain unchanged.\n
+//! \n
+//! The instance TypeIIRMLPosition::DeterministicTimingInstance is
+//! allocated by the first call with the flag set.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \sa RMLPositionFlags::EnableDeterministicTiming
+//  ----------------------------------------------------------
+    void ExecuteDeterministicTimingPath(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double AdvanceFeedOverride(const double &ElapsedTimeInSeconds)
+//!
+//! \brief
+//! Moves the applied feed override factor towards the desired one and
+//! returns the trajectory time that corresponds to the elapsed time
+//!
+//! \details
+//! TypeIIRMLPosition::AppliedFeedOverride and
+//! TypeIIRMLPosition::FeedOverrideRate are updated.
+//!
+//! \param ElapsedTimeInSeconds
+//! Duration of the current cycle in seconds
+//!
+//! \return
+//! Trajectory time \f$ \Delta\tau \f$ of the current cycle, that is, the
+//! integral of the applied factor over the cycle
+//!
+//! \sa TypeIIRMLPosition::SetFeedOverride()
+//  ----------------------------------------------------------
+    double AdvanceFeedOverride(const double &ElapsedTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void TransformInputValuesToTrajectoryTime(const double &Factor, const double &Rate)
+//!
+//! \brief
+//! Transforms the current velocity and acceleration vectors of
+//! TypeIIRMLPosition::CurrentInputParameters from the time of the user
+//! to the trajectory time
+//!
+//! \details
+//! If the current state of motion equals the output values of the last
+//! cycle, the unscaled output values of the last cycle are used, such that
+//! the trajectory is continued without a new calculation.
+//!
+//! \param Factor
+//! Feed override factor that was applied to the output values of the last
+//! cycle
+//!
+//! \param Rate
+//! Rate of change of the factor that was applied to the output values of
+//! the last cycle
+//  ----------------------------------------------------------
+    void TransformInputValuesToTrajectoryTime(      const double    &Factor
+                                                ,   const double    &Rate   );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void TransformOutputValuesToRealTime(RMLPositionOutputParameters *OP) const
+//!
+//! \brief
+//! Scales the velocity and acceleration vectors of the output values with
+//! the applied feed override factor and its rate of change
+//!
+//! \param OP
+//! Pointer to the output values
+//  ----------------------------------------------------------
+    void TransformOutputValuesToRealTime(RMLPositionOutputParameters *OP) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool IsIncrementalRecomputationPossible(const RMLPositionFlags &Flags) const
+//!
+//! \brief
+//! Checks, whether only the degrees of freedom with changed input values
+//! may be recalculated
+//!
+//! \details
+//! This is the case, if
+//!
+//!  - the current trajectory was calculated with
+//!    RMLFlags::NO_SYNCHRONIZATION, such that all degrees of freedom are
+//!    independent of each other,
+//!  - the last cycle provided a valid trajectory
+//!    (ReflexxesAPI::RML_WORKING or ReflexxesAPI::RML_FINAL_STATE_REACHED),
+//!  - the flags did not change,
+//!  - RMLPositionFlags::EnableDeterministicTiming is not set, and
+//!  - the calculation is not distributed over several cycles
+//!    (cf. RMLPositionFlags::NumberOfRecomputationCycles).
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \return
+//! \c true, if an incremental recalculation is possible
+//!
+//! \sa TypeIIRMLPosition::RecomputeChangedDOFs()
+//  ----------------------------------------------------------
+    bool IsIncrementalRecomputationPossible(const RMLPositionFlags &Flags) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void RecomputeChangedDOFs(void)
+//!
+//! \brief
+//! Executes Step 1 and Step 2 only for the degrees of freedom marked in
+//! TypeIIRMLPosition::ChangedDOFsVector
+//!
+//! \details
+//! Degrees of freedom, whose trajectory has already ended or that were
+//! not part of the modified selection vector, are recalculated as well,
+//! because a complete calculation would plan them anew from their
+//! current state of motion (e.g., if they continue with a non-zero target
+//! velocity beyond their target position). The motion polynomials of all
+//! other selected degrees of freedom are kept, and their time base is
+//! shifted by the value of TypeIIRMLPosition::InternalClockInSeconds of
+//! the last cycle, such that the time \f$ t\,=\,0 \f$ corresponds to
+//! the current state of motion for all degrees of freedom. Afterwards,
+//! the internal clock is set to one cycle as after a complete
+//! calculation.
+//!
+//! \sa TypeIIRMLPosition::IsIncrementalRecomputationPossible()
+//  ----------------------------------------------------------
+    void RecomputeChangedDOFs(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn double QuantizeForTrajectoryCache(const double &Value) const
+//!
+//! \brief
+//! Rounds a value to an integer multiple of
+//! TypeIIRMLPosition::TrajectoryCacheResolution
+//!
+//! \return
+//! The number of multiples (a negative zero is returned as positive
+//! zero) or, if the resolution is zero, the unchanged value
+//  ----------------------------------------------------------
+    double QuantizeForTrajectoryCache(const double &Value) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void CalculateTrajectoryCacheKey(void)
+//!
+//! \brief
+//! Sets up TypeIIRMLPosition::TrajectoryCacheKeyValues and
+//! TypeIIRMLPosition::TrajectoryCacheHashValue for the current input
+//! values
+//  ----------------------------------------------------------
+    void CalculateTrajectoryCacheKey(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool LookUpTrajectoryCache(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Replaces Steps 1 and 2 by a stored trajectory, if one matches the
+//! current input values
+//!
+//! \details
+//! The position polynomials of each selected degree of freedom are
+//! translated by the difference between its current position and the
+//! current position, for which the trajectory was calculated. If
+//! TypeIIRMLPosition::TrajectoryCacheResolution is zero, this difference
+//! has to be zero.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \return
+//! \c true, if a stored trajectory was used
+//!
+//! \sa TypeIIRMLPosition::SetTrajectoryCache()
+//! \sa TypeIIRMLPosition::StoreInTrajectoryCache()
+//  ----------------------------------------------------------
+    bool LookUpTrajectoryCache(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void StoreInTrajectoryCache(const RMLPositionFlags &Flags)
+//!
+//! \brief
+//! Stores the trajectory calculated by Steps 1 and 2 in the entry that
+//! was used least recently
+//!
+//! \details
+//! This method has to be called after a call of
+//! TypeIIRMLPosition::LookUpTrajectoryCache() for the same input values
+//! returned \c false.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//  ----------------------------------------------------------
+    void StoreInTrajectoryCache(const RMLPositionFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool LookUpTrajectoryCacheFile(const RMLPositionFlags &Flags, const double &MinimumSynchronizationTime)
+//!
+//! \brief
+//! Replaces Steps 1 and 2 by a trajectory of the mapped trajectory cache
+//! file, if one matches the current input values
+//!
+//! \details
+//! TypeIIRMLPosition::CalculateTrajectoryCacheKey() has to be called
+//! before.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \param MinimumSynchronizationTime
+//! Quantized value of RMLInputParameters::MinimumSynchronizationTime
+//!
+//! \return
+//! \c true, if a trajectory of the file was used
+//!
+//! \sa TypeIIRMLPosition::MapTrajectoryCacheFile()
+//  ----------------------------------------------------------
+    bool LookUpTrajectoryCacheFile(     const RMLPositionFlags  &Flags
+                                    ,   const double            &MinimumSynchronizationTime );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void TranslatePositionPolynomials(const unsigned int &DOF, const double &Offset)
+//!
+//! \brief
+//! Adds \c Offset to all valid position polynomials of one degree of
+//! freedom
+//!
+//! \details
+//! This is used to apply a stored trajectory to another current
+//! position (cf. TypeIIRMLPosition::LookUpTrajectoryCache()).
+//  ----------------------------------------------------------
+    void TranslatePositionPolynomials(      const unsigned int  &DOF
+                                        ,   const double        &Offset );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool IsAmortizedRecomputationPossible(const RMLPositionFlags &Flags) const
+//!
+//! \brief
+//! Checks, whether the trajectory of the last cycle can be continued
+//! while a new trajectory is calculated over several cycles
+//!
+//! \details
+//! This is the case, if
+//!
+//!  - RMLPositionFlags::NumberOfRecomputationCycles is greater than one,
+//!  - the last cycle provided a valid trajectory
+//!    (ReflexxesAPI::RML_WORKING or ReflexxesAPI::RML_FINAL_STATE_REACHED),
+//!  - the flags and the selection vector did not change,
+//!  - the current position and velocity vectors equal the output values
+//!    of the last cycle, and
+//!  - the duration of the current cycle equals the nominal cycle time
+//!    (cf. TypeIIRMLPosition::NominalCycleTime).
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \return
+//! \c true, if the trajectory of the last cycle can be continued
+//!
+//! \sa RMLPositionFlags::NumberOfRecomputationCycles
+//  ----------------------------------------------------------
+    bool IsAmortizedRecomputationPossible(const RMLPositionFlags &Flags) const;
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn int GetNextStateOfMotionAtTime(const double &TimeValueInSeconds, RMLPositionOutputParameters *OutputValues) const
+//! \fn bool StartAmortizedRecomputation(const RMLPositionFlags &Flags)
 //!
 //! \brief
-//! Once the method of TypeIIRMLPosition::GetNextStateOfMotion() was
-//! \em successfully called to compute a trajectory, this method can be
-//! used to compute a state of motion on this trajectory at a given time
-//! instant.
+//! Starts the calculation of a new trajectory over
+//! RMLPositionFlags::NumberOfRecomputationCycles cycles
 //!
 //! \details
-//! After the method GetNextStateOfMotion() was called and no error value
-//! was returned (i.e., ReflexxesAPI::RML_WORKING or
-//! ReflexxesAPI::RML_FINAL_STATE_REACHED was returned), a trajectory was
-//! successfully generated. In order to compute a state of motion of this
-//! trajectory at a given time instant, this method can be used.
-//! No new calculations are started by calling this method; only the
-//! existing result of the method GetNextStateOfMotion() is used.
-//! \c TimeValueInSeconds specifies the time of the desired state of
-//! motion, which is copied to OutputValues (cf.
-//! RMLPositionOutputParameters).\n
-//! \n
-//! If the method TypeIIRMLPosition::GetNextStateOfMotion() returned an
-//! error, the same error will be returned by this method. The value of
-//! \c TimeValueInSeconds has to be positive and below the values of
-//! RML_MAX_EXECUTION_TIME (\f$ 10^{10} \f$ seconds).\n
-//! \n
-//! For further information, please refer to the documentation of
-//! TypeIIRMLPosition::GetNextStateOfMotion().
-//!
-//! \param TimeValueInSeconds
-//! Time value in seconds, at which the desired state of motion is
-//! calculated.
+//! The new trajectory is calculated by
+//! TypeIIRMLPosition::AmortizedRecomputationInstance. Its initial state
+//! of motion is the state of motion, which the trajectory of the last
+//! cycle reaches at the end of the last cycle before the switch, such
+//! that the switch to the new trajectory is state-consistent. The current
+//! input values are stored as the input values of the new trajectory, and
+//! the first stage of the calculation is executed
+//! (cf. TypeIIRMLPosition::ExecuteAmortizedRecomputationStage()).
+//! Afterwards, the trajectory of the last cycle is continued for this
+//! cycle.
 //!
-//! \param OutputValues
-//! Output values of the position-based Type II On-Line Trajectory
-//! Generation algorithm. For detailed information, please refer to the
-//! class RMLPositionOutputParameters and to the page
-//! \ref page_OutputValues.
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
 //!
 //! \return
-//! An element of ReflexxesAPI::RMLResultValue:\n\n
-//!  - ReflexxesAPI::RML_WORKING: \copydoc ReflexxesAPI::RML_WORKING\n\n
-//!  - ReflexxesAPI::RML_FINAL_STATE_REACHED: \copydoc ReflexxesAPI::RML_FINAL_STATE_REACHED\n\n
-//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES: \copydoc ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES\n\n
-//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS: \copydoc ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS\n\n
-//!  - ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION: \copydoc ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION\n\n
-//!  - ReflexxesAPI::RML_ERROR_NULL_POINTER: \copydoc ReflexxesAPI::RML_ERROR_NULL_POINTER\n\n
-//!  - ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG: \copydoc ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG\n\n
-//!  - ReflexxesAPI::RML_ERROR_USER_TIME_OUT_OF_RANGE: \copydoc ReflexxesAPI::RML_ERROR_USER_TIME_OUT_OF_RANGE\n\n
+//! \c false, if the new trajectory cannot be calculated over several
+//! cycles. In this case, it has to be calculated within this cycle.
 //!
-//! \sa TypeIIRMLPosition
-//! \sa RMLPositionOutputParameters
-//! \sa RMLPositionFlags
-//! \sa ReflexxesAPI
-//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
-//! \sa TypeIIRMLVelocity::GetNextStateOfMotionAtTime()
+//! \sa TypeIIRMLPosition::ContinueAmortizedRecomputation()
 //  ----------------------------------------------------------
-    int GetNextStateOfMotionAtTime(     const double                        &TimeValueInSeconds
-                                    ,   RMLPositionOutputParameters         *OutputValues       ) const;
+    bool StartAmortizedRecomputation(const RMLPositionFlags &Flags);
 
-protected:
 
 //  ---------------------- Doxygen info ----------------------
-//! \enum FunctionResults
+//! \fn bool ContinueAmortizedRecomputation(const RMLPositionFlags &Flags, bool *ANewCalculationWasPerformed)
 //!
 //! \brief
-//! For class-internal use only: return values of boolean methods
+//! Executes the next stage of a trajectory calculation that was started
+//! by TypeIIRMLPosition::StartAmortizedRecomputation()
+//!
+//! \details
+//! In all cycles but the last one, the trajectory of the last cycle is
+//! continued. In the last cycle, the new trajectory becomes the current
+//! one, and its input values become the input values of this cycle. The
+//! current state of motion of degrees of freedom, which are already in
+//! their target state of motion, is set to this state as in
+//! TypeIIRMLPosition::SetupModifiedSelectionVector(), such that the output
+//! values equal the ones of a calculation within this cycle.
+//! Changes of the input values that occurred in the meantime are
+//! detected in the next cycle and lead to another calculation.
+//!
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \param ANewCalculationWasPerformed
+//! Pointer to a \c bool value, which is set to \c true, if this cycle
+//! switched to the new trajectory
+//!
+//! \return
+//! \c false, if the calculation was discarded, because the input values
+//! are not consistent with the output values of the last cycle, or
+//! because Step 1 failed. In this case, a new trajectory has to be
+//! calculated within this cycle.
 //  ----------------------------------------------------------
-    enum FunctionResults
-    {
-        //! \brief The method was executed without any error
-        FUNC_SUCCESS        =   false,
-        //! \brief The method was executed, and an error occurred
-        FUNC_ERROR_OCCURRED =   true
-    };
+    bool ContinueAmortizedRecomputation(        const RMLPositionFlags  &Flags
+                                            ,   bool                    *ANewCalculationWasPerformed);
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \enum DominatValueForPhaseSync
+//! \fn bool ExecuteAmortizedRecomputationStage(const RMLPositionFlags &Flags)
 //!
 //! \brief
-//! Set of input vector identifiers that can determine the normalized
-//! vector for phase-synchronization.
+//! Executes one stage of a trajectory calculation by
+//! TypeIIRMLPosition::AmortizedRecomputationInstance
 //!
 //! \details
-//! In order to assure numerical stability, the input vector with the
-//! greatest magnitude is used to compute the normalized reference
-//! direction vector for phase-synchronized trajectories. The attribute
-//! TypeIIRMLPosition::PhaseSynchronizationMagnitude is set-up by the
-//! method TypeIIRMLPosition::IsPhaseSynchronizationPossible(),
-//! which checks, whether all conditions for the generation of a
-//! phase-synchronized trajectory are fulfilled.
+//! For \f$ K \f$ cycles (cf. RMLPositionFlags::NumberOfRecomputationCycles),
+//! the minimum execution times of the degrees of freedom are calculated
+//! in equally sized portions during the stages \f$ 1,\,\dots,\,K-1 \f$.
+//! Stage \f$ K-1 \f$ additionally determines the synchronization time,
+//! and stage \f$ K \f$ executes Step 2.
 //!
-//! \sa TypeIIRMLPosition::PhaseSynchronizationMagnitude
-//! \sa TypeIIRMLPosition::IsPhaseSynchronizationPossible()
-//! \sa \ref page_SynchronizationBehavior
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
+//!
+//! \return
+//! \c false, if Step 1 did not lead to a valid synchronization time
 //  ----------------------------------------------------------
-    enum DominatValueForPhaseSync
-    {
-        //! \brief No value has been assigned yet.
-        UNDEFINED           =   0,
-        //! \brief The position difference vector
-        //! \f$ \left( \vec{P}_i^{\,trgt}\ -\ \vec{P}_i\right) \f$
-        //! was to the dominant value to determine the reference vector
-        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
-        POSITION            =   1,
-        //! \brief The current acceleration vector \f$ \vec{A}_i \f$
-        //! was to the dominant value to determine the reference vector
-        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
-        CURRENT_VELOCITY    =   3,
-        //! \brief The target velocity vector \f$ \vec{V}_i^{\,trgt} \f$
-        //! was to the dominant value to determine the reference vector
-        //! \f$ \vec{\varrho}_i \f$ for a phase-synchronized trajectory.
-        TARGET_VELOCITY     =   4
-    };
+    bool ExecuteAmortizedRecomputationStage(const RMLPositionFlags &Flags);
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn void CompareInitialAndTargetStateofMotion(void)
+//! \fn void ContinuePreviousTrajectory(void)
 //!
 //! \brief
-//! If the initial state of motion \em exactly equals the target state of
-//! motion, an adaptation is performed
+//! Prepares a cycle, in which the trajectory of the last cycle is
+//! continued, while a new one is calculated
 //!
 //! \details
-//! If the initial state of motion \em exactly equals the target state
-//! of motion, we add a negligible error to the input state of motion in
-//! order to let the decision trees run deterministically. Otherwise, these
-//! values would be a singularity for the decision trees as
+//! The input values of this cycle are replaced by the ones of the current
+//! trajectory (except for the current state of motion), and the internal
+//! clock is advanced by one cycle.
+//  ----------------------------------------------------------
+    void ContinuePreviousTrajectory(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int ComputeOutputValues(const RMLPositionFlags &Flags, const bool &ANewCalculationWasPerformed)
 //!
-//! - either <em>no trajectory</em> is required (i.e., an execution time
-//!   of zero seconds), or
-//! - the current motion is continued until the same state of motion is
-//!   reached again (time-optimally).
+//! \brief
+//! Samples the current trajectory and sets up all output values of a
+//! cycle (Step 3)
 //!
-//! As this case can only occur, if the input values change, \em and if
-//! the output values of the last cycle are not directly fed back to the
-//! input parameters of this cycle, we need to calculate the trajectory to
-//! reach the desired state of motion. Otherwise, no trajectory would be
-//! required at all and it would not make sense to the On-Line
-//! Trajectory Generation algorithm.
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
 //!
-//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//! \param ANewCalculationWasPerformed
+//! Indicates, whether the current trajectory was calculated in this
+//! cycle
+//!
+//! \return
+//! The return value of TypeIIRMLPosition::Step3()
+//!
+//! \sa TypeIIRMLPosition::ComputeNextStateOfMotion()
 //  ----------------------------------------------------------
-    void CompareInitialAndTargetStateofMotion(void);
+    int ComputeOutputValues(        const RMLPositionFlags  &Flags
+                                ,   const bool              &ANewCalculationWasPerformed);
+
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn void Step1(void)
+//! \fn int ComputeMinimumExecutionTime(const RMLPositionFlags &Flags, double *ExecutionTime, bool *IsPhaseSynchronized)
 //!
 //! \brief
-//! Step 1 of the On-Line Trajectory Generation algorithm: Calculate
-//! the synchronization time \f$ t_i^{\,sync} \f$
+//! Executes Step 1 for the validated input values in
+//! TypeIIRMLPosition::CurrentInputParameters and returns the resulting
+//! synchronization time
 //!
-//! \details
-//! The only result of this method is a value for the synchronization time
-//! \f$ t_i^{\,sync} \f$ (cf. TypeIIRMLPosition::SynchronizationTime) and
-//! the information, whether the motion is phase-synchronized or
-//! time-synchronized (cf.
-//! TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized).\n
-//! \n
-//! To achieve this, a set of other functionalities is used:
-//! <ul>
-//!   <li>TypeIIRMLMath::TypeIIRMLDecisionTree1A() to calculate
-//!       \f$ \vec{t}_i^{\,min} \f$ (cf.
-//!       TypeIIRMLPosition::MinimumExecutionTimes)</li>
-//!   <li>TypeIIRMLPosition::IsPhaseSynchronizationPossible() to check, whether
-//!       phase-synchronization is possible</li>
-//!   <li><ul>
-//!         <li>TypeIIRMLMath::TypeIIRMLDecisionTree1B(), and</li>
-//!         <li>TypeIIRMLMath::TypeIIRMLDecisionTree1C()\n</li>
-//!       </ul>
-//!       to calculate all inoperative time intervals
-//!       \f$ _k{\cal Z}_i\ \forall\ k\ \in\ \left\{1,\,\dots,\,K\right\} \f$
-//!   <li>TypeIIRMLMath::Quicksort() to sort all calculated times and to
-//!       finally determine the synchronization time \f$ t_i^{\,sync} \f$.
-//! </ul>
-//! \n
-//! A brief overview about the interrelations among the different steps
-//! and decision trees can be found in section \ref page_TypeIIAndIVOverview.
+//! \param Flags
+//! Flags of the position-based algorithm (cf. RMLPositionFlags)
 //!
-//! \sa TypeIIRMLPosition::Step2()
-//! \sa TypeIIRMLPosition::Step3()
-//! \sa TypeIIRMLPosition::SynchronizationTime
-//! \sa TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized
-//! \sa \ref page_TypeIIAndIVOverview
+//! \param ExecutionTime
+//! A pointer to a \c double value, to which the execution time in seconds
+//! will be written (only if no error occurs).
+//!
+//! \param IsPhaseSynchronized
+//! An optional pointer to a \c bool value (may be \c NULL)
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue
+//!
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTime()
+//! \sa TypeIIRMLPosition::GetMinimumExecutionTimes()
 //  ----------------------------------------------------------
-    void Step1(void);
+    int ComputeMinimumExecutionTime(        const RMLPositionFlags  &Flags
+                                        ,   double                  *ExecutionTime
+                                        ,   bool                    *IsPhaseSynchronized);
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -585,6 +1808,13 @@ protected:
 //! RMLVelocityOutputParameters that finally is casted to a
 //! RMLPositionOutputParameters object, namely \c OutputValues.
 //!
+//! Unless the flag RMLFlags::ONLY_PHASE_SYNCHRONIZATION is set, the
+//! casting procedure is skipped, and the method
+//! TypeIIRMLPosition::DirectFallBackStrategy() computes the same
+//! trajectory without any intermediate objects and with a bounded
+//! execution time; the output values may differ in the last bits and in
+//! the time values of the extremes as described there.
+//!
 //! A detailed description of the three-layered safety mechanism of the
 //! Reflexxes Motion Libraries can be found at \ref page_ErrorHandling.
 //!
@@ -627,7 +1857,112 @@ protected:
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn bool IsWithinAnInoperativeTimeInterval(const double &SynchronizationTimeCandidate, const RMLDoubleVector &MaximalExecutionTime, const RMLDoubleVector &AlternativeExecutionTime) const
+//! \fn void DirectFallBackStrategy(const RMLPositionInputParameters &InputValues, RMLPositionOutputParameters *OutputValues, const RMLPositionFlags &InputsFlags) const
+//!
+//! \brief
+//! Allocation-free implementation of the second layer of the safety
+//! concept that works directly on the given input and output values
+//!
+//! \details
+//! This method is called by TypeIIRMLPosition::FallBackStrategy() unless
+//! the flag RMLFlags::ONLY_PHASE_SYNCHRONIZATION is set. Instead of
+//! copying the input values to an RMLVelocityInputParameters object,
+//! calling TypeIIRMLVelocity::GetNextStateOfMotion(), and copying the
+//! resulting RMLVelocityOutputParameters object back, the two-segment
+//! velocity profile of each degree of freedom (constant acceleration
+//! until the target velocity is reached, constant velocity afterwards)
+//! is computed in closed form from the vectors of \c InputValues, and the
+//! results are written directly into the vectors of \c OutputValues.
+//! The target velocity vector is selected as described at
+//! TypeIIRMLPosition::FallBackStrategy().\n
+//! \n
+//! The arithmetic operations equal the ones of the velocity-based
+//! algorithm with the flag RMLFlags::NO_SYNCHRONIZATION in a cycle, in
+//! which a new trajectory is calculated. If the maximum acceleration of a
+//! selected degree of freedom is not positive, all selected degrees of
+//! freedom keep their current velocity (cf.
+//! TypeIIRMLVelocity::FallBackStrategy()).\n
+//! \n
+//! <b>Deviations from the velocity-based algorithm</b>\n
+//! As this method does not keep any state between two calls, its output
+//! values differ from the ones of the velocity-based algorithm in the
+//! following cases:
+//!
+//!  - If the fall-back strategy is applied in several consecutive cycles
+//!    and the output values are fed back to the input values, the
+//!    velocity-based algorithm continues the trajectory it calculated in
+//!    the first of these cycles, while this method calculates a new
+//!    trajectory from the current state of motion in each cycle. Both
+//!    trajectories are identical in exact arithmetic, but positions,
+//!    velocities, and the synchronization time may differ in the last
+//!    bits (a few units in the last place) from the second cycle on.
+//!
+//!  - The velocity-based algorithm does not assign time values to
+//!    extremes that are reached at the end of the current cycle, such
+//!    that it reports the time values of its previous cycles. This method
+//!    reports zero in this case. The extreme position values are the same.
+//!
+//!  - If RMLFlags::EnableTheCalculationOfTheExtremumMotionStates is
+//!    \c false, the extremum motion states are set to zero, while the
+//!    velocity-based algorithm always calculates them.
+//!
+//! <b>Worst-case execution time</b>\n
+//! The method contains no iterations and no recursions. Its execution time
+//! is bounded by
+//!
+//!  - \f$ \mathcal{O}(K) \f$ (one division and about 20 further
+//!    floating-point operations per degree of freedom) if
+//!    RMLFlags::EnableTheCalculationOfTheExtremumMotionStates is \c false
+//!    (plus zeroing the \f$ 6\,K^2 \f$ extremum values), and
+//!  - \f$ \mathcal{O}(K^2) \f$ (\f$ 2\,K^2 \f$ evaluations of one
+//!    segment of a profile) otherwise,
+//!
+//! where \f$ K \f$ is the number of degrees of freedom.
+//!
+//! \param InputValues
+//! The current input values of the position-based On-Line Trajectory
+//! Generation algorithm; the number of degrees of freedom has to match
+//! TypeIIRMLPosition::NumberOfDOFs.
+//!
+//! \param OutputValues
+//! Pointer to an RMLPositionOutputParameters object, to which the output
+//! values are written; the number of degrees of freedom has to match
+//! TypeIIRMLPosition::NumberOfDOFs.
+//!
+//! \param InputsFlags
+//! The current input flags of the position-based On-Line Trajectory
+//! Generation algorithm.
+//!
+//! \sa TypeIIRMLPosition::FallBackStrategy()
+//! \sa TypeIIRMLVelocityBatch
+//! \sa \ref page_ErrorHandling
+//  ----------------------------------------------------------
+    void DirectFallBackStrategy(        const RMLPositionInputParameters    &InputValues
+                                    ,   RMLPositionOutputParameters         *OutputValues
+                                    ,   const RMLPositionFlags              &InputsFlags    ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SortInoperativeTimeIntervals(void)
+//!
+//! \brief
+//! Sets up the sorted arrays
+//! TypeIIRMLPosition::SortedBeginningsOfInoperativeTimeIntervals and
+//! TypeIIRMLPosition::SortedEndingsOfInoperativeTimeIntervals
+//!
+//! \details
+//! Only the non-empty inoperative time intervals of the degrees of freedom
+//! in TypeIIRMLPosition::ModifiedDOFs are considered. Afterwards, the
+//! method IsWithinAnInoperativeTimeInterval() checks a candidate for
+//! \f$ t_i^{\,sync} \f$ without iterating over all degrees of freedom.
+//!
+//! \sa TypeIIRMLPosition::IsWithinAnInoperativeTimeInterval()
+//  ----------------------------------------------------------
+    void SortInoperativeTimeIntervals(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn bool IsWithinAnInoperativeTimeInterval(const double &SynchronizationTimeCandidate, unsigned int *NumberOfPassedBeginnings, unsigned int *NumberOfPassedEndings) const
 //!
 //! \brief
 //! Checks, whether the value \c SynchronizationTimeCandidate lies
@@ -642,19 +1977,29 @@ protected:
 //! whether it is within an inoperative time interval
 //! \f$ _k\zeta_{i}\ \forall\ k\ \in \ \left\{1,\,\dots,\,K\right\} \f$
 //! where all inoperative intervals are described by
-//! \f$ _k\zeta_{i}\,=\,\left[_kt_{i}^{\,begin},\,_kt_{i}^{\,end}\right] \f$.
+//! \f$ _k\zeta_{i}\,=\,\left[_kt_{i}^{\,begin},\,_kt_{i}^{\,end}\right] \f$.\n
+//! \n
+//! The candidates are checked in ascending order. The method counts the
+//! interval beginnings that are less than the candidate and the interval
+//! endings that are less than or equal to the candidate in the sorted
+//! arrays set up by SortInoperativeTimeIntervals(). The candidate lies
+//! within an inoperative time interval, if the first number is greater.
+//! As both counters are only advanced, checking all candidates requires
+//! \f$ \mathcal{O}(K) \f$ operations instead of
+//! \f$ \mathcal{O}(K^2) \f$.
 //!
 //! \param SynchronizationTimeCandidate
 //! Possible candidate for \f$ t_i^{\,sync} \f$ that will be checked by
-//! this method. The value is given in seconds.
+//! this method. The value is given in seconds and must not be less than
+//! the candidate of the previous call with the same counters.
 //!
-//! \param MaximalExecutionTime
-//! Beginning of an inoperative time interval \f$ _kt_{i}^{\,begin} \f$ in
-//! seconds
+//! \param NumberOfPassedBeginnings
+//! Pointer to the counter of the passed interval beginnings, which has to
+//! be zero for the first candidate
 //!
-//! \param AlternativeExecutionTime
-//! Ending of an inoperative time interval \f$ _kt_{i}^{\,end} \f$ in
-//! seconds
+//! \param NumberOfPassedEndings
+//! Pointer to the counter of the passed interval endings, which has to
+//! be zero for the first candidate
 //!
 //! \return
 //!  - \c true if \c SynchronizationTimeCandidate lies within the
@@ -662,10 +2007,11 @@ protected:
 //!  - \c false otherwise
 //!
 //! \sa TypeIIRMLPosition::Step1()
+//! \sa TypeIIRMLPosition::SortInoperativeTimeIntervals()
 //  ----------------------------------------------------------
     bool IsWithinAnInoperativeTimeInterval(     const double            &SynchronizationTimeCandidate
-                                            ,   const RMLDoubleVector   &MaximalExecutionTime
-                                            ,   const RMLDoubleVector   &AlternativeExecutionTime) const;
+                                            ,   unsigned int            *NumberOfPassedBeginnings
+                                            ,   unsigned int            *NumberOfPassedEndings      ) const;
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -817,6 +2163,22 @@ protected:
                                     ,   RMLPositionOutputParameters *OP                 ) const;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Sets TypeIIRMLPosition::NumberOfDOFs and the dimensions of all
+//! internal vectors and parameter objects
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom, which must not exceed
+//! TypeIIRMLPosition::MaxNumberOfDOFs
+//!
+//! \sa TypeIIRMLPosition::Reconfigure()
+//  ----------------------------------------------------------
+    void SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void SetPositionalExtremsToZero(RMLPositionOutputParameters *OP) const
 //!
@@ -890,14 +2252,72 @@ protected:
 //! TypeIIRMLPosition::CurrentInputParameters \f$ \vec{S}_i \f$, and all
 //! following parts make use of TypeIIRMLPosition::ModifiedSelectionVector.
 //!
-//! \sa TypeIIRMLPosition::ModifiedSelectionVector
-//! \sa RMLPositionInputParameters::SelectionVector
-//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
-//! \sa TypeIIRMLPosition::Step1()
-//! \sa TypeIIRMLVelocity::SetupPhaseSyncSelectionVector()
-//! \sa \ref page_SynchronizationBehavior
+//! \sa TypeIIRMLPosition::ModifiedSelectionVector
+//! \sa RMLPositionInputParameters::SelectionVector
+//! \sa TypeIIRMLPosition::GetNextStateOfMotion()
+//! \sa TypeIIRMLPosition::Step1()
+//! \sa TypeIIRMLVelocity::SetupPhaseSyncSelectionVector()
+//! \sa \ref page_SynchronizationBehavior
+//  ----------------------------------------------------------
+    void SetupModifiedSelectionVector(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetupModifiedSelectionVector(const unsigned int &FirstDOF, const unsigned int &LastDOF)
+//!
+//! \brief
+//! Executes TypeIIRMLPosition::SetupModifiedSelectionVector() for the
+//! degrees of freedom \f$ FirstDOF,\,\dots,\,LastDOF-1 \f$ only
+//!
+//! \param FirstDOF
+//! Index of the first degree of freedom
+//!
+//! \param LastDOF
+//! Index of the last degree of freedom plus one
+//!
+//! \sa TypeIIRMLPosition::RecomputeChangedDOFs()
+//  ----------------------------------------------------------
+    void SetupModifiedSelectionVector(      const unsigned int  &FirstDOF
+                                        ,   const unsigned int  &LastDOF    );
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetupSelectedDOFs(void)
+//!
+//! \brief
+//! Sets up the index list TypeIIRMLPosition::SelectedDOFs of the
+//! degrees of freedom that are selected by
+//! RMLPositionInputParameters::SelectionVector
+//!
+//! \details
+//! The list is only rebuilt if the selection vector differs from the one,
+//! for which the list was set up before
+//! (cf. TypeIIRMLPosition::IndexedSelectionVector), such that the
+//! calculation loops only iterate over the selected degrees of freedom.
+//!
+//! \sa TypeIIRMLPosition::SetupModifiedDOFs()
+//  ----------------------------------------------------------
+    void SetupSelectedDOFs(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetupModifiedDOFs(void)
+//!
+//! \brief
+//! Sets up the index list TypeIIRMLPosition::ModifiedDOFs of the
+//! degrees of freedom that are selected by
+//! TypeIIRMLPosition::ModifiedSelectionVector
+//!
+//! \details
+//! This method has to be called whenever
+//! TypeIIRMLPosition::ModifiedSelectionVector was changed. As the
+//! modified selection vector is a subset of the original one, only the
+//! elements of TypeIIRMLPosition::SelectedDOFs are checked.
+//!
+//! \sa TypeIIRMLPosition::SetupModifiedSelectionVector()
+//! \sa TypeIIRMLPosition::SetupSelectedDOFs()
 //  ----------------------------------------------------------
-    void SetupModifiedSelectionVector(void);
+    void SetupModifiedDOFs(void);
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -956,6 +2376,33 @@ protected:
     bool                        CalculatePositionalExtremsFlag;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var bool FullCalculationWasPerformed
+//!
+//! \brief
+//! Indicates, whether the last call of
+//! TypeIIRMLPosition::ComputeNextStateOfMotion() executed Steps 1 and 2
+//!
+//! \sa TypeIIRMLPosition::ExecuteDeterministicTimingPath()
+//  ----------------------------------------------------------
+    bool                        FullCalculationWasPerformed;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool UseStep1Cache
+//!
+//! \brief
+//! Indicates, whether TypeIIRMLPosition::Step1() may reuse the results
+//! stored in TypeIIRMLPosition::Step1Cache
+//!
+//! \details
+//! The cache is bypassed if RMLPositionFlags::EnableDeterministicTiming
+//! is set, such that the worst-case execution time of all calls remains
+//! the same.
+//  ----------------------------------------------------------
+    bool                        UseStep1Cache;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var int ReturnValue
 //!
@@ -979,6 +2426,52 @@ protected:
     unsigned int                NumberOfDOFs;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int MaxNumberOfDOFs
+//!
+//! \brief
+//! The number of degrees of freedom, for which all internal objects were
+//! allocated by the constructor
+//!
+//! \details
+//! The objects TypeIIRMLPosition::DeterministicTimingInstance and
+//! TypeIIRMLPosition::AmortizedRecomputationInstance are allocated for
+//! this number of degrees of freedom, too.
+//!
+//! \sa TypeIIRMLPosition::Reconfigure()
+//  ----------------------------------------------------------
+    unsigned int                MaxNumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfSelectedDOFs
+//!
+//! \brief
+//! Number of valid elements of TypeIIRMLPosition::SelectedDOFs
+//  ----------------------------------------------------------
+    unsigned int                NumberOfSelectedDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfModifiedDOFs
+//!
+//! \brief
+//! Number of valid elements of TypeIIRMLPosition::ModifiedDOFs
+//  ----------------------------------------------------------
+    unsigned int                NumberOfModifiedDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfInoperativeTimeIntervals
+//!
+//! \brief
+//! Number of valid elements of
+//! TypeIIRMLPosition::SortedBeginningsOfInoperativeTimeIntervals and
+//! TypeIIRMLPosition::SortedEndingsOfInoperativeTimeIntervals
+//  ----------------------------------------------------------
+    unsigned int                NumberOfInoperativeTimeIntervals;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var unsigned int GreatestDOFForPhaseSynchronization
 //!
@@ -1008,13 +2501,30 @@ protected:
 //! \var double CycleTime
 //!
 //! \brief
-//! Contains the cycle time in seconds
+//! Contains the duration of the current cycle in seconds
+//!
+//! \details
+//! This value equals TypeIIRMLPosition::NominalCycleTime, unless the
+//! current cycle was executed by
+//! TypeIIRMLPosition::GetNextStateOfMotion() with an elapsed time.
 //!
 //! \sa TypeIIRMLPosition::TypeIIRMLPosition()
 //  ----------------------------------------------------------
     double                      CycleTime;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var double NominalCycleTime
+//!
+//! \brief
+//! Contains the cycle time in seconds as specified by the constructor
+//! or by TypeIIRMLPosition::Reconfigure()
+//!
+//! \sa TypeIIRMLPosition::CycleTime
+//  ----------------------------------------------------------
+    double                      NominalCycleTime;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var double SynchronizationTime
 //!
@@ -1075,6 +2585,67 @@ protected:
     RMLBoolVector               *ModifiedSelectionVector;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBoolVector *ChangedDOFsVector
+//!
+//! \brief
+//! Boolean vector, which contains the selected degrees of freedom, whose
+//! input values changed since the last cycle
+//!
+//! \details
+//! This vector is only set up, if
+//! TypeIIRMLPosition::IsIncrementalRecomputationPossible() returns
+//! \c true.
+//!
+//! \sa TypeIIRMLPosition::RecomputeChangedDOFs()
+//  ----------------------------------------------------------
+    RMLBoolVector               *ChangedDOFsVector;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBoolVector *IndexedSelectionVector
+//!
+//! \brief
+//! Copy of the selection vector, for which TypeIIRMLPosition::SelectedDOFs
+//! was set up
+//!
+//! \sa TypeIIRMLPosition::SetupSelectedDOFs()
+//  ----------------------------------------------------------
+    RMLBoolVector               *IndexedSelectionVector;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLVector<unsigned int> *SelectedDOFs
+//!
+//! \brief
+//! Ascending indices of the degrees of freedom that are selected by
+//! RMLPositionInputParameters::SelectionVector
+//!
+//! \details
+//! Only the first TypeIIRMLPosition::NumberOfSelectedDOFs elements are
+//! valid.
+//!
+//! \sa TypeIIRMLPosition::SetupSelectedDOFs()
+//  ----------------------------------------------------------
+    RMLVector<unsigned int>     *SelectedDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLVector<unsigned int> *ModifiedDOFs
+//!
+//! \brief
+//! Ascending indices of the degrees of freedom that are selected by
+//! TypeIIRMLPosition::ModifiedSelectionVector
+//!
+//! \details
+//! Only the first TypeIIRMLPosition::NumberOfModifiedDOFs elements are
+//! valid.
+//!
+//! \sa TypeIIRMLPosition::SetupModifiedDOFs()
+//  ----------------------------------------------------------
+    RMLVector<unsigned int>     *ModifiedDOFs;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var RMLVector<Step1_Profile> *UsedStep1AProfiles
 //!
@@ -1293,6 +2864,30 @@ protected:
     RMLDoubleVector             *ArrayOfSortedTimes;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *SortedBeginningsOfInoperativeTimeIntervals
+//!
+//! \brief
+//! Ascending beginnings \f$ _kt_{i}^{\,begin} \f$ of all non-empty
+//! inoperative time intervals in seconds
+//!
+//! \sa TypeIIRMLPosition::SortInoperativeTimeIntervals()
+//  ----------------------------------------------------------
+    RMLDoubleVector             *SortedBeginningsOfInoperativeTimeIntervals;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *SortedEndingsOfInoperativeTimeIntervals
+//!
+//! \brief
+//! Ascending endings \f$ _kt_{i}^{\,end} \f$ of all non-empty
+//! inoperative time intervals in seconds
+//!
+//! \sa TypeIIRMLPosition::SortInoperativeTimeIntervals()
+//  ----------------------------------------------------------
+    RMLDoubleVector             *SortedEndingsOfInoperativeTimeIntervals;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var RMLDoubleVector *ZeroVector
 //!
@@ -1445,6 +3040,27 @@ protected:
     MotionPolynomials           *Polynomials;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var Step1CacheEntry *Step1Cache
+//!
+//! \brief
+//! Array of TypeIIRMLPosition::MaxNumberOfDOFs entries, which contain
+//! the results of the decision trees 1A, 1B, and 1C of the last
+//! calculation of each degree of freedom
+//!
+//! \details
+//! If the input values of Step 1 of a degree of freedom did not change
+//! bit by bit, the stored results are used instead of running the
+//! decision trees again. The entries are invalidated by
+//! TypeIIRMLPosition::Reset().
+//!
+//! \sa TypeIIRMLMath::Step1CacheEntry
+//! \sa TypeIIRMLPosition::UseStep1Cache
+//! \sa TypeIIRMLPosition::Step1()
+//  ----------------------------------------------------------
+    Step1CacheEntry             *Step1Cache;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var DominatValueForPhaseSync PhaseSynchronizationMagnitude
 //!
@@ -1461,6 +3077,240 @@ protected:
     DominatValueForPhaseSync    PhaseSynchronizationMagnitude;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPosition *DeterministicTimingInstance
+//!
+//! \brief
+//! Second instance of the position-based algorithm, which executes a
+//! trajectory calculation in all cycles, in which this object does not
+//! calculate a new trajectory; \c NULL until the first call with
+//! RMLPositionFlags::EnableDeterministicTiming set
+//!
+//! \sa TypeIIRMLPosition::ExecuteDeterministicTimingPath()
+//  ----------------------------------------------------------
+    TypeIIRMLPosition           *DeterministicTimingInstance;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int AmortizedRecomputationStage
+//!
+//! \brief
+//! Number of the next stage of a trajectory calculation over several
+//! cycles; zero if no such calculation is pending
+//!
+//! \sa TypeIIRMLPosition::ExecuteAmortizedRecomputationStage()
+//  ----------------------------------------------------------
+    unsigned int                AmortizedRecomputationStage;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPosition *AmortizedRecomputationInstance
+//!
+//! \brief
+//! Second instance of the position-based algorithm, which calculates a
+//! new trajectory over several cycles; \c NULL until the first call with
+//! RMLPositionFlags::NumberOfRecomputationCycles greater than one
+//!
+//! \sa TypeIIRMLPosition::StartAmortizedRecomputation()
+//  ----------------------------------------------------------
+    TypeIIRMLPosition           *AmortizedRecomputationInstance;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLMemoryResource *MemoryResource
+//!
+//! \brief
+//! Memory resource that was active while this object was constructed
+//!
+//! \details
+//! The objects TypeIIRMLPosition::DeterministicTimingInstance and
+//! TypeIIRMLPosition::AmortizedRecomputationInstance are allocated from
+//! this resource, too; if it is \c NULL, they are allocated from the
+//! resource that is active when they are needed.
+//!
+//! \sa RMLMemoryResource
+//  ----------------------------------------------------------
+    RMLMemoryResource           *MemoryResource;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double FeedOverride
+//!
+//! \brief
+//! Desired feed override factor \f$ s^{\,trgt} \f$
+//!
+//! \sa TypeIIRMLPosition::SetFeedOverride()
+//  ----------------------------------------------------------
+    double                      FeedOverride;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double AppliedFeedOverride
+//!
+//! \brief
+//! Feed override factor \f$ s \f$ that was applied at the end of the last
+//! cycle
+//!
+//! \sa TypeIIRMLPosition::AdvanceFeedOverride()
+//  ----------------------------------------------------------
+    double                      AppliedFeedOverride;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double FeedOverrideRate
+//!
+//! \brief
+//! Rate of change \f$ \dot{s} \f$ of the applied feed override factor
+//! at the end of the last cycle
+//!
+//! \sa TypeIIRMLPosition::AdvanceFeedOverride()
+//  ----------------------------------------------------------
+    double                      FeedOverrideRate;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double MaxFeedOverrideRate
+//!
+//! \brief
+//! Maximum rate of change \f$ \dot{s}^{\,max} \f$ of the applied feed
+//! override factor
+//!
+//! \sa TypeIIRMLPosition::SetMaxFeedOverrideRate()
+//  ----------------------------------------------------------
+    double                      MaxFeedOverrideRate;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TrajectoryCacheEntry *TrajectoryCache
+//!
+//! \brief
+//! Array of TypeIIRMLPosition::NumberOfTrajectoryCacheEntries stored
+//! trajectories; \c NULL, if no cache is set up
+//!
+//! \sa TypeIIRMLPosition::SetTrajectoryCache()
+//  ----------------------------------------------------------
+    TrajectoryCacheEntry        *TrajectoryCache;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfTrajectoryCacheEntries
+//!
+//! \brief
+//! Number of elements of TypeIIRMLPosition::TrajectoryCache
+//  ----------------------------------------------------------
+    unsigned int                NumberOfTrajectoryCacheEntries;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double TrajectoryCacheResolution
+//!
+//! \brief
+//! Resolution of the key values of the trajectory cache
+//!
+//! \sa TypeIIRMLPosition::QuantizeForTrajectoryCache()
+//  ----------------------------------------------------------
+    double                      TrajectoryCacheResolution;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *TrajectoryCacheKeyValues
+//!
+//! \brief
+//! Quantized key values of the current input values (cf.
+//! TRAJECTORY_CACHE_KEY_VALUES_PER_DOF)
+//!
+//! \sa TypeIIRMLPosition::CalculateTrajectoryCacheKey()
+//  ----------------------------------------------------------
+    RMLDoubleVector             *TrajectoryCacheKeyValues;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int TrajectoryCacheHashValue
+//!
+//! \brief
+//! Hash value of TypeIIRMLPosition::TrajectoryCacheKeyValues and of the
+//! remaining key values
+//  ----------------------------------------------------------
+    unsigned int                TrajectoryCacheHashValue;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long TrajectoryCacheClock
+//!
+//! \brief
+//! Counter of look-ups, which orders the entries by their last use
+//!
+//! \sa TypeIIRMLMath::TrajectoryCacheEntry::LastUse
+//  ----------------------------------------------------------
+    unsigned long long          TrajectoryCacheClock;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long TrajectoryCacheHits
+//!
+//! \brief
+//! Number of calculations that used a stored trajectory
+//!
+//! \sa TypeIIRMLPosition::GetTrajectoryCacheStatistics()
+//  ----------------------------------------------------------
+    unsigned long long          TrajectoryCacheHits;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long TrajectoryCacheMisses
+//!
+//! \brief
+//! Number of calculations that did not find a stored trajectory
+//!
+//! \sa TypeIIRMLPosition::GetTrajectoryCacheStatistics()
+//  ----------------------------------------------------------
+    unsigned long long          TrajectoryCacheMisses;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var TypeIIRMLPlatform::MappedFile TrajectoryCacheFile
+//!
+//! \brief
+//! Descriptor of the file mapped by
+//! TypeIIRMLPosition::MapTrajectoryCacheFile()
+//  ----------------------------------------------------------
+    TypeIIRMLPlatform::MappedFile   TrajectoryCacheFile;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var const RMLTrajectoryCacheHeader *TrajectoryCacheFileHeader
+//!
+//! \brief
+//! Pointer to the header of the mapped trajectory cache file; \c NULL,
+//! if no file is mapped
+//  ----------------------------------------------------------
+    const RMLTrajectoryCacheHeader  *TrajectoryCacheFileHeader;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var const unsigned char *TrajectoryCacheFileRecords
+//!
+//! \brief
+//! Pointer to the first record of the mapped trajectory cache file
+//  ----------------------------------------------------------
+    const unsigned char             *TrajectoryCacheFileRecords;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long TrajectoryCacheFileNumberOfRecords
+//!
+//! \brief
+//! Number of records of the mapped trajectory cache file as validated by
+//! TypeIIRMLPosition::MapTrajectoryCacheFile()
+//!
+//! \details
+//! Only this value is used for the look-up, such that no record beyond
+//! the validated ones is accessed, even if the header of the file is
+//! changed while it is mapped.
+//  ----------------------------------------------------------
+    unsigned long long              TrajectoryCacheFileNumberOfRecords;
+
+
 };  // class TypeIIRMLPosition
 
 
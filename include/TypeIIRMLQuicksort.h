@@ -61,7 +61,11 @@ namespace TypeIIRMLMath
 //! \n
 //! \f$ _kt_i^{\,min},\,_kt_i^{\,begin},\,_kt_i^{\,end}\ \forall\ k\ \in\ \left\{1,\,\dots,\,K\right\} \f$\n
 //! \n
-//! where \f$ K \f$ is the number of degrees of freedom.
+//! where \f$ K \f$ is the number of degrees of freedom.\n
+//! \n
+//! If the recursion depth exceeds \f$ 2\,\lfloor\log_2 K \rfloor \f$,
+//! the remaining range is sorted by Heapsort, such that the worst-case
+//! complexity is \f$ O(K\,\log K) \f$.
 //!
 //! \param LeftBound
 //! Index value for the left border
@@ -0,0 +1,270 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLStep1Cache.h
+//!
+//! \brief
+//! Header file for the struct TypeIIRMLMath::Step1CacheEntry
+//!
+//! \details
+//! Per-DOF cache for the results of the decision trees of Step 1
+//! (cf. TypeIIRMLPosition::Step1()). This struct is part of the namespace
+//! TypeIIRMLMath.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __TypeIIRMLStep1Cache__
+#define __TypeIIRMLStep1Cache__
+
+
+#include <TypeIIRMLStep1Profiles.h>
+#include <RMLMemoryResource.h>
+
+namespace TypeIIRMLMath
+{
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct Step1CacheEntry
+//!
+//! \brief
+//! Results of the decision trees 1A, 1B, and 1C for one degree of
+//! freedom together with the input values they were calculated for
+//!
+//! \details
+//! The decision trees only depend on the six values stored here, such
+//! that their results can be reused bit by bit, if these values did not
+//! change since the last calculation. This is, for instance, the case for
+//! degrees of freedom that rest while the target of another degree of
+//! freedom is changed, or for all degrees of freedom after the final
+//! state of motion was reached with
+//! RMLPositionFlags::RECOMPUTE_TRAJECTORY.
+//!
+//! \sa TypeIIRMLPosition::Step1Cache
+//  ----------------------------------------------------------
+struct Step1CacheEntry : public RMLMemoryObject
+{
+//  ---------------------- Doxygen info ----------------------
+//! \fn Step1CacheEntry(void)
+//!
+//! \brief
+//! Constructor of the struct Step1CacheEntry, which creates an invalid
+//! entry
+//  ----------------------------------------------------------
+    Step1CacheEntry(void)
+    {
+        this->Invalidate();
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Invalidate(void)
+//!
+//! \brief
+//! Marks all results of the entry as invalid
+//  ----------------------------------------------------------
+    inline void Invalidate(void)
+    {
+        this->IsValid                           =   false;
+        this->InoperativeTimeIntervalIsValid    =   false;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline bool Matches(const double &CurrentPositionValue, const double &CurrentVelocityValue, const double &TargetPositionValue, const double &TargetVelocityValue, const double &MaxVelocityValue, const double &MaxAccelerationValue) const
+//!
+//! \brief
+//! Checks, whether the entry is valid and was calculated for exactly the
+//! given input values
+//  ----------------------------------------------------------
+    inline bool Matches(        const double    &CurrentPositionValue
+                            ,   const double    &CurrentVelocityValue
+                            ,   const double    &TargetPositionValue
+                            ,   const double    &TargetVelocityValue
+                            ,   const double    &MaxVelocityValue
+                            ,   const double    &MaxAccelerationValue   ) const
+    {
+        return(     (this->IsValid                                      )
+                &&  (this->CurrentPosition  ==  CurrentPositionValue    )
+                &&  (this->CurrentVelocity  ==  CurrentVelocityValue    )
+                &&  (this->TargetPosition   ==  TargetPositionValue     )
+                &&  (this->TargetVelocity   ==  TargetVelocityValue     )
+                &&  (this->MaxVelocity      ==  MaxVelocityValue        )
+                &&  (this->MaxAcceleration  ==  MaxAccelerationValue    )   );
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline void Store(const double &CurrentPositionValue, const double &CurrentVelocityValue, const double &TargetPositionValue, const double &TargetVelocityValue, const double &MaxVelocityValue, const double &MaxAccelerationValue, const Step1_Profile &ProfileValue, const double &MinimumExecutionTimeValue)
+//!
+//! \brief
+//! Stores the results of decision tree 1A for the given input values
+//!
+//! \details
+//! Results of the decision trees 1B and 1C, which were stored before,
+//! become invalid.
+//  ----------------------------------------------------------
+    inline void Store(      const double            &CurrentPositionValue
+                        ,   const double            &CurrentVelocityValue
+                        ,   const double            &TargetPositionValue
+                        ,   const double            &TargetVelocityValue
+                        ,   const double            &MaxVelocityValue
+                        ,   const double            &MaxAccelerationValue
+                        ,   const Step1_Profile     &ProfileValue
+                        ,   const double            &MinimumExecutionTimeValue  )
+    {
+        this->CurrentPosition                   =   CurrentPositionValue        ;
+        this->CurrentVelocity                   =   CurrentVelocityValue        ;
+        this->TargetPosition                    =   TargetPositionValue         ;
+        this->TargetVelocity                    =   TargetVelocityValue         ;
+        this->MaxVelocity                       =   MaxVelocityValue            ;
+        this->MaxAcceleration                   =   MaxAccelerationValue        ;
+        this->Profile                           =   ProfileValue                ;
+        this->MinimumExecutionTime              =   MinimumExecutionTimeValue   ;
+        this->IsValid                           =   true                        ;
+        this->InoperativeTimeIntervalIsValid    =   false                       ;
+    }
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CurrentPosition
+//!
+//! \brief
+//! Current position, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  CurrentPosition;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CurrentVelocity
+//!
+//! \brief
+//! Current velocity, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  CurrentVelocity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double TargetPosition
+//!
+//! \brief
+//! Target position, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  TargetPosition;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double TargetVelocity
+//!
+//! \brief
+//! Target velocity, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  TargetVelocity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double MaxVelocity
+//!
+//! \brief
+//! Maximum velocity, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  MaxVelocity;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double MaxAcceleration
+//!
+//! \brief
+//! Maximum acceleration, for which the entry was calculated
+//  ----------------------------------------------------------
+    double                  MaxAcceleration;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var Step1_Profile Profile
+//!
+//! \brief
+//! Motion profile determined by decision tree 1A
+//  ----------------------------------------------------------
+    Step1_Profile           Profile;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double MinimumExecutionTime
+//!
+//! \brief
+//! Minimum execution time determined by decision tree 1A
+//  ----------------------------------------------------------
+    double                  MinimumExecutionTime;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double BeginningOfInoperativeTimeInterval
+//!
+//! \brief
+//! Beginning of the inoperative time interval determined by decision
+//! tree 1B
+//  ----------------------------------------------------------
+    double                  BeginningOfInoperativeTimeInterval;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double EndingOfInoperativeTimeInterval
+//!
+//! \brief
+//! Ending of the inoperative time interval determined by decision
+//! tree 1C (\c RML_INFINITY, if there is none)
+//  ----------------------------------------------------------
+    double                  EndingOfInoperativeTimeInterval;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool IsValid
+//!
+//! \brief
+//! Indicates, whether the results of decision tree 1A are valid
+//  ----------------------------------------------------------
+    bool                    IsValid;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool InoperativeTimeIntervalIsValid
+//!
+//! \brief
+//! Indicates, whether the results of the decision trees 1B and 1C are
+//! valid
+//  ----------------------------------------------------------
+    bool                    InoperativeTimeIntervalIsValid;
+};
+
+}   // namespace TypeIIRMLMath
+
+#endif
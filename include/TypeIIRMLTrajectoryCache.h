@@ -0,0 +1,364 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLTrajectoryCache.h
+//!
+//! \brief
+//! Header file for the struct TypeIIRMLMath::TrajectoryCacheEntry
+//!
+//! \details
+//! Entries of the trajectory cache of the position-based algorithm
+//! (cf. TypeIIRMLPosition::SetTrajectoryCache()). This struct is part of
+//! the namespace TypeIIRMLMath.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __TypeIIRMLTrajectoryCache__
+#define __TypeIIRMLTrajectoryCache__
+
+
+#include <TypeIIRMLPolynomial.h>
+#include <TypeIIRMLStep1Profiles.h>
+#include <RMLMemoryResource.h>
+#include <RMLVector.h>
+
+#include <stddef.h>
+#include <string.h>
+
+
+namespace TypeIIRMLMath
+{
+
+//  ---------------------- Doxygen info ----------------------
+//! \def TRAJECTORY_CACHE_KEY_VALUES_PER_DOF
+//!
+//! \brief
+//! Number of values per degree of freedom in
+//! TrajectoryCacheEntry::KeyValues
+//!
+//! \details
+//! Position difference (or target position, if the resolution is zero),
+//! current velocity, target velocity, maximum velocity, and maximum
+//! acceleration.
+//  ----------------------------------------------------------
+#define TRAJECTORY_CACHE_KEY_VALUES_PER_DOF     5
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct TrajectoryCacheEntry
+//!
+//! \brief
+//! Trajectory of the position-based algorithm together with the
+//! quantized input values it was calculated for
+//!
+//! \details
+//! An entry contains everything Steps 1 and 2 of
+//! TypeIIRMLPosition::GetNextStateOfMotion() produce. Positions are only
+//! contained relatively (\f$ \vec{P}_{i}^{\,trgt}\,-\,\vec{P}_{i} \f$), such
+//! that an entry can be used for any current position by translating the
+//! position polynomials (cf. TypeIIRMLPosition::LookUpTrajectoryCache()).
+//!
+//! \sa TypeIIRMLPosition::TrajectoryCache
+//  ----------------------------------------------------------
+struct TrajectoryCacheEntry : public RMLMemoryObject
+{
+//  ---------------------- Doxygen info ----------------------
+//! \fn TrajectoryCacheEntry(void)
+//!
+//! \brief
+//! Constructor of the struct TrajectoryCacheEntry, which creates an
+//! invalid entry without memory (cf. TrajectoryCacheEntry::Allocate())
+//  ----------------------------------------------------------
+    TrajectoryCacheEntry(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~TrajectoryCacheEntry(void)
+//!
+//! \brief
+//! Destructor of the struct TrajectoryCacheEntry
+//  ----------------------------------------------------------
+    ~TrajectoryCacheEntry(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Allocate(const unsigned int &MaxNumberOfDOFs)
+//!
+//! \brief
+//! Allocates the memory of an entry for up to \c MaxNumberOfDOFs degrees
+//! of freedom from the active memory resource
+//  ----------------------------------------------------------
+    void Allocate(const unsigned int &MaxNumberOfDOFs);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn static size_t GetSize(const unsigned int &MaxNumberOfDOFs)
+//!
+//! \brief
+//! Returns the number of bytes an allocated entry occupies
+//  ----------------------------------------------------------
+    static size_t GetSize(const unsigned int &MaxNumberOfDOFs);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool IsValid
+//!
+//! \brief
+//! Indicates, whether the entry contains a trajectory
+//  ----------------------------------------------------------
+    bool                        IsValid;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int HashValue
+//!
+//! \brief
+//! Hash value of the key, which is compared before the key values
+//  ----------------------------------------------------------
+    unsigned int                HashValue;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned long long LastUse
+//!
+//! \brief
+//! Value of TypeIIRMLPosition::TrajectoryCacheClock, when the entry was
+//! stored or used the last time; the entry with the smallest value is
+//! replaced first.
+//  ----------------------------------------------------------
+    unsigned long long          LastUse;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfDOFs
+//!
+//! \brief
+//! Number of degrees of freedom of the stored trajectory
+//  ----------------------------------------------------------
+    unsigned int                NumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var int SynchronizationBehavior
+//!
+//! \brief
+//! Value of RMLFlags::SynchronizationBehavior, for which the trajectory
+//! was calculated
+//  ----------------------------------------------------------
+    int                         SynchronizationBehavior;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CycleTime
+//!
+//! \brief
+//! Cycle time, for which the trajectory was calculated
+//  ----------------------------------------------------------
+    double                      CycleTime;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double MinimumSynchronizationTime
+//!
+//! \brief
+//! Quantized value of RMLInputParameters::MinimumSynchronizationTime
+//  ----------------------------------------------------------
+    double                      MinimumSynchronizationTime;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *KeyValues
+//!
+//! \brief
+//! Quantized input values of all degrees of freedom (cf.
+//! TRAJECTORY_CACHE_KEY_VALUES_PER_DOF)
+//  ----------------------------------------------------------
+    RMLDoubleVector             *KeyValues;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBoolVector *SelectionVector
+//!
+//! \brief
+//! Selection vector, for which the trajectory was calculated
+//  ----------------------------------------------------------
+    RMLBoolVector               *SelectionVector;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *CurrentPosition
+//!
+//! \brief
+//! Current position vector, for which the position polynomials were
+//! calculated
+//  ----------------------------------------------------------
+    RMLDoubleVector             *CurrentPosition;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var MotionPolynomials *Polynomials
+//!
+//! \brief
+//! Motion polynomials of all degrees of freedom (cf.
+//! TypeIIRMLPosition::Polynomials)
+//  ----------------------------------------------------------
+    MotionPolynomials           *Polynomials;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBoolVector *ModifiedSelectionVector
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::ModifiedSelectionVector
+//  ----------------------------------------------------------
+    RMLBoolVector               *ModifiedSelectionVector;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLDoubleVector *MinimumExecutionTimes
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::MinimumExecutionTimes
+//  ----------------------------------------------------------
+    RMLDoubleVector             *MinimumExecutionTimes;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLVector<Step1_Profile> *UsedStep1AProfiles
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::UsedStep1AProfiles
+//  ----------------------------------------------------------
+    RMLVector<Step1_Profile>    *UsedStep1AProfiles;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double SynchronizationTime
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::SynchronizationTime
+//  ----------------------------------------------------------
+    double                      SynchronizationTime;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int GreatestDOFForPhaseSynchronization
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::GreatestDOFForPhaseSynchronization
+//  ----------------------------------------------------------
+    unsigned int                GreatestDOFForPhaseSynchronization;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var bool IsPhaseSynchronized
+//!
+//! \brief
+//! Copy of TypeIIRMLPosition::CurrentTrajectoryIsPhaseSynchronized
+//  ----------------------------------------------------------
+    bool                        IsPhaseSynchronized;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned long long HashTrajectoryCacheValue(const unsigned long long &HashValue, const double &Value)
+//!
+//! \brief
+//! Adds a value to a hash value (FNV-1a applied to 64-bit words instead
+//! of bytes)
+//  ----------------------------------------------------------
+inline unsigned long long HashTrajectoryCacheValue(     const unsigned long long    &HashValue
+                                                    ,   const double                &Value      )
+{
+    unsigned long long          Word        =   0;
+
+    memcpy(&Word, &Value, sizeof(double));
+
+    return((HashValue ^ Word) * 1099511628211ULL);
+}
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn template <class T> unsigned int HashTrajectoryCacheKey(const double *KeyValues, const T *SelectionVector, const unsigned int &NumberOfDOFs)
+//!
+//! \brief
+//! Calculates the hash value of quantized key values (cf.
+//! TrajectoryCacheEntry::HashValue)
+//!
+//! \details
+//! Unselected degrees of freedom do not influence the trajectory, and
+//! their key values are not considered (the selection vectors are
+//! compared separately).
+//!
+//! \param KeyValues
+//! Array of TRAJECTORY_CACHE_KEY_VALUES_PER_DOF values per degree of
+//! freedom
+//!
+//! \param SelectionVector
+//! Array of one element per degree of freedom, which is converted to
+//! \c bool
+//!
+//! \param NumberOfDOFs
+//! Number of degrees of freedom
+//  ----------------------------------------------------------
+template <class T>
+unsigned int HashTrajectoryCacheKey(        const double        *KeyValues
+                                        ,   const T             *SelectionVector
+                                        ,   const unsigned int  &NumberOfDOFs       )
+{
+    unsigned int                i               =   0
+                            ,   j               =   0;
+
+    unsigned long long          HashValue       =   14695981039346656037ULL;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        if (SelectionVector[i])
+        {
+            for (j = 0; j < TRAJECTORY_CACHE_KEY_VALUES_PER_DOF; j++)
+            {
+                HashValue   =   HashTrajectoryCacheValue(       HashValue
+                                                            ,   KeyValues[TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * i + j]  );
+            }
+        }
+        else
+        {
+            HashValue   =   HashTrajectoryCacheValue(HashValue, -1.0);
+        }
+    }
+
+    return((unsigned int)(HashValue ^ (HashValue >> 32)));
+}
+
+}   // namespace TypeIIRMLMath
+
+#endif
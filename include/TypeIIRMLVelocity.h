@@ -53,6 +53,7 @@
 #include <RMLVelocityInputParameters.h>
 #include <RMLVelocityOutputParameters.h>
 #include <RMLVector.h>
+#include <ReflexxesCAPI.h>
 #include <TypeIIRMLPolynomial.h>
 #include <RMLVelocityFlags.h>
 
@@ -100,13 +101,13 @@ using namespace TypeIIRMLMath;
 //! \sa \ref page_ErrorHandling
 //! \sa \ref page_SynchronizationBehavior
 //  ----------------------------------------------------------
-class TypeIIRMLVelocity
+class TypeIIRMLVelocity : public RMLMemoryObject
 {
 public:
 
 
 //  ---------------------- Doxygen info ----------------------
-//! \fn TypeIIRMLVelocity(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//! \fn TypeIIRMLVelocity(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds, const unsigned int &MaxNumberOfDOFs = 0)
 //!
 //! \brief
 //! Constructor of the class TypeIIRMLVelocity
@@ -121,11 +122,18 @@ public:
 //! \param CycleTimeInSeconds
 //! Specifies the cycle time in seconds
 //!
+//! \param MaxNumberOfDOFs
+//! Specifies the number of degrees of freedom, for which memory is
+//! reserved (cf. TypeIIRMLVelocity::Reconfigure()). Values smaller than
+//! \c DegreesOfFreedom (e.g., the default value of zero) are replaced by
+//! \c DegreesOfFreedom.
+//!
 //! \sa TypeIIRMLVelocity::TypeIIRMLVelocity()
 //! \sa TypeIIRMLPosition::TypeIIRMLPosition()
 //  ----------------------------------------------------------
     TypeIIRMLVelocity(      const unsigned int  &DegreesOfFreedom
-                        ,   const double        &CycleTimeInSeconds);
+                        ,   const double        &CycleTimeInSeconds
+                        ,   const unsigned int  &MaxNumberOfDOFs    = 0);
 
 
 //  ---------------------- Doxygen info ----------------------
@@ -249,6 +257,92 @@ public:
                                 ,   const RMLVelocityFlags              &Flags);
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStateOfMotion(const RMLVelocityInputParameters &InputValues, RMLVelocityOutputParameters *OutputValues, const RMLVelocityFlags &Flags, const double &ElapsedTimeInSeconds)
+//!
+//! \brief
+//! Variant of TypeIIRMLVelocity::GetNextStateOfMotion() for cycles, whose
+//! duration differs from the nominal cycle time
+//!
+//! \details
+//! Instead of the cycle time passed to the constructor, the internal
+//! clock is advanced by \c ElapsedTimeInSeconds, and the current
+//! trajectory is sampled at this instant. This is useful for
+//! communication systems with jittered or deliberately changed periods.
+//! A changed duration alone does \em not lead to a new calculation of the
+//! trajectory: if the input values did not change, the result equals the
+//! one of TypeIIRMLVelocity::GetNextStateOfMotionAtTime() for
+//! \c ElapsedTimeInSeconds, and the trajectory is continued from that
+//! instant on.\n
+//! \n
+//! The next call of TypeIIRMLVelocity::GetNextStateOfMotion() without this
+//! parameter uses the nominal cycle time again.
+//!
+//! \param InputValues
+//! Input values of the algorithm
+//!
+//! \param OutputValues
+//! Output values of the algorithm
+//!
+//! \param Flags
+//! Flags of the algorithm
+//!
+//! \param ElapsedTimeInSeconds
+//! Time in seconds, which elapsed since the previous call. This value
+//! has to be positive.
+//!
+//! \return
+//! The same values as TypeIIRMLVelocity::GetNextStateOfMotion(); if
+//! \c ElapsedTimeInSeconds is not positive,
+//! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES is returned, and the
+//! output values remain unchanged.
+//!
+//! \sa ReflexxesAPI::RMLVelocity()
+//  ----------------------------------------------------------
+    int GetNextStateOfMotion(       const RMLVelocityInputParameters    &InputValues
+                                ,   RMLVelocityOutputParameters         *OutputValues
+                                ,   const RMLVelocityFlags              &Flags
+                                ,   const double                        &ElapsedTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStateOfMotion(const rml_in_view &InputValues, rml_out_view *OutputValues, const RMLVelocityFlags &Flags)
+//!
+//! \brief
+//! Variant of TypeIIRMLVelocity::GetNextStateOfMotion(), whose input and output
+//! values are located in caller-owned memory
+//!
+//! \details
+//! The input values are directly read from the arrays described by
+//! \c InputValues, and the output values are directly written to the
+//! arrays described by \c OutputValues (cf. ReflexxesCAPI.h), such that
+//! no objects of the classes RMLVelocityInputParameters and
+//! RMLVelocityOutputParameters have to be set up by the caller. This
+//! method does not allocate memory.
+//!
+//! \param InputValues
+//! Views of the input values, the number of degrees of freedom equals the
+//! one specified at the constructor.
+//!
+//! \param OutputValues
+//! Views of the output values; arrays with a \c NULL pointer are not
+//! written.
+//!
+//! \param Flags
+//! A set of boolean values to configure the behavior of the algorithm
+//! (cf. RMLVelocityFlags).
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue
+//!
+//! \sa TypeIIRMLVelocity::GetNextStateOfMotion()
+//! \sa rml_velocity_step()
+//  ----------------------------------------------------------
+    int GetNextStateOfMotion(       const rml_in_view                   &InputValues
+                                ,   rml_out_view                        *OutputValues
+                                ,   const RMLVelocityFlags              &Flags);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn int GetNextStateOfMotionAtTime(const double &TimeValueInSeconds, RMLVelocityOutputParameters *OutputValues) const
 //!
@@ -309,9 +403,123 @@ public:
                                     ,   RMLVelocityOutputParameters         *OutputValues       ) const;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int PrepareForRealTime(const RMLVelocityFlags &Flags)
+//!
+//! \brief
+//! Executes a warm-up calculation with synthetic input values
+//!
+//! \details
+//! All degrees of freedom are accelerated towards a target velocity,
+//! which is changed during the motion. Afterwards,
+//! TypeIIRMLVelocity::Reset() is called, such that the next call of
+//! TypeIIRMLVelocity::GetNextStateOfMotion() starts a new calculation.
+//!
+//! \param Flags
+//! The flags that will be used during the real-time execution
+//!
+//! \return
+//! ReflexxesAPI::RML_WORKING on success or the error value of the warm-up
+//! calculation
+//!
+//! \sa ReflexxesAPI::PrepareForRealTime()
+//! \sa TypeIIRMLPosition::PrepareForRealTime()
+//  ----------------------------------------------------------
+    int PrepareForRealTime(const RMLVelocityFlags &Flags);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn void Reset(void)
+//!
+//! \brief
+//! Discards the current trajectory, such that the next call of
+//! TypeIIRMLVelocity::GetNextStateOfMotion() starts a new calculation
+//!
+//! \details
+//! No memory is allocated or freed, that is, this method is real-time
+//! capable.
+//!
+//! \sa TypeIIRMLVelocity::Reconfigure()
+//! \sa ReflexxesAPI::Reset()
+//  ----------------------------------------------------------
+    void Reset(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int Reconfigure(const unsigned int &DegreesOfFreedom, const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Changes the number of degrees of freedom and the cycle time without
+//! reallocating memory
+//!
+//! \details
+//! All internal vectors keep their memory, which was reserved for
+//! TypeIIRMLVelocity::MaxNumberOfDOFs degrees of freedom by the
+//! constructor, such that this method is real-time capable. Afterwards,
+//! TypeIIRMLVelocity::Reset() is called.
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom
+//!
+//! \param CycleTimeInSeconds
+//! New cycle time in seconds
+//!
+//! \return
+//!  - ReflexxesAPI::RML_WORKING on success
+//!  - ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS, if \c DegreesOfFreedom is
+//!    zero or greater than TypeIIRMLVelocity::MaxNumberOfDOFs
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if
+//!    \c CycleTimeInSeconds is not positive
+//!
+//! In case of an error, the object remains unchanged.
+//!
+//! \sa ReflexxesAPI::Reconfigure()
+//  ----------------------------------------------------------
+    int Reconfigure(        const unsigned int  &DegreesOfFreedom
+                        ,   const double        &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline unsigned int GetMaxNumberOfDOFs(void) const
+//!
+//! \brief
+//! Returns TypeIIRMLVelocity::MaxNumberOfDOFs
+//  ----------------------------------------------------------
+    inline unsigned int GetMaxNumberOfDOFs(void) const
+    {
+        return(this->MaxNumberOfDOFs);
+    }
+
+
 protected:
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn int ComputeNextStateOfMotion(const RMLVelocityFlags &Flags)
+//!
+//! \brief
+//! Executes the algorithm for the input values stored in
+//! TypeIIRMLVelocity::CurrentInputParameters
+//!
+//! \details
+//! This method contains the algorithm of
+//! TypeIIRMLVelocity::GetNextStateOfMotion(). It expects that the number of
+//! degrees of freedom has been checked, and the result is stored in
+//! TypeIIRMLVelocity::OutputParameters, from where the public methods copy it
+//! into the respective output data structure of the user.
+//!
+//! \param Flags
+//! A set of boolean values to configure the behavior of the algorithm.
+//!
+//! \return
+//! An element of ReflexxesAPI::RMLResultValue, which is also stored in
+//! TypeIIRMLVelocity::ReturnValue
+//!
+//! \sa TypeIIRMLVelocity::GetNextStateOfMotion()
+//  ----------------------------------------------------------
+    int ComputeNextStateOfMotion(const RMLVelocityFlags &Flags);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \enum FunctionResults
 //!
@@ -660,6 +868,22 @@ protected:
     void SetPositionalExtremsToZero(RMLVelocityOutputParameters *OP) const;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+//!
+//! \brief
+//! Sets TypeIIRMLVelocity::NumberOfDOFs and the dimensions of all
+//! internal vectors and parameter objects
+//!
+//! \param DegreesOfFreedom
+//! New number of degrees of freedom, which must not exceed
+//! TypeIIRMLVelocity::MaxNumberOfDOFs
+//!
+//! \sa TypeIIRMLVelocity::Reconfigure()
+//  ----------------------------------------------------------
+    void SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \fn void SetupPhaseSyncSelectionVector(void)
 //!
@@ -690,6 +914,24 @@ protected:
     void SetupPhaseSyncSelectionVector(void);
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \fn void SetupSelectedDOFs(void)
+//!
+//! \brief
+//! Sets up the index list TypeIIRMLVelocity::SelectedDOFs of the
+//! degrees of freedom that are selected by
+//! RMLVelocityInputParameters::SelectionVector
+//!
+//! \details
+//! The list is only rebuilt if the selection vector differs from the one,
+//! for which the list was set up before
+//! (cf. TypeIIRMLVelocity::IndexedSelectionVector).
+//!
+//! \sa TypeIIRMLPosition::SetupSelectedDOFs()
+//  ----------------------------------------------------------
+    void SetupSelectedDOFs(void);
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var bool CurrentTrajectoryIsPhaseSynchronized
 //!
@@ -751,6 +993,27 @@ protected:
     unsigned int                NumberOfDOFs;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int MaxNumberOfDOFs
+//!
+//! \brief
+//! The number of degrees of freedom, for which all internal objects were
+//! allocated by the constructor
+//!
+//! \sa TypeIIRMLVelocity::Reconfigure()
+//  ----------------------------------------------------------
+    unsigned int                MaxNumberOfDOFs;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var unsigned int NumberOfSelectedDOFs
+//!
+//! \brief
+//! Number of valid elements of TypeIIRMLVelocity::SelectedDOFs
+//  ----------------------------------------------------------
+    unsigned int                NumberOfSelectedDOFs;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var unsigned int DOFWithGreatestExecutionTime
 //!
@@ -766,13 +1029,30 @@ protected:
 //! \var double CycleTime
 //!
 //! \brief
-//! Contains the cycle time in seconds
+//! Contains the duration of the current cycle in seconds
+//!
+//! \details
+//! This value equals TypeIIRMLVelocity::NominalCycleTime, unless the
+//! current cycle was executed by
+//! TypeIIRMLVelocity::GetNextStateOfMotion() with an elapsed time.
 //!
 //! \sa TypeIIRMLVelocity::TypeIIRMLVelocity()
 //  ----------------------------------------------------------
     double                      CycleTime;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var double NominalCycleTime
+//!
+//! \brief
+//! Contains the cycle time in seconds as specified by the constructor
+//! or by TypeIIRMLVelocity::Reconfigure()
+//!
+//! \sa TypeIIRMLVelocity::CycleTime
+//  ----------------------------------------------------------
+    double                      NominalCycleTime;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var double SynchronizationTime
 //!
@@ -832,6 +1112,34 @@ protected:
     RMLBoolVector               *PhaseSyncSelectionVector;
 
 
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLBoolVector *IndexedSelectionVector
+//!
+//! \brief
+//! Copy of the selection vector, for which TypeIIRMLVelocity::SelectedDOFs
+//! was set up
+//!
+//! \sa TypeIIRMLVelocity::SetupSelectedDOFs()
+//  ----------------------------------------------------------
+    RMLBoolVector               *IndexedSelectionVector;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var RMLVector<unsigned int> *SelectedDOFs
+//!
+//! \brief
+//! Ascending indices of the degrees of freedom that are selected by
+//! RMLVelocityInputParameters::SelectionVector
+//!
+//! \details
+//! Only the first TypeIIRMLVelocity::NumberOfSelectedDOFs elements are
+//! valid.
+//!
+//! \sa TypeIIRMLVelocity::SetupSelectedDOFs()
+//  ----------------------------------------------------------
+    RMLVector<unsigned int>     *SelectedDOFs;
+
+
 //  ---------------------- Doxygen info ----------------------
 //! \var RMLIntVector *ExecutionTimes
 //!
@@ -0,0 +1,252 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLVelocityBatch.h
+//!
+//! \brief
+//! Header file for the class TypeIIRMLVelocityBatch
+//!
+//! \details
+//! Batched velocity-based algorithm for a large number of independent
+//! axes.
+//!
+//! \sa TypeIIRMLVelocity
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#ifndef __TypeIIRMLVelocityBatch__
+#define __TypeIIRMLVelocityBatch__
+
+
+#include <stddef.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLVelocityBatchInputValues
+//!
+//! \brief
+//! Input values of TypeIIRMLVelocityBatch::GetNextStatesOfMotion() as a
+//! structure of arrays
+//!
+//! \details
+//! Each member points to an array with one element per axis. The arrays
+//! are owned by the caller and do not need to be aligned.
+//!
+//! \sa TypeIIRMLVelocityBatch
+//! \sa RMLVelocityInputParameters
+//  ----------------------------------------------------------
+struct RMLVelocityBatchInputValues
+{
+    //! \brief Current positions \f$ P_i \f$
+    const double            *CurrentPosition;
+    //! \brief Current velocities \f$ V_i \f$
+    const double            *CurrentVelocity;
+    //! \brief Current accelerations \f$ A_i \f$, only used for axes that
+    //! are not selected
+    const double            *CurrentAcceleration;
+    //! \brief Maximum accelerations \f$ A_i^{\,max} \f$
+    const double            *MaxAcceleration;
+    //! \brief Target velocities \f$ V_i^{\,trgt} \f$
+    const double            *TargetVelocity;
+    //! \brief Selection vector with one byte per axis (non-zero means
+    //! selected); \c NULL selects all axes
+    const unsigned char     *Selection;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLVelocityBatchOutputValues
+//!
+//! \brief
+//! Output values of TypeIIRMLVelocityBatch::GetNextStatesOfMotion() as a
+//! structure of arrays
+//!
+//! \details
+//! Each member points to an array with one element per axis. The members
+//! \c ExecutionTimes, \c PositionValuesAtTargetVelocity, and
+//! \c ResultValues are optional and may be \c NULL.
+//!
+//! \sa TypeIIRMLVelocityBatch
+//! \sa RMLVelocityOutputParameters
+//  ----------------------------------------------------------
+struct RMLVelocityBatchOutputValues
+{
+    //! \brief New positions \f$ P_{i+1} \f$
+    double                  *NewPosition;
+    //! \brief New velocities \f$ V_{i+1} \f$
+    double                  *NewVelocity;
+    //! \brief New accelerations \f$ A_{i+1} \f$
+    double                  *NewAcceleration;
+    //! \brief Time required to reach the target velocity from the current
+    //! state of motion
+    double                  *ExecutionTimes;
+    //! \brief Positions at the instant the target velocity is reached
+    double                  *PositionValuesAtTargetVelocity;
+    //! \brief Result of each axis (ReflexxesAPI::RML_WORKING,
+    //! ReflexxesAPI::RML_FINAL_STATE_REACHED, or
+    //! ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES)
+    int                     *ResultValues;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \class TypeIIRMLVelocityBatch
+//!
+//! \brief
+//! Velocity-based Type II On-Line Trajectory Generation algorithm for a
+//! large number of \em independent axes
+//!
+//! \details
+//! Conveyors or jog modes commonly move hundreds of axes, which do not
+//! have to be synchronized with each other. Instead of one instance of
+//! TypeIIRMLVelocity per axis, this class computes the next state of
+//! motion of all axes with one call, whose input and output values are
+//! arrays of the caller (structure of arrays). The two-segment velocity
+//! profile of each axis, that is, constant acceleration until the target
+//! velocity is reached followed by constant velocity, is evaluated
+//! without branches, such that two axes are processed per SSE2
+//! instruction if the target platform supports SSE2.\n
+//! \n
+//! The class does not keep any state: each call computes the profile from
+//! the current state of motion of each axis and samples it at the end of
+//! the cycle. The result of each axis equals the one of a one-DOF
+//! TypeIIRMLVelocity object with RMLFlags::NO_SYNCHRONIZATION in a cycle,
+//! in which the trajectory is recomputed. Axes with a maximum acceleration
+//! that is not positive keep their current velocity (cf.
+//! TypeIIRMLVelocity::FallBackStrategy()).\n
+//! \n
+//! No memory is allocated, and all methods are real-time capable.
+//!
+//! \sa TypeIIRMLVelocity
+//! \sa RMLVelocityBatchInputValues
+//! \sa RMLVelocityBatchOutputValues
+//  ----------------------------------------------------------
+class TypeIIRMLVelocityBatch
+{
+public:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn TypeIIRMLVelocityBatch(const double &CycleTimeInSeconds)
+//!
+//! \brief
+//! Constructor of the class TypeIIRMLVelocityBatch
+//!
+//! \param CycleTimeInSeconds
+//! Specifies the cycle time in seconds
+//  ----------------------------------------------------------
+    TypeIIRMLVelocityBatch(const double &CycleTimeInSeconds);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn ~TypeIIRMLVelocityBatch(void)
+//!
+//! \brief
+//! Destructor of the class TypeIIRMLVelocityBatch
+//  ----------------------------------------------------------
+    ~TypeIIRMLVelocityBatch(void);
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int GetNextStatesOfMotion(const size_t &NumberOfAxes, const RMLVelocityBatchInputValues &InputValues, RMLVelocityBatchOutputValues *OutputValues) const
+//!
+//! \brief
+//! Computes the states of motion of all axes at the end of the cycle
+//!
+//! \param NumberOfAxes
+//! Number of elements of all arrays of \c InputValues and
+//! \c OutputValues
+//!
+//! \param InputValues
+//! Arrays of the current states of motion, the kinematic constraints,
+//! and the target velocities
+//!
+//! \param OutputValues
+//! Arrays, to which the new states of motion are written
+//!
+//! \return
+//!  - ReflexxesAPI::RML_WORKING, if at least one selected axis has not
+//!    reached its target velocity yet,
+//!  - ReflexxesAPI::RML_FINAL_STATE_REACHED, if all selected axes
+//!    reached their target velocities,
+//!  - ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES, if the maximum
+//!    acceleration of at least one selected axis is not positive, or
+//!  - ReflexxesAPI::RML_ERROR_NULL_POINTER, if a mandatory array is
+//!    \c NULL.
+//  ----------------------------------------------------------
+    int GetNextStatesOfMotion(      const size_t                        &NumberOfAxes
+                                ,   const RMLVelocityBatchInputValues   &InputValues
+                                ,   RMLVelocityBatchOutputValues        *OutputValues   ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn inline double GetCycleTime(void) const
+//!
+//! \brief
+//! Returns the cycle time in seconds
+//  ----------------------------------------------------------
+    inline double GetCycleTime(void) const
+    {
+        return(this->CycleTime);
+    }
+
+
+protected:
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \fn int ComputeOneAxis(const size_t &Index, const RMLVelocityBatchInputValues &InputValues, RMLVelocityBatchOutputValues *OutputValues) const
+//!
+//! \brief
+//! Computes the state of motion of a single axis (scalar variant of the
+//! vectorized kernel)
+//!
+//! \return
+//! The result value of the axis
+//  ----------------------------------------------------------
+    int ComputeOneAxis(     const size_t                        &Index
+                        ,   const RMLVelocityBatchInputValues   &InputValues
+                        ,   RMLVelocityBatchOutputValues        *OutputValues   ) const;
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var double CycleTime
+//!
+//! \brief
+//! Contains the cycle time in seconds
+//  ----------------------------------------------------------
+    double          CycleTime;
+
+};  // class TypeIIRMLVelocityBatch
+
+
+#endif
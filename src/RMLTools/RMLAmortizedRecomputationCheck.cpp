@@ -0,0 +1,535 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLAmortizedRecomputationCheck.cpp
+//!
+//! \brief
+//! Differential check of the amortized recomputation of the
+//! position-based algorithm
+//!
+//! \details
+//! Feeds random sequences of input values into two instances of the
+//! position-based algorithm: one instance distributes each calculation
+//! over \f$ K \f$ cycles (cf. RMLPositionFlags::NumberOfRecomputationCycles),
+//! the other one receives each change of the input values \f$ K-1 \f$
+//! cycles later and calculates the new trajectory within a single cycle.
+//! The output values of both instances are compared bit by bit in every
+//! cycle.
+//!
+//! \sa TypeIIRMLPosition::StartAmortizedRecomputation()
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ReflexxesAPI.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+
+
+//*************************************************************************
+// defines
+
+#define CYCLE_TIME_IN_SECONDS                   0.001
+#define DEFAULT_NUMBER_OF_RUNS                  100
+#define DEFAULT_SEED                            1
+#define MAXIMUM_NUMBER_OF_DOFS                  12
+#define MAXIMUM_NUMBER_OF_RECOMPUTATION_CYCLES  6
+#define NUMBER_OF_CYCLES_PER_RUN                6000
+#define MEAN_NUMBER_OF_CYCLES_BETWEEN_CHANGES   40
+#define MEAN_NUMBER_OF_CYCLES_UNTIL_REST        2000
+#define MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES   10
+
+
+//*************************************************************************
+// RandomValue()
+//
+// Returns a pseudo-random value between Minimum and Maximum
+//*************************************************************************
+static double RandomValue(      const double    &Minimum
+                            ,   const double    &Maximum)
+{
+    return(Minimum + (Maximum - Minimum) * (double)rand() / (double)RAND_MAX);
+}
+
+
+//*************************************************************************
+// InitializeInputValues()
+//
+// Sets up a random, valid state of motion for all degrees of freedom
+//*************************************************************************
+static void InitializeInputValues(      RMLPositionInputParameters  *IP
+                                    ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i   =   0;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        IP->CurrentPositionVector->VecData      [i] =   RandomValue(-1.0,   1.0 );
+        IP->CurrentVelocityVector->VecData      [i] =   0.0;
+        IP->CurrentAccelerationVector->VecData  [i] =   0.0;
+        IP->MaxVelocityVector->VecData          [i] =   RandomValue( 0.5,   2.0 );
+        IP->MaxAccelerationVector->VecData      [i] =   RandomValue( 1.0,   5.0 );
+        IP->MaxJerkVector->VecData              [i] =   RandomValue(10.0,   50.0);
+        IP->TargetPositionVector->VecData       [i] =   RandomValue(-2.0,   2.0 );
+        IP->TargetVelocityVector->VecData       [i] =   0.0;
+        IP->SelectionVector->VecData            [i] =   true;
+    }
+}
+
+
+//*************************************************************************
+// ChangeInputValues()
+//
+// Changes the target state of motion of all degrees of freedom and, in
+// some cases, their maximum accelerations. Non-zero target velocities
+// are chosen for every second change.
+//*************************************************************************
+static void ChangeInputValues(      RMLPositionInputParameters  *IP
+                                ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i                       =   0;
+
+    bool                NonZeroTargetVelocities =   (rand() % 2 == 0)
+                    ,   NewMaxAccelerations     =   (rand() % 3 == 0);
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        if (rand() % 3 == 0)
+        {
+            continue;
+        }
+
+        IP->TargetPositionVector->VecData[i]    =   RandomValue(-2.0, 2.0);
+
+        if (NonZeroTargetVelocities)
+        {
+            IP->TargetVelocityVector->VecData[i]    =   RandomValue(    -0.3 * IP->MaxVelocityVector->VecData[i]
+                                                                    ,    0.3 * IP->MaxVelocityVector->VecData[i]    );
+        }
+        else
+        {
+            IP->TargetVelocityVector->VecData[i]    =   0.0;
+        }
+
+        if (NewMaxAccelerations)
+        {
+            IP->MaxAccelerationVector->VecData[i]   =   RandomValue(1.0, 5.0);
+        }
+    }
+}
+
+
+//*************************************************************************
+// CopyTargetValues()
+//
+// Copies the values changed by ChangeInputValues()
+//*************************************************************************
+static void CopyTargetValues(       const RMLPositionInputParameters    &Source
+                                ,   RMLPositionInputParameters          *Destination)
+{
+    *(Destination->TargetPositionVector)    =   *(Source.TargetPositionVector)  ;
+    *(Destination->TargetVelocityVector)    =   *(Source.TargetVelocityVector)  ;
+    *(Destination->MaxAccelerationVector)   =   *(Source.MaxAccelerationVector) ;
+}
+
+
+//*************************************************************************
+// FeedBackOutputValues()
+//
+// Uses the output values of a cycle as current state of motion of the
+// next cycle
+//*************************************************************************
+static void FeedBackOutputValues(       RMLPositionInputParameters          *IP
+                                    ,   const RMLPositionOutputParameters   &OP)
+{
+    *(IP->CurrentPositionVector)        =   *(OP.NewPositionVector)     ;
+    *(IP->CurrentVelocityVector)        =   *(OP.NewVelocityVector)     ;
+    *(IP->CurrentAccelerationVector)    =   *(OP.NewAccelerationVector) ;
+}
+
+
+//*************************************************************************
+// AreBitwiseEqual()
+//
+// Compares two vectors bit by bit, that is, zero values of different
+// signs are considered to be different
+//*************************************************************************
+static bool AreBitwiseEqual(    const RMLDoubleVector   &A
+                            ,   const RMLDoubleVector   &B)
+{
+    return(memcmp(      A.VecData
+                    ,   B.VecData
+                    ,   A.GetVecDim() * sizeof(double)) == 0);
+}
+
+
+//*************************************************************************
+// CompareOutputValues()
+//
+// Compares the output values of both instances and returns the name of
+// the first attribute that differs or NULL, if all values are equal bit
+// by bit
+//*************************************************************************
+static const char *CompareOutputValues(     const RMLPositionOutputParameters   &AmortizedOP
+                                        ,   const int                           &AmortizedResultValue
+                                        ,   const RMLPositionOutputParameters   &ReferenceOP
+                                        ,   const int                           &ReferenceResultValue)
+{
+    if (AmortizedResultValue != ReferenceResultValue)
+    {
+        return("result value");
+    }
+
+    if (AmortizedOP.ANewCalculationWasPerformed != ReferenceOP.ANewCalculationWasPerformed)
+    {
+        return("ANewCalculationWasPerformed");
+    }
+
+    if (!AreBitwiseEqual(*(AmortizedOP.NewPositionVector), *(ReferenceOP.NewPositionVector)))
+    {
+        return("NewPositionVector");
+    }
+
+    if (!AreBitwiseEqual(*(AmortizedOP.NewVelocityVector), *(ReferenceOP.NewVelocityVector)))
+    {
+        return("NewVelocityVector");
+    }
+
+    if (!AreBitwiseEqual(*(AmortizedOP.NewAccelerationVector), *(ReferenceOP.NewAccelerationVector)))
+    {
+        return("NewAccelerationVector");
+    }
+
+    if (memcmp(     &(AmortizedOP.SynchronizationTime)
+                ,   &(ReferenceOP.SynchronizationTime)
+                ,   sizeof(double)) != 0)
+    {
+        return("SynchronizationTime");
+    }
+
+    if (AmortizedOP.TrajectoryIsPhaseSynchronized != ReferenceOP.TrajectoryIsPhaseSynchronized)
+    {
+        return("TrajectoryIsPhaseSynchronized");
+    }
+
+    if (!AreBitwiseEqual(*(AmortizedOP.ExecutionTimes), *(ReferenceOP.ExecutionTimes)))
+    {
+        return("ExecutionTimes");
+    }
+
+    return(NULL);
+}
+
+
+//*************************************************************************
+// PrintUsage()
+//*************************************************************************
+static void PrintUsage(const char *ProgramName)
+{
+    printf("Usage: %s [-r <runs>] [-s <seed>] [-q]\n\n", ProgramName);
+    printf("  -r <runs>         Number of random runs per synchronization behavior (default %d)\n", DEFAULT_NUMBER_OF_RUNS);
+    printf("  -s <seed>         Seed of the first run (default %d)\n", DEFAULT_SEED);
+    printf("  -q                Only prints the summary\n");
+}
+
+
+//*************************************************************************
+// Main function of the differential check
+//
+// Each run uses a random number of degrees of freedom, a random number
+// of recomputation cycles K, and one of the synchronization behaviors
+// RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE,
+// RMLFlags::ONLY_TIME_SYNCHRONIZATION, and RMLFlags::NO_SYNCHRONIZATION.
+// The target state of motion changes in random cycles, and the next change
+// occurs at least K cycles later. Both instances continue with their own
+// output values.
+//
+// If the amortized instance starts a calculation in the cycle of a change
+// (RMLPositionOutputParameters::ANewCalculationWasPerformed is \c false),
+// the reference instance receives the change K-1 cycles later, that is,
+// in the cycle, in which the amortized instance switches to the new
+// trajectory. Otherwise (e.g., at the first cycle or after an error), the
+// amortized instance calculates the new trajectory within the cycle, and
+// the reference instance receives the change in the same cycle.
+//
+// Without synchronization, a regular instance only recalculates the
+// changed degrees of freedom (cf. TypeIIRMLPosition::RecomputeChangedDOFs()),
+// while the amortized recomputation always executes the complete
+// calculation. Both results may differ in the last bits, and therefore,
+// RMLPositionFlags::EnableDeterministicTiming is set for the reference
+// instance in this case: it does not change the output values, but it
+// disables the incremental recomputation.
+//
+// A run fails in its first cycle with different output values. The exit
+// code is EXIT_SUCCESS, if no run failed.
+//*************************************************************************
+int main(int argc, char *argv[])
+{
+    // ********************************************************************
+    // Variable declarations and definitions
+
+    bool                                Quiet                       =   false   ;
+
+    const char                          *Mismatch                   =   NULL    ;
+
+    int                                 i                           =   0
+                                    ,   AmortizedResultValue        =   0
+                                    ,   ReferenceResultValue        =   0
+                                    ,   SynchronizationBehavior     =   0
+                                    ,   CyclesUntilReferenceChange  =   -1      ;
+
+    unsigned int                        NumberOfRuns                =   DEFAULT_NUMBER_OF_RUNS
+                                    ,   Seed                        =   DEFAULT_SEED
+                                    ,   Run                         =   0
+                                    ,   Behavior                    =   0
+                                    ,   Cycle                       =   0
+                                    ,   NumberOfDOFs                =   0
+                                    ,   CyclesSinceLastChange       =   0
+                                    ,   MeanCyclesBetweenChanges    =   0       ;
+
+    unsigned long long                  NumberOfComparedCycles      =   0
+                                    ,   NumberOfSwitches            =   0
+                                    ,   NumberOfFailedRuns          =   0
+                                    ,   NumberOfFailedRunsPerBehavior[3]        ;
+
+    ReflexxesAPI                        *AmortizedRML               =   NULL
+                                    ,   *ReferenceRML               =   NULL    ;
+
+    RMLPositionInputParameters          *AmortizedIP                =   NULL
+                                    ,   *ReferenceIP                =   NULL    ;
+
+    RMLPositionOutputParameters         *AmortizedOP                =   NULL
+                                    ,   *ReferenceOP                =   NULL    ;
+
+    RMLPositionFlags                    AmortizedFlags                          ;
+
+    RMLPositionFlags                    ReferenceFlags                          ;
+
+    const int                           SynchronizationBehaviors[3] =   {       RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE
+                                                                            ,   RMLFlags::ONLY_TIME_SYNCHRONIZATION
+                                                                            ,   RMLFlags::NO_SYNCHRONIZATION            };
+
+    // ********************************************************************
+    // Command line arguments
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            NumberOfRuns    =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            Seed            =   (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            Quiet           =   true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Reflexxes Motion Libraries                             \n"  );
+    printf("RMLAmortizedRecomputationCheck                         \n\n");
+    printf("Runs per behavior      : %u\n"      , NumberOfRuns                                  );
+    printf("Cycles per run         : %d\n"      , NUMBER_OF_CYCLES_PER_RUN                      );
+    printf("Seed                   : %u\n"      , Seed                                          );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Creating all relevant objects of the Type II Reflexxes Motion Library
+
+    AmortizedIP     =   new RMLPositionInputParameters(     MAXIMUM_NUMBER_OF_DOFS  );
+    ReferenceIP     =   new RMLPositionInputParameters(     MAXIMUM_NUMBER_OF_DOFS  );
+    AmortizedOP     =   new RMLPositionOutputParameters(    MAXIMUM_NUMBER_OF_DOFS  );
+    ReferenceOP     =   new RMLPositionOutputParameters(    MAXIMUM_NUMBER_OF_DOFS  );
+
+    for (Behavior = 0; Behavior < 3; Behavior++)
+    {
+        NumberOfFailedRunsPerBehavior[Behavior] =   0;
+
+        SynchronizationBehavior =   SynchronizationBehaviors[Behavior];
+
+        for (Run = 0; Run < NumberOfRuns; Run++)
+        {
+            srand(Seed + Run);
+
+            NumberOfDOFs    =   1 + (unsigned int)rand() % MAXIMUM_NUMBER_OF_DOFS;
+
+            AmortizedIP->SetNumberOfDOFs(NumberOfDOFs);
+            ReferenceIP->SetNumberOfDOFs(NumberOfDOFs);
+            AmortizedOP->SetNumberOfDOFs(NumberOfDOFs);
+            ReferenceOP->SetNumberOfDOFs(NumberOfDOFs);
+
+            AmortizedFlags.SynchronizationBehavior      =   SynchronizationBehavior;
+            ReferenceFlags.SynchronizationBehavior      =   SynchronizationBehavior;
+            ReferenceFlags.EnableDeterministicTiming    =   (SynchronizationBehavior == RMLFlags::NO_SYNCHRONIZATION);
+            AmortizedFlags.NumberOfRecomputationCycles  =   2 + (unsigned int)rand() % (MAXIMUM_NUMBER_OF_RECOMPUTATION_CYCLES - 1);
+
+            // In every second run, most trajectories reach their target
+            // state of motion before the next change.
+            MeanCyclesBetweenChanges    =   (rand() % 2 == 0)?(MEAN_NUMBER_OF_CYCLES_BETWEEN_CHANGES):(MEAN_NUMBER_OF_CYCLES_UNTIL_REST);
+
+            AmortizedRML    =   new ReflexxesAPI(       NumberOfDOFs
+                                                    ,   CYCLE_TIME_IN_SECONDS   );
+            ReferenceRML    =   new ReflexxesAPI(       NumberOfDOFs
+                                                    ,   CYCLE_TIME_IN_SECONDS   );
+
+            InitializeInputValues(      AmortizedIP
+                                    ,   NumberOfDOFs    );
+
+            *ReferenceIP    =   *AmortizedIP;
+
+            CyclesSinceLastChange       =   0;
+            CyclesUntilReferenceChange  =   -1;
+
+            for (Cycle = 0; Cycle < NUMBER_OF_CYCLES_PER_RUN; Cycle++)
+            {
+                CyclesSinceLastChange++;
+
+                if (    (CyclesSinceLastChange  >   AmortizedFlags.NumberOfRecomputationCycles)
+                    &&  (rand() % MeanCyclesBetweenChanges == 0)                                   )
+                {
+                    ChangeInputValues(      AmortizedIP
+                                        ,   NumberOfDOFs    );
+                    CyclesSinceLastChange   =   0;
+                }
+
+                AmortizedResultValue    =   AmortizedRML->RMLPosition(      *AmortizedIP
+                                                                        ,   AmortizedOP
+                                                                        ,   AmortizedFlags  );
+
+                if (CyclesSinceLastChange == 0)
+                {
+                    if (AmortizedOP->ANewCalculationWasPerformed)
+                    {
+                        CyclesUntilReferenceChange  =   0;
+                    }
+                    else
+                    {
+                        CyclesUntilReferenceChange  =   (int)AmortizedFlags.NumberOfRecomputationCycles - 1;
+                        NumberOfSwitches++;
+                    }
+                }
+
+                if (CyclesUntilReferenceChange == 0)
+                {
+                    CopyTargetValues(       *AmortizedIP
+                                        ,   ReferenceIP     );
+                }
+
+                if (CyclesUntilReferenceChange >= 0)
+                {
+                    CyclesUntilReferenceChange--;
+                }
+
+                ReferenceResultValue    =   ReferenceRML->RMLPosition(      *ReferenceIP
+                                                                        ,   ReferenceOP
+                                                                        ,   ReferenceFlags  );
+
+                NumberOfComparedCycles++;
+
+                Mismatch    =   CompareOutputValues(        *AmortizedOP
+                                                        ,   AmortizedResultValue
+                                                        ,   *ReferenceOP
+                                                        ,   ReferenceResultValue    );
+
+                if (Mismatch != NULL)
+                {
+                    if ((!Quiet) && (NumberOfFailedRuns < MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES))
+                    {
+                        printf(     "Mismatch in cycle %u of run %u (behavior %d, %u DOFs, K = %u): %s\n"
+                                ,   Cycle
+                                ,   Run
+                                ,   SynchronizationBehavior
+                                ,   NumberOfDOFs
+                                ,   AmortizedFlags.NumberOfRecomputationCycles
+                                ,   Mismatch                                    );
+                    }
+                    NumberOfFailedRuns++;
+                    NumberOfFailedRunsPerBehavior[Behavior]++;
+                    break;
+                }
+
+                FeedBackOutputValues(       AmortizedIP
+                                        ,   *AmortizedOP    );
+                FeedBackOutputValues(       ReferenceIP
+                                        ,   *ReferenceOP    );
+            }
+
+            delete  AmortizedRML    ;
+            delete  ReferenceRML    ;
+        }
+    }
+
+    // ********************************************************************
+    // Summary
+
+    printf("Compared cycles        : %llu\n"    , NumberOfComparedCycles                        );
+    printf("Amortized calculations : %llu\n"    , NumberOfSwitches                              );
+    printf("Failed runs            : %llu (%llu / %llu / %llu)\n"
+                                                , NumberOfFailedRuns
+                                                , NumberOfFailedRunsPerBehavior[0]
+                                                , NumberOfFailedRunsPerBehavior[1]
+                                                , NumberOfFailedRunsPerBehavior[2]              );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Deleting the objects of the Reflexxes Motion Library end terminating
+    // the process
+
+    delete  AmortizedIP     ;
+    delete  ReferenceIP     ;
+    delete  AmortizedOP     ;
+    delete  ReferenceOP     ;
+
+    if (NumberOfFailedRuns == 0)
+    {
+        printf("The amortized recomputation matches the delayed calculation bit by bit.\n");
+        exit(EXIT_SUCCESS);
+    }
+    else
+    {
+        printf("The amortized recomputation differs from the delayed calculation.\n");
+        exit(EXIT_FAILURE);
+    }
+}
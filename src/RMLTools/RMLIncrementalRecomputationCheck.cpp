@@ -0,0 +1,565 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLIncrementalRecomputationCheck.cpp
+//!
+//! \brief
+//! Differential check of the incremental recomputation of the
+//! position-based algorithm
+//!
+//! \details
+//! Feeds the same sequence of input values into two instances of the
+//! position-based algorithm without synchronization: one instance
+//! recalculates only the changed degrees of freedom, the other one always
+//! executes the complete calculation. The output values of both instances
+//! are compared in every cycle.
+//!
+//! \sa TypeIIRMLPosition::RecomputeChangedDOFs()
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ReflexxesAPI.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+
+
+//*************************************************************************
+// defines
+
+#define CYCLE_TIME_IN_SECONDS                   0.001
+#define DEFAULT_NUMBER_OF_DOFS                  8
+#define DEFAULT_NUMBER_OF_CYCLES                200000
+#define DEFAULT_SEED                            1
+#define MAXIMUM_NUMBER_OF_FIXED_CYCLES          100000
+#define MEAN_NUMBER_OF_CYCLES_BETWEEN_CHANGES   50
+#define TOLERANCE                               1.0e-6
+#define MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES   10
+
+
+//*************************************************************************
+// RandomValue()
+//
+// Returns a pseudo-random value between Minimum and Maximum
+//*************************************************************************
+static double RandomValue(      const double    &Minimum
+                            ,   const double    &Maximum)
+{
+    return(Minimum + (Maximum - Minimum) * (double)rand() / (double)RAND_MAX);
+}
+
+
+//*************************************************************************
+// InitializeInputValues()
+//
+// Sets up a random, valid state of motion for all degrees of freedom.
+// All target velocities are zero: if a degree of freedom approaches a
+// non-zero target velocity on its final ramp, the sampled state of motion
+// lies on the switching curve of the decision tree of Step 1, and rounding
+// errors decide whether a complete calculation continues the ramp or
+// starts an overshoot. Non-zero target velocities are covered by the fixed
+// sequence.
+//*************************************************************************
+static void InitializeInputValues(      RMLPositionInputParameters  *IP
+                                    ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i   =   0;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        IP->CurrentPositionVector->VecData      [i] =   RandomValue(-1.0,   1.0 );
+        IP->CurrentVelocityVector->VecData      [i] =   RandomValue(-0.2,   0.2 );
+        IP->CurrentAccelerationVector->VecData  [i] =   0.0;
+        IP->MaxVelocityVector->VecData          [i] =   RandomValue( 0.5,   2.0 );
+        IP->MaxAccelerationVector->VecData      [i] =   RandomValue( 1.0,   5.0 );
+        IP->MaxJerkVector->VecData              [i] =   RandomValue(10.0,   50.0);
+        IP->TargetPositionVector->VecData       [i] =   RandomValue(-2.0,   2.0 );
+        IP->TargetVelocityVector->VecData       [i] =   0.0;
+        IP->SelectionVector->VecData            [i] =   true;
+    }
+}
+
+
+//*************************************************************************
+// ChangeInputValues()
+//
+// Changes the target position or the selection of one randomly chosen
+// degree of freedom in both sets of input values. At
+// least one degree of freedom remains selected.
+//*************************************************************************
+static void ChangeInputValues(      RMLPositionInputParameters  *IncrementalIP
+                                ,   RMLPositionInputParameters  *CompleteIP
+                                ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i                       =   0
+                    ,   NumberOfSelectedDOFs    =   0;
+
+    double              Value                   =   0.0;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        if (IncrementalIP->SelectionVector->VecData[i])
+        {
+            NumberOfSelectedDOFs++;
+        }
+    }
+
+    i   =   (unsigned int)rand() % NumberOfDOFs;
+
+    if (rand() % 2 == 0)
+    {
+        Value   =   RandomValue(-2.0, 2.0);
+
+        IncrementalIP->TargetPositionVector->VecData[i] =   Value;
+        CompleteIP->TargetPositionVector->VecData   [i] =   Value;
+    }
+    else
+    {
+        if ((!IncrementalIP->SelectionVector->VecData[i]) || (NumberOfSelectedDOFs > 1))
+        {
+            IncrementalIP->SelectionVector->VecData[i]  =   !IncrementalIP->SelectionVector->VecData[i];
+            CompleteIP->SelectionVector->VecData   [i]  =   IncrementalIP->SelectionVector->VecData[i];
+        }
+    }
+}
+
+
+//*************************************************************************
+// FeedBackOutputValues()
+//
+// Uses the output values of a cycle as current state of motion of the
+// next cycle
+//*************************************************************************
+static void FeedBackOutputValues(       RMLPositionInputParameters          *IP
+                                    ,   const RMLPositionOutputParameters   &OP)
+{
+    *(IP->CurrentPositionVector)        =   *(OP.NewPositionVector)     ;
+    *(IP->CurrentVelocityVector)        =   *(OP.NewVelocityVector)     ;
+    *(IP->CurrentAccelerationVector)    =   *(OP.NewAccelerationVector) ;
+}
+
+
+//*************************************************************************
+// GreatestDeviation()
+//
+// Returns the greatest absolute difference of two vectors
+//*************************************************************************
+static double GreatestDeviation(    const RMLDoubleVector   &A
+                                ,   const RMLDoubleVector   &B)
+{
+    unsigned int        i           =   0;
+
+    double              Deviation   =   0.0;
+
+    for (i = 0; i < A.GetVecDim(); i++)
+    {
+        if (fabs(A.VecData[i] - B.VecData[i]) > Deviation)
+        {
+            Deviation   =   fabs(A.VecData[i] - B.VecData[i]);
+        }
+    }
+
+    return(Deviation);
+}
+
+
+//*************************************************************************
+// HasConsistentGreatestDOF()
+//
+// Checks whether RMLOutputParameters::DOFWithTheGreatestExecutionTime
+// refers to a degree of freedom with the greatest execution time
+//*************************************************************************
+static bool HasConsistentGreatestDOF(const RMLPositionOutputParameters &OP)
+{
+    unsigned int        i   =   0;
+
+    if (OP.DOFWithTheGreatestExecutionTime >= OP.GetNumberOfDOFs())
+    {
+        return(false);
+    }
+
+    for (i = 0; i < OP.GetNumberOfDOFs(); i++)
+    {
+        if (    OP.ExecutionTimes->VecData[i]
+            >   OP.ExecutionTimes->VecData[OP.DOFWithTheGreatestExecutionTime]  )
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+
+//*************************************************************************
+// CompareOutputValues()
+//
+// Compares the output values of both instances and returns the name of
+// the first attribute that differs by more than TOLERANCE or NULL, if all
+// values match. The greatest deviation of positions and velocities is
+// accumulated in MaximumDeviation. Accelerations are not compared: they
+// are piecewise constant, and if a switching time of a profile coincides
+// with the end of a cycle, either of both adjacent values may be returned.
+//*************************************************************************
+static const char *CompareOutputValues(     const RMLPositionOutputParameters   &IncrementalOP
+                                        ,   const int                           &IncrementalResultValue
+                                        ,   const RMLPositionOutputParameters   &CompleteOP
+                                        ,   const int                           &CompleteResultValue
+                                        ,   double                              *MaximumDeviation)
+{
+    double              PositionDeviation       =   GreatestDeviation(      *(IncrementalOP.NewPositionVector)
+                                                                        ,   *(CompleteOP.NewPositionVector)         )
+                    ,   VelocityDeviation       =   GreatestDeviation(      *(IncrementalOP.NewVelocityVector)
+                                                                        ,   *(CompleteOP.NewVelocityVector)         );
+
+    if (PositionDeviation > *MaximumDeviation)
+    {
+        *MaximumDeviation   =   PositionDeviation;
+    }
+
+    if (VelocityDeviation > *MaximumDeviation)
+    {
+        *MaximumDeviation   =   VelocityDeviation;
+    }
+
+    if (IncrementalResultValue != CompleteResultValue)
+    {
+        return("result value");
+    }
+
+    if (PositionDeviation > TOLERANCE)
+    {
+        return("NewPositionVector");
+    }
+
+    if (VelocityDeviation > TOLERANCE)
+    {
+        return("NewVelocityVector");
+    }
+
+    if (GreatestDeviation(      *(IncrementalOP.ExecutionTimes)
+                            ,   *(CompleteOP.ExecutionTimes)    ) > TOLERANCE)
+    {
+        return("ExecutionTimes");
+    }
+
+    if (!HasConsistentGreatestDOF(IncrementalOP))
+    {
+        return("DOFWithTheGreatestExecutionTime");
+    }
+
+    return(NULL);
+}
+
+
+//*************************************************************************
+// PrintUsage()
+//*************************************************************************
+static void PrintUsage(const char *ProgramName)
+{
+    printf("Usage: %s [-n <DOFs>] [-c <cycles>] [-s <seed>] [-q]\n\n", ProgramName);
+    printf("  -n <DOFs>         Number of degrees of freedom (default %d)\n", DEFAULT_NUMBER_OF_DOFS);
+    printf("  -c <cycles>       Number of cycles of the random sequence (default %d)\n", DEFAULT_NUMBER_OF_CYCLES);
+    printf("  -s <seed>         Seed of the random sequence (default %d)\n", DEFAULT_SEED);
+    printf("  -q                Only prints the summary\n");
+}
+
+
+//*************************************************************************
+// Main function of the differential check
+//
+// Two instances of the position-based algorithm are run with
+// RMLFlags::NO_SYNCHRONIZATION. For the second instance,
+// RMLPositionFlags::EnableDeterministicTiming is set: it does not change
+// the output values, but it disables the incremental recomputation of
+// TypeIIRMLPosition::RecomputeChangedDOFs(), such that every change of the
+// input values leads to a complete calculation. Each instance continues
+// with its own output values. Two input sequences are checked:
+//
+//  - A fixed sequence, in which the trajectory of one degree of freedom
+//    ends with a non-zero target velocity, such that it moves beyond its
+//    target position, and afterwards another degree of freedom becomes
+//    deselected.
+//
+//  - A random sequence, in which target positions and the selection
+//    vector change in random cycles.
+//
+// As both instances calculate time-optimal trajectories from the same
+// states of motion, the output values may only differ by numerical
+// errors. The exit code is EXIT_SUCCESS, if all cycles match within
+// TOLERANCE.
+//*************************************************************************
+int main(int argc, char *argv[])
+{
+    // ********************************************************************
+    // Variable declarations and definitions
+
+    bool                                Quiet                       =   false   ;
+
+    const char                          *Mismatch                   =   NULL    ;
+
+    int                                 i                           =   0
+                                    ,   IncrementalResultValue      =   0
+                                    ,   CompleteResultValue         =   0       ;
+
+    unsigned int                        NumberOfDOFs                =   DEFAULT_NUMBER_OF_DOFS
+                                    ,   NumberOfCycles              =   DEFAULT_NUMBER_OF_CYCLES
+                                    ,   Seed                        =   DEFAULT_SEED
+                                    ,   Sequence                    =   0
+                                    ,   Cycle                       =   0
+                                    ,   NumberOfSequenceCycles      =   0
+                                    ,   CoastingCycles              =   0       ;
+
+    unsigned long long                  NumberOfComparedCycles      =   0
+                                    ,   NumberOfMismatches          =   0
+                                    ,   NumberOfRecomputations      =   0       ;
+
+    double                              MaximumDeviation            =   0.0     ;
+
+    ReflexxesAPI                        *IncrementalRML             =   NULL
+                                    ,   *CompleteRML                =   NULL    ;
+
+    RMLPositionInputParameters          *IncrementalIP              =   NULL
+                                    ,   *CompleteIP                 =   NULL    ;
+
+    RMLPositionOutputParameters         *IncrementalOP              =   NULL
+                                    ,   *CompleteOP                 =   NULL    ;
+
+    RMLPositionFlags                    IncrementalFlags                        ;
+
+    RMLPositionFlags                    CompleteFlags                           ;
+
+    // ********************************************************************
+    // Command line arguments
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            NumberOfDOFs    =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            NumberOfCycles  =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            Seed            =   (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            Quiet           =   true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (NumberOfDOFs < 3)
+    {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Reflexxes Motion Libraries                             \n"  );
+    printf("RMLIncrementalRecomputationCheck                       \n\n");
+    printf("Degrees of freedom     : %u\n"      , NumberOfDOFs                                  );
+    printf("Random cycles          : %u\n"      , NumberOfCycles                                );
+    printf("Seed                   : %u\n"      , Seed                                          );
+    printf("Tolerance              : %g\n"      , TOLERANCE                                     );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Creating all relevant objects of the Type II Reflexxes Motion Library
+
+    IncrementalIP   =   new RMLPositionInputParameters(     NumberOfDOFs    );
+    CompleteIP      =   new RMLPositionInputParameters(     NumberOfDOFs    );
+    IncrementalOP   =   new RMLPositionOutputParameters(    NumberOfDOFs    );
+    CompleteOP      =   new RMLPositionOutputParameters(    NumberOfDOFs    );
+
+    IncrementalFlags.SynchronizationBehavior    =   RMLFlags::NO_SYNCHRONIZATION;
+    CompleteFlags.SynchronizationBehavior       =   RMLFlags::NO_SYNCHRONIZATION;
+    CompleteFlags.EnableDeterministicTiming     =   true;
+
+    // ********************************************************************
+    // Sequence 0: a degree of freedom is deselected, while another one
+    // moves beyond its target position.
+    // Sequence 1: random changes of the input values
+
+    for (Sequence = 0; Sequence < 2; Sequence++)
+    {
+        IncrementalRML  =   new ReflexxesAPI(       NumberOfDOFs
+                                                ,   CYCLE_TIME_IN_SECONDS   );
+        CompleteRML     =   new ReflexxesAPI(       NumberOfDOFs
+                                                ,   CYCLE_TIME_IN_SECONDS   );
+
+        srand(Seed);
+
+        InitializeInputValues(      IncrementalIP
+                                ,   NumberOfDOFs    );
+
+        if (Sequence == 0)
+        {
+            // The first degree of freedom reaches its target position
+            // quickly with a non-zero target velocity, while all other
+            // ones have a long way to go.
+            for (i = 0; i < (int)NumberOfDOFs; i++)
+            {
+                IncrementalIP->CurrentPositionVector->VecData   [i] =   0.0;
+                IncrementalIP->CurrentVelocityVector->VecData   [i] =   0.0;
+                IncrementalIP->TargetPositionVector->VecData    [i] =   (i == 0)?(0.1):(5.0);
+                IncrementalIP->TargetVelocityVector->VecData    [i] =   (i == 0)?(0.5 * IncrementalIP->MaxVelocityVector->VecData[i]):(0.0);
+            }
+
+            NumberOfSequenceCycles  =   MAXIMUM_NUMBER_OF_FIXED_CYCLES;
+        }
+        else
+        {
+            NumberOfSequenceCycles  =   NumberOfCycles;
+        }
+
+        *CompleteIP     =   *IncrementalIP;
+
+        CoastingCycles  =   0;
+
+        for (Cycle = 0; Cycle < NumberOfSequenceCycles; Cycle++)
+        {
+            if (Sequence == 0)
+            {
+                // Once the first degree of freedom has been moving beyond
+                // its target position for a while, the second one becomes
+                // deselected.
+                if ((Cycle > 0) && (IncrementalOP->ExecutionTimes->VecData[0] == 0.0))
+                {
+                    CoastingCycles++;
+                }
+
+                if (CoastingCycles == 100)
+                {
+                    IncrementalIP->SelectionVector->VecData[1]  =   false;
+                    CompleteIP->SelectionVector->VecData[1]     =   false;
+                }
+
+                if ((CoastingCycles > 100) && (IncrementalResultValue == ReflexxesAPI::RML_FINAL_STATE_REACHED))
+                {
+                    break;
+                }
+            }
+            else if (rand() % MEAN_NUMBER_OF_CYCLES_BETWEEN_CHANGES == 0)
+            {
+                ChangeInputValues(      IncrementalIP
+                                    ,   CompleteIP
+                                    ,   NumberOfDOFs    );
+            }
+
+            IncrementalResultValue  =   IncrementalRML->RMLPosition(        *IncrementalIP
+                                                                        ,   IncrementalOP
+                                                                        ,   IncrementalFlags    );
+
+            CompleteResultValue     =   CompleteRML->RMLPosition(           *CompleteIP
+                                                                        ,   CompleteOP
+                                                                        ,   CompleteFlags       );
+
+            if (IncrementalOP->ANewCalculationWasPerformed)
+            {
+                NumberOfRecomputations++;
+            }
+
+            Mismatch    =   CompareOutputValues(        *IncrementalOP
+                                                    ,   IncrementalResultValue
+                                                    ,   *CompleteOP
+                                                    ,   CompleteResultValue
+                                                    ,   &MaximumDeviation       );
+
+            if (Mismatch != NULL)
+            {
+                if ((!Quiet) && (NumberOfMismatches < MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES))
+                {
+                    printf(     "Mismatch in cycle %u (sequence %u): %s (incremental result %d, complete result %d)\n"
+                            ,   Cycle
+                            ,   Sequence
+                            ,   Mismatch
+                            ,   IncrementalResultValue
+                            ,   CompleteResultValue                                                                 );
+                }
+                NumberOfMismatches++;
+            }
+
+            NumberOfComparedCycles++;
+
+            FeedBackOutputValues(       IncrementalIP
+                                    ,   *IncrementalOP  );
+            FeedBackOutputValues(       CompleteIP
+                                    ,   *CompleteOP     );
+        }
+
+        delete  IncrementalRML  ;
+        delete  CompleteRML     ;
+    }
+
+    // ********************************************************************
+    // Summary
+
+    printf("Compared cycles        : %llu\n"    , NumberOfComparedCycles                        );
+    printf("Recomputations         : %llu\n"    , NumberOfRecomputations                        );
+    printf("Mismatches             : %llu\n"    , NumberOfMismatches                            );
+    printf("Maximum deviation      : %g\n"      , MaximumDeviation                              );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Deleting the objects of the Reflexxes Motion Library end terminating
+    // the process
+
+    delete  IncrementalIP   ;
+    delete  CompleteIP      ;
+    delete  IncrementalOP   ;
+    delete  CompleteOP      ;
+
+    if (NumberOfMismatches == 0)
+    {
+        printf("The incremental recomputation matches the complete calculation.\n");
+        exit(EXIT_SUCCESS);
+    }
+    else
+    {
+        printf("The incremental recomputation differs from the complete calculation.\n");
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,518 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLReplay.cpp
+//!
+//! \brief
+//! Replay application for binary log files of the Reflexxes Motion Libraries
+//!
+//! \details
+//! Replays a log written by RMLBinaryLogWriter, verifies all output values
+//! bit by bit, and reports the latency of each cycle as well as the
+//! number of recomputations and fallback cycles.
+//!
+//! \sa RMLBinaryLogReader
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ReflexxesAPI.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLVelocityFlags.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLBinaryLogReader.h>
+#include <TypeIIRMLPlatform.h>
+#include <TypeIIRMLQuicksort.h>
+
+
+//*************************************************************************
+// defines
+
+#define MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES   10
+
+
+//*************************************************************************
+// IsBitwiseEqual()
+//
+// Compares two arrays of double values bit by bit
+//*************************************************************************
+static bool IsBitwiseEqual(     const double        *A
+                            ,   const double        *B
+                            ,   const unsigned int  &NumberOfDOFs)
+{
+    return(memcmp(A, B, NumberOfDOFs * sizeof(double)) == 0);
+}
+
+
+//*************************************************************************
+// CompareOutputValues()
+//
+// Compares the output values of the replayed cycle with the recorded ones
+// and returns the name of the first differing attribute or NULL, if all
+// values are equal bit by bit.
+//*************************************************************************
+static const char *CompareOutputValues(     const RMLBinaryLogReader        &Reader
+                                        ,   const RMLBinaryLogRecordHeader  *Record
+                                        ,   const RMLOutputParameters       &OutputValues
+                                        ,   const int                       &ResultValue)
+{
+    unsigned int        NumberOfDOFs    =   Reader.GetNumberOfDOFs();
+
+    if (ResultValue != Record->ResultValue)
+    {
+        return("result value");
+    }
+
+    if (    OutputValues.ANewCalculationWasPerformed
+        !=  ((Record->StatusBits & RML_BINARY_LOG_NEW_CALCULATION_WAS_PERFORMED) != 0)  )
+    {
+        return("ANewCalculationWasPerformed");
+    }
+
+    if (    OutputValues.TrajectoryIsPhaseSynchronized
+        !=  ((Record->StatusBits & RML_BINARY_LOG_TRAJECTORY_IS_PHASE_SYNCHRONIZED) != 0)   )
+    {
+        return("TrajectoryIsPhaseSynchronized");
+    }
+
+    if (OutputValues.DOFWithTheGreatestExecutionTime != Record->DOFWithTheGreatestExecutionTime)
+    {
+        return("DOFWithTheGreatestExecutionTime");
+    }
+
+    if (memcmp(&(OutputValues.SynchronizationTime), &(Record->SynchronizationTime), sizeof(double)) != 0)
+    {
+        return("SynchronizationTime");
+    }
+
+    if (!IsBitwiseEqual(    OutputValues.NewPositionVector->VecData
+                        ,   Reader.GetDataBlock(Record, RML_BINARY_LOG_NEW_POSITION)
+                        ,   NumberOfDOFs                                                ))
+    {
+        return("NewPositionVector");
+    }
+
+    if (!IsBitwiseEqual(    OutputValues.NewVelocityVector->VecData
+                        ,   Reader.GetDataBlock(Record, RML_BINARY_LOG_NEW_VELOCITY)
+                        ,   NumberOfDOFs                                                ))
+    {
+        return("NewVelocityVector");
+    }
+
+    if (!IsBitwiseEqual(    OutputValues.NewAccelerationVector->VecData
+                        ,   Reader.GetDataBlock(Record, RML_BINARY_LOG_NEW_ACCELERATION)
+                        ,   NumberOfDOFs                                                ))
+    {
+        return("NewAccelerationVector");
+    }
+
+    if (!IsBitwiseEqual(    OutputValues.ExecutionTimes->VecData
+                        ,   Reader.GetDataBlock(Record, RML_BINARY_LOG_EXECUTION_TIMES)
+                        ,   NumberOfDOFs                                                ))
+    {
+        return("ExecutionTimes");
+    }
+
+    return(NULL);
+}
+
+
+//*************************************************************************
+// PrintUsage()
+//*************************************************************************
+static void PrintUsage(const char *ProgramName)
+{
+    printf("Usage: %s <log file> [-r <repetitions>] [-c <CSV file>] [-q]\n\n", ProgramName);
+    printf("  -r <repetitions>  Replays the log several times (profiling)\n");
+    printf("  -c <CSV file>     Writes the latency of each cycle to a CSV file\n");
+    printf("  -q                Only prints the summary\n");
+}
+
+
+//*************************************************************************
+// Main function of the replay application
+//
+// A binary log file written by RMLBinaryLogWriter is replayed cycle by
+// cycle: the recorded input values, flags, elapsed cycle times, and feed
+// override settings are fed into a fresh ReflexxesAPI object as fast as
+// possible, the output values are compared bit by bit with the recorded
+// ones, and the execution time of each call of ReflexxesAPI::RMLPosition()
+// or ReflexxesAPI::RMLVelocity() is measured.
+//
+// The exit code is EXIT_SUCCESS, if all cycles were reproduced exactly,
+// such that this application can be used as a regression gate.
+//*************************************************************************
+int main(int argc, char *argv[])
+{
+    // ********************************************************************
+    // Variable declarations and definitions
+
+    bool                                Quiet                       =   false   ;
+
+    const char                          *LogFileName                =   NULL
+                                    ,   *CSVFileName                =   NULL
+                                    ,   *Mismatch                   =   NULL    ;
+
+    int                                 i                           =   0
+                                    ,   ResultValue                 =   0
+                                    ,   NumberOfRepetitions         =   1
+                                    ,   Repetition                  =   0       ;
+
+    unsigned long long                  Cycle                       =   0
+                                    ,   NumberOfRecords             =   0
+                                    ,   NumberOfReplayedCycles      =   0
+                                    ,   NumberOfMismatches          =   0
+                                    ,   NumberOfRecomputations      =   0
+                                    ,   NumberOfFallbacks           =   0
+                                    ,   NumberOfIncompleteRecords   =   0       ;
+
+    double                              StartTime                   =   0.0
+                                    ,   Latency                     =   0.0
+                                    ,   SumOfLatencies              =   0.0
+                                    ,   AppliedFeedOverride         =   0.0
+                                    ,   *Latencies                  =   NULL    ;
+
+    FILE                                *CSVFile                    =   NULL    ;
+
+    ReflexxesAPI                        *RML                        =   NULL    ;
+
+    RMLPositionInputParameters          *PositionIP                 =   NULL    ;
+
+    RMLPositionOutputParameters         *PositionOP                 =   NULL    ;
+
+    RMLPositionFlags                    PositionFlags                           ;
+
+    RMLVelocityInputParameters          *VelocityIP                 =   NULL    ;
+
+    RMLVelocityOutputParameters         *VelocityOP                 =   NULL    ;
+
+    RMLVelocityFlags                    VelocityFlags                           ;
+
+    RMLBinaryLogReader                  Reader                                  ;
+
+    const RMLBinaryLogRecordHeader      *Record                     =   NULL    ;
+
+    // ********************************************************************
+    // Command line arguments
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            NumberOfRepetitions =   atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            CSVFileName         =   argv[++i];
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            Quiet               =   true;
+        }
+        else if ((argv[i][0] != '-') && (LogFileName == NULL))
+        {
+            LogFileName         =   argv[i];
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if ((LogFileName == NULL) || (NumberOfRepetitions < 1))
+    {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    if (Reader.Open(LogFileName) != RMLBinaryLogReader::RETURN_SUCCESS)
+    {
+        printf("Error: '%s' is not a compatible binary log file.\n", LogFileName);
+        exit(EXIT_FAILURE);
+    }
+
+    NumberOfRecords =   Reader.GetNumberOfRecords();
+
+    if (NumberOfRecords == 0)
+    {
+        printf("Error: '%s' does not contain any records.\n", LogFileName);
+        exit(EXIT_FAILURE);
+    }
+
+    if (CSVFileName != NULL)
+    {
+        CSVFile =   fopen(CSVFileName, "w");
+
+        if (CSVFile == NULL)
+        {
+            printf("Error: '%s' cannot be opened.\n", CSVFileName);
+            exit(EXIT_FAILURE);
+        }
+
+        fprintf(CSVFile, "repetition,cycle,latency_us,result,recomputation,fallback,match\n");
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Reflexxes Motion Libraries                             \n"  );
+    printf("RMLReplay                                              \n\n");
+    printf("Log file               : %s\n"      , LogFileName                                   );
+    printf("Degrees of freedom     : %u\n"      , Reader.GetNumberOfDOFs()                      );
+    printf("Cycle time             : %g s\n"    , Reader.GetCycleTime()                         );
+    printf("Records                : %llu\n"    , NumberOfRecords                               );
+    printf("-------------------------------------------------------\n"  );
+
+    if (Reader.GetNumberOfOverwrittenRecords() > 0)
+    {
+        printf( "Warning: %llu records at the beginning of the log are missing.\n"
+                "The replay starts in the middle of the recorded stream, such that\n"
+                "differences are expected until the first recomputation.\n"
+                ,   Reader.GetNumberOfOverwrittenRecords()                              );
+    }
+
+    // ********************************************************************
+    // Creating all relevant objects of the Type II Reflexxes Motion Library
+
+    PositionIP  =   new RMLPositionInputParameters(     Reader.GetNumberOfDOFs()    );
+    PositionOP  =   new RMLPositionOutputParameters(    Reader.GetNumberOfDOFs()    );
+    VelocityIP  =   new RMLVelocityInputParameters(     Reader.GetNumberOfDOFs()    );
+    VelocityOP  =   new RMLVelocityOutputParameters(    Reader.GetNumberOfDOFs()    );
+
+    Latencies   =   new double[(size_t)(NumberOfRecords * NumberOfRepetitions)];
+
+    // ********************************************************************
+    // Replay loop
+
+    for (Repetition = 0; Repetition < NumberOfRepetitions; Repetition++)
+    {
+        // Every repetition starts with a fresh object, such that the
+        // internal state matches the one of the recording.
+        RML =   new ReflexxesAPI(       Reader.GetNumberOfDOFs()
+                                    ,   Reader.GetCycleTime()       );
+
+        // Recomputations and fallback cycles are reported per replay of
+        // the log, such that they can be compared with the log itself.
+        NumberOfRecomputations  =   0;
+        NumberOfFallbacks       =   0;
+
+        for (Cycle = 0; Cycle < NumberOfRecords; Cycle++)
+        {
+            Record  =   Reader.GetRecord(Cycle);
+
+            if (Record == NULL)
+            {
+                if (Repetition == 0)
+                {
+                    NumberOfIncompleteRecords++;
+                }
+                continue;
+            }
+
+            if ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) == 0)
+            {
+                Reader.GetPositionInputValues(      Record
+                                                ,   PositionIP
+                                                ,   &PositionFlags  );
+
+                // The feed override state evolves from the recorded
+                // settings in the same way as during the recording.
+                RML->SetFeedOverride(           Record->FeedOverride        );
+                RML->SetMaxFeedOverrideRate(    Record->MaxFeedOverrideRate );
+
+                StartTime   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+                ResultValue =   RML->RMLPosition(       *PositionIP
+                                                    ,   PositionOP
+                                                    ,   PositionFlags
+                                                    ,   Record->ElapsedTime );
+
+                Latency     =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+
+                Mismatch    =   CompareOutputValues(        Reader
+                                                        ,   Record
+                                                        ,   *PositionOP
+                                                        ,   ResultValue     );
+
+                AppliedFeedOverride =   RML->GetFeedOverride();
+
+                if (    (Mismatch == NULL)
+                    &&  (memcmp(&AppliedFeedOverride, &(Record->AppliedFeedOverride), sizeof(double)) != 0) )
+                {
+                    Mismatch    =   "AppliedFeedOverride";
+                }
+
+                if (PositionOP->ANewCalculationWasPerformed)
+                {
+                    NumberOfRecomputations++;
+                }
+            }
+            else
+            {
+                Reader.GetVelocityInputValues(      Record
+                                                ,   VelocityIP
+                                                ,   &VelocityFlags  );
+
+                StartTime   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+                ResultValue =   RML->RMLVelocity(       *VelocityIP
+                                                    ,   VelocityOP
+                                                    ,   VelocityFlags
+                                                    ,   Record->ElapsedTime );
+
+                Latency     =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+
+                Mismatch    =   CompareOutputValues(        Reader
+                                                        ,   Record
+                                                        ,   *VelocityOP
+                                                        ,   ResultValue     );
+
+                if (    (Mismatch == NULL)
+                    &&  (!IsBitwiseEqual(   VelocityOP->PositionValuesAtTargetVelocity->VecData
+                                        ,   Reader.GetDataBlock(Record, RML_BINARY_LOG_POSITION_VALUES_AT_TARGET_VELOCITY)
+                                        ,   Reader.GetNumberOfDOFs()                                                        )))
+                {
+                    Mismatch    =   "PositionValuesAtTargetVelocity";
+                }
+
+                if (VelocityOP->ANewCalculationWasPerformed)
+                {
+                    NumberOfRecomputations++;
+                }
+            }
+
+            // All error values except RML_ERROR_NULL_POINTER are
+            // accompanied by the execution of the fallback strategy.
+            if ((ResultValue < 0) && (ResultValue != ReflexxesAPI::RML_ERROR_NULL_POINTER))
+            {
+                NumberOfFallbacks++;
+            }
+
+            if (Mismatch != NULL)
+            {
+                if ((!Quiet) && (NumberOfMismatches < MAXIMUM_NUMBER_OF_REPORTED_MISMATCHES))
+                {
+                    printf(     "Mismatch in cycle %llu (repetition %d): %s (recorded result %d, replayed result %d)\n"
+                            ,   Cycle
+                            ,   Repetition
+                            ,   Mismatch
+                            ,   Record->ResultValue
+                            ,   ResultValue                                                                             );
+                }
+                NumberOfMismatches++;
+            }
+
+            if (CSVFile != NULL)
+            {
+                fprintf(    CSVFile
+                        ,   "%d,%llu,%.3f,%d,%d,%d,%d\n"
+                        ,   Repetition
+                        ,   Cycle
+                        ,   1.0e6 * Latency
+                        ,   ResultValue
+                        ,   ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) == 0)
+                                ?   (int)PositionOP->ANewCalculationWasPerformed
+                                :   (int)VelocityOP->ANewCalculationWasPerformed
+                        ,   (int)((ResultValue < 0) && (ResultValue != ReflexxesAPI::RML_ERROR_NULL_POINTER))
+                        ,   (int)(Mismatch == NULL)                                                             );
+            }
+
+            Latencies[NumberOfReplayedCycles]   =   Latency;
+            SumOfLatencies                      +=  Latency;
+            NumberOfReplayedCycles++;
+        }
+
+        delete  RML;
+    }
+
+    // ********************************************************************
+    // Summary
+
+    if (NumberOfReplayedCycles > 0)
+    {
+        TypeIIRMLMath::Quicksort(       0
+                                    ,   (int)NumberOfReplayedCycles - 1
+                                    ,   Latencies                       );
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Repetitions            : %d\n"      , NumberOfRepetitions                           );
+    printf("Replayed cycles (total): %llu\n"    , NumberOfReplayedCycles                        );
+    printf("Mismatches (total)     : %llu\n"    , NumberOfMismatches                            );
+    printf("Incomplete records     : %llu\n"    , NumberOfIncompleteRecords                     );
+    printf("Recomputations per log : %llu\n"    , NumberOfRecomputations                        );
+    printf("Fallbacks per log      : %llu\n"    , NumberOfFallbacks                             );
+
+    if (NumberOfReplayedCycles > 0)
+    {
+        printf("Latency minimum        : %10.3f us\n"   , 1.0e6 * Latencies[0]                                                  );
+        printf("Latency mean           : %10.3f us\n"   , 1.0e6 * SumOfLatencies / (double)NumberOfReplayedCycles               );
+        printf("Latency median         : %10.3f us\n"   , 1.0e6 * Latencies[NumberOfReplayedCycles / 2]                         );
+        printf("Latency 99th percentile: %10.3f us\n"   , 1.0e6 * Latencies[(NumberOfReplayedCycles * 99) / 100]                );
+        printf("Latency maximum        : %10.3f us\n"   , 1.0e6 * Latencies[NumberOfReplayedCycles - 1]                         );
+    }
+
+    printf("-------------------------------------------------------\n"  );
+
+    if (CSVFile != NULL)
+    {
+        fclose(CSVFile);
+    }
+
+    // ********************************************************************
+    // Deleting the objects of the Reflexxes Motion Library end terminating
+    // the process
+
+    delete[]    Latencies   ;
+    delete      PositionIP  ;
+    delete      PositionOP  ;
+    delete      VelocityIP  ;
+    delete      VelocityOP  ;
+
+    Reader.Close();
+
+    if ((NumberOfMismatches == 0) && (NumberOfIncompleteRecords == 0))
+    {
+        printf("All cycles were reproduced bit by bit.\n");
+        exit(EXIT_SUCCESS);
+    }
+    else
+    {
+        printf("The replay differs from the recording.\n");
+        exit(EXIT_FAILURE);
+    }
+}
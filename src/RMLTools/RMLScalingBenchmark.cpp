@@ -0,0 +1,504 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLScalingBenchmark.cpp
+//!
+//! \brief
+//! Scaling benchmark for the number of degrees of freedom
+//!
+//! \details
+//! Sweeps the number of degrees of freedom and reports the execution time
+//! and the memory consumption of recomputation cycles (new input values in
+//! every cycle) and of steady-state cycles (unchanged input values).
+//!
+//! \sa RMLMemoryRegion
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ReflexxesAPI.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLVelocityFlags.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLMemoryRegion.h>
+#include <TypeIIRMLPlatform.h>
+
+
+//*************************************************************************
+// defines
+
+#define CYCLE_TIME_IN_SECONDS                   0.001
+#define MINIMUM_NUMBER_OF_DOFS                  8
+#define DEFAULT_MAXIMUM_NUMBER_OF_DOFS          512
+#define DEFAULT_NUMBER_OF_CYCLES                1000
+#define DEFAULT_REGION_SIZE_IN_MEGABYTES        256
+
+
+//*************************************************************************
+// RandomValue()
+//
+// Returns a pseudo-random value between Minimum and Maximum
+//*************************************************************************
+static double RandomValue(      const double    &Minimum
+                            ,   const double    &Maximum)
+{
+    return(Minimum + (Maximum - Minimum) * (double)rand() / (double)RAND_MAX);
+}
+
+
+//*************************************************************************
+// InitializeInputValues()
+//
+// Sets up a random, valid state of motion for all degrees of freedom. The
+// same seed is used for every number of degrees of freedom, such that the
+// first degrees of freedom of all runs are equal.
+//*************************************************************************
+static void InitializeInputValues(      RMLPositionInputParameters  *PositionIP
+                                    ,   RMLVelocityInputParameters  *VelocityIP
+                                    ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i   =   0;
+
+    srand(1);
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        PositionIP->CurrentPositionVector->VecData  [i] =   RandomValue(-1.0,   1.0 );
+        PositionIP->CurrentVelocityVector->VecData  [i] =   RandomValue(-0.2,   0.2 );
+        PositionIP->MaxVelocityVector->VecData      [i] =   RandomValue( 0.5,   2.0 );
+        PositionIP->MaxAccelerationVector->VecData  [i] =   RandomValue( 1.0,   5.0 );
+        PositionIP->TargetPositionVector->VecData   [i] =   RandomValue(-2.0,   2.0 );
+        PositionIP->SelectionVector->VecData        [i] =   true;
+
+        VelocityIP->CurrentPositionVector->VecData  [i] =   PositionIP->CurrentPositionVector->VecData  [i];
+        VelocityIP->CurrentVelocityVector->VecData  [i] =   PositionIP->CurrentVelocityVector->VecData  [i];
+        VelocityIP->MaxAccelerationVector->VecData  [i] =   PositionIP->MaxAccelerationVector->VecData  [i];
+        VelocityIP->TargetVelocityVector->VecData   [i] =   RandomValue(-1.0,   1.0 );
+        VelocityIP->SelectionVector->VecData        [i] =   true;
+    }
+}
+
+
+//*************************************************************************
+// ChangeInputValues()
+//
+// Mirrors the target state of motion, such that the next cycle requires a
+// recomputation of the trajectory
+//*************************************************************************
+static void ChangeInputValues(      RMLPositionInputParameters  *PositionIP
+                                ,   RMLVelocityInputParameters  *VelocityIP
+                                ,   const unsigned int          &NumberOfDOFs)
+{
+    unsigned int        i   =   0;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        PositionIP->TargetPositionVector->VecData   [i] =   -PositionIP->TargetPositionVector->VecData  [i];
+        VelocityIP->TargetVelocityVector->VecData   [i] =   -VelocityIP->TargetVelocityVector->VecData  [i];
+    }
+}
+
+
+//*************************************************************************
+// RunCycles()
+//
+// Executes a number of cycles of the selected algorithm and measures the
+// mean and the maximum execution time of a cycle as well as the number of
+// bytes that are allocated per cycle. If ChangeInputs is true, the target
+// state of motion is changed before every cycle; otherwise, one initial
+// cycle, which is not measured, computes the trajectory, and all measured
+// cycles only sample it.
+//*************************************************************************
+static void RunCycles(      ReflexxesAPI                    *RML
+                        ,   RMLPositionInputParameters      *PositionIP
+                        ,   RMLPositionOutputParameters     *PositionOP
+                        ,   const RMLPositionFlags          &PositionFlags
+                        ,   RMLVelocityInputParameters      *VelocityIP
+                        ,   RMLVelocityOutputParameters     *VelocityOP
+                        ,   const RMLVelocityFlags          &VelocityFlags
+                        ,   const RMLMemoryRegion           &Region
+                        ,   const bool                      &UseVelocityInterface
+                        ,   const bool                      &ChangeInputs
+                        ,   const unsigned int              &NumberOfCycles
+                        ,   double                          *MeanExecutionTime
+                        ,   double                          *MaximumExecutionTime
+                        ,   double                          *BytesPerCycle
+                        ,   unsigned int                    *NumberOfRecomputations)
+{
+    unsigned int        Cycle               =   0
+                    ,   NumberOfDOFs        =   PositionIP->GetNumberOfDOFs();
+
+    size_t              UsedSize            =   0;
+
+    double              StartTime           =   0.0
+                    ,   ExecutionTime       =   0.0
+                    ,   SumOfExecutionTimes =   0.0;
+
+    *MaximumExecutionTime   =   0.0;
+    *NumberOfRecomputations =   0;
+
+    if (!ChangeInputs)
+    {
+        ChangeInputValues(      PositionIP
+                            ,   VelocityIP
+                            ,   NumberOfDOFs    );
+
+        if (UseVelocityInterface)
+        {
+            RML->RMLVelocity(       *VelocityIP
+                                ,   VelocityOP
+                                ,   VelocityFlags   );
+
+            *(VelocityIP->CurrentPositionVector)    =   *(VelocityOP->NewPositionVector);
+            *(VelocityIP->CurrentVelocityVector)    =   *(VelocityOP->NewVelocityVector);
+        }
+        else
+        {
+            RML->RMLPosition(       *PositionIP
+                                ,   PositionOP
+                                ,   PositionFlags   );
+
+            *(PositionIP->CurrentPositionVector)    =   *(PositionOP->NewPositionVector);
+            *(PositionIP->CurrentVelocityVector)    =   *(PositionOP->NewVelocityVector);
+        }
+    }
+
+    UsedSize    =   Region.GetUsedSize();
+
+    for (Cycle = 0; Cycle < NumberOfCycles; Cycle++)
+    {
+        if (ChangeInputs)
+        {
+            ChangeInputValues(      PositionIP
+                                ,   VelocityIP
+                                ,   NumberOfDOFs    );
+        }
+
+        if (UseVelocityInterface)
+        {
+            StartTime       =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+            RML->RMLVelocity(       *VelocityIP
+                                ,   VelocityOP
+                                ,   VelocityFlags   );
+
+            ExecutionTime   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+
+            if (VelocityOP->ANewCalculationWasPerformed)
+            {
+                (*NumberOfRecomputations)++;
+            }
+
+            *(VelocityIP->CurrentPositionVector)    =   *(VelocityOP->NewPositionVector);
+            *(VelocityIP->CurrentVelocityVector)    =   *(VelocityOP->NewVelocityVector);
+        }
+        else
+        {
+            StartTime       =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+            RML->RMLPosition(       *PositionIP
+                                ,   PositionOP
+                                ,   PositionFlags   );
+
+            ExecutionTime   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+
+            if (PositionOP->ANewCalculationWasPerformed)
+            {
+                (*NumberOfRecomputations)++;
+            }
+
+            *(PositionIP->CurrentPositionVector)    =   *(PositionOP->NewPositionVector);
+            *(PositionIP->CurrentVelocityVector)    =   *(PositionOP->NewVelocityVector);
+        }
+
+        SumOfExecutionTimes +=  ExecutionTime;
+
+        if (ExecutionTime > *MaximumExecutionTime)
+        {
+            *MaximumExecutionTime   =   ExecutionTime;
+        }
+    }
+
+    *MeanExecutionTime  =   SumOfExecutionTimes / (double)NumberOfCycles;
+    *BytesPerCycle      =   (double)(Region.GetUsedSize() - UsedSize) / (double)NumberOfCycles;
+}
+
+
+//*************************************************************************
+// PrintUsage()
+//*************************************************************************
+static void PrintUsage(const char *ProgramName)
+{
+    printf("Usage: %s [-n <DOFs>] [-c <cycles>] [-m <megabytes>] [-e] [-v]\n\n", ProgramName);
+    printf("  -n <DOFs>         Maximum number of degrees of freedom (default %d)\n", DEFAULT_MAXIMUM_NUMBER_OF_DOFS);
+    printf("  -c <cycles>       Measured cycles per run (default %d)\n", DEFAULT_NUMBER_OF_CYCLES);
+    printf("  -m <megabytes>    Size of the memory region (default %d)\n", DEFAULT_REGION_SIZE_IN_MEGABYTES);
+    printf("  -e                Enables the calculation of the extremum motion states\n");
+    printf("  -v                Benchmarks the velocity-based algorithm\n");
+}
+
+
+//*************************************************************************
+// Main function of the scaling benchmark
+//
+// The number of degrees of freedom is doubled from MINIMUM_NUMBER_OF_DOFS
+// up to the specified maximum. For each number, all objects of the
+// library are created inside of an RMLMemoryRegion, such that their
+// memory footprint as well as all allocations during the measured cycles
+// can be determined. Two runs are measured:
+//
+//  - Recomputation cycles: the target state of motion changes in every
+//    cycle, such that the complete algorithm is executed.
+//
+//  - Steady-state cycles: the input values remain unchanged, such that
+//    the trajectory is only sampled.
+//
+// Besides the absolute values, the execution time is normalized to
+// N log2(N) for recomputation cycles and to N for steady-state cycles, such
+// that both columns remain approximately constant, if the algorithm
+// scales as desired.
+//*************************************************************************
+int main(int argc, char *argv[])
+{
+    // ********************************************************************
+    // Variable declarations and definitions
+
+    bool                                UseVelocityInterface        =   false   ;
+
+    int                                 i                           =   0       ;
+
+    unsigned int                        NumberOfDOFs                =   0
+                                    ,   MaximumNumberOfDOFs         =   DEFAULT_MAXIMUM_NUMBER_OF_DOFS
+                                    ,   NumberOfCycles              =   DEFAULT_NUMBER_OF_CYCLES
+                                    ,   RegionSizeInMegabytes       =   DEFAULT_REGION_SIZE_IN_MEGABYTES
+                                    ,   NumberOfRecomputations      =   0
+                                    ,   NumberOfSteadyRecomputations=   0       ;
+
+    unsigned long long                  NumberOfHeapAllocations     =   0       ;
+
+    size_t                              Footprint                   =   0       ;
+
+    double                              RecomputationTime           =   0.0
+                                    ,   MaximumRecomputationTime    =   0.0
+                                    ,   RecomputationBytes          =   0.0
+                                    ,   SteadyStateTime             =   0.0
+                                    ,   MaximumSteadyStateTime      =   0.0
+                                    ,   SteadyStateBytes            =   0.0     ;
+
+    RMLMemoryRegion                     *Region                     =   NULL    ;
+
+    ReflexxesAPI                        *RML                        =   NULL    ;
+
+    RMLPositionInputParameters          *PositionIP                 =   NULL    ;
+
+    RMLPositionOutputParameters         *PositionOP                 =   NULL    ;
+
+    RMLPositionFlags                    PositionFlags                           ;
+
+    RMLVelocityInputParameters          *VelocityIP                 =   NULL    ;
+
+    RMLVelocityOutputParameters         *VelocityOP                 =   NULL    ;
+
+    RMLVelocityFlags                    VelocityFlags                           ;
+
+    // ********************************************************************
+    // Command line arguments
+
+    PositionFlags.EnableTheCalculationOfTheExtremumMotionStates =   false;
+    VelocityFlags.EnableTheCalculationOfTheExtremumMotionStates =   false;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            MaximumNumberOfDOFs     =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            NumberOfCycles          =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-m") == 0) && (i + 1 < argc))
+        {
+            RegionSizeInMegabytes   =   (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-e") == 0)
+        {
+            PositionFlags.EnableTheCalculationOfTheExtremumMotionStates =   true;
+            VelocityFlags.EnableTheCalculationOfTheExtremumMotionStates =   true;
+        }
+        else if (strcmp(argv[i], "-v") == 0)
+        {
+            UseVelocityInterface    =   true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (    (MaximumNumberOfDOFs < MINIMUM_NUMBER_OF_DOFS)
+        ||  (NumberOfCycles == 0)
+        ||  (RegionSizeInMegabytes == 0)                    )
+    {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Reflexxes Motion Libraries                             \n"  );
+    printf("RMLScalingBenchmark                                    \n\n");
+    printf("Algorithm              : %s\n"      , (UseVelocityInterface)?("velocity-based"):("position-based")  );
+    printf("Extremum motion states : %s\n"      , (PositionFlags.EnableTheCalculationOfTheExtremumMotionStates)?("enabled"):("disabled"));
+    printf("Cycles per run         : %u\n"      , NumberOfCycles                                                );
+    printf("-------------------------------------------------------\n\n");
+
+    printf("                  |            recomputation cycles            |            steady-state cycles             |\n");
+    printf("  DOFs  footprint | mean [us]   max [us] /NlogN [ns] [B/cycle] | mean [us]   max [us]     /N [ns] [B/cycle] | heap\n");
+
+    for (NumberOfDOFs = MINIMUM_NUMBER_OF_DOFS; NumberOfDOFs <= MaximumNumberOfDOFs; NumberOfDOFs *= 2)
+    {
+        // ****************************************************************
+        // Creating all relevant objects of the Type II Reflexxes Motion
+        // Library inside of a memory region
+
+        Region  =   new RMLMemoryRegion((size_t)RegionSizeInMegabytes * 1024 * 1024);
+
+        if (!Region->IsValid())
+        {
+            printf("Error: A memory region of %u MB cannot be allocated.\n", RegionSizeInMegabytes);
+            delete  Region;
+            exit(EXIT_FAILURE);
+        }
+
+        Region->Activate();
+
+        RML         =   new ReflexxesAPI(       NumberOfDOFs
+                                            ,   CYCLE_TIME_IN_SECONDS   );
+
+        PositionIP  =   new RMLPositionInputParameters(     NumberOfDOFs    );
+        PositionOP  =   new RMLPositionOutputParameters(    NumberOfDOFs    );
+        VelocityIP  =   new RMLVelocityInputParameters(     NumberOfDOFs    );
+        VelocityOP  =   new RMLVelocityOutputParameters(    NumberOfDOFs    );
+
+        Footprint   =   Region->GetUsedSize();
+
+        InitializeInputValues(      PositionIP
+                                ,   VelocityIP
+                                ,   NumberOfDOFs    );
+
+        // ****************************************************************
+        // Measurements
+
+        RunCycles(      RML
+                    ,   PositionIP
+                    ,   PositionOP
+                    ,   PositionFlags
+                    ,   VelocityIP
+                    ,   VelocityOP
+                    ,   VelocityFlags
+                    ,   *Region
+                    ,   UseVelocityInterface
+                    ,   true
+                    ,   NumberOfCycles
+                    ,   &RecomputationTime
+                    ,   &MaximumRecomputationTime
+                    ,   &RecomputationBytes
+                    ,   &NumberOfRecomputations     );
+
+        RunCycles(      RML
+                    ,   PositionIP
+                    ,   PositionOP
+                    ,   PositionFlags
+                    ,   VelocityIP
+                    ,   VelocityOP
+                    ,   VelocityFlags
+                    ,   *Region
+                    ,   UseVelocityInterface
+                    ,   false
+                    ,   NumberOfCycles
+                    ,   &SteadyStateTime
+                    ,   &MaximumSteadyStateTime
+                    ,   &SteadyStateBytes
+                    ,   &NumberOfSteadyRecomputations   );
+
+        NumberOfHeapAllocations =   Region->GetNumberOfHeapAllocations();
+
+        RMLMemoryResource::Deactivate();
+
+        printf(     "%6u %7lu KB | %9.3f %10.3f %11.3f %9.1f | %9.3f %10.3f %11.3f %9.1f | %llu\n"
+                ,   NumberOfDOFs
+                ,   (unsigned long)(Footprint / 1024)
+                ,   1.0e6 * RecomputationTime
+                ,   1.0e6 * MaximumRecomputationTime
+                ,   1.0e9 * RecomputationTime / ((double)NumberOfDOFs * log((double)NumberOfDOFs) / log(2.0))
+                ,   RecomputationBytes
+                ,   1.0e6 * SteadyStateTime
+                ,   1.0e6 * MaximumSteadyStateTime
+                ,   1.0e9 * SteadyStateTime / (double)NumberOfDOFs
+                ,   SteadyStateBytes
+                ,   NumberOfHeapAllocations                                                                 );
+
+        if (    (NumberOfRecomputations != NumberOfCycles)
+            ||  (NumberOfSteadyRecomputations != 0)         )
+        {
+            printf(     "Warning: %u of %u recomputation cycles and %u of %u steady-state cycles recomputed the trajectory.\n"
+                    ,   NumberOfRecomputations
+                    ,   NumberOfCycles
+                    ,   NumberOfSteadyRecomputations
+                    ,   NumberOfCycles                                                                                      );
+        }
+
+        // ****************************************************************
+        // Deleting the objects of the Reflexxes Motion Library before
+        // their memory region
+
+        delete  RML         ;
+        delete  PositionIP  ;
+        delete  PositionOP  ;
+        delete  VelocityIP  ;
+        delete  VelocityOP  ;
+        delete  Region      ;
+    }
+
+    printf("-------------------------------------------------------\n"  );
+
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,326 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLVelocityLimitCheck.cpp
+//!
+//! \brief
+//! Regression check for the velocity limits of the position-based
+//! algorithm
+//!
+//! \details
+//! Runs trajectories of the position-based algorithm from random states of
+//! motion, whose velocities are within the kinematic limits, for all
+//! synchronization behaviors and checks in every cycle that no velocity
+//! exceeds RMLPositionInputParameters::MaxVelocityVector. The first
+//! trajectory starts from a state of motion, for which Step 1 selected a
+//! profile without a constant-velocity phase in earlier versions (cf.
+//! TypeIIRMLMath::Decision_1A__005()), such that the velocity exceeded its
+//! maximum by about 20 percent.
+//!
+//! \sa TypeIIRMLMath::TypeIIRMLDecisionTree1A()
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ReflexxesAPI.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+
+
+//*************************************************************************
+// defines
+
+#define CYCLE_TIME_IN_SECONDS                   0.001
+#define DEFAULT_NUMBER_OF_DOFS                  6
+#define DEFAULT_NUMBER_OF_TRAJECTORIES          200
+#define DEFAULT_SEED                            1
+#define MAXIMUM_NUMBER_OF_CYCLES                100000
+#define RELATIVE_TOLERANCE                      1.0e-9
+#define MAXIMUM_NUMBER_OF_REPORTED_VIOLATIONS   10
+
+
+//*************************************************************************
+// RandomValue()
+//
+// Returns a pseudo-random value between Minimum and Maximum
+//*************************************************************************
+static double RandomValue(      const double    &Minimum
+                            ,   const double    &Maximum)
+{
+    return(Minimum + (Maximum - Minimum) * (double)rand() / (double)RAND_MAX);
+}
+
+
+//*************************************************************************
+// InitializeInputValues()
+//
+// Sets up a random state of motion, whose velocities and target
+// velocities are within the kinematic limits. If Regression is set, the
+// first degree of freedom starts from the state of motion of the fixed
+// regression case.
+//*************************************************************************
+static void InitializeInputValues(      RMLPositionInputParameters  *IP
+                                    ,   const unsigned int          &NumberOfDOFs
+                                    ,   const bool                  &Regression)
+{
+    unsigned int        i   =   0;
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        IP->MaxVelocityVector->VecData          [i] =   RandomValue( 0.5,   2.0 );
+        IP->MaxAccelerationVector->VecData      [i] =   RandomValue( 1.0,   5.0 );
+        IP->MaxJerkVector->VecData              [i] =   RandomValue(10.0,   50.0);
+        IP->CurrentPositionVector->VecData      [i] =   RandomValue(-1.0,   1.0 );
+        IP->CurrentVelocityVector->VecData      [i] =   RandomValue(-0.9,   0.9 )
+                                                        *   IP->MaxVelocityVector->VecData[i];
+        IP->CurrentAccelerationVector->VecData  [i] =   0.0;
+        IP->TargetPositionVector->VecData       [i] =   RandomValue(-2.0,   2.0 );
+        IP->TargetVelocityVector->VecData       [i] =   (rand() % 2 == 0)?(0.0):(RandomValue(-0.8, 0.8)
+                                                        *   IP->MaxVelocityVector->VecData[i]);
+        IP->SelectionVector->VecData            [i] =   true;
+    }
+
+    if (Regression)
+    {
+        IP->CurrentPositionVector->VecData      [0] =   -0.27043105441631332    ;
+        IP->CurrentVelocityVector->VecData      [0] =   0.0053603640782462214   ;
+        IP->TargetPositionVector->VecData       [0] =   0.86918771773073233     ;
+        IP->TargetVelocityVector->VecData       [0] =   0.0                     ;
+        IP->MaxVelocityVector->VecData          [0] =   1.9283445877620693      ;
+        IP->MaxAccelerationVector->VecData      [0] =   4.6647802720148022      ;
+    }
+}
+
+
+//*************************************************************************
+// PrintUsage()
+//*************************************************************************
+static void PrintUsage(const char *ProgramName)
+{
+    printf("Usage: %s [-n <DOFs>] [-t <trajectories>] [-s <seed>] [-q]\n\n", ProgramName);
+    printf("  -n <DOFs>         Number of degrees of freedom (default %d)\n", DEFAULT_NUMBER_OF_DOFS);
+    printf("  -t <trajectories> Number of trajectories per synchronization behavior (default %d)\n", DEFAULT_NUMBER_OF_TRAJECTORIES);
+    printf("  -s <seed>         Seed of the random states of motion (default %d)\n", DEFAULT_SEED);
+    printf("  -q                Only prints the summary\n");
+}
+
+
+//*************************************************************************
+// Main function of the regression check
+//
+// Every trajectory is executed until the final state of motion is reached,
+// and the output values of each cycle are used as the current state of
+// motion of the next cycle. A velocity violates its limit, if its absolute
+// value exceeds MaxVelocityVector by more than RELATIVE_TOLERANCE. The
+// exit code is EXIT_SUCCESS, if no violation occurred.
+//*************************************************************************
+int main(int argc, char *argv[])
+{
+    // ********************************************************************
+    // Variable declarations and definitions
+
+    bool                                Quiet                       =   false   ;
+
+    int                                 i                           =   0
+                                    ,   ResultValue                 =   0       ;
+
+    unsigned int                        NumberOfDOFs                =   DEFAULT_NUMBER_OF_DOFS
+                                    ,   NumberOfTrajectories        =   DEFAULT_NUMBER_OF_TRAJECTORIES
+                                    ,   Seed                        =   DEFAULT_SEED
+                                    ,   Behavior                    =   0
+                                    ,   Trajectory                  =   0
+                                    ,   Cycle                       =   0
+                                    ,   j                           =   0       ;
+
+    unsigned long long                  NumberOfCheckedCycles       =   0
+                                    ,   NumberOfViolations          =   0       ;
+
+    double                              GreatestRatio               =   0.0
+                                    ,   Ratio                       =   0.0     ;
+
+    ReflexxesAPI                        *RML                        =   NULL    ;
+
+    RMLPositionInputParameters          *IP                         =   NULL    ;
+
+    RMLPositionOutputParameters         *OP                         =   NULL    ;
+
+    RMLPositionFlags                    Flags                                   ;
+
+    const int                           Behaviors[3]                =   {       RMLFlags::NO_SYNCHRONIZATION
+                                                                            ,   RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE
+                                                                            ,   RMLFlags::ONLY_TIME_SYNCHRONIZATION         };
+
+    // ********************************************************************
+    // Command line arguments
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            NumberOfDOFs            =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            NumberOfTrajectories    =   (unsigned int)atoi(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            Seed                    =   (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            Quiet                   =   true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (NumberOfDOFs == 0)
+    {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("-------------------------------------------------------\n"  );
+    printf("Reflexxes Motion Libraries                             \n"  );
+    printf("RMLVelocityLimitCheck                                  \n\n");
+    printf("Degrees of freedom     : %u\n"      , NumberOfDOFs                                  );
+    printf("Trajectories           : %u\n"      , NumberOfTrajectories                          );
+    printf("Seed                   : %u\n"      , Seed                                          );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Creating all relevant objects of the Type II Reflexxes Motion Library
+
+    RML =   new ReflexxesAPI(                   NumberOfDOFs
+                                            ,   CYCLE_TIME_IN_SECONDS   );
+    IP  =   new RMLPositionInputParameters(     NumberOfDOFs            );
+    OP  =   new RMLPositionOutputParameters(    NumberOfDOFs            );
+
+    srand(Seed);
+
+    for (Behavior = 0; Behavior < 3; Behavior++)
+    {
+        Flags.SynchronizationBehavior   =   Behaviors[Behavior];
+
+        for (Trajectory = 0; Trajectory < NumberOfTrajectories; Trajectory++)
+        {
+            InitializeInputValues(      IP
+                                    ,   NumberOfDOFs
+                                    ,   (Trajectory == 0)   );
+
+            for (Cycle = 0; Cycle < MAXIMUM_NUMBER_OF_CYCLES; Cycle++)
+            {
+                ResultValue =   RML->RMLPosition(       *IP
+                                                    ,   OP
+                                                    ,   Flags   );
+
+                if (ResultValue < 0)
+                {
+                    break;
+                }
+
+                for (j = 0; j < NumberOfDOFs; j++)
+                {
+                    Ratio   =   fabs(OP->NewVelocityVector->VecData[j])
+                                /   IP->MaxVelocityVector->VecData[j];
+
+                    if (Ratio > GreatestRatio)
+                    {
+                        GreatestRatio   =   Ratio;
+                    }
+
+                    if (Ratio > 1.0 + RELATIVE_TOLERANCE)
+                    {
+                        if ((!Quiet) && (NumberOfViolations < MAXIMUM_NUMBER_OF_REPORTED_VIOLATIONS))
+                        {
+                            printf(     "Violation in trajectory %u (behavior %d), cycle %u, DOF %u: |v| = %.9g > %.9g\n"
+                                    ,   Trajectory
+                                    ,   Behaviors[Behavior]
+                                    ,   Cycle
+                                    ,   j
+                                    ,   fabs(OP->NewVelocityVector->VecData[j])
+                                    ,   IP->MaxVelocityVector->VecData[j]               );
+                        }
+                        NumberOfViolations++;
+                    }
+                }
+
+                NumberOfCheckedCycles++;
+
+                if (ResultValue == ReflexxesAPI::RML_FINAL_STATE_REACHED)
+                {
+                    break;
+                }
+
+                *(IP->CurrentPositionVector)        =   *(OP->NewPositionVector)        ;
+                *(IP->CurrentVelocityVector)        =   *(OP->NewVelocityVector)        ;
+                *(IP->CurrentAccelerationVector)    =   *(OP->NewAccelerationVector)    ;
+            }
+        }
+    }
+
+    // ********************************************************************
+    // Summary
+
+    printf("Checked cycles         : %llu\n"    , NumberOfCheckedCycles                         );
+    printf("Violations             : %llu\n"    , NumberOfViolations                            );
+    printf("Greatest |v| / vmax    : %.12g\n"   , GreatestRatio                                 );
+    printf("-------------------------------------------------------\n"  );
+
+    // ********************************************************************
+    // Deleting the objects of the Reflexxes Motion Library end terminating
+    // the process
+
+    delete  RML ;
+    delete  IP  ;
+    delete  OP  ;
+
+    if (NumberOfViolations == 0)
+    {
+        printf("All velocities are within their limits.\n");
+        exit(EXIT_SUCCESS);
+    }
+    else
+    {
+        printf("The velocity limits were exceeded.\n");
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,471 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLBinaryLogReader.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLBinaryLogReader
+//!
+//! \details
+//! For further information, please refer to the file RMLBinaryLogReader.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <RMLBinaryLogReader.h>
+#include <string.h>
+
+
+//****************************************************************************
+// RMLBinaryLogReader()
+
+RMLBinaryLogReader::RMLBinaryLogReader(void)
+{
+    this->Header    =   NULL;
+    this->Records   =   NULL;
+
+    TypeIIRMLPlatform::InitializeMappedFile(&(this->File));
+}
+
+
+//****************************************************************************
+// ~RMLBinaryLogReader()
+
+RMLBinaryLogReader::~RMLBinaryLogReader(void)
+{
+    this->Close();
+}
+
+
+//****************************************************************************
+// Open()
+
+int RMLBinaryLogReader::Open(const char *FileName)
+{
+    const RMLBinaryLogHeader    *FileHeader     =   NULL;
+
+    this->Close();
+
+    if (!TypeIIRMLPlatform::MapFile(    FileName
+                                    ,   0
+                                    ,   false
+                                    ,   &(this->File)   ))
+    {
+        return(RMLBinaryLogReader::RETURN_ERROR);
+    }
+
+    FileHeader  =   (const RMLBinaryLogHeader*)this->File.Data;
+
+    if (    (this->File.Size < RML_BINARY_LOG_ALIGNMENT)
+        ||  (memcmp(FileHeader->MagicNumber, RML_BINARY_LOG_MAGIC_NUMBER, sizeof(FileHeader->MagicNumber)) != 0)  )
+    {
+        TypeIIRMLPlatform::UnmapFile(&(this->File));
+        return(RMLBinaryLogReader::RETURN_INVALID_FILE);
+    }
+
+    if (    (FileHeader->EndiannessTag  !=  RML_BINARY_LOG_ENDIANNESS_TAG                       )
+        ||  (FileHeader->FormatVersion  !=  RML_BINARY_LOG_FORMAT_VERSION                       )
+        ||  (FileHeader->HeaderSize     !=  sizeof(RMLBinaryLogHeader)                          )
+        ||  (FileHeader->RecordSize     !=  RMLBinaryLogRecordSize(FileHeader->NumberOfDOFs)    )   )
+    {
+        TypeIIRMLPlatform::UnmapFile(&(this->File));
+        return(RMLBinaryLogReader::RETURN_INCOMPATIBLE_FORMAT);
+    }
+
+    if (    (FileHeader->Capacity == 0)
+        ||  (   (this->File.Size - RML_BINARY_LOG_ALIGNMENT) / FileHeader->RecordSize
+                <   FileHeader->Capacity                                                ) )
+    {
+        TypeIIRMLPlatform::UnmapFile(&(this->File));
+        return(RMLBinaryLogReader::RETURN_INVALID_FILE);
+    }
+
+    this->Header    =   FileHeader;
+    this->Records   =   ((const unsigned char*)this->File.Data) + RML_BINARY_LOG_ALIGNMENT;
+
+    return(RMLBinaryLogReader::RETURN_SUCCESS);
+}
+
+
+//****************************************************************************
+// Close()
+
+void RMLBinaryLogReader::Close(void)
+{
+    TypeIIRMLPlatform::UnmapFile(&(this->File));
+
+    this->Header    =   NULL;
+    this->Records   =   NULL;
+
+    return;
+}
+
+
+//****************************************************************************
+// GetNumberOfRecords()
+
+unsigned long long RMLBinaryLogReader::GetNumberOfRecords(void) const
+{
+    unsigned long long      NumberOfReservedRecords =   0;
+
+    if (this->Header == NULL)
+    {
+        return(0);
+    }
+
+    NumberOfReservedRecords =   this->Header->NumberOfReservedRecords;
+
+    if (NumberOfReservedRecords > this->Header->Capacity)
+    {
+        return(this->Header->Capacity);
+    }
+    else
+    {
+        return(NumberOfReservedRecords);
+    }
+}
+
+
+//****************************************************************************
+// GetNumberOfOverwrittenRecords()
+
+unsigned long long RMLBinaryLogReader::GetNumberOfOverwrittenRecords(void) const
+{
+    if (this->Header == NULL)
+    {
+        return(0);
+    }
+
+    return(this->Header->NumberOfReservedRecords - this->GetNumberOfRecords());
+}
+
+
+//****************************************************************************
+// GetRecord()
+
+const RMLBinaryLogRecordHeader *RMLBinaryLogReader::GetRecord(const unsigned long long &Index) const
+{
+    unsigned long long              SequenceNumber  =   0;
+
+    const RMLBinaryLogRecordHeader  *Record         =   NULL;
+
+    if ((this->Header == NULL) || (Index >= this->GetNumberOfRecords()))
+    {
+        return(NULL);
+    }
+
+    if ((this->Header->FileFlags & RML_BINARY_LOG_RING_BUFFER) != 0)
+    {
+        SequenceNumber  =   this->GetNumberOfOverwrittenRecords() + Index;
+    }
+    else
+    {
+        SequenceNumber  =   Index;
+    }
+
+    Record  =   (const RMLBinaryLogRecordHeader*)(      this->Records
+                                                    +   (size_t)(SequenceNumber % this->Header->Capacity)
+                                                        *   this->Header->RecordSize                    );
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    if (Record->SequenceNumber != SequenceNumber + 1)
+    {
+        return(NULL);
+    }
+
+    return(Record);
+}
+
+
+//****************************************************************************
+// CopyRecord()
+
+const RMLBinaryLogRecordHeader *RMLBinaryLogReader::CopyRecord(     const unsigned long long    &Index
+                                                                ,   void                        *Buffer
+                                                                ,   const size_t                &BufferSize ) const
+{
+    unsigned long long              SequenceNumber  =   0;
+
+    const RMLBinaryLogRecordHeader  *Record         =   NULL;
+
+    if (    (Buffer         ==  NULL                    )
+        ||  (BufferSize     <   this->GetRecordSize()   )   )
+    {
+        return(NULL);
+    }
+
+    // The record is checked by GetRecord() before the copy, and its
+    // sequence number is read again afterwards: the writer sets it to
+    // zero before it starts to overwrite the slot.
+    Record  =   this->GetRecord(Index);
+
+    if (Record == NULL)
+    {
+        return(NULL);
+    }
+
+    SequenceNumber  =   Record->SequenceNumber;
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    memcpy(     Buffer
+            ,   (const void*)Record
+            ,   this->GetRecordSize()   );
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    if (Record->SequenceNumber != SequenceNumber)
+    {
+        return(NULL);
+    }
+
+    return((const RMLBinaryLogRecordHeader*)Buffer);
+}
+
+
+//****************************************************************************
+// GetDataBlock()
+
+const double *RMLBinaryLogReader::GetDataBlock(     const RMLBinaryLogRecordHeader  *Record
+                                                ,   const RMLBinaryLogDataBlock     &Block  ) const
+{
+    if ((this->Header == NULL) || (Record == NULL))
+    {
+        return(NULL);
+    }
+
+    return(     ((const double*)(((const unsigned char*)Record) + sizeof(RMLBinaryLogRecordHeader)))
+            +   (unsigned int)Block * this->Header->NumberOfDOFs                                        );
+}
+
+
+//****************************************************************************
+// GetSelectionVector()
+
+const unsigned char *RMLBinaryLogReader::GetSelectionVector(const RMLBinaryLogRecordHeader *Record) const
+{
+    if ((this->Header == NULL) || (Record == NULL))
+    {
+        return(NULL);
+    }
+
+    return(     ((const unsigned char*)Record)
+            +   sizeof(RMLBinaryLogRecordHeader)
+            +   RML_BINARY_LOG_NUMBER_OF_DATA_BLOCKS * this->Header->NumberOfDOFs * sizeof(double) );
+}
+
+
+//****************************************************************************
+// GetPositionInputValues()
+
+bool RMLBinaryLogReader::GetPositionInputValues(        const RMLBinaryLogRecordHeader  *Record
+                                                    ,   RMLPositionInputParameters      *InputValues
+                                                    ,   RMLPositionFlags                *Flags      ) const
+{
+    unsigned int        NumberOfDOFs    =   this->GetNumberOfDOFs();
+
+    if (    (Record         ==  NULL                                                    )
+        ||  (InputValues    ==  NULL                                                    )
+        ||  (Flags          ==  NULL                                                    )
+        ||  ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) != 0              )
+        ||  (InputValues->GetNumberOfDOFs() != NumberOfDOFs                             )   )
+    {
+        return(false);
+    }
+
+    this->ReadInputValues(      Record
+                            ,   InputValues );
+
+    memcpy(     InputValues->MaxVelocityVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_MAX_VELOCITY)
+            ,   NumberOfDOFs * sizeof(double)                                       );
+    memcpy(     InputValues->TargetPositionVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_TARGET_POSITION)
+            ,   NumberOfDOFs * sizeof(double)                                       );
+    memcpy(     InputValues->AlternativeTargetVelocityVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_ALTERNATIVE_TARGET_VELOCITY)
+            ,   NumberOfDOFs * sizeof(double)                                       );
+
+    Flags->SynchronizationBehavior                          =   Record->SynchronizationBehavior                                 ;
+    Flags->EnableTheCalculationOfTheExtremumMotionStates    =   (Record->EnableTheCalculationOfTheExtremumMotionStates != 0)    ;
+    Flags->BehaviorAfterFinalStateOfMotionIsReached         =   Record->BehaviorAfterFinalStateOfMotionIsReached                ;
+    Flags->KeepCurrentVelocityInCaseOfFallbackStrategy      =   (Record->KeepCurrentVelocityInCaseOfFallbackStrategy != 0)      ;
+    Flags->EnableDeterministicTiming                        =   (Record->EnableDeterministicTiming != 0)                        ;
+    Flags->NumberOfRecomputationCycles                      =   (Record->NumberOfRecomputationCycles == 0)?
+                                                                (1):(Record->NumberOfRecomputationCycles)                   ;
+
+    return(true);
+}
+
+
+//****************************************************************************
+// GetPositionOutputValues()
+
+bool RMLBinaryLogReader::GetPositionOutputValues(       const RMLBinaryLogRecordHeader  *Record
+                                                    ,   RMLPositionOutputParameters     *OutputValues) const
+{
+    if (    (Record         ==  NULL                                                    )
+        ||  (OutputValues   ==  NULL                                                    )
+        ||  ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) != 0              )
+        ||  (OutputValues->GetNumberOfDOFs() != this->GetNumberOfDOFs()                 )   )
+    {
+        return(false);
+    }
+
+    this->ReadOutputValues(     Record
+                            ,   OutputValues    );
+
+    return(true);
+}
+
+
+//****************************************************************************
+// GetVelocityInputValues()
+
+bool RMLBinaryLogReader::GetVelocityInputValues(        const RMLBinaryLogRecordHeader  *Record
+                                                    ,   RMLVelocityInputParameters      *InputValues
+                                                    ,   RMLVelocityFlags                *Flags      ) const
+{
+    if (    (Record         ==  NULL                                                    )
+        ||  (InputValues    ==  NULL                                                    )
+        ||  (Flags          ==  NULL                                                    )
+        ||  ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) == 0              )
+        ||  (InputValues->GetNumberOfDOFs() != this->GetNumberOfDOFs()                  )   )
+    {
+        return(false);
+    }
+
+    this->ReadInputValues(      Record
+                            ,   InputValues );
+
+    Flags->SynchronizationBehavior                          =   Record->SynchronizationBehavior                                 ;
+    Flags->EnableTheCalculationOfTheExtremumMotionStates    =   (Record->EnableTheCalculationOfTheExtremumMotionStates != 0)    ;
+
+    return(true);
+}
+
+
+//****************************************************************************
+// GetVelocityOutputValues()
+
+bool RMLBinaryLogReader::GetVelocityOutputValues(       const RMLBinaryLogRecordHeader  *Record
+                                                    ,   RMLVelocityOutputParameters     *OutputValues) const
+{
+    if (    (Record         ==  NULL                                                    )
+        ||  (OutputValues   ==  NULL                                                    )
+        ||  ((Record->StatusBits & RML_BINARY_LOG_VELOCITY_INTERFACE) == 0              )
+        ||  (OutputValues->GetNumberOfDOFs() != this->GetNumberOfDOFs()                 )   )
+    {
+        return(false);
+    }
+
+    this->ReadOutputValues(     Record
+                            ,   OutputValues    );
+
+    memcpy(     OutputValues->PositionValuesAtTargetVelocity->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_POSITION_VALUES_AT_TARGET_VELOCITY)
+            ,   this->GetNumberOfDOFs() * sizeof(double)                                        );
+
+    return(true);
+}
+
+
+//****************************************************************************
+// ReadInputValues()
+
+void RMLBinaryLogReader::ReadInputValues(       const RMLBinaryLogRecordHeader  *Record
+                                            ,   RMLInputParameters              *InputValues) const
+{
+    unsigned int            i               =   0;
+
+    unsigned int            NumberOfDOFs    =   this->GetNumberOfDOFs();
+
+    const unsigned char     *Selection      =   this->GetSelectionVector(Record);
+
+    InputValues->MinimumSynchronizationTime =   Record->MinimumSynchronizationTime;
+
+    memcpy(     InputValues->CurrentPositionVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_CURRENT_POSITION)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+    memcpy(     InputValues->CurrentVelocityVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_CURRENT_VELOCITY)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+    memcpy(     InputValues->CurrentAccelerationVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_CURRENT_ACCELERATION)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+    memcpy(     InputValues->MaxAccelerationVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_MAX_ACCELERATION)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+    memcpy(     InputValues->MaxJerkVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_MAX_JERK)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+    memcpy(     InputValues->TargetVelocityVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_TARGET_VELOCITY)
+            ,   NumberOfDOFs * sizeof(double)                                   );
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        InputValues->SelectionVector->VecData[i]    =   (Selection[i] != 0);
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// ReadOutputValues()
+
+void RMLBinaryLogReader::ReadOutputValues(      const RMLBinaryLogRecordHeader  *Record
+                                            ,   RMLOutputParameters             *OutputValues) const
+{
+    unsigned int            NumberOfDOFs    =   this->GetNumberOfDOFs();
+
+    OutputValues->ANewCalculationWasPerformed       =   ((Record->StatusBits & RML_BINARY_LOG_NEW_CALCULATION_WAS_PERFORMED)      != 0)   ;
+    OutputValues->TrajectoryIsPhaseSynchronized     =   ((Record->StatusBits & RML_BINARY_LOG_TRAJECTORY_IS_PHASE_SYNCHRONIZED)   != 0)   ;
+    OutputValues->DOFWithTheGreatestExecutionTime   =   Record->DOFWithTheGreatestExecutionTime                                         ;
+    OutputValues->SynchronizationTime               =   Record->SynchronizationTime                                                     ;
+
+    memcpy(     OutputValues->NewPositionVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_NEW_POSITION)
+            ,   NumberOfDOFs * sizeof(double)                               );
+    memcpy(     OutputValues->NewVelocityVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_NEW_VELOCITY)
+            ,   NumberOfDOFs * sizeof(double)                               );
+    memcpy(     OutputValues->NewAccelerationVector->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_NEW_ACCELERATION)
+            ,   NumberOfDOFs * sizeof(double)                               );
+    memcpy(     OutputValues->ExecutionTimes->VecData
+            ,   this->GetDataBlock(Record, RML_BINARY_LOG_EXECUTION_TIMES)
+            ,   NumberOfDOFs * sizeof(double)                               );
+
+    return;
+}
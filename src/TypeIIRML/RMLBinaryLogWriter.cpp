@@ -0,0 +1,451 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLBinaryLogWriter.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLBinaryLogWriter
+//!
+//! \details
+//! For further information, please refer to the file RMLBinaryLogWriter.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <RMLBinaryLogWriter.h>
+#include <string.h>
+
+
+//****************************************************************************
+// RMLBinaryLogWriter()
+
+RMLBinaryLogWriter::RMLBinaryLogWriter(     const unsigned int          &DegreesOfFreedom
+                                        ,   const double                &CycleTimeInSeconds
+                                        ,   const unsigned long long    &MaximumNumberOfRecords
+                                        ,   const bool                  &RingBuffer)
+{
+    this->NumberOfDOFs              =   DegreesOfFreedom                                ;
+    this->RingBuffer                =   RingBuffer                                      ;
+    this->CycleTime                 =   CycleTimeInSeconds                              ;
+    this->Capacity                  =   MaximumNumberOfRecords                          ;
+    this->RecordSize                =   RMLBinaryLogRecordSize(this->NumberOfDOFs)      ;
+    this->NumberOfDroppedRecords    =   0                                               ;
+    this->Header                    =   NULL                                            ;
+    this->Records                   =   NULL                                            ;
+
+    TypeIIRMLPlatform::InitializeMappedFile(&(this->File));
+}
+
+
+//****************************************************************************
+// ~RMLBinaryLogWriter()
+
+RMLBinaryLogWriter::~RMLBinaryLogWriter(void)
+{
+    this->Close();
+}
+
+
+//****************************************************************************
+// Open()
+
+int RMLBinaryLogWriter::Open(const char *FileName)
+{
+    size_t          FileSize    =   0;
+
+    this->Close();
+
+    if ((this->Capacity == 0) || (this->NumberOfDOFs == 0))
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+
+    FileSize    =   RML_BINARY_LOG_ALIGNMENT + (size_t)this->Capacity * this->RecordSize;
+
+    if (!TypeIIRMLPlatform::MapFile(    FileName
+                                    ,   FileSize
+                                    ,   true
+                                    ,   &(this->File)   ))
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+
+    // Touch all pages, such that no page faults occur in the real-time
+    // context.
+    memset(this->File.Data, 0x0, this->File.Size);
+
+    this->Header                            =   (RMLBinaryLogHeader*)this->File.Data                            ;
+    this->Records                           =   ((unsigned char*)this->File.Data) + RML_BINARY_LOG_ALIGNMENT    ;
+
+    memcpy(this->Header->MagicNumber, RML_BINARY_LOG_MAGIC_NUMBER, sizeof(this->Header->MagicNumber));
+    strncpy(this->Header->LibraryVersion, RML_BINARY_LOG_LIBRARY_VERSION, sizeof(this->Header->LibraryVersion) - 1);
+
+    this->Header->FormatVersion             =   RML_BINARY_LOG_FORMAT_VERSION                                   ;
+    this->Header->EndiannessTag             =   RML_BINARY_LOG_ENDIANNESS_TAG                                   ;
+    this->Header->HeaderSize                =   sizeof(RMLBinaryLogHeader)                                      ;
+    this->Header->RecordSize                =   (unsigned int)this->RecordSize                                  ;
+    this->Header->NumberOfDOFs              =   this->NumberOfDOFs                                              ;
+    this->Header->FileFlags                 =   (this->RingBuffer)?(RML_BINARY_LOG_RING_BUFFER):(0)             ;
+    this->Header->Capacity                  =   this->Capacity                                                  ;
+    this->Header->NumberOfReservedRecords   =   0                                                               ;
+    this->Header->CycleTime                 =   this->CycleTime                                                 ;
+
+    this->NumberOfDroppedRecords            =   0                                                               ;
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    return(RMLBinaryLogWriter::RETURN_SUCCESS);
+}
+
+
+//****************************************************************************
+// Close()
+
+void RMLBinaryLogWriter::Close(void)
+{
+    if (this->Header != NULL)
+    {
+        TypeIIRMLPlatform::FlushMappedFile(this->File, true);
+    }
+
+    TypeIIRMLPlatform::UnmapFile(&(this->File));
+
+    this->Header    =   NULL;
+    this->Records   =   NULL;
+
+    return;
+}
+
+
+//****************************************************************************
+// Flush()
+
+int RMLBinaryLogWriter::Flush(const bool &Synchronous) const
+{
+    if (this->Header == NULL)
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+
+    if (TypeIIRMLPlatform::FlushMappedFile(this->File, Synchronous))
+    {
+        return(RMLBinaryLogWriter::RETURN_SUCCESS);
+    }
+    else
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+}
+
+
+//****************************************************************************
+// AppendPosition()
+
+int RMLBinaryLogWriter::AppendPosition(     const RMLPositionInputParameters    &InputValues
+                                        ,   const RMLPositionFlags              &Flags
+                                        ,   const RMLPositionOutputParameters   &OutputValues
+                                        ,   const int                           &ResultValue
+                                        ,   const unsigned long long            &TimeStamp
+                                        ,   const double                        &ElapsedTimeInSeconds
+                                        ,   const double                        &FeedOverride
+                                        ,   const double                        &AppliedFeedOverride
+                                        ,   const double                        &MaxFeedOverrideRate)
+{
+    unsigned char               *Record         =   NULL;
+
+    unsigned long long          SequenceNumber  =   0;
+
+    RMLBinaryLogRecordHeader    *RecordHeader   =   NULL;
+
+    if (this->Header == NULL)
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+
+    if (    (InputValues.GetNumberOfDOFs()  !=  this->NumberOfDOFs)
+        ||  (OutputValues.GetNumberOfDOFs() !=  this->NumberOfDOFs) )
+    {
+        return(RMLBinaryLogWriter::RETURN_NUMBER_OF_DOFS);
+    }
+
+    Record  =   this->ReserveRecord(&SequenceNumber);
+
+    if (Record == NULL)
+    {
+        return(RMLBinaryLogWriter::RETURN_LOG_FULL);
+    }
+
+    RecordHeader    =   (RMLBinaryLogRecordHeader*)Record;
+
+    RecordHeader->TimeStamp                                     =   TimeStamp                                                               ;
+    RecordHeader->ElapsedTime                                   =   (ElapsedTimeInSeconds > 0.0)?(ElapsedTimeInSeconds):(this->CycleTime)   ;
+    RecordHeader->StatusBits                                    =   0                                                                       ;
+    RecordHeader->SynchronizationBehavior                       =   Flags.SynchronizationBehavior                                           ;
+    RecordHeader->EnableTheCalculationOfTheExtremumMotionStates =   (unsigned char)Flags.EnableTheCalculationOfTheExtremumMotionStates      ;
+    RecordHeader->BehaviorAfterFinalStateOfMotionIsReached      =   (unsigned char)Flags.BehaviorAfterFinalStateOfMotionIsReached           ;
+    RecordHeader->KeepCurrentVelocityInCaseOfFallbackStrategy   =   (unsigned char)Flags.KeepCurrentVelocityInCaseOfFallbackStrategy        ;
+    RecordHeader->EnableDeterministicTiming                     =   (unsigned char)Flags.EnableDeterministicTiming                          ;
+    RecordHeader->NumberOfRecomputationCycles                   =   (Flags.NumberOfRecomputationCycles > 255)?
+                                                                    (255):((unsigned char)Flags.NumberOfRecomputationCycles)                ;
+    RecordHeader->FeedOverride                                  =   FeedOverride                                                            ;
+    RecordHeader->AppliedFeedOverride                           =   AppliedFeedOverride                                                     ;
+    RecordHeader->MaxFeedOverrideRate                           =   MaxFeedOverrideRate                                                     ;
+
+    this->WriteInputValues(     Record
+                            ,   InputValues );
+
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_MAX_VELOCITY)
+            ,   InputValues.MaxVelocityVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_TARGET_POSITION)
+            ,   InputValues.TargetPositionVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_ALTERNATIVE_TARGET_VELOCITY)
+            ,   InputValues.AlternativeTargetVelocityVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memset(     this->DataBlock(Record, RML_BINARY_LOG_POSITION_VALUES_AT_TARGET_VELOCITY)
+            ,   0x0
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+
+    this->WriteOutputValues(    Record
+                            ,   OutputValues
+                            ,   ResultValue     );
+
+    this->PublishRecord(    Record
+                        ,   SequenceNumber  );
+
+    return(RMLBinaryLogWriter::RETURN_SUCCESS);
+}
+
+
+//****************************************************************************
+// AppendVelocity()
+
+int RMLBinaryLogWriter::AppendVelocity(     const RMLVelocityInputParameters    &InputValues
+                                        ,   const RMLVelocityFlags              &Flags
+                                        ,   const RMLVelocityOutputParameters   &OutputValues
+                                        ,   const int                           &ResultValue
+                                        ,   const unsigned long long            &TimeStamp
+                                        ,   const double                        &ElapsedTimeInSeconds)
+{
+    unsigned char               *Record         =   NULL;
+
+    unsigned long long          SequenceNumber  =   0;
+
+    RMLBinaryLogRecordHeader    *RecordHeader   =   NULL;
+
+    if (this->Header == NULL)
+    {
+        return(RMLBinaryLogWriter::RETURN_ERROR);
+    }
+
+    if (    (InputValues.GetNumberOfDOFs()  !=  this->NumberOfDOFs)
+        ||  (OutputValues.GetNumberOfDOFs() !=  this->NumberOfDOFs) )
+    {
+        return(RMLBinaryLogWriter::RETURN_NUMBER_OF_DOFS);
+    }
+
+    Record  =   this->ReserveRecord(&SequenceNumber);
+
+    if (Record == NULL)
+    {
+        return(RMLBinaryLogWriter::RETURN_LOG_FULL);
+    }
+
+    RecordHeader    =   (RMLBinaryLogRecordHeader*)Record;
+
+    RecordHeader->TimeStamp                                     =   TimeStamp                                                               ;
+    RecordHeader->ElapsedTime                                   =   (ElapsedTimeInSeconds > 0.0)?(ElapsedTimeInSeconds):(this->CycleTime)   ;
+    RecordHeader->StatusBits                                    =   RML_BINARY_LOG_VELOCITY_INTERFACE                                       ;
+    RecordHeader->SynchronizationBehavior                       =   Flags.SynchronizationBehavior                                           ;
+    RecordHeader->EnableTheCalculationOfTheExtremumMotionStates =   (unsigned char)Flags.EnableTheCalculationOfTheExtremumMotionStates      ;
+    RecordHeader->BehaviorAfterFinalStateOfMotionIsReached      =   0                                                                       ;
+    RecordHeader->KeepCurrentVelocityInCaseOfFallbackStrategy   =   0                                                                       ;
+    RecordHeader->EnableDeterministicTiming                     =   0                                                                       ;
+    RecordHeader->NumberOfRecomputationCycles                   =   0                                                                       ;
+    RecordHeader->FeedOverride                                  =   0.0                                                                     ;
+    RecordHeader->AppliedFeedOverride                           =   0.0                                                                     ;
+    RecordHeader->MaxFeedOverrideRate                           =   0.0                                                                     ;
+
+    this->WriteInputValues(     Record
+                            ,   InputValues );
+
+    memset(     this->DataBlock(Record, RML_BINARY_LOG_MAX_VELOCITY)
+            ,   0x0
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memset(     this->DataBlock(Record, RML_BINARY_LOG_TARGET_POSITION)
+            ,   0x0
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memset(     this->DataBlock(Record, RML_BINARY_LOG_ALTERNATIVE_TARGET_VELOCITY)
+            ,   0x0
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_POSITION_VALUES_AT_TARGET_VELOCITY)
+            ,   OutputValues.PositionValuesAtTargetVelocity->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                                 );
+
+    this->WriteOutputValues(    Record
+                            ,   OutputValues
+                            ,   ResultValue     );
+
+    this->PublishRecord(    Record
+                        ,   SequenceNumber  );
+
+    return(RMLBinaryLogWriter::RETURN_SUCCESS);
+}
+
+
+//****************************************************************************
+// ReserveRecord()
+
+unsigned char *RMLBinaryLogWriter::ReserveRecord(unsigned long long *SequenceNumber)
+{
+    unsigned long long          Index   =   0;
+
+    unsigned char               *Record =   NULL;
+
+    Index   =   TypeIIRMLPlatform::AtomicFetchAndAdd(       &(this->Header->NumberOfReservedRecords)
+                                                        ,   1                                           );
+
+    if ((!this->RingBuffer) && (Index >= this->Capacity))
+    {
+        TypeIIRMLPlatform::AtomicFetchAndAdd(       &(this->NumberOfDroppedRecords)
+                                                ,   1                                   );
+        return(NULL);
+    }
+
+    Record  =   this->Records + (size_t)(Index % this->Capacity) * this->RecordSize;
+
+    // Invalidate the slot before it is overwritten, such that readers
+    // never consider a partially written record as valid.
+    ((RMLBinaryLogRecordHeader*)Record)->SequenceNumber =   0;
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    *SequenceNumber =   Index + 1;
+
+    return(Record);
+}
+
+
+//****************************************************************************
+// WriteInputValues()
+
+void RMLBinaryLogWriter::WriteInputValues(      unsigned char               *Record
+                                            ,   const RMLInputParameters    &InputValues) const
+{
+    unsigned int                i               =   0;
+
+    unsigned char               *Selection      =       Record
+                                                    +   sizeof(RMLBinaryLogRecordHeader)
+                                                    +   RML_BINARY_LOG_NUMBER_OF_DATA_BLOCKS * this->NumberOfDOFs * sizeof(double);
+
+    ((RMLBinaryLogRecordHeader*)Record)->MinimumSynchronizationTime =   InputValues.MinimumSynchronizationTime;
+
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_CURRENT_POSITION)
+            ,   InputValues.CurrentPositionVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_CURRENT_VELOCITY)
+            ,   InputValues.CurrentVelocityVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_CURRENT_ACCELERATION)
+            ,   InputValues.CurrentAccelerationVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_MAX_ACCELERATION)
+            ,   InputValues.MaxAccelerationVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_MAX_JERK)
+            ,   InputValues.MaxJerkVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_TARGET_VELOCITY)
+            ,   InputValues.TargetVelocityVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                             );
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        Selection[i]    =   (InputValues.SelectionVector->VecData[i])?(1):(0);
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// WriteOutputValues()
+
+void RMLBinaryLogWriter::WriteOutputValues(     unsigned char               *Record
+                                            ,   const RMLOutputParameters   &OutputValues
+                                            ,   const int                   &ResultValue) const
+{
+    RMLBinaryLogRecordHeader    *RecordHeader   =   (RMLBinaryLogRecordHeader*)Record;
+
+    RecordHeader->ResultValue                       =   ResultValue                                     ;
+    RecordHeader->DOFWithTheGreatestExecutionTime   =   OutputValues.DOFWithTheGreatestExecutionTime    ;
+    RecordHeader->SynchronizationTime               =   OutputValues.SynchronizationTime                ;
+
+    if (OutputValues.ANewCalculationWasPerformed)
+    {
+        RecordHeader->StatusBits    |=  RML_BINARY_LOG_NEW_CALCULATION_WAS_PERFORMED;
+    }
+
+    if (OutputValues.TrajectoryIsPhaseSynchronized)
+    {
+        RecordHeader->StatusBits    |=  RML_BINARY_LOG_TRAJECTORY_IS_PHASE_SYNCHRONIZED;
+    }
+
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_NEW_POSITION)
+            ,   OutputValues.NewPositionVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                     );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_NEW_VELOCITY)
+            ,   OutputValues.NewVelocityVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                     );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_NEW_ACCELERATION)
+            ,   OutputValues.NewAccelerationVector->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                     );
+    memcpy(     this->DataBlock(Record, RML_BINARY_LOG_EXECUTION_TIMES)
+            ,   OutputValues.ExecutionTimes->VecData
+            ,   this->NumberOfDOFs * sizeof(double)                     );
+
+    return;
+}
+
+
+//****************************************************************************
+// PublishRecord()
+
+void RMLBinaryLogWriter::PublishRecord(     unsigned char               *Record
+                                        ,   const unsigned long long    &SequenceNumber) const
+{
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    ((RMLBinaryLogRecordHeader*)Record)->SequenceNumber =   SequenceNumber;
+
+    return;
+}
@@ -0,0 +1,543 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLCheckForValidity.cpp
+//!
+//! \brief
+//! Implementation file for the validity checks of the input parameters
+//! with per-degree-of-freedom results
+//!
+//! \details
+//! For further information, please refer to the files
+//! RMLPositionInputParameters.h, RMLVelocityInputParameters.h, and
+//! RMLValidityMask.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <RMLPositionInputParameters.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLValidityMask.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define RML_CHECK_FOR_VALIDITY_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+//*******************************************************************************************
+// SetMaskBits()
+
+static inline void SetMaskBits(     unsigned int        *Words
+                                ,   const unsigned int  &Index
+                                ,   const unsigned int  &Bits   )
+{
+    if ((Words != NULL) && (Bits != 0))
+    {
+        Words[Index / RMLValidityMask::BITS_PER_WORD]   |=  (Bits << (Index % RMLValidityMask::BITS_PER_WORD));
+    }
+}
+
+
+//*******************************************************************************************
+// CheckPositionDOF()
+//
+// Scalar check of one degree of freedom, the conditions are the ones of
+// RMLPositionInputParameters::CheckForValidity(void).
+
+static unsigned int CheckPositionDOF(       const double    &MaxVelocity
+                                        ,   const double    &MaxAcceleration
+                                        ,   const double    &TargetVelocity
+                                        ,   const double    &CurrentPosition
+                                        ,   const double    &TargetPosition
+                                        ,   const double    &CurrentVelocity
+                                        ,   const double    &CurrentAcceleration
+                                        ,   const double    &MagnitudeLimit         )
+{
+    unsigned int        Result                      =   0;
+
+    double              MinimumOrderOfMagnitude     =   0.0
+                    ,   MaximumOrderOfMagnitude     =   0.0;
+
+    // The comparisons are negated, such that NaN values are invalid.
+    if (!(MaxVelocity > 0.0))
+    {
+        Result  |=  RMLValidityMask::MAX_VELOCITY_NOT_POSITIVE;
+    }
+    if (!(MaxAcceleration > 0.0))
+    {
+        Result  |=  RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE;
+    }
+    if (!(fabs(TargetVelocity) <= MaxVelocity))
+    {
+        Result  |=  RMLValidityMask::TARGET_VELOCITY_EXCEEDS_MAX_VELOCITY;
+    }
+    if (Result != 0)
+    {
+        return(Result);
+    }
+
+    if (    (MaxVelocity    >=  MaxAcceleration             )
+        &&  (MaxVelocity    >=  fabs(CurrentPosition)       )
+        &&  (MaxVelocity    >=  fabs(TargetPosition)        )
+        &&  (MaxVelocity    >=  fabs(CurrentVelocity)       )
+        &&  (MaxVelocity    >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   MaxVelocity;
+    }
+    else if (   (MaxAcceleration    >=  fabs(CurrentPosition)       )
+            &&  (MaxAcceleration    >=  fabs(TargetPosition)        )
+            &&  (MaxAcceleration    >=  fabs(CurrentVelocity)       )
+            &&  (MaxAcceleration    >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   MaxAcceleration;
+    }
+    else if (   (fabs(CurrentPosition)  >=  fabs(TargetPosition)        )
+            &&  (fabs(CurrentPosition)  >=  fabs(CurrentVelocity)       )
+            &&  (fabs(CurrentPosition)  >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   fabs(CurrentPosition);
+    }
+    else if (   (fabs(TargetPosition)   >=  fabs(CurrentVelocity)       )
+            &&  (fabs(TargetPosition)   >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   fabs(TargetPosition);
+    }
+    else
+    {
+        MaximumOrderOfMagnitude =   fabs(CurrentAcceleration);
+    }
+
+    MinimumOrderOfMagnitude =   (MaxVelocity <= MaxAcceleration)?(MaxVelocity):(MaxAcceleration);
+
+    if ((MaximumOrderOfMagnitude / MinimumOrderOfMagnitude) > MagnitudeLimit)
+    {
+        Result  |=  RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED;
+    }
+
+    return(Result);
+}
+
+
+//*******************************************************************************************
+// CheckVelocityDOF()
+//
+// Scalar check of one degree of freedom, the conditions are the ones of
+// RMLVelocityInputParameters::CheckForValidity(void) plus the check of the
+// maximum acceleration.
+
+static unsigned int CheckVelocityDOF(       const double    &MaxAcceleration
+                                        ,   const double    &MaxJerk
+                                        ,   const double    &TargetVelocity
+                                        ,   const double    &CurrentPosition
+                                        ,   const double    &CurrentVelocity
+                                        ,   const double    &CurrentAcceleration
+                                        ,   const double    &MagnitudeLimit         )
+{
+    double              MinimumOrderOfMagnitude     =   0.0
+                    ,   MaximumOrderOfMagnitude     =   0.0;
+
+    if (MaxAcceleration <= 0.0)
+    {
+        return(RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE);
+    }
+
+    if (    (MaxAcceleration    >=  MaxJerk                     )
+        &&  (MaxAcceleration    >=  fabs(TargetVelocity)        )
+        &&  (MaxAcceleration    >=  fabs(CurrentPosition)       )
+        &&  (MaxAcceleration    >=  fabs(CurrentVelocity)       )
+        &&  (MaxAcceleration    >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   MaxAcceleration;
+    }
+    else if (   (MaxJerk    >=  fabs(TargetVelocity)        )
+            &&  (MaxJerk    >=  fabs(CurrentPosition)       )
+            &&  (MaxJerk    >=  fabs(CurrentVelocity)       )
+            &&  (MaxJerk    >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   MaxJerk;
+    }
+    else if (   (fabs(TargetVelocity)   >=  fabs(CurrentPosition)       )
+            &&  (fabs(TargetVelocity)   >=  fabs(CurrentVelocity)       )
+            &&  (fabs(TargetVelocity)   >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   fabs(TargetVelocity);
+    }
+    else if (   (fabs(CurrentPosition)  >=  fabs(CurrentVelocity)       )
+            &&  (fabs(CurrentPosition)  >=  fabs(CurrentAcceleration)   )   )
+    {
+        MaximumOrderOfMagnitude =   fabs(CurrentPosition);
+    }
+    else
+    {
+        MaximumOrderOfMagnitude =   fabs(CurrentAcceleration);
+    }
+
+    MinimumOrderOfMagnitude =   (MaxAcceleration <= MaxJerk)?(MaxAcceleration):(MaxJerk);
+
+    if ((MaximumOrderOfMagnitude / MinimumOrderOfMagnitude) > MagnitudeLimit)
+    {
+        return(RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED);
+    }
+
+    return(0);
+}
+
+
+#if defined(RML_CHECK_FOR_VALIDITY_USE_SSE2)
+
+//*******************************************************************************************
+// Select2()
+
+static inline __m128d Select2(      const __m128d   &Mask2
+                                ,   const __m128d   &IfTrue2
+                                ,   const __m128d   &IfFalse2   )
+{
+    return(_mm_or_pd(_mm_and_pd(Mask2, IfTrue2), _mm_andnot_pd(Mask2, IfFalse2)));
+}
+
+
+//*******************************************************************************************
+// GreaterOrEqualToAll2()
+
+static inline __m128d GreaterOrEqualToAll2(     const __m128d   &Value2
+                                            ,   const __m128d   &A2
+                                            ,   const __m128d   &B2
+                                            ,   const __m128d   &C2     )
+{
+    return(_mm_and_pd(      _mm_cmpge_pd(Value2, A2)
+                        ,   _mm_and_pd(_mm_cmpge_pd(Value2, B2), _mm_cmpge_pd(Value2, C2))));
+}
+
+#endif
+
+
+//*******************************************************************************************
+// RMLPositionInputParameters::CheckForValidity()
+
+unsigned int RMLPositionInputParameters::CheckForValidity(RMLValidityMask *Mask) const
+{
+    unsigned int        i                   =   0
+                    ,   Selected            =   0
+                    ,   Bits                =   0
+                    ,   Result              =   0
+                    ,   *Masks[RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS];
+
+    const bool          *Selection          =   this->SelectionVector->VecData;
+
+    const double        *MaxV               =   this->MaxVelocityVector->VecData
+                    ,   *MaxA               =   this->MaxAccelerationVector->VecData
+                    ,   *TargetV            =   this->TargetVelocityVector->VecData
+                    ,   *P                  =   this->CurrentPositionVector->VecData
+                    ,   *TargetP            =   this->TargetPositionVector->VecData
+                    ,   *V                  =   this->CurrentVelocityVector->VecData
+                    ,   *A                  =   this->CurrentAccelerationVector->VecData
+                    ,   MagnitudeLimit      =   (double)pow((float)10, (int)(RMLPositionInputParameters::MAXIMUM_MAGNITUDE_RANGE));
+
+    for (i = 0; i < RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS; i++)
+    {
+        Masks[i]    =   NULL;
+    }
+
+    if ((Mask != NULL) && (Mask->GetNumberOfDOFs() == this->NumberOfDOFs))
+    {
+        Mask->Clear();
+
+        Masks[0]    =   Mask->GetMask(RMLValidityMask::MAX_VELOCITY_NOT_POSITIVE            );
+        Masks[1]    =   Mask->GetMask(RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE        );
+        Masks[2]    =   Mask->GetMask(RMLValidityMask::TARGET_VELOCITY_EXCEEDS_MAX_VELOCITY );
+        Masks[3]    =   Mask->GetMask(RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED             );
+    }
+
+    i   =   0;
+
+#if defined(RML_CHECK_FOR_VALIDITY_USE_SSE2)
+
+    const __m128d   Zero2               =   _mm_setzero_pd()
+                ,   One2                =   _mm_set1_pd(1.0)
+                ,   SignBit2            =   _mm_set1_pd(-0.0)
+                ,   MagnitudeLimit2     =   _mm_set1_pd(MagnitudeLimit);
+
+    __m128d         MaxV2
+                ,   MaxA2
+                ,   AbsTargetV2
+                ,   AbsP2
+                ,   AbsTargetP2
+                ,   AbsV2
+                ,   AbsA2
+                ,   Failure2[RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS]
+                ,   Invalid2
+                ,   Maximum2
+                ,   Minimum2;
+
+    unsigned int    j                   =   0;
+
+    for (i = 0; i + 1 < this->NumberOfDOFs; i += 2)
+    {
+        Selected    =   ((Selection[i])?(0x1):(0x0)) | ((Selection[i + 1])?(0x2):(0x0));
+
+        if (Selected == 0)
+        {
+            continue;
+        }
+
+        MaxV2       =   _mm_loadu_pd(MaxV + i);
+        MaxA2       =   _mm_loadu_pd(MaxA + i);
+        AbsTargetV2 =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(TargetV    + i));
+        AbsP2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(P          + i));
+        AbsTargetP2 =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(TargetP    + i));
+        AbsV2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(V          + i));
+        AbsA2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(A          + i));
+
+        Failure2[0] =   _mm_cmpngt_pd(MaxV2, Zero2);
+        Failure2[1] =   _mm_cmpngt_pd(MaxA2, Zero2);
+        Failure2[2] =   _mm_cmpnle_pd(AbsTargetV2, MaxV2);
+        Invalid2    =   _mm_or_pd(Failure2[0], _mm_or_pd(Failure2[1], Failure2[2]));
+
+        // The order of magnitude is only checked if the values above are
+        // valid; the selection of the maximum equals the one of
+        // RMLPositionInputParameters::CheckForValidity(void).
+        Maximum2    =   Select2(    _mm_and_pd(_mm_cmpge_pd(AbsTargetP2, AbsV2), _mm_cmpge_pd(AbsTargetP2, AbsA2))
+                                ,   AbsTargetP2
+                                ,   AbsA2                                                                       );
+        Maximum2    =   Select2(    GreaterOrEqualToAll2(AbsP2, AbsTargetP2, AbsV2, AbsA2)
+                                ,   AbsP2
+                                ,   Maximum2                                                                    );
+        Maximum2    =   Select2(    _mm_and_pd(GreaterOrEqualToAll2(MaxA2, AbsP2, AbsTargetP2, AbsV2), _mm_cmpge_pd(MaxA2, AbsA2))
+                                ,   MaxA2
+                                ,   Maximum2                                                                    );
+        Maximum2    =   Select2(    _mm_and_pd(     GreaterOrEqualToAll2(MaxV2, MaxA2, AbsP2, AbsTargetP2)
+                                                ,   _mm_and_pd(_mm_cmpge_pd(MaxV2, AbsV2), _mm_cmpge_pd(MaxV2, AbsA2)))
+                                ,   MaxV2
+                                ,   Maximum2                                                                    );
+
+        Minimum2    =   Select2(_mm_cmple_pd(MaxV2, MaxA2), MaxV2, MaxA2);
+        // avoid divisions by zero for invalid values
+        Minimum2    =   Select2(Invalid2, One2, Minimum2);
+
+        Failure2[3] =   _mm_andnot_pd(Invalid2, _mm_cmpgt_pd(_mm_div_pd(Maximum2, Minimum2), MagnitudeLimit2));
+
+        if ((((unsigned int)_mm_movemask_pd(_mm_or_pd(Invalid2, Failure2[3]))) & Selected) == 0)
+        {
+            continue;
+        }
+
+        for (j = 0; j < RMLValidityMask::NUMBER_OF_DOF_FAILURE_REASONS; j++)
+        {
+            Bits    =   ((unsigned int)_mm_movemask_pd(Failure2[j])) & Selected;
+
+            if (Bits != 0)
+            {
+                Result  |=  (0x1 << j);
+                SetMaskBits(Masks[j], i, Bits);
+            }
+        }
+    }
+
+#endif
+
+    for (; i < this->NumberOfDOFs; i++)
+    {
+        if (Selection[i])
+        {
+            Bits    =   CheckPositionDOF(       MaxV    [i]
+                                            ,   MaxA    [i]
+                                            ,   TargetV [i]
+                                            ,   P       [i]
+                                            ,   TargetP [i]
+                                            ,   V       [i]
+                                            ,   A       [i]
+                                            ,   MagnitudeLimit  );
+
+            Result  |=  Bits;
+
+            SetMaskBits(Masks[0], i, (Bits & RMLValidityMask::MAX_VELOCITY_NOT_POSITIVE            )?(0x1):(0x0));
+            SetMaskBits(Masks[1], i, (Bits & RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE        )?(0x1):(0x0));
+            SetMaskBits(Masks[2], i, (Bits & RMLValidityMask::TARGET_VELOCITY_EXCEEDS_MAX_VELOCITY )?(0x1):(0x0));
+            SetMaskBits(Masks[3], i, (Bits & RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED             )?(0x1):(0x0));
+        }
+    }
+
+    if (this->MinimumSynchronizationTime > 1e10)
+    {
+        Result  |=  RMLValidityMask::MIN_SYNCHRONIZATION_TIME_TOO_BIG;
+    }
+
+    if ((Mask != NULL) && (Mask->GetNumberOfDOFs() == this->NumberOfDOFs))
+    {
+        Mask->FailureReasons    =   Result;
+    }
+
+    return(Result);
+}
+
+
+//*******************************************************************************************
+// RMLVelocityInputParameters::CheckForValidity()
+
+unsigned int RMLVelocityInputParameters::CheckForValidity(RMLValidityMask *Mask) const
+{
+    unsigned int        i                   =   0
+                    ,   Bits                =   0
+                    ,   Result              =   0
+                    ,   *MaxAccelerationNotPositive =   NULL
+                    ,   *MagnitudeRangeExceeded     =   NULL;
+
+    const bool          *Selection          =   this->SelectionVector->VecData;
+
+    const double        *MaxA               =   this->MaxAccelerationVector->VecData
+                    ,   *MaxJ               =   this->MaxJerkVector->VecData
+                    ,   *TargetV            =   this->TargetVelocityVector->VecData
+                    ,   *P                  =   this->CurrentPositionVector->VecData
+                    ,   *V                  =   this->CurrentVelocityVector->VecData
+                    ,   *A                  =   this->CurrentAccelerationVector->VecData
+                    ,   MagnitudeLimit      =   (double)pow((float)10, (int)(RMLVelocityInputParameters::MAXIMUM_MAGNITUDE_RANGE));
+
+    if ((Mask != NULL) && (Mask->GetNumberOfDOFs() == this->NumberOfDOFs))
+    {
+        Mask->Clear();
+
+        MaxAccelerationNotPositive  =   Mask->GetMask(RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE);
+        MagnitudeRangeExceeded      =   Mask->GetMask(RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED     );
+    }
+
+    i   =   0;
+
+#if defined(RML_CHECK_FOR_VALIDITY_USE_SSE2)
+
+    const __m128d   Zero2               =   _mm_setzero_pd()
+                ,   One2                =   _mm_set1_pd(1.0)
+                ,   SignBit2            =   _mm_set1_pd(-0.0)
+                ,   MagnitudeLimit2     =   _mm_set1_pd(MagnitudeLimit);
+
+    __m128d         MaxA2
+                ,   MaxJ2
+                ,   AbsTargetV2
+                ,   AbsP2
+                ,   AbsV2
+                ,   AbsA2
+                ,   Invalid2
+                ,   Maximum2
+                ,   Minimum2
+                ,   MagnitudeFailure2;
+
+    unsigned int    Selected            =   0;
+
+    for (i = 0; i + 1 < this->NumberOfDOFs; i += 2)
+    {
+        Selected    =   ((Selection[i])?(0x1):(0x0)) | ((Selection[i + 1])?(0x2):(0x0));
+
+        if (Selected == 0)
+        {
+            continue;
+        }
+
+        MaxA2       =   _mm_loadu_pd(MaxA + i);
+        MaxJ2       =   _mm_loadu_pd(MaxJ + i);
+        AbsTargetV2 =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(TargetV    + i));
+        AbsP2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(P          + i));
+        AbsV2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(V          + i));
+        AbsA2       =   _mm_andnot_pd(SignBit2, _mm_loadu_pd(A          + i));
+
+        Invalid2    =   _mm_cmple_pd(MaxA2, Zero2);
+
+        // selection of the maximum as in
+        // RMLVelocityInputParameters::CheckForValidity(void)
+        Maximum2    =   Select2(    _mm_and_pd(_mm_cmpge_pd(AbsP2, AbsV2), _mm_cmpge_pd(AbsP2, AbsA2))
+                                ,   AbsP2
+                                ,   AbsA2                                                                       );
+        Maximum2    =   Select2(    GreaterOrEqualToAll2(AbsTargetV2, AbsP2, AbsV2, AbsA2)
+                                ,   AbsTargetV2
+                                ,   Maximum2                                                                    );
+        Maximum2    =   Select2(    _mm_and_pd(GreaterOrEqualToAll2(MaxJ2, AbsTargetV2, AbsP2, AbsV2), _mm_cmpge_pd(MaxJ2, AbsA2))
+                                ,   MaxJ2
+                                ,   Maximum2                                                                    );
+        Maximum2    =   Select2(    _mm_and_pd(     GreaterOrEqualToAll2(MaxA2, MaxJ2, AbsTargetV2, AbsP2)
+                                                ,   _mm_and_pd(_mm_cmpge_pd(MaxA2, AbsV2), _mm_cmpge_pd(MaxA2, AbsA2)))
+                                ,   MaxA2
+                                ,   Maximum2                                                                    );
+
+        Minimum2    =   Select2(_mm_cmple_pd(MaxA2, MaxJ2), MaxA2, MaxJ2);
+        Minimum2    =   Select2(Invalid2, One2, Minimum2);
+
+        MagnitudeFailure2   =   _mm_andnot_pd(Invalid2, _mm_cmpgt_pd(_mm_div_pd(Maximum2, Minimum2), MagnitudeLimit2));
+
+        Bits    =   ((unsigned int)_mm_movemask_pd(Invalid2)) & Selected;
+
+        if (Bits != 0)
+        {
+            Result  |=  RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE;
+            SetMaskBits(MaxAccelerationNotPositive, i, Bits);
+        }
+
+        Bits    =   ((unsigned int)_mm_movemask_pd(MagnitudeFailure2)) & Selected;
+
+        if (Bits != 0)
+        {
+            Result  |=  RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED;
+            SetMaskBits(MagnitudeRangeExceeded, i, Bits);
+        }
+    }
+
+#endif
+
+    for (; i < this->NumberOfDOFs; i++)
+    {
+        if (Selection[i])
+        {
+            Bits    =   CheckVelocityDOF(       MaxA    [i]
+                                            ,   MaxJ    [i]
+                                            ,   TargetV [i]
+                                            ,   P       [i]
+                                            ,   V       [i]
+                                            ,   A       [i]
+                                            ,   MagnitudeLimit  );
+
+            Result  |=  Bits;
+
+            SetMaskBits(MaxAccelerationNotPositive  , i, (Bits & RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE )?(0x1):(0x0));
+            SetMaskBits(MagnitudeRangeExceeded      , i, (Bits & RMLValidityMask::MAGNITUDE_RANGE_EXCEEDED      )?(0x1):(0x0));
+        }
+    }
+
+    if (this->MinimumSynchronizationTime > 1e10)
+    {
+        Result  |=  RMLValidityMask::MIN_SYNCHRONIZATION_TIME_TOO_BIG;
+    }
+
+    if ((Mask != NULL) && (Mask->GetNumberOfDOFs() == this->NumberOfDOFs))
+    {
+        Mask->FailureReasons    =   Result;
+    }
+
+    return(Result);
+}
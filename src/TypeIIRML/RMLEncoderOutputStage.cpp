@@ -0,0 +1,306 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLEncoderOutputStage.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLEncoderOutputStage
+//!
+//! \details
+//! For further information, please refer to the file RMLEncoderOutputStage.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+
+#include <RMLEncoderOutputStage.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define RML_ENCODER_OUTPUT_STAGE_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+//*******************************************************************************************
+// defines
+
+// Adding and subtracting 1.5 * 2^52 rounds a double value with an absolute
+// value of less than 2^51 to the nearest integer (ties to even).
+#define RML_ROUNDING_CONSTANT           6755399441055744.0
+#define RML_MAXIMUM_ABSOLUTE_COUNT      2251799813685248.0
+
+
+// Both types of counts have to have the specified size.
+typedef char RMLEncoderInt32CountSizeCheck [(sizeof(int)        == RMLEncoderOutputStage::INT32_COUNTS) ?   1   :   -1];
+typedef char RMLEncoderInt64CountSizeCheck [(sizeof(long long)  == RMLEncoderOutputStage::INT64_COUNTS) ?   1   :   -1];
+
+
+//*******************************************************************************************
+// RoundAndWrap()
+//
+// Scalar counterpart of the SSE2 implementation in
+// RMLEncoderOutputStage::WriteCounts(), both yield identical results.
+
+static inline double RoundAndWrap(      const double    &Value
+                                    ,   const double    &Modulo)
+{
+    double      Count       =   Value
+            ,   Quotient    =   0.0
+            ,   Turns       =   0.0;
+
+    // Saturation as by _mm_min_pd() and _mm_max_pd(), which also maps
+    // NaN values to the maximum.
+    Count   =   (Count  <   RML_MAXIMUM_ABSOLUTE_COUNT)?(Count):(RML_MAXIMUM_ABSOLUTE_COUNT);
+    Count   =   (Count  >   -RML_MAXIMUM_ABSOLUTE_COUNT)?(Count):(-RML_MAXIMUM_ABSOLUTE_COUNT);
+
+    Count   =   (Count + RML_ROUNDING_CONSTANT) - RML_ROUNDING_CONSTANT;
+
+    if (Modulo > 0.0)
+    {
+        Quotient    =   Count / Modulo;
+        Turns       =   (Quotient + RML_ROUNDING_CONSTANT) - RML_ROUNDING_CONSTANT;
+
+        if (Turns > Quotient)
+        {
+            Turns   -=  1.0;
+        }
+
+        Count   -=  Turns * Modulo;
+
+        if (Count < 0.0)
+        {
+            Count   +=  Modulo;
+        }
+
+        if (Count >= Modulo)
+        {
+            Count   -=  Modulo;
+        }
+    }
+
+    return(Count);
+}
+
+
+//*******************************************************************************************
+// StoreCount()
+
+static inline void StoreCount(      unsigned char                           *Address
+                                ,   const RMLEncoderOutputStage::CountType  &Type
+                                ,   const double                            &Count)
+{
+    int             Count32     =   0;
+
+    long long       Count64     =   (long long)Count;
+
+    // memcpy() is used, as the counts of a process image are not
+    // necessarily aligned.
+    if (Type == RMLEncoderOutputStage::INT64_COUNTS)
+    {
+        memcpy(Address, &Count64, sizeof(long long));
+    }
+    else
+    {
+        Count32 =   (int)((unsigned int)Count64);
+        memcpy(Address, &Count32, sizeof(int));
+    }
+}
+
+
+//*******************************************************************************************
+// RMLEncoderOutputStage()
+
+RMLEncoderOutputStage::RMLEncoderOutputStage(const unsigned int &DegreesOfFreedom)
+{
+    this->NumberOfDOFs      =   DegreesOfFreedom;
+    this->Type              =   RMLEncoderOutputStage::INT32_COUNTS;
+    this->Stride            =   sizeof(int);
+    this->ProcessImage      =   NULL;
+
+    this->CountsPerUnit     =   new RMLDoubleVector(DegreesOfFreedom);
+    this->OffsetInCounts    =   new RMLDoubleVector(DegreesOfFreedom);
+    this->Modulo            =   new RMLDoubleVector(DegreesOfFreedom);
+
+    this->CountsPerUnit->Set(1.0);
+    this->OffsetInCounts->Set(0.0);
+    this->Modulo->Set(0.0);
+}
+
+
+//*******************************************************************************************
+// ~RMLEncoderOutputStage()
+
+RMLEncoderOutputStage::~RMLEncoderOutputStage(void)
+{
+    delete  this->CountsPerUnit;
+    delete  this->OffsetInCounts;
+    delete  this->Modulo;
+
+    this->CountsPerUnit     =   NULL;
+    this->OffsetInCounts    =   NULL;
+    this->Modulo            =   NULL;
+    this->ProcessImage      =   NULL;
+}
+
+
+//*******************************************************************************************
+// SetAxis()
+
+int RMLEncoderOutputStage::SetAxis(     const unsigned int  &DOF
+                                    ,   const double        &CountsPerUnit
+                                    ,   const double        &OffsetInCounts
+                                    ,   const double        &Modulo)
+{
+    if (    (DOF >= this->NumberOfDOFs)
+        ||  (!(fabs(CountsPerUnit) > 0.0))
+        ||  (!(fabs(CountsPerUnit) <= RML_MAXIMUM_ABSOLUTE_COUNT))
+        ||  (!(fabs(OffsetInCounts) <= RML_MAXIMUM_ABSOLUTE_COUNT))
+        ||  (!(Modulo >= 0.0))
+        ||  (!(Modulo < RML_MAXIMUM_ABSOLUTE_COUNT))
+        ||  (floor(Modulo) != Modulo)                                   )
+    {
+        return(RMLEncoderOutputStage::RETURN_ERROR);
+    }
+
+    (this->CountsPerUnit->VecData)  [DOF]   =   CountsPerUnit;
+    (this->OffsetInCounts->VecData) [DOF]   =   OffsetInCounts;
+    (this->Modulo->VecData)         [DOF]   =   Modulo;
+
+    return(RMLEncoderOutputStage::RETURN_SUCCESS);
+}
+
+
+//*******************************************************************************************
+// SetProcessImage()
+
+int RMLEncoderOutputStage::SetProcessImage(     void                *FirstCount
+                                            ,   const CountType     &Type
+                                            ,   const size_t        &StrideInBytes)
+{
+    if (    (   (Type != RMLEncoderOutputStage::INT32_COUNTS)
+            &&  (Type != RMLEncoderOutputStage::INT64_COUNTS)   )
+        ||  (   (StrideInBytes != 0)
+            &&  (StrideInBytes < (size_t)Type)                  )   )
+    {
+        return(RMLEncoderOutputStage::RETURN_ERROR);
+    }
+
+    this->ProcessImage  =   (unsigned char*)FirstCount;
+    this->Type          =   Type;
+    this->Stride        =   (StrideInBytes == 0)?((size_t)Type):(StrideInBytes);
+
+    return(RMLEncoderOutputStage::RETURN_SUCCESS);
+}
+
+
+//*******************************************************************************************
+// WriteCounts()
+
+void RMLEncoderOutputStage::WriteCounts(const RMLDoubleVector &PositionVector) const
+{
+    unsigned int        i               =   0;
+
+    unsigned char       *Address        =   this->ProcessImage;
+
+    const double        *Position       =   PositionVector.VecData
+                    ,   *Scale          =   this->CountsPerUnit->VecData
+                    ,   *Offset         =   this->OffsetInCounts->VecData
+                    ,   *Wrap           =   this->Modulo->VecData;
+
+    if (    (this->ProcessImage == NULL)
+        ||  (PositionVector.GetVecDim() != this->NumberOfDOFs)  )
+    {
+        return;
+    }
+
+#if defined(RML_ENCODER_OUTPUT_STAGE_USE_SSE2)
+
+    const __m128d   Zero2               =   _mm_setzero_pd()
+                ,   One2                =   _mm_set1_pd(1.0)
+                ,   Rounding2           =   _mm_set1_pd(RML_ROUNDING_CONSTANT)
+                ,   Maximum2            =   _mm_set1_pd(RML_MAXIMUM_ABSOLUTE_COUNT)
+                ,   Minimum2            =   _mm_set1_pd(-RML_MAXIMUM_ABSOLUTE_COUNT);
+
+    __m128d         Count2
+                ,   Modulo2
+                ,   Quotient2
+                ,   Turns2
+                ,   Wrapped2
+                ,   IsWrapped2;
+
+    double          Counts[2];
+
+    for (; i + 1 < this->NumberOfDOFs; i += 2)
+    {
+        Count2      =   _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(Position + i), _mm_loadu_pd(Scale + i)), _mm_loadu_pd(Offset + i));
+        Count2      =   _mm_max_pd(_mm_min_pd(Count2, Maximum2), Minimum2);
+        Count2      =   _mm_sub_pd(_mm_add_pd(Count2, Rounding2), Rounding2);
+
+        Modulo2     =   _mm_loadu_pd(Wrap + i);
+        IsWrapped2  =   _mm_cmpgt_pd(Modulo2, Zero2);
+
+        if (_mm_movemask_pd(IsWrapped2) != 0)
+        {
+            // Axes without wrapping divide by zero here; their results are
+            // discarded below.
+            Quotient2   =   _mm_div_pd(Count2, Modulo2);
+            Turns2      =   _mm_sub_pd(_mm_add_pd(Quotient2, Rounding2), Rounding2);
+            Turns2      =   _mm_sub_pd(Turns2, _mm_and_pd(_mm_cmpgt_pd(Turns2, Quotient2), One2));
+            Wrapped2    =   _mm_sub_pd(Count2, _mm_mul_pd(Turns2, Modulo2));
+            Wrapped2    =   _mm_add_pd(Wrapped2, _mm_and_pd(_mm_cmplt_pd(Wrapped2, Zero2), Modulo2));
+            Wrapped2    =   _mm_sub_pd(Wrapped2, _mm_and_pd(_mm_cmpge_pd(Wrapped2, Modulo2), Modulo2));
+            Count2      =   _mm_or_pd(_mm_and_pd(IsWrapped2, Wrapped2), _mm_andnot_pd(IsWrapped2, Count2));
+        }
+
+        _mm_storeu_pd(Counts, Count2);
+
+        StoreCount(Address, this->Type, Counts[0]);
+        Address +=  this->Stride;
+        StoreCount(Address, this->Type, Counts[1]);
+        Address +=  this->Stride;
+    }
+
+#endif
+
+    for (; i < this->NumberOfDOFs; i++)
+    {
+        StoreCount(     Address
+                    ,   this->Type
+                    ,   RoundAndWrap(       Position[i] * Scale[i] + Offset[i]
+                                        ,   Wrap[i]                             )   );
+        Address +=  this->Stride;
+    }
+
+    return;
+}
@@ -0,0 +1,171 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryPool.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLMemoryPool
+//!
+//! \details
+//! For further information, please refer to the file RMLMemoryPool.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+
+#include <RMLMemoryPool.h>
+#include <TypeIIRMLPlatform.h>
+
+
+//****************************************************************************
+// RMLMemoryPool()
+
+RMLMemoryPool::RMLMemoryPool(       const size_t    &SizeInBytes
+                                ,   const bool      &UseHugePages) : RMLMemoryRegion(SizeInBytes, UseHugePages)
+{
+    unsigned int        i   =   0;
+
+    for (i = 0; i < RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES; i++)
+    {
+        this->FreeLists[i]  =   NULL;
+    }
+
+    this->FreeListLock  =   0;
+}
+
+
+//****************************************************************************
+// ~RMLMemoryPool()
+
+RMLMemoryPool::~RMLMemoryPool(void)
+{
+}
+
+
+//****************************************************************************
+// Allocate()
+
+void *RMLMemoryPool::Allocate(const size_t &SizeInBytes)
+{
+    unsigned int        SizeClass   =   RMLMemoryPool::GetSizeClass(SizeInBytes);
+
+    void                *Block      =   NULL;
+
+    if (SizeClass >= RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES)
+    {
+        return(NULL);
+    }
+
+    this->LockFreeLists();
+
+    Block   =   this->FreeLists[SizeClass];
+
+    if (Block != NULL)
+    {
+        this->FreeLists[SizeClass]  =   *((void**)Block);
+    }
+
+    this->UnlockFreeLists();
+
+    if (Block == NULL)
+    {
+        Block   =   RMLMemoryRegion::Allocate(((size_t)RML_CACHE_LINE_SIZE) << SizeClass);
+    }
+
+    return(Block);
+}
+
+
+//****************************************************************************
+// Deallocate()
+
+void RMLMemoryPool::Deallocate(     void            *Pointer
+                                ,   const size_t    &SizeInBytes)
+{
+    unsigned int        SizeClass   =   RMLMemoryPool::GetSizeClass(SizeInBytes);
+
+    if ((Pointer == NULL) || (SizeClass >= RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES))
+    {
+        return;
+    }
+
+    this->LockFreeLists();
+
+    *((void**)Pointer)          =   this->FreeLists[SizeClass];
+    this->FreeLists[SizeClass]  =   Pointer;
+
+    this->UnlockFreeLists();
+}
+
+
+//****************************************************************************
+// GetSizeClass()
+
+unsigned int RMLMemoryPool::GetSizeClass(const size_t &SizeInBytes)
+{
+    unsigned int        SizeClass   =   0;
+
+    size_t              BlockSize   =   RML_CACHE_LINE_SIZE;
+
+    while ((BlockSize < SizeInBytes) && (SizeClass < RML_NUMBER_OF_MEMORY_POOL_SIZE_CLASSES))
+    {
+        BlockSize   <<= 1;
+        SizeClass++;
+    }
+
+    return(SizeClass);
+}
+
+
+//****************************************************************************
+// LockFreeLists()
+
+void RMLMemoryPool::LockFreeLists(void)
+{
+    while (!TypeIIRMLPlatform::AtomicCompareAndSwap(&(this->FreeListLock), 0, 1))
+    {
+        while (this->FreeListLock != 0)
+        {
+        }
+    }
+}
+
+
+//****************************************************************************
+// UnlockFreeLists()
+
+void RMLMemoryPool::UnlockFreeLists(void)
+{
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    this->FreeListLock  =   0;
+}
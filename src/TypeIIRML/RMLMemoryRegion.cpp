@@ -0,0 +1,181 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryRegion.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLMemoryRegion
+//!
+//! \details
+//! For further information, please refer to the file RMLMemoryRegion.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+
+#include <RMLMemoryRegion.h>
+#include <TypeIIRMLPlatform.h>
+
+
+//****************************************************************************
+// RMLMemoryRegion()
+
+RMLMemoryRegion::RMLMemoryRegion(       const size_t    &SizeInBytes
+                                    ,   const bool      &UseHugePages)
+{
+    size_t      Granularity     =   (UseHugePages)?(RML_HUGE_PAGE_SIZE):(TypeIIRMLPlatform::GetPageSize());
+
+    this->Size                      =   ((SizeInBytes + Granularity - 1) / Granularity) * Granularity;
+    this->UsedSize                  =   0;
+    this->HugePagesUsed             =   false;
+    this->Locked                    =   false;
+
+    this->Base  =   (unsigned char*)TypeIIRMLPlatform::AllocateMemoryRegion(    this->Size
+                                                                            ,   UseHugePages
+                                                                            ,   &(this->HugePagesUsed)  );
+    if (this->Base == NULL)
+    {
+        this->Size  =   0;
+    }
+}
+
+
+//****************************************************************************
+// ~RMLMemoryRegion()
+
+RMLMemoryRegion::~RMLMemoryRegion(void)
+{
+    if (this->Base != NULL)
+    {
+        if (this->Locked)
+        {
+            TypeIIRMLPlatform::UnlockMemory(this->Base, this->Size);
+        }
+        TypeIIRMLPlatform::FreeMemoryRegion(this->Base, this->Size);
+    }
+
+    this->Base  =   NULL;
+}
+
+
+//****************************************************************************
+// Allocate()
+
+void *RMLMemoryRegion::Allocate(const size_t &SizeInBytes)
+{
+    unsigned long long      BlockSize   =   0
+                        ,   Offset      =   0   ;
+
+    if (this->Base == NULL)
+    {
+        return(NULL);
+    }
+
+    BlockSize   =   ((SizeInBytes + RML_CACHE_LINE_SIZE - 1) / RML_CACHE_LINE_SIZE) * RML_CACHE_LINE_SIZE;
+
+    Offset      =   TypeIIRMLPlatform::AtomicFetchAndAdd(&(this->UsedSize), BlockSize);
+
+    if (Offset + BlockSize > this->Size)
+    {
+        return(NULL);
+    }
+
+    return(this->Base + Offset);
+}
+
+
+//****************************************************************************
+// Deallocate()
+
+void RMLMemoryRegion::Deallocate(       void            *
+                                    ,   const size_t    &               )
+{
+    // The memory of a region is released as a whole by Reset().
+    return;
+}
+
+
+//****************************************************************************
+// Reset()
+
+void RMLMemoryRegion::Reset(void)
+{
+    this->UsedSize  =   0;
+
+    return;
+}
+
+
+//****************************************************************************
+// Lock()
+
+int RMLMemoryRegion::Lock(void)
+{
+    size_t                  i           =   0
+                        ,   PageSize    =   0   ;
+
+    volatile unsigned char  *Byte       =   NULL;
+
+    if (this->Base == NULL)
+    {
+        return(RMLMemoryRegion::RETURN_ERROR);
+    }
+
+    // Touch every page once, such that the operating system maps all of
+    // them, also if the region cannot be locked. Reading and writing back
+    // a byte preserves the objects that were already allocated.
+    PageSize    =   TypeIIRMLPlatform::GetPageSize();
+
+    for (i = 0; i < this->Size; i += PageSize)
+    {
+        Byte    =   this->Base + i;
+        *Byte   =   *Byte;
+    }
+
+    if (!this->Locked)
+    {
+        this->Locked    =   TypeIIRMLPlatform::LockMemory(this->Base, this->Size);
+    }
+
+    return((this->Locked)?(RMLMemoryRegion::RETURN_SUCCESS):(RMLMemoryRegion::RETURN_ERROR));
+}
+
+
+//****************************************************************************
+// GetUsedSize()
+
+size_t RMLMemoryRegion::GetUsedSize(void) const
+{
+    unsigned long long      Used    =   this->UsedSize;
+
+    return((Used > (unsigned long long)this->Size)?(this->Size):((size_t)Used));
+}
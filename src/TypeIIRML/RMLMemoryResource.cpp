@@ -0,0 +1,217 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLMemoryResource.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLMemoryResource
+//!
+//! \details
+//! For further information, please refer to the file RMLMemoryResource.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+
+#include <RMLMemoryResource.h>
+#include <TypeIIRMLPlatform.h>
+
+#include <new>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \struct RMLMemoryBlockInformation
+//!
+//! \brief
+//! Origin of a memory block of RMLMemoryResource::AllocateObject()
+//  ----------------------------------------------------------
+struct RMLMemoryBlockInformation
+{
+    //! \brief Resource of the block; \c NULL for blocks of the heap
+    RMLMemoryResource       *Resource;
+
+    //! \brief Size in bytes that was requested from the resource
+    size_t                  SizeInBytes;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \union RMLMemoryBlockHeader
+//!
+//! \brief
+//! Header that directly precedes every memory block of
+//! RMLMemoryResource::AllocateObject()
+//!
+//! \details
+//! Blocks of the heap start with the header. Blocks of a resource start
+//! with one cache line (RML_CACHE_LINE_SIZE) that contains the header at
+//! its end, such that the alignment of the resource is preserved. The
+//! union keeps the alignment of \c double values.
+//  ----------------------------------------------------------
+union RMLMemoryBlockHeader
+{
+    RMLMemoryBlockInformation   Information;
+    double                      Alignment[2];
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \var static RMLMemoryResource *ActiveResource
+//!
+//! \brief
+//! Active resource of the calling thread (cf. RMLMemoryResource::Activate())
+//  ----------------------------------------------------------
+#if defined(_MSC_VER)
+static __declspec(thread) RMLMemoryResource *ActiveResource =   NULL;
+#else
+static __thread RMLMemoryResource           *ActiveResource =   NULL;
+#endif
+
+
+//****************************************************************************
+// RMLMemoryResource()
+
+RMLMemoryResource::RMLMemoryResource(void)
+{
+    this->NumberOfHeapAllocations   =   0;
+}
+
+
+//****************************************************************************
+// ~RMLMemoryResource()
+
+RMLMemoryResource::~RMLMemoryResource(void)
+{
+    if (ActiveResource == this)
+    {
+        ActiveResource  =   NULL;
+    }
+}
+
+
+//****************************************************************************
+// Activate()
+
+void RMLMemoryResource::Activate(void)
+{
+    ActiveResource  =   this;
+}
+
+
+//****************************************************************************
+// Deactivate()
+
+void RMLMemoryResource::Deactivate(void)
+{
+    ActiveResource  =   NULL;
+}
+
+
+//****************************************************************************
+// GetActiveResource()
+
+RMLMemoryResource *RMLMemoryResource::GetActiveResource(void)
+{
+    return(ActiveResource);
+}
+
+
+//****************************************************************************
+// SetActiveResource()
+
+void RMLMemoryResource::SetActiveResource(RMLMemoryResource *Resource)
+{
+    ActiveResource  =   Resource;
+}
+
+
+//****************************************************************************
+// AllocateObject()
+
+void *RMLMemoryResource::AllocateObject(        const size_t        &SizeInBytes
+                                            ,   RMLMemoryResource   *Resource   )
+{
+    size_t                  BlockSize   =   0;
+
+    unsigned char           *Block      =   NULL;
+
+    RMLMemoryBlockHeader    *Header     =   NULL;
+
+    if (Resource != NULL)
+    {
+        BlockSize   =   RML_CACHE_LINE_SIZE + SizeInBytes;
+        Block       =   (unsigned char*)Resource->Allocate(BlockSize);
+
+        if (Block != NULL)
+        {
+            Header                          =   (RMLMemoryBlockHeader*)(Block + RML_CACHE_LINE_SIZE) - 1;
+            Header->Information.Resource    =   Resource;
+            Header->Information.SizeInBytes =   BlockSize;
+
+            return(Block + RML_CACHE_LINE_SIZE);
+        }
+
+        TypeIIRMLPlatform::AtomicFetchAndAdd(&(Resource->NumberOfHeapAllocations), 1);
+    }
+
+    Header                          =   (RMLMemoryBlockHeader*)::operator new(sizeof(RMLMemoryBlockHeader) + SizeInBytes);
+    Header->Information.Resource    =   NULL;
+    Header->Information.SizeInBytes =   sizeof(RMLMemoryBlockHeader) + SizeInBytes;
+
+    return(Header + 1);
+}
+
+
+//****************************************************************************
+// FreeObject()
+
+void RMLMemoryResource::FreeObject(void *Pointer)
+{
+    RMLMemoryBlockHeader    *Header     =   NULL;
+
+    if (Pointer == NULL)
+    {
+        return;
+    }
+
+    Header  =   (RMLMemoryBlockHeader*)Pointer - 1;
+
+    if (Header->Information.Resource == NULL)
+    {
+        ::operator delete(Header);
+    }
+    else
+    {
+        Header->Information.Resource->Deallocate(       (unsigned char*)Pointer - RML_CACHE_LINE_SIZE
+                                                    ,   Header->Information.SizeInBytes             );
+    }
+}
@@ -0,0 +1,526 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file RMLParallelExecutor.cpp
+//!
+//! \brief
+//! Implementation file for the class RMLParallelExecutor
+//!
+//! \details
+//! For further information, please refer to the file RMLParallelExecutor.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <RMLParallelExecutor.h>
+#include <TypeIIRMLPlatform.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// RMLParallelExecutor()
+
+RMLParallelExecutor::RMLParallelExecutor(       const unsigned int  &MaxNumberOfInstances
+                                            ,   const unsigned int  &NumberOfWorkers
+                                            ,   const bool          &PinWorkersToProcessors)
+{
+    unsigned int        i                   =   0
+                    ,   j                   =   0
+                    ,   NumberOfProcessors  =   TypeIIRMLPlatform::GetNumberOfProcessors();
+
+    this->MaxNumberOfInstances      =   MaxNumberOfInstances                                                ;
+    this->NumberOfInstances         =   0                                                                   ;
+    this->NumberOfWorkers           =   (NumberOfWorkers > 0)?(NumberOfWorkers):(NumberOfProcessors)        ;
+    this->NumberOfStolenInstances   =   0                                                                   ;
+    this->CycleDuration             =   0.0                                                                 ;
+    this->TerminateWorkers          =   false                                                               ;
+    this->FinishedWorkers           =   0                                                                   ;
+
+    this->Instances                 =   new Instance        [this->MaxNumberOfInstances ]                   ;
+    this->Order                     =   new unsigned int    [this->MaxNumberOfInstances ]                   ;
+    this->Workers                   =   new Worker          [this->NumberOfWorkers      ]                   ;
+
+    for (i = 0; i < this->MaxNumberOfInstances; i++)
+    {
+        this->Instances[i].RML                          =   NULL    ;
+        this->Instances[i].PositionInputParameters      =   NULL    ;
+        this->Instances[i].PositionOutputParameters     =   NULL    ;
+        this->Instances[i].PositionFlags                =   NULL    ;
+        this->Instances[i].VelocityInputParameters      =   NULL    ;
+        this->Instances[i].VelocityOutputParameters     =   NULL    ;
+        this->Instances[i].VelocityFlags                =   NULL    ;
+        this->Order[i]                                  =   i       ;
+    }
+
+    TypeIIRMLPlatform::InitializeSemaphore(&(this->CycleFinishedSemaphore));
+
+    for (i = 0; i < this->NumberOfWorkers; i++)
+    {
+        this->Workers[i].NextIndex                  =   0       ;
+        this->Workers[i].Begin                      =   0       ;
+        this->Workers[i].End                        =   0       ;
+        this->Workers[i].StolenInstances            =   0       ;
+        this->Workers[i].Index                      =   i       ;
+        this->Workers[i].Executor                   =   this    ;
+        this->Workers[i].WorkerThread.Handle        =   NULL    ;
+
+        TypeIIRMLPlatform::InitializeSemaphore(&(this->Workers[i].StartSemaphore));
+    }
+
+    // The calling thread of ExecuteCycle() acts as worker zero, such that
+    // only NumberOfWorkers - 1 threads are started.
+    for (i = 1; i < this->NumberOfWorkers; i++)
+    {
+        if (!TypeIIRMLPlatform::StartThread(       RMLParallelExecutor::WorkerFunction
+                                                ,   (void*)&(this->Workers[i])
+                                                ,   (PinWorkersToProcessors)?((int)(i % NumberOfProcessors)):(-1)
+                                                ,   &(this->Workers[i].WorkerThread)                                    ))
+        {
+            break;
+        }
+    }
+
+    // If not all threads could be started, only the running ones are used.
+    for (j = i; j < this->NumberOfWorkers; j++)
+    {
+        TypeIIRMLPlatform::DestroySemaphore(&(this->Workers[j].StartSemaphore));
+    }
+
+    this->NumberOfWorkers   =   i;
+}
+
+
+//****************************************************************************
+// ~RMLParallelExecutor()
+
+RMLParallelExecutor::~RMLParallelExecutor(void)
+{
+    unsigned int        i       =   0;
+
+    this->TerminateWorkers  =   true;
+
+    TypeIIRMLPlatform::FullMemoryBarrier();
+
+    for (i = 1; i < this->NumberOfWorkers; i++)
+    {
+        TypeIIRMLPlatform::PostSemaphore(&(this->Workers[i].StartSemaphore));
+    }
+
+    for (i = 0; i < this->NumberOfWorkers; i++)
+    {
+        TypeIIRMLPlatform::JoinThread       (&(this->Workers[i].WorkerThread)   );
+        TypeIIRMLPlatform::DestroySemaphore (&(this->Workers[i].StartSemaphore) );
+    }
+
+    TypeIIRMLPlatform::DestroySemaphore(&(this->CycleFinishedSemaphore));
+
+    for (i = 0; i < this->NumberOfInstances; i++)
+    {
+        delete this->Instances[i].RML                       ;
+        delete this->Instances[i].PositionInputParameters   ;
+        delete this->Instances[i].PositionOutputParameters  ;
+        delete this->Instances[i].PositionFlags             ;
+        delete this->Instances[i].VelocityInputParameters   ;
+        delete this->Instances[i].VelocityOutputParameters  ;
+        delete this->Instances[i].VelocityFlags             ;
+    }
+
+    delete[]    this->Instances ;
+    delete[]    this->Order     ;
+    delete[]    this->Workers   ;
+
+    this->Instances =   NULL;
+    this->Order     =   NULL;
+    this->Workers   =   NULL;
+}
+
+
+//****************************************************************************
+// AddPositionInstance()
+
+int RMLParallelExecutor::AddPositionInstance(       const unsigned int  &DegreesOfFreedom
+                                                ,   const double        &CycleTimeInSeconds)
+{
+    return(this->AddInstance(       RMLParallelExecutor::POSITION_BASED
+                                ,   DegreesOfFreedom
+                                ,   CycleTimeInSeconds                  ));
+}
+
+
+//****************************************************************************
+// AddVelocityInstance()
+
+int RMLParallelExecutor::AddVelocityInstance(       const unsigned int  &DegreesOfFreedom
+                                                ,   const double        &CycleTimeInSeconds)
+{
+    return(this->AddInstance(       RMLParallelExecutor::VELOCITY_BASED
+                                ,   DegreesOfFreedom
+                                ,   CycleTimeInSeconds                  ));
+}
+
+
+//****************************************************************************
+// AddInstance()
+
+int RMLParallelExecutor::AddInstance(       const InstanceType  &Type
+                                        ,   const unsigned int  &DegreesOfFreedom
+                                        ,   const double        &CycleTimeInSeconds)
+{
+    Instance            *NewInstance    =   NULL;
+
+    if (this->NumberOfInstances >= this->MaxNumberOfInstances)
+    {
+        return(RMLParallelExecutor::RETURN_NO_MORE_INSTANCES);
+    }
+
+    if ((DegreesOfFreedom == 0) || (CycleTimeInSeconds <= 0.0))
+    {
+        return(RMLParallelExecutor::RETURN_ERROR);
+    }
+
+    NewInstance                                 =   &(this->Instances[this->NumberOfInstances]);
+
+    NewInstance->Type                           =   Type                                                ;
+    NewInstance->RML                            =   new ReflexxesAPI(       DegreesOfFreedom
+                                                                        ,   CycleTimeInSeconds  )       ;
+    NewInstance->ResultValue                    =   ReflexxesAPI::RML_ERROR                             ;
+    NewInstance->NewCalculationWasPerformed     =   true                                                ;
+    NewInstance->Worker                         =   0                                                   ;
+    NewInstance->Latency                        =   0.0                                                 ;
+    NewInstance->MaximumLatency                 =   0.0                                                 ;
+
+    if (Type == RMLParallelExecutor::POSITION_BASED)
+    {
+        NewInstance->PositionInputParameters    =   new RMLPositionInputParameters  (DegreesOfFreedom)  ;
+        NewInstance->PositionOutputParameters   =   new RMLPositionOutputParameters (DegreesOfFreedom)  ;
+        NewInstance->PositionFlags              =   new RMLPositionFlags                                ;
+    }
+    else
+    {
+        NewInstance->VelocityInputParameters    =   new RMLVelocityInputParameters  (DegreesOfFreedom)  ;
+        NewInstance->VelocityOutputParameters   =   new RMLVelocityOutputParameters (DegreesOfFreedom)  ;
+        NewInstance->VelocityFlags              =   new RMLVelocityFlags                                ;
+    }
+
+    this->NumberOfInstances++;
+
+    return((int)(this->NumberOfInstances - 1));
+}
+
+
+//****************************************************************************
+// ExecuteCycle()
+
+int RMLParallelExecutor::ExecuteCycle(void)
+{
+    unsigned int        i           =   0;
+
+    int                 Result      =   RMLParallelExecutor::RETURN_SUCCESS;
+
+    double              StartTime   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+    this->DistributeInstances();
+
+    this->FinishedWorkers   =   0;
+
+    // The semaphores order all memory accesses of the calling thread
+    // before the ones of the workers.
+    for (i = 1; i < this->NumberOfWorkers; i++)
+    {
+        TypeIIRMLPlatform::PostSemaphore(&(this->Workers[i].StartSemaphore));
+    }
+
+    this->ProcessInstances(0);
+
+    if (!this->FinishWork())
+    {
+        TypeIIRMLPlatform::WaitForSemaphore(&(this->CycleFinishedSemaphore));
+    }
+
+    this->NumberOfStolenInstances   =   0;
+
+    for (i = 0; i < this->NumberOfWorkers; i++)
+    {
+        this->NumberOfStolenInstances   +=  this->Workers[i].StolenInstances;
+    }
+
+    for (i = 0; i < this->NumberOfInstances; i++)
+    {
+        if (this->Instances[i].ResultValue < 0)
+        {
+            Result  =   RMLParallelExecutor::RETURN_ERROR;
+        }
+    }
+
+    this->CycleDuration =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+
+    return(Result);
+}
+
+
+//****************************************************************************
+// WorkerFunction()
+
+void RMLParallelExecutor::WorkerFunction(void *Argument)
+{
+    Worker              *ThisWorker     =   (Worker*)Argument;
+
+    for (;;)
+    {
+        TypeIIRMLPlatform::WaitForSemaphore(&(ThisWorker->StartSemaphore));
+
+        if (ThisWorker->Executor->TerminateWorkers)
+        {
+            return;
+        }
+
+        ThisWorker->Executor->ProcessInstances(ThisWorker->Index);
+
+        if (ThisWorker->Executor->FinishWork())
+        {
+            TypeIIRMLPlatform::PostSemaphore(&(ThisWorker->Executor->CycleFinishedSemaphore));
+        }
+    }
+}
+
+
+//****************************************************************************
+// DistributeInstances()
+
+void RMLParallelExecutor::DistributeInstances(void)
+{
+    unsigned int        i               =   0
+                    ,   WorkerIndex     =   0
+                    ,   Begin           =   0
+                    ,   Pass            =   0;
+
+    // Dealing round-robin starting at worker zero assigns one more
+    // instance to the first workers, if the numbers do not divide.
+    for (i = 0; i < this->NumberOfWorkers; i++)
+    {
+        this->Workers[i].Begin              =   Begin;
+        this->Workers[i].End                =   Begin;
+        this->Workers[i].StolenInstances    =   0;
+
+        Begin   +=      this->NumberOfInstances / this->NumberOfWorkers
+                    +   ((i < this->NumberOfInstances % this->NumberOfWorkers)?(1):(0));
+    }
+
+    // In the first pass, the instances that performed a new calculation
+    // in the last cycle are dealt, in the second pass all others.
+    for (Pass = 0; Pass < 2; Pass++)
+    {
+        for (i = 0; i < this->NumberOfInstances; i++)
+        {
+            if (this->Instances[i].NewCalculationWasPerformed == (Pass == 0))
+            {
+                this->Order[this->Workers[WorkerIndex].End] =   i;
+                this->Workers[WorkerIndex].End++;
+
+                WorkerIndex++;
+
+                if (WorkerIndex == this->NumberOfWorkers)
+                {
+                    WorkerIndex =   0;
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < this->NumberOfWorkers; i++)
+    {
+        this->Workers[i].NextIndex  =   this->Workers[i].Begin;
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// ProcessInstances()
+
+void RMLParallelExecutor::ProcessInstances(const unsigned int &WorkerIndex)
+{
+    unsigned int        i               =   0
+                    ,   Victim          =   0
+                    ,   InstanceIndex   =   0;
+
+    while (this->ClaimInstance(WorkerIndex, &InstanceIndex))
+    {
+        this->ExecuteInstance(InstanceIndex, WorkerIndex);
+    }
+
+    for (i = 1; i < this->NumberOfWorkers; i++)
+    {
+        Victim  =   (WorkerIndex + i) % this->NumberOfWorkers;
+
+        while (this->ClaimInstance(Victim, &InstanceIndex))
+        {
+            this->ExecuteInstance(InstanceIndex, WorkerIndex);
+            this->Workers[WorkerIndex].StolenInstances++;
+        }
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// ClaimInstance()
+
+bool RMLParallelExecutor::ClaimInstance(        const unsigned int  &WorkerIndex
+                                            ,   unsigned int        *InstanceIndex)
+{
+    unsigned long long  Position    =   0;
+
+    Position    =   TypeIIRMLPlatform::AtomicFetchAndAdd(       &(this->Workers[WorkerIndex].NextIndex)
+                                                            ,   1                                       );
+
+    if (Position >= this->Workers[WorkerIndex].End)
+    {
+        return(false);
+    }
+
+    *InstanceIndex  =   this->Order[Position];
+
+    return(true);
+}
+
+
+//****************************************************************************
+// ExecuteInstance()
+
+void RMLParallelExecutor::ExecuteInstance(      const unsigned int  &InstanceIndex
+                                            ,   const unsigned int  &WorkerIndex)
+{
+    Instance            *ThisInstance   =   &(this->Instances[InstanceIndex]);
+
+    double              StartTime       =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds();
+
+    if (ThisInstance->Type == RMLParallelExecutor::POSITION_BASED)
+    {
+        ThisInstance->ResultValue   =   ThisInstance->RML->RMLPosition(     *(ThisInstance->PositionInputParameters)
+                                                                        ,   ThisInstance->PositionOutputParameters
+                                                                        ,   *(ThisInstance->PositionFlags)          );
+
+        ThisInstance->NewCalculationWasPerformed    =   ThisInstance->PositionOutputParameters->ANewCalculationWasPerformed;
+    }
+    else
+    {
+        ThisInstance->ResultValue   =   ThisInstance->RML->RMLVelocity(     *(ThisInstance->VelocityInputParameters)
+                                                                        ,   ThisInstance->VelocityOutputParameters
+                                                                        ,   *(ThisInstance->VelocityFlags)          );
+
+        ThisInstance->NewCalculationWasPerformed    =   ThisInstance->VelocityOutputParameters->ANewCalculationWasPerformed;
+    }
+
+    ThisInstance->Latency   =   TypeIIRMLPlatform::GetMonotonicTimeInSeconds() - StartTime;
+    ThisInstance->Worker    =   WorkerIndex;
+
+    if (ThisInstance->Latency > ThisInstance->MaximumLatency)
+    {
+        ThisInstance->MaximumLatency    =   ThisInstance->Latency;
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// FinishWork()
+
+bool RMLParallelExecutor::FinishWork(void)
+{
+    return(TypeIIRMLPlatform::AtomicFetchAndAdd(&(this->FinishedWorkers), 1) == this->NumberOfWorkers - 1);
+}
+
+
+//****************************************************************************
+// Accessors
+
+RMLPositionInputParameters *RMLParallelExecutor::GetPositionInputParameters(const unsigned int &Index)
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].PositionInputParameters):(NULL));
+}
+
+
+RMLPositionFlags *RMLParallelExecutor::GetPositionFlags(const unsigned int &Index)
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].PositionFlags):(NULL));
+}
+
+
+const RMLPositionOutputParameters *RMLParallelExecutor::GetPositionOutputParameters(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].PositionOutputParameters):(NULL));
+}
+
+
+RMLVelocityInputParameters *RMLParallelExecutor::GetVelocityInputParameters(const unsigned int &Index)
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].VelocityInputParameters):(NULL));
+}
+
+
+RMLVelocityFlags *RMLParallelExecutor::GetVelocityFlags(const unsigned int &Index)
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].VelocityFlags):(NULL));
+}
+
+
+const RMLVelocityOutputParameters *RMLParallelExecutor::GetVelocityOutputParameters(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].VelocityOutputParameters):(NULL));
+}
+
+
+int RMLParallelExecutor::GetResultValue(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].ResultValue):(ReflexxesAPI::RML_ERROR));
+}
+
+
+double RMLParallelExecutor::GetLatency(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].Latency):(0.0));
+}
+
+
+double RMLParallelExecutor::GetMaximumLatency(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].MaximumLatency):(0.0));
+}
+
+
+unsigned int RMLParallelExecutor::GetWorkerOfInstance(const unsigned int &Index) const
+{
+    return((Index < this->NumberOfInstances)?(this->Instances[Index].Worker):(0));
+}
@@ -59,17 +59,23 @@
 
 ReflexxesAPI::ReflexxesAPI(     const unsigned int  &DegreesOfFreedom
                            ,    const double        &CycleTimeInSeconds
-                           ,    const unsigned int  &NumberOfAdditionalThreads)
+                           ,    const unsigned int  &NumberOfAdditionalThreads
+                           ,    RMLMemoryResource   *MemoryResource
+                           ,    const unsigned int  &MaxNumberOfDOFs)
 {
+    RMLMemoryResourceScope  Scope(MemoryResource);
+
     this->NumberOfDOFs          =   DegreesOfFreedom            ;
     this->NumberOfOwnThreads    =   NumberOfAdditionalThreads   ;
     this->CycleTime             =   CycleTimeInSeconds          ;
 
     this->RMLPositionObject     =   (void*) new TypeIIRMLPosition(      DegreesOfFreedom
-                                                                    ,   CycleTimeInSeconds);
+                                                                    ,   CycleTimeInSeconds
+                                                                    ,   MaxNumberOfDOFs     );
 
     this->RMLVelocityObject     =   (void*) new TypeIIRMLVelocity(      DegreesOfFreedom
-                                                                    ,   CycleTimeInSeconds);
+                                                                    ,   CycleTimeInSeconds
+                                                                    ,   MaxNumberOfDOFs     );
 }
 
 
@@ -99,6 +105,21 @@ int ReflexxesAPI::RMLPosition(      const RMLPositionInputParameters    &InputVa
 }
 
 
+//****************************************************************************
+// RMLPosition()
+
+int ReflexxesAPI::RMLPosition(      const RMLPositionInputParameters    &InputValues
+                                ,   RMLPositionOutputParameters         *OutputValues
+                                ,   const RMLPositionFlags              &Flags
+                                ,   const double                        &ElapsedTimeInSeconds)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->GetNextStateOfMotion(       InputValues
+                                                                                    ,   OutputValues
+                                                                                    ,   Flags
+                                                                                    ,   ElapsedTimeInSeconds    ));
+}
+
+
 //****************************************************************************
 // RMLPositionAtAGivenSampleTime()
 
@@ -110,6 +131,38 @@ int ReflexxesAPI::RMLPositionAtAGivenSampleTime(    const double
 }
 
 
+
+//****************************************************************************
+// RMLPositionMinimumExecutionTime()
+
+int ReflexxesAPI::RMLPositionMinimumExecutionTime(      const RMLPositionInputParameters    &InputValues
+                                                    ,   const RMLPositionFlags              &Flags
+                                                    ,   double                              *ExecutionTime
+                                                    ,   bool                                *IsPhaseSynchronized)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->GetMinimumExecutionTime(        InputValues
+                                                                                        ,   Flags
+                                                                                        ,   ExecutionTime
+                                                                                        ,   IsPhaseSynchronized ));
+}
+
+
+
+//****************************************************************************
+// RMLPositionMinimumExecutionTimes()
+
+int ReflexxesAPI::RMLPositionMinimumExecutionTimes(     const RMLPositionInputParameters    &InputValues
+                                                    ,   const RMLPositionFlags              &Flags
+                                                    ,   const RMLPositionCandidateTargets   &Candidates
+                                                    ,   RMLPositionCandidateResults         *Results)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->GetMinimumExecutionTimes(       InputValues
+                                                                                        ,   Flags
+                                                                                        ,   Candidates
+                                                                                        ,   Results     ));
+}
+
+
 //****************************************************************************
 // RMLVelocity()
 
@@ -123,6 +176,21 @@ int ReflexxesAPI::RMLVelocity(      const RMLVelocityInputParameters    &InputVa
 }
 
 
+//****************************************************************************
+// RMLVelocity()
+
+int ReflexxesAPI::RMLVelocity(      const RMLVelocityInputParameters    &InputValues
+                                ,   RMLVelocityOutputParameters         *OutputValues
+                                ,   const RMLVelocityFlags              &Flags
+                                ,   const double                        &ElapsedTimeInSeconds)
+{
+    return(((TypeIIRMLVelocity*)(this->RMLVelocityObject))->GetNextStateOfMotion(       InputValues
+                                                                                    ,   OutputValues
+                                                                                    ,   Flags
+                                                                                    ,   ElapsedTimeInSeconds    ));
+}
+
+
 //****************************************************************************
 // RMLVelocityAtAGivenSampleTime()
 
@@ -132,3 +200,165 @@ int ReflexxesAPI::RMLVelocityAtAGivenSampleTime(    const double
     return(((TypeIIRMLVelocity*)(this->RMLVelocityObject))->GetNextStateOfMotionAtTime(     TimeValueInSeconds
                                                                                         ,   OutputValues        ));
 }
+
+
+//****************************************************************************
+// PrepareForRealTime()
+
+int ReflexxesAPI::PrepareForRealTime(       const RMLPositionFlags  &PositionFlags
+                                        ,   const RMLVelocityFlags  &VelocityFlags)
+{
+    int     Result  =   ReflexxesAPI::RML_ERROR;
+
+    Result  =   ((TypeIIRMLPosition*)(this->RMLPositionObject))->PrepareForRealTime(PositionFlags);
+
+    if (Result < 0)
+    {
+        return(Result);
+    }
+
+    return(((TypeIIRMLVelocity*)(this->RMLVelocityObject))->PrepareForRealTime(VelocityFlags));
+}
+
+
+//****************************************************************************
+// Reset()
+
+void ReflexxesAPI::Reset(void)
+{
+    ((TypeIIRMLPosition*)(this->RMLPositionObject))->Reset();
+    ((TypeIIRMLVelocity*)(this->RMLVelocityObject))->Reset();
+
+    return;
+}
+
+
+//****************************************************************************
+// Reconfigure()
+
+int ReflexxesAPI::Reconfigure(      const unsigned int  &DegreesOfFreedom
+                                ,   const double        &CycleTimeInSeconds)
+{
+    int     Result  =   ReflexxesAPI::RML_ERROR;
+
+    // Both objects were constructed with the same number of reserved
+    // degrees of freedom, and both check the same conditions, that is,
+    // either both or none of them are reconfigured.
+    Result  =   ((TypeIIRMLPosition*)(this->RMLPositionObject))->Reconfigure(       DegreesOfFreedom
+                                                                                ,   CycleTimeInSeconds  );
+
+    if (Result != ReflexxesAPI::RML_WORKING)
+    {
+        return(Result);
+    }
+
+    ((TypeIIRMLVelocity*)(this->RMLVelocityObject))->Reconfigure(       DegreesOfFreedom
+                                                                    ,   CycleTimeInSeconds  );
+
+    this->NumberOfDOFs  =   DegreesOfFreedom    ;
+    this->CycleTime     =   CycleTimeInSeconds  ;
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// GetMaxNumberOfDOFs()
+
+unsigned int ReflexxesAPI::GetMaxNumberOfDOFs(void) const
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->GetMaxNumberOfDOFs());
+}
+
+
+//****************************************************************************
+// SetFeedOverride()
+
+int ReflexxesAPI::SetFeedOverride(const double &Factor)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->SetFeedOverride(Factor));
+}
+
+
+//****************************************************************************
+// SetMaxFeedOverrideRate()
+
+int ReflexxesAPI::SetMaxFeedOverrideRate(const double &Rate)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->SetMaxFeedOverrideRate(Rate));
+}
+
+
+//****************************************************************************
+// GetFeedOverride()
+
+double ReflexxesAPI::GetFeedOverride(void) const
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->GetFeedOverride());
+}
+
+
+//****************************************************************************
+// GetScaledKinematicLimits()
+
+void ReflexxesAPI::GetScaledKinematicLimits(        const RMLPositionInputParameters    &InputValues
+                                                ,   RMLDoubleVector                     *MaxVelocityVector
+                                                ,   RMLDoubleVector                     *MaxAccelerationVector
+                                                ,   RMLDoubleVector                     *MaxJerkVector          ) const
+{
+    ((TypeIIRMLPosition*)(this->RMLPositionObject))->GetScaledKinematicLimits(      InputValues
+                                                                                ,   MaxVelocityVector
+                                                                                ,   MaxAccelerationVector
+                                                                                ,   MaxJerkVector           );
+}
+
+
+//****************************************************************************
+// SetTrajectoryCache()
+
+int ReflexxesAPI::SetTrajectoryCache(       const size_t    &MemoryBudgetInBytes
+                                        ,   const double    &Resolution         )
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->SetTrajectoryCache(     MemoryBudgetInBytes
+                                                                                ,   Resolution          ));
+}
+
+
+//****************************************************************************
+// GetTrajectoryCacheStatistics()
+
+void ReflexxesAPI::GetTrajectoryCacheStatistics(        unsigned long long  *NumberOfHits
+                                                    ,   unsigned long long  *NumberOfMisses
+                                                    ,   unsigned int        *NumberOfEntries    ) const
+{
+    ((TypeIIRMLPosition*)(this->RMLPositionObject))->GetTrajectoryCacheStatistics(     NumberOfHits
+                                                                                    ,   NumberOfMisses
+                                                                                    ,   NumberOfEntries );
+}
+
+
+//****************************************************************************
+// WriteTrajectoryCacheFile()
+
+int ReflexxesAPI::WriteTrajectoryCacheFile(const char *FileName) const
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->WriteTrajectoryCacheFile(FileName));
+}
+
+
+//****************************************************************************
+// MapTrajectoryCacheFile()
+
+int ReflexxesAPI::MapTrajectoryCacheFile(const char *FileName)
+{
+    return(((TypeIIRMLPosition*)(this->RMLPositionObject))->MapTrajectoryCacheFile(FileName));
+}
+
+
+//****************************************************************************
+// UnmapTrajectoryCacheFile()
+
+void ReflexxesAPI::UnmapTrajectoryCacheFile(void)
+{
+    ((TypeIIRMLPosition*)(this->RMLPositionObject))->UnmapTrajectoryCacheFile();
+}
@@ -0,0 +1,315 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file ReflexxesCAPI.cpp
+//!
+//! \brief
+//! Implementation file for the C interface of the Type II Reflexxes
+//! Motion Library
+//!
+//! \details
+//! For further information, please refer to the file ReflexxesCAPI.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <ReflexxesCAPI.h>
+#include <ReflexxesAPI.h>
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLVelocity.h>
+#include <RMLPositionFlags.h>
+#include <RMLVelocityFlags.h>
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Instance of the position-based algorithm behind the handle
+//! rml_position
+//  ----------------------------------------------------------
+struct rml_position
+{
+    TypeIIRMLPosition   *Engine;
+    RMLPositionFlags    Flags;
+};
+
+
+//  ---------------------- Doxygen info ----------------------
+//! \brief
+//! Instance of the velocity-based algorithm behind the handle
+//! rml_velocity
+//  ----------------------------------------------------------
+struct rml_velocity
+{
+    TypeIIRMLVelocity   *Engine;
+    RMLVelocityFlags    Flags;
+};
+
+
+//****************************************************************************
+// SetFlags()
+
+static void SetFlags(       const rml_flags     &CFlags
+                        ,   RMLFlags            *Flags)
+{
+    Flags->SynchronizationBehavior                          =   (unsigned char)CFlags.synchronization_behavior                          ;
+    Flags->EnableTheCalculationOfTheExtremumMotionStates    =   (CFlags.enable_the_calculation_of_the_extremum_motion_states != 0)      ;
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_flags_init()
+
+void rml_flags_init(rml_flags *flags)
+{
+    RMLPositionFlags        Flags;
+
+    if (flags == NULL)
+    {
+        return;
+    }
+
+    flags->synchronization_behavior                                 =   Flags.SynchronizationBehavior                       ;
+    flags->enable_the_calculation_of_the_extremum_motion_states     =   Flags.EnableTheCalculationOfTheExtremumMotionStates ;
+    flags->behavior_after_final_state_of_motion_is_reached          =   Flags.BehaviorAfterFinalStateOfMotionIsReached      ;
+    flags->keep_current_velocity_in_case_of_fallback_strategy       =   Flags.KeepCurrentVelocityInCaseOfFallbackStrategy   ;
+    flags->enable_deterministic_timing                              =   Flags.EnableDeterministicTiming                     ;
+    flags->number_of_recomputation_cycles                           =   Flags.NumberOfRecomputationCycles                   ;
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_position_create()
+
+rml_position *rml_position_create(      unsigned int    number_of_dofs
+                                    ,   double          cycle_time_in_seconds   )
+{
+    rml_position        *Handle     =   NULL;
+
+    RMLPositionFlags    Flags;
+
+    if (number_of_dofs == 0)
+    {
+        return(NULL);
+    }
+
+    try
+    {
+        Handle          =   new rml_position;
+        Handle->Engine  =   NULL;
+        Handle->Engine  =   new TypeIIRMLPosition(      number_of_dofs
+                                                    ,   cycle_time_in_seconds   );
+
+        // The internal instances for deterministic timing and for amortized
+        // recomputations are allocated by a warm-up with both options, such
+        // that rml_position_step() does not allocate memory for any flags.
+        Flags.EnableDeterministicTiming     =   true;
+        Flags.NumberOfRecomputationCycles   =   2;
+
+        if (Handle->Engine->PrepareForRealTime(Flags) < 0)
+        {
+            rml_position_destroy(Handle);
+            return(NULL);
+        }
+    }
+    catch (...)
+    {
+        if (Handle != NULL)
+        {
+            delete Handle->Engine;
+            delete Handle;
+        }
+        return(NULL);
+    }
+
+    return(Handle);
+}
+
+
+//****************************************************************************
+// rml_position_destroy()
+
+void rml_position_destroy(rml_position *handle)
+{
+    if (handle == NULL)
+    {
+        return;
+    }
+
+    delete handle->Engine;
+    delete handle;
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_position_set_flags()
+
+void rml_position_set_flags(        rml_position        *handle
+                                ,   const rml_flags     *flags  )
+{
+    if ((handle == NULL) || (flags == NULL))
+    {
+        return;
+    }
+
+    SetFlags(*flags, &(handle->Flags));
+
+    handle->Flags.BehaviorAfterFinalStateOfMotionIsReached      =   flags->behavior_after_final_state_of_motion_is_reached              ;
+    handle->Flags.KeepCurrentVelocityInCaseOfFallbackStrategy   =   (flags->keep_current_velocity_in_case_of_fallback_strategy != 0)    ;
+    handle->Flags.EnableDeterministicTiming                     =   (flags->enable_deterministic_timing != 0)                           ;
+    handle->Flags.NumberOfRecomputationCycles                   =   flags->number_of_recomputation_cycles                               ;
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_position_step()
+
+int rml_position_step(      rml_position        *handle
+                        ,   const rml_in_view   *input
+                        ,   rml_out_view        *output )
+{
+    if ((handle == NULL) || (input == NULL) || (output == NULL))
+    {
+        return(RML_RESULT_ERROR_NULL_POINTER);
+    }
+
+    // No exception may leave the C interface.
+    try
+    {
+        return(handle->Engine->GetNextStateOfMotion(     *input
+                                                    ,   output
+                                                    ,   handle->Flags   ));
+    }
+    catch (...)
+    {
+        return(RML_RESULT_ERROR);
+    }
+}
+
+
+//****************************************************************************
+// rml_velocity_create()
+
+rml_velocity *rml_velocity_create(      unsigned int    number_of_dofs
+                                    ,   double          cycle_time_in_seconds   )
+{
+    rml_velocity        *Handle     =   NULL;
+
+    if (number_of_dofs == 0)
+    {
+        return(NULL);
+    }
+
+    try
+    {
+        Handle          =   new rml_velocity;
+        Handle->Engine  =   NULL;
+        Handle->Engine  =   new TypeIIRMLVelocity(      number_of_dofs
+                                                    ,   cycle_time_in_seconds   );
+    }
+    catch (...)
+    {
+        if (Handle != NULL)
+        {
+            delete Handle;
+        }
+        return(NULL);
+    }
+
+    return(Handle);
+}
+
+
+//****************************************************************************
+// rml_velocity_destroy()
+
+void rml_velocity_destroy(rml_velocity *handle)
+{
+    if (handle == NULL)
+    {
+        return;
+    }
+
+    delete handle->Engine;
+    delete handle;
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_velocity_set_flags()
+
+void rml_velocity_set_flags(        rml_velocity        *handle
+                                ,   const rml_flags     *flags  )
+{
+    if ((handle == NULL) || (flags == NULL))
+    {
+        return;
+    }
+
+    SetFlags(*flags, &(handle->Flags));
+
+    return;
+}
+
+
+//****************************************************************************
+// rml_velocity_step()
+
+int rml_velocity_step(      rml_velocity        *handle
+                        ,   const rml_in_view   *input
+                        ,   rml_out_view        *output )
+{
+    if ((handle == NULL) || (input == NULL) || (output == NULL))
+    {
+        return(RML_RESULT_ERROR_NULL_POINTER);
+    }
+
+    // No exception may leave the C interface.
+    try
+    {
+        return(handle->Engine->GetNextStateOfMotion(     *input
+                                                    ,   output
+                                                    ,   handle->Flags   ));
+    }
+    catch (...)
+    {
+        return(RML_RESULT_ERROR);
+    }
+}
@@ -0,0 +1,362 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLAmortizedRecomputation.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <ReflexxesAPI.h>
+
+using namespace TypeIIRMLMath;
+
+
+//****************************************************************************
+// IsAmortizedRecomputationPossible()
+
+bool TypeIIRMLPosition::IsAmortizedRecomputationPossible(const RMLPositionFlags &Flags) const
+{
+    unsigned int                i                   =   0;
+
+    if (    (Flags.NumberOfRecomputationCycles  <=  1)
+        ||  (   (this->ReturnValue  !=  ReflexxesAPI::RML_WORKING               )
+            &&  (this->ReturnValue  !=  ReflexxesAPI::RML_FINAL_STATE_REACHED   )   )
+        ||  (Flags                              !=  this->OldFlags) )
+    {
+        return(false);
+    }
+
+    // The state of motion, at which the new trajectory starts, is
+    // predicted for cycles of the nominal duration.
+    if (this->CycleTime != this->NominalCycleTime)
+    {
+        return(false);
+    }
+
+    if (        *(this->CurrentInputParameters->SelectionVector)
+            !=
+                *(this->OldInputParameters->SelectionVector)    )
+    {
+        return(false);
+    }
+
+    // The trajectory of the last cycle can only be continued, if its
+    // output values were fed back.
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            if (!(      IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                    ,   (this->OutputParameters->NewPositionVector->VecData)[i])
+                    &&  IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                    ,   (this->OutputParameters->NewVelocityVector->VecData)[i]) ))
+            {
+                return(false);
+            }
+        }
+    }
+
+    return(true);
+}
+
+
+//****************************************************************************
+// StartAmortizedRecomputation()
+
+bool TypeIIRMLPosition::StartAmortizedRecomputation(const RMLPositionFlags &Flags)
+{
+    unsigned int                i                   =   0;
+
+    double                      TimeValueInSeconds  =   this->InternalClockInSeconds;
+
+    TypeIIRMLPosition           *Instance           =   NULL;
+
+    if (this->AmortizedRecomputationInstance == NULL)
+    {
+        RMLMemoryResourceScope  Scope(this->MemoryResource);
+
+        this->AmortizedRecomputationInstance    =   new TypeIIRMLPosition(      this->NumberOfDOFs
+                                                                            ,   this->CycleTime
+                                                                            ,   this->MaxNumberOfDOFs   );
+    }
+
+    Instance    =   this->AmortizedRecomputationInstance;
+
+    *(Instance->CurrentInputParameters) =   *(this->CurrentInputParameters);
+
+    // The trajectory of the last cycle is continued for K - 1 cycles. The
+    // state of motion at the end of cycle K - 1 becomes the initial state
+    // of motion of the new trajectory, which is used from cycle K on. The
+    // internal clock is advanced in the same way as in
+    // TypeIIRMLPosition::ContinuePreviousTrajectory() to obtain exactly
+    // the same state of motion. The output values of the instance are only
+    // used as temporary memory.
+    for (i = 1; i < Flags.NumberOfRecomputationCycles; i++)
+    {
+        TimeValueInSeconds  +=  this->CycleTime;
+    }
+
+    this->Step3(        TimeValueInSeconds
+                    ,   Instance->OutputParameters  );
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if ( (this->ModifiedSelectionVector->VecData)[i] )
+        {
+            (Instance->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                =   (this->OldInputParameters->TargetPositionVector->VecData)[i]
+                        -   ((this->StoredTargetPosition->VecData)[i]
+                        -   (Instance->OutputParameters->NewPositionVector->VecData)[i] );
+            (Instance->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                =   (Instance->OutputParameters->NewVelocityVector->VecData)[i];
+            (Instance->CurrentInputParameters->CurrentAccelerationVector->VecData)[i]
+                =   (Instance->OutputParameters->NewAccelerationVector->VecData)[i];
+        }
+    }
+
+    this->AmortizedRecomputationStage   =   1;
+
+    if (!(this->ExecuteAmortizedRecomputationStage(Flags)))
+    {
+        this->AmortizedRecomputationStage   =   0;
+        return(false);
+    }
+
+    this->ContinuePreviousTrajectory();
+
+    return(true);
+}
+
+
+//****************************************************************************
+// ContinueAmortizedRecomputation()
+
+bool TypeIIRMLPosition::ContinueAmortizedRecomputation(     const RMLPositionFlags  &Flags
+                                                        ,   bool                    *ANewCalculationWasPerformed)
+{
+    unsigned int                i                   =   0;
+
+    TypeIIRMLPosition           *Instance           =   this->AmortizedRecomputationInstance;
+
+    MotionPolynomials           *SwapPolynomials    =   NULL;
+
+    RMLBoolVector               *SwapBoolVector     =   NULL;
+
+    RMLDoubleVector             *SwapDoubleVector   =   NULL;
+
+    RMLVector<Step1_Profile>    *SwapProfiles       =   NULL;
+
+    *ANewCalculationWasPerformed    =   false;
+
+    if (    (!(this->IsAmortizedRecomputationPossible(Flags)))
+        ||  (!(this->ExecuteAmortizedRecomputationStage(Flags))) )
+    {
+        this->AmortizedRecomputationStage   =   0;
+        return(false);
+    }
+
+    if (this->AmortizedRecomputationStage <= Flags.NumberOfRecomputationCycles)
+    {
+        this->ContinuePreviousTrajectory();
+        return(true);
+    }
+
+    // The new trajectory is complete: exchange the trajectory of this
+    // object and the one of the instance.
+
+    SwapPolynomials                         =   this->Polynomials;
+    this->Polynomials                       =   Instance->Polynomials;
+    Instance->Polynomials                   =   SwapPolynomials;
+
+    SwapBoolVector                          =   this->ModifiedSelectionVector;
+    this->ModifiedSelectionVector           =   Instance->ModifiedSelectionVector;
+    Instance->ModifiedSelectionVector       =   SwapBoolVector;
+
+    this->SetupModifiedDOFs();
+
+    SwapProfiles                            =   this->UsedStep1AProfiles;
+    this->UsedStep1AProfiles                =   Instance->UsedStep1AProfiles;
+    Instance->UsedStep1AProfiles            =   SwapProfiles;
+
+    SwapDoubleVector                        =   this->StoredTargetPosition;
+    this->StoredTargetPosition              =   Instance->StoredTargetPosition;
+    Instance->StoredTargetPosition          =   SwapDoubleVector;
+
+    SwapDoubleVector                        =   this->MinimumExecutionTimes;
+    this->MinimumExecutionTimes             =   Instance->MinimumExecutionTimes;
+    Instance->MinimumExecutionTimes         =   SwapDoubleVector;
+
+    this->SynchronizationTime                       =   Instance->SynchronizationTime                   ;
+    this->CurrentTrajectoryIsPhaseSynchronized      =   Instance->CurrentTrajectoryIsPhaseSynchronized  ;
+    this->CurrentTrajectoryIsNotSynchronized        =   Instance->CurrentTrajectoryIsNotSynchronized    ;
+    this->GreatestDOFForPhaseSynchronization        =   Instance->GreatestDOFForPhaseSynchronization    ;
+    this->MotionProfileForPhaseSynchronization      =   Instance->MotionProfileForPhaseSynchronization  ;
+    this->PhaseSynchronizationMagnitude             =   Instance->PhaseSynchronizationMagnitude         ;
+
+    // The input values of the new trajectory become the input values of
+    // this cycle. The current state of motion is the one of this cycle,
+    // which equals the initial state of motion of the new trajectory.
+    *(Instance->CurrentInputParameters->CurrentPositionVector)      =   *(this->CurrentInputParameters->CurrentPositionVector)      ;
+    *(Instance->CurrentInputParameters->CurrentVelocityVector)      =   *(this->CurrentInputParameters->CurrentVelocityVector)      ;
+    *(Instance->CurrentInputParameters->CurrentAccelerationVector)  =   *(this->CurrentInputParameters->CurrentAccelerationVector)  ;
+
+    // Degrees of freedom that are already in their target state of motion
+    // are set to this state as in
+    // TypeIIRMLPosition::SetupModifiedSelectionVector(), such that their
+    // output values equal the ones of a calculation within this cycle.
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (    ((Instance->CurrentInputParameters->SelectionVector->VecData)[i])
+            &&  (!(this->ModifiedSelectionVector->VecData)[i])                    )
+        {
+            (Instance->CurrentInputParameters->CurrentPositionVector->VecData)          [i]
+                =   (Instance->CurrentInputParameters->TargetPositionVector->VecData)   [i];
+            (Instance->CurrentInputParameters->CurrentVelocityVector->VecData)          [i] =   0.0;
+            (Instance->CurrentInputParameters->CurrentAccelerationVector->VecData)      [i] =   0.0;
+        }
+    }
+
+    *(this->CurrentInputParameters) =   *(Instance->CurrentInputParameters) ;
+    *(this->OldInputParameters)     =   *(this->CurrentInputParameters)     ;
+    this->OldFlags                  =   Flags                               ;
+
+    this->InternalClockInSeconds        =   this->CycleTime;
+    this->AmortizedRecomputationStage   =   0;
+
+    *ANewCalculationWasPerformed    =   true;
+
+    return(true);
+}
+
+
+//****************************************************************************
+// ExecuteAmortizedRecomputationStage()
+
+bool TypeIIRMLPosition::ExecuteAmortizedRecomputationStage(const RMLPositionFlags &Flags)
+{
+    unsigned int                i                   =   0
+                            ,   Stage               =   this->AmortizedRecomputationStage
+                            ,   NumberOfStep1Stages =   Flags.NumberOfRecomputationCycles - 1;
+
+    TypeIIRMLPosition           *Instance           =   this->AmortizedRecomputationInstance;
+
+    if (Stage == 1)
+    {
+        *(Instance->StoredTargetPosition)   =   *(Instance->CurrentInputParameters->TargetPositionVector);
+
+        Instance->CompareInitialAndTargetStateofMotion();
+
+        Instance->UseStep1Cache                         =   !(Flags.EnableDeterministicTiming);
+
+        Instance->CurrentTrajectoryIsPhaseSynchronized  =       ((  Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION           )
+                                                            ||  (   Flags.SynchronizationBehavior == RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE    ));
+
+        Instance->CurrentTrajectoryIsNotSynchronized    =       (   Flags.SynchronizationBehavior == RMLFlags::NO_SYNCHRONIZATION                   );
+    }
+
+    if (Stage <= NumberOfStep1Stages)
+    {
+        Instance->Step1MinimumExecutionTimes(       ((Stage - 1) * this->NumberOfDOFs) / NumberOfStep1Stages
+                                                ,   (Stage * this->NumberOfDOFs) / NumberOfStep1Stages          );
+
+        if (Stage == NumberOfStep1Stages)
+        {
+            Instance->Step1SynchronizationTime();
+
+            if (    (Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
+                &&  (!(Instance->CurrentTrajectoryIsPhaseSynchronized)) )
+            {
+                return(false);
+            }
+
+            if (Instance->SynchronizationTime > RML_MAX_EXECUTION_TIME)
+            {
+                return(false);
+            }
+
+            for (i = 0; i < this->NumberOfDOFs; i++)
+            {
+                (Instance->Polynomials)[i].ValidPolynomials = 0;
+            }
+
+            Instance->ApplyMinimumSynchronizationTime(Flags);
+        }
+    }
+    else
+    {
+        Instance->Step2();
+    }
+
+    this->AmortizedRecomputationStage++;
+
+    return(true);
+}
+
+
+//****************************************************************************
+// ContinuePreviousTrajectory()
+
+void TypeIIRMLPosition::ContinuePreviousTrajectory(void)
+{
+    // The input values of the current trajectory are used for this cycle,
+    // such that the output values are the ones that would have been
+    // calculated without the new input values.
+    *(this->OldInputParameters->CurrentPositionVector)      =   *(this->CurrentInputParameters->CurrentPositionVector)      ;
+    *(this->OldInputParameters->CurrentVelocityVector)      =   *(this->CurrentInputParameters->CurrentVelocityVector)      ;
+    *(this->OldInputParameters->CurrentAccelerationVector)  =   *(this->CurrentInputParameters->CurrentAccelerationVector)  ;
+
+    *(this->CurrentInputParameters) =   *(this->OldInputParameters);
+
+    this->InternalClockInSeconds    +=  this->CycleTime;
+    this->SynchronizationTime       -=  this->CycleTime;
+
+    if (this->SynchronizationTime < 0.0)
+    {
+        this->SynchronizationTime = 0.0;
+    }
+
+    return;
+}
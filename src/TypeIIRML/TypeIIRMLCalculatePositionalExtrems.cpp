@@ -70,6 +70,8 @@ void TypeIIRMLPosition::CalculatePositionalExtrems(     const double
                         ,   TimeOfZeroVelocity2         =   0.0
                         ,   TimeValueAtExtremumPosition =   0.0;
 
+    OP->SetPosExtremaVectorArraysModified();
+
     for (i = 0; i < this->NumberOfDOFs; i++)
     {
         if ((this->ModifiedSelectionVector->VecData)[i])
@@ -292,28 +294,10 @@ void TypeIIRMLPosition::CalculatePositionalExtrems(     const double
 
 void TypeIIRMLPosition::SetPositionalExtremsToZero(RMLPositionOutputParameters *OP) const
 {
-    unsigned int            i                           =   0
-                        ,   k                           =   0;
+    unsigned int            i                           =   0;
 
     for (i = 0; i < this->NumberOfDOFs; i++)
     {
-        for (k = 0; k < this->NumberOfDOFs; k++)
-        {
-            (((OP->MinPosExtremaPositionVectorArray)[i])->VecData)[k]
-            =   0.0;
-            (((OP->MinPosExtremaVelocityVectorArray)[i])->VecData)[k]
-            =   0.0;
-            (((OP->MinPosExtremaAccelerationVectorArray)[i])->VecData)[k]
-            =   0.0;
-
-            (((OP->MaxPosExtremaPositionVectorArray)[i])->VecData)[k]
-            =   0.0;
-            (((OP->MaxPosExtremaVelocityVectorArray)[i])->VecData)[k]
-            =   0.0;
-            (((OP->MaxPosExtremaAccelerationVectorArray)[i])->VecData)[k]
-            =   0.0;
-        }
-
         (OP->MinPosExtremaPositionVectorOnly->VecData)[i]
         =   0.0;
         (OP->MaxPosExtremaPositionVectorOnly->VecData)[i]
@@ -323,4 +307,10 @@ void TypeIIRMLPosition::SetPositionalExtremsToZero(RMLPositionOutputParameters *
         (OP->MaxExtremaTimesVector->VecData)[i]
         =   0.0;
     }
+
+    // The arrays of the motion states at the positional extrema are only
+    // zeroed once, such that a cycle without the calculation of the
+    // extremum motion states does not depend on the square of the number
+    // of degrees of freedom.
+    OP->SetPosExtremaVectorArraysToZero();
 }
@@ -100,10 +100,9 @@ bool TypeIIRMLMath::Decision_1A__005(       const double &CurrentPosition
                                         ,   const double &MaxVelocity
                                         ,   const double &MaxAcceleration)
 {
-    return(     (CurrentPosition + (3.0 * pow2(MaxVelocity)
-                - pow2(CurrentVelocity) - CurrentVelocity * (MaxVelocity
-                - TargetVelocity) - MaxVelocity * TargetVelocity
-                - pow2(TargetVelocity)) / (2.0 * MaxAcceleration))
+    return(     (CurrentPosition + (2.0 * pow2(MaxVelocity)
+                - pow2(CurrentVelocity) - pow2(TargetVelocity))
+                / (2.0 * MaxAcceleration))
             <=  TargetPosition);
 }
 
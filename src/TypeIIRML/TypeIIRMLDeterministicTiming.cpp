@@ -0,0 +1,177 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLDeterministicTiming.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLPosition.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionFlags.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// SetUpPaddingInputValues()
+//
+// Writes the fixed input values, for which the execution path of a
+// trajectory calculation is executed in cycles without a calculation. The
+// values are chosen, such that Steps 1 and 2 pass through their most
+// expensive branches for all degrees of freedom:
+//
+//  - All degrees of freedom are selected, and none of them is in its
+//    target state of motion.
+//  - The current velocity, the target velocity, and the position
+//    difference of all degrees of freedom are equal, such that the check
+//    for phase-synchronization passes all degrees of freedom. The maximum
+//    velocity of the last degree of freedom is too small for the
+//    phase-synchronized motion, such that the check fails at the last
+//    degree of freedom, and the time-synchronized path is executed.
+//  - The target velocity and the current velocity point towards the
+//    target position, such that (almost) all degrees of freedom have an
+//    inoperative time interval (decision trees 1B and 1C).
+//  - The minimum synchronization time lies within these intervals, such
+//    that the synchronization time is shifted over all of them, and
+//    Step 2 calculates the profiles behind the intervals.
+//  - Without synchronization, the check for phase-synchronization and
+//    the inoperative time intervals are not considered. In this case, the
+//    target velocity is zero, such that all degrees of freedom overshoot
+//    their target positions, and Steps 1 and 2 have to calculate profiles
+//    with a change of the direction of motion.
+
+static void SetUpPaddingInputValues(        const unsigned int          &NumberOfDOFs
+                                        ,   const int                   &SynchronizationBehavior
+                                        ,   RMLPositionInputParameters  *InputValues            )
+{
+    unsigned int        i       =   0;
+
+    double              Factor          =   0.0
+                    ,   TargetVelocity  =   0.4;
+
+    if (SynchronizationBehavior == RMLFlags::NO_SYNCHRONIZATION)
+    {
+        TargetVelocity  =   0.0;
+    }
+
+    for (i = 0; i < NumberOfDOFs; i++)
+    {
+        Factor  =   (double)i / (double)NumberOfDOFs;
+
+        (InputValues->SelectionVector->VecData              )[i]    =   true;
+        (InputValues->CurrentPositionVector->VecData        )[i]    =   0.0;
+        (InputValues->CurrentVelocityVector->VecData        )[i]    =   0.5;
+        (InputValues->CurrentAccelerationVector->VecData    )[i]    =   0.0;
+        (InputValues->TargetPositionVector->VecData         )[i]    =   0.05;
+        (InputValues->TargetVelocityVector->VecData         )[i]    =   TargetVelocity;
+        (InputValues->MaxVelocityVector->VecData            )[i]    =   1.0 + 0.25 * Factor;
+        (InputValues->MaxAccelerationVector->VecData        )[i]    =   1.0 + 0.5 * Factor;
+        (InputValues->MaxJerkVector->VecData                )[i]    =   1.0;
+    }
+
+    (InputValues->MaxVelocityVector->VecData        )[NumberOfDOFs - 1] =   0.95;
+    (InputValues->MaxAccelerationVector->VecData    )[NumberOfDOFs - 1] =   2.0;
+
+    InputValues->MinimumSynchronizationTime =   0.2;
+
+    return;
+}
+
+
+//****************************************************************************
+// ExecuteDeterministicTimingPath()
+
+void TypeIIRMLPosition::ExecuteDeterministicTimingPath(const RMLPositionFlags &Flags)
+{
+    unsigned int                i                   =   0;
+
+    double                      ExecutionTime       =   0.0;
+
+    RMLPositionFlags            InstanceFlags;
+
+    if (!Flags.EnableDeterministicTiming)
+    {
+        return;
+    }
+
+    if (this->DeterministicTimingInstance == NULL)
+    {
+        RMLMemoryResourceScope  Scope(this->MemoryResource);
+
+        this->DeterministicTimingInstance   =   new TypeIIRMLPosition(      this->NumberOfDOFs
+                                                                        ,   this->CycleTime
+                                                                        ,   this->MaxNumberOfDOFs   );
+    }
+
+    // Step 3 and the calculation of the positional extremes were already
+    // executed by this object.
+    if (this->FullCalculationWasPerformed)
+    {
+        return;
+    }
+
+    // Steps 1 and 2 are executed for fixed input values (and not for the
+    // last input values), such that cycles without a calculation and cycles
+    // of the fall-back strategy take at least as long as a calculation
+    // for typical input values. The instance must not stop after Step 1,
+    // because phase-synchronization is not possible.
+    InstanceFlags   =   Flags;
+
+    if (InstanceFlags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
+    {
+        InstanceFlags.SynchronizationBehavior   =   RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE;
+    }
+
+    SetUpPaddingInputValues(        this->NumberOfDOFs
+                                ,   InstanceFlags.SynchronizationBehavior
+                                ,   this->DeterministicTimingInstance->CurrentInputParameters   );
+
+    if (this->DeterministicTimingInstance->ComputeMinimumExecutionTime(     InstanceFlags
+                                                                        ,   &ExecutionTime
+                                                                        ,   NULL            ) >= 0)
+    {
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            (this->DeterministicTimingInstance->Polynomials)[i].ValidPolynomials = 0;
+        }
+
+        this->DeterministicTimingInstance->Step2();
+    }
+
+    return;
+}
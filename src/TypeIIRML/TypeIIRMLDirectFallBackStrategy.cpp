@@ -0,0 +1,397 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLDirectFallBackStrategy.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <TypeIIRMLDecisions.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLVector.h>
+#include <math.h>
+
+
+using namespace TypeIIRMLMath;
+
+
+//*******************************************************************************************
+// ComputeFallBackProfile()
+//
+// Computes the two-segment velocity profile of one degree of freedom, that
+// is, constant acceleration until the target velocity is reached and
+// constant velocity afterwards. The arithmetic operations equal the ones of
+// TypeIIRMLVelocity::ComputeTrajectoryParameters().
+
+static void ComputeFallBackProfile(     const double    &CurrentPosition
+                                    ,   const double    &CurrentVelocity
+                                    ,   const double    &MaxAcceleration
+                                    ,   const double    &TargetVelocity
+                                    ,   double          *AccelerationSign
+                                    ,   double          *TimeForFirstSegment
+                                    ,   double          *PositionAtTargetVelocity
+                                    ,   double          *VelocityAtTargetVelocity   )
+{
+    *AccelerationSign           =   (Decision_V___001(CurrentVelocity, TargetVelocity))?(1.0):(-1.0);
+
+    *TimeForFirstSegment        =   fabs(CurrentVelocity - TargetVelocity) / MaxAcceleration;
+
+    *PositionAtTargetVelocity   =       CurrentPosition
+                                    +   (       CurrentVelocity * *TimeForFirstSegment
+                                            +   *AccelerationSign * (0.5 * MaxAcceleration * pow2(*TimeForFirstSegment)));
+
+    *VelocityAtTargetVelocity   =   CurrentVelocity + *AccelerationSign * MaxAcceleration * *TimeForFirstSegment;
+}
+
+
+//*******************************************************************************************
+// SampleFallBackProfile()
+//
+// Samples a profile computed by ComputeFallBackProfile() at the time
+// TimeValueInSeconds (relative to the current state of motion). The
+// arithmetic operations equal the ones of
+// TypeIIRMLPolynomial::CalculateValue().
+
+static void SampleFallBackProfile(      const double    &CurrentPosition
+                                    ,   const double    &CurrentVelocity
+                                    ,   const double    &MaxAcceleration
+                                    ,   const double    &AccelerationSign
+                                    ,   const double    &TimeForFirstSegment
+                                    ,   const double    &PositionAtTargetVelocity
+                                    ,   const double    &VelocityAtTargetVelocity
+                                    ,   const double    &TimeValueInSeconds
+                                    ,   double          *Position
+                                    ,   double          *Velocity
+                                    ,   double          *Acceleration               )
+{
+    if (!(TimeValueInSeconds > TimeForFirstSegment))
+    {
+        *Position       =       AccelerationSign * (0.5 * MaxAcceleration) * TimeValueInSeconds * TimeValueInSeconds
+                            +   CurrentVelocity * TimeValueInSeconds
+                            +   CurrentPosition;
+        *Velocity       =   AccelerationSign * MaxAcceleration * TimeValueInSeconds + CurrentVelocity;
+        *Acceleration   =   AccelerationSign * MaxAcceleration;
+    }
+    else
+    {
+        if (VelocityAtTargetVelocity != 0.0)
+        {
+            *Position   =       VelocityAtTargetVelocity * (TimeValueInSeconds - TimeForFirstSegment)
+                            +   PositionAtTargetVelocity;
+        }
+        else
+        {
+            *Position   =   PositionAtTargetVelocity;
+        }
+        *Velocity       =   VelocityAtTargetVelocity;
+        *Acceleration   =   0.0;
+    }
+}
+
+
+//*******************************************************************************************
+// DirectFallBackStrategy()
+
+void TypeIIRMLPosition::DirectFallBackStrategy(     const RMLPositionInputParameters    &InputValues
+                                                ,   RMLPositionOutputParameters         *OutputValues
+                                                ,   const RMLPositionFlags              &InputsFlags    ) const
+{
+    bool                ErroneousInputValues        =   false;
+
+    unsigned int        i                           =   0
+                    ,   k                           =   0;
+
+    double              AccelerationSign            =   0.0
+                    ,   TimeForFirstSegment         =   0.0
+                    ,   PositionAtTargetVelocity    =   0.0
+                    ,   VelocityAtTargetVelocity    =   0.0
+                    ,   TimeOfZeroVelocity          =   0.0
+                    ,   AnalizedPosition            =   0.0
+                    ,   DummyValue                  =   0.0
+                    ,   SynchronizationTime         =   0.0;
+
+    const bool          *Selection                  =   InputValues.SelectionVector->VecData;
+
+    const double        *P                          =   InputValues.CurrentPositionVector->VecData
+                    ,   *V                          =   InputValues.CurrentVelocityVector->VecData
+                    ,   *A                          =   InputValues.CurrentAccelerationVector->VecData
+                    ,   *MaxA                       =   InputValues.MaxAccelerationVector->VecData
+                    ,   *TargetV                    =   NULL;
+
+    if (InputsFlags.KeepCurrentVelocityInCaseOfFallbackStrategy)
+    {
+        TargetV =   InputValues.CurrentVelocityVector->VecData;
+    }
+    else
+    {
+        TargetV =   InputValues.AlternativeTargetVelocityVector->VecData;
+    }
+
+    OutputValues->TrajectoryIsPhaseSynchronized     =   false;
+    OutputValues->ANewCalculationWasPerformed       =   true;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if ((Selection[i]) && (!(MaxA[i] > 0.0)))
+        {
+            ErroneousInputValues    =   true;
+        }
+    }
+
+    if (ErroneousInputValues)
+    {
+        // keep the current velocity (cf. TypeIIRMLVelocity::FallBackStrategy())
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            if (Selection[i])
+            {
+                (OutputValues->NewPositionVector->VecData)[i]       =   P[i] + this->CycleTime * V[i];
+                (OutputValues->NewVelocityVector->VecData)[i]       =   V[i];
+                (OutputValues->NewAccelerationVector->VecData)[i]   =   0.0;
+            }
+            else
+            {
+                (OutputValues->NewPositionVector->VecData)[i]       =   P[i];
+                (OutputValues->NewVelocityVector->VecData)[i]       =   V[i];
+                (OutputValues->NewAccelerationVector->VecData)[i]   =   A[i];
+            }
+        }
+
+        OutputValues->SynchronizationTime   =   0.0;
+
+        this->SetPositionalExtremsToZero(OutputValues);
+        return;
+    }
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (Selection[i])
+        {
+            ComputeFallBackProfile(     P[i]
+                                    ,   V[i]
+                                    ,   MaxA[i]
+                                    ,   TargetV[i]
+                                    ,   &AccelerationSign
+                                    ,   &TimeForFirstSegment
+                                    ,   &PositionAtTargetVelocity
+                                    ,   &VelocityAtTargetVelocity   );
+
+            SampleFallBackProfile(      P[i]
+                                    ,   V[i]
+                                    ,   MaxA[i]
+                                    ,   AccelerationSign
+                                    ,   TimeForFirstSegment
+                                    ,   PositionAtTargetVelocity
+                                    ,   VelocityAtTargetVelocity
+                                    ,   this->CycleTime
+                                    ,   &((OutputValues->NewPositionVector->VecData)[i])
+                                    ,   &((OutputValues->NewVelocityVector->VecData)[i])
+                                    ,   &((OutputValues->NewAccelerationVector->VecData)[i])    );
+
+            // cf. the execution times of TypeIIRMLVelocity::ComputeNextStateOfMotion()
+            // in a cycle, in which a new trajectory is calculated
+            TimeForFirstSegment =   TimeForFirstSegment - this->CycleTime + this->CycleTime;
+
+            if (TimeForFirstSegment > SynchronizationTime)
+            {
+                SynchronizationTime =   TimeForFirstSegment;
+            }
+        }
+        else
+        {
+            (OutputValues->NewPositionVector->VecData)[i]       =   P[i];
+            (OutputValues->NewVelocityVector->VecData)[i]       =   V[i];
+            (OutputValues->NewAccelerationVector->VecData)[i]   =   A[i];
+        }
+    }
+
+    OutputValues->SynchronizationTime   =   SynchronizationTime;
+
+    if (!InputsFlags.EnableTheCalculationOfTheExtremumMotionStates)
+    {
+        this->SetPositionalExtremsToZero(OutputValues);
+        return;
+    }
+
+    OutputValues->SetPosExtremaVectorArraysModified();
+
+    // Positional extremes, cf. TypeIIRMLVelocity::CalculatePositionalExtrems().
+    // The extreme values of each selected degree of freedom are either
+    // reached at the end of this cycle, at the instant of zero velocity
+    // within the first segment, or at the instant the target velocity is
+    // reached. As the velocity-based algorithm does not assign a time
+    // value to an extremum at the end of this cycle, such extremes are
+    // reported with a time value of zero instead of the cycle time;
+    // otherwise, the cycle time would remain in the output values of
+    // subsequent cycles, because TypeIIRMLPosition::CalculatePositionalExtrems()
+    // only overwrites the time values of the extremes it finds.
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (Selection[i])
+        {
+            (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i] =   (OutputValues->NewPositionVector->VecData)[i];
+            (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i] =   (OutputValues->NewPositionVector->VecData)[i];
+            (OutputValues->MinExtremaTimesVector->VecData)[i]           =   0.0;
+            (OutputValues->MaxExtremaTimesVector->VecData)[i]           =   0.0;
+
+            ComputeFallBackProfile(     P[i]
+                                    ,   V[i]
+                                    ,   MaxA[i]
+                                    ,   TargetV[i]
+                                    ,   &AccelerationSign
+                                    ,   &TimeForFirstSegment
+                                    ,   &PositionAtTargetVelocity
+                                    ,   &VelocityAtTargetVelocity   );
+
+            if (    (TimeForFirstSegment > 0.0)
+                &&  (Sign(V[i]) != Sign(VelocityAtTargetVelocity))  )
+            {
+                TimeOfZeroVelocity  =   -V[i] / (AccelerationSign * MaxA[i]);
+
+                if (TimeOfZeroVelocity > 0.0)
+                {
+                    SampleFallBackProfile(      P[i]
+                                            ,   V[i]
+                                            ,   MaxA[i]
+                                            ,   AccelerationSign
+                                            ,   TimeForFirstSegment
+                                            ,   PositionAtTargetVelocity
+                                            ,   VelocityAtTargetVelocity
+                                            ,   TimeOfZeroVelocity
+                                            ,   &AnalizedPosition
+                                            ,   &DummyValue
+                                            ,   &DummyValue                 );
+
+                    if (AnalizedPosition > (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i])
+                    {
+                        (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i] =   AnalizedPosition;
+                        (OutputValues->MaxExtremaTimesVector->VecData)[i]           =   TimeOfZeroVelocity;
+                    }
+                    if (AnalizedPosition < (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i])
+                    {
+                        (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i] =   AnalizedPosition;
+                        (OutputValues->MinExtremaTimesVector->VecData)[i]           =   TimeOfZeroVelocity;
+                    }
+                }
+            }
+
+            if (PositionAtTargetVelocity > (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i])
+            {
+                (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i] =   PositionAtTargetVelocity;
+                (OutputValues->MaxExtremaTimesVector->VecData)[i]           =   TimeForFirstSegment;
+            }
+            if (PositionAtTargetVelocity < (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i])
+            {
+                (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i] =   PositionAtTargetVelocity;
+                (OutputValues->MinExtremaTimesVector->VecData)[i]           =   TimeForFirstSegment;
+            }
+        }
+        else
+        {
+            (OutputValues->MinPosExtremaPositionVectorOnly->VecData)[i] =   P[i];
+            (OutputValues->MaxPosExtremaPositionVectorOnly->VecData)[i] =   P[i];
+            (OutputValues->MinExtremaTimesVector->VecData)[i]           =   0.0;
+            (OutputValues->MaxExtremaTimesVector->VecData)[i]           =   0.0;
+        }
+    }
+
+    // states of motion of all degrees of freedom at the instants of the
+    // extreme values
+
+    for (k = 0; k < this->NumberOfDOFs; k++)
+    {
+        if (Selection[k])
+        {
+            ComputeFallBackProfile(     P[k]
+                                    ,   V[k]
+                                    ,   MaxA[k]
+                                    ,   TargetV[k]
+                                    ,   &AccelerationSign
+                                    ,   &TimeForFirstSegment
+                                    ,   &PositionAtTargetVelocity
+                                    ,   &VelocityAtTargetVelocity   );
+        }
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            if ((Selection[i]) && (Selection[k]))
+            {
+                SampleFallBackProfile(      P[k]
+                                        ,   V[k]
+                                        ,   MaxA[k]
+                                        ,   AccelerationSign
+                                        ,   TimeForFirstSegment
+                                        ,   PositionAtTargetVelocity
+                                        ,   VelocityAtTargetVelocity
+                                        ,   (OutputValues->MinExtremaTimesVector->VecData)[i]
+                                        ,   &((((OutputValues->MinPosExtremaPositionVectorArray)[i])->VecData)[k])
+                                        ,   &((((OutputValues->MinPosExtremaVelocityVectorArray)[i])->VecData)[k])
+                                        ,   &((((OutputValues->MinPosExtremaAccelerationVectorArray)[i])->VecData)[k])  );
+
+                SampleFallBackProfile(      P[k]
+                                        ,   V[k]
+                                        ,   MaxA[k]
+                                        ,   AccelerationSign
+                                        ,   TimeForFirstSegment
+                                        ,   PositionAtTargetVelocity
+                                        ,   VelocityAtTargetVelocity
+                                        ,   (OutputValues->MaxExtremaTimesVector->VecData)[i]
+                                        ,   &((((OutputValues->MaxPosExtremaPositionVectorArray)[i])->VecData)[k])
+                                        ,   &((((OutputValues->MaxPosExtremaVelocityVectorArray)[i])->VecData)[k])
+                                        ,   &((((OutputValues->MaxPosExtremaAccelerationVectorArray)[i])->VecData)[k])  );
+            }
+            else
+            {
+                (((OutputValues->MinPosExtremaPositionVectorArray)[i])->VecData)[k]     =   P[k];
+                (((OutputValues->MinPosExtremaVelocityVectorArray)[i])->VecData)[k]     =   V[k];
+                (((OutputValues->MinPosExtremaAccelerationVectorArray)[i])->VecData)[k] =   A[k];
+
+                (((OutputValues->MaxPosExtremaPositionVectorArray)[i])->VecData)[k]     =   P[k];
+                (((OutputValues->MaxPosExtremaVelocityVectorArray)[i])->VecData)[k]     =   V[k];
+                (((OutputValues->MaxPosExtremaAccelerationVectorArray)[i])->VecData)[k] =   A[k];
+            }
+        }
+    }
+
+    return;
+}
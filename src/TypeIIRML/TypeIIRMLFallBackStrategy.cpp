@@ -60,6 +60,21 @@ void TypeIIRMLPosition::FallBackStrategy(       const RMLPositionInputParameters
 {
     unsigned int        i   =   0;
 
+    // The direct fall-back strategy works on the given input and output
+    // values without any intermediate copies. Phase-synchronized
+    // fall-back trajectories and input values with a different number of
+    // degrees of freedom are still handled by the velocity-based
+    // algorithm.
+    if (    (InputsFlags.SynchronizationBehavior    !=  RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
+        &&  (InputValues.GetNumberOfDOFs()          ==  this->NumberOfDOFs                  )
+        &&  (OutputValues->GetNumberOfDOFs()        ==  this->NumberOfDOFs                  )   )
+    {
+        this->DirectFallBackStrategy(       InputValues
+                                        ,   OutputValues
+                                        ,   InputsFlags     );
+        return;
+    }
+
     *(this->VelocityInputParameters->SelectionVector)
         =   *(InputValues.SelectionVector);
     *(this->VelocityInputParameters->CurrentPositionVector)
@@ -95,7 +110,8 @@ void TypeIIRMLPosition::FallBackStrategy(       const RMLPositionInputParameters
 
     this->RMLVelocityObject->GetNextStateOfMotion(      *(this->VelocityInputParameters)
                                                     ,   this->VelocityOutputParameters
-                                                    ,   this->VelocityFlags);
+                                                    ,   this->VelocityFlags
+                                                    ,   this->CycleTime                 );
 
     *(OutputValues->NewPositionVector)
         =   *(this->VelocityOutputParameters->NewPositionVector);
@@ -121,20 +137,32 @@ void TypeIIRMLPosition::FallBackStrategy(       const RMLPositionInputParameters
     *(OutputValues->MaxExtremaTimesVector)
         =   *(this->VelocityOutputParameters->MaxExtremaTimesVector);
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    // The arrays of the motion states at the positional extrema are not
+    // copied if they are zero in both objects (cf.
+    // RMLOutputParameters::PosExtremaVectorArraysAreZero).
+    if (this->VelocityOutputParameters->ArePosExtremaVectorArraysZero())
+    {
+        OutputValues->SetPosExtremaVectorArraysToZero();
+    }
+    else
     {
-        *((OutputValues->MinPosExtremaPositionVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MinPosExtremaPositionVectorArray)[i]);
-        *((OutputValues->MinPosExtremaVelocityVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MinPosExtremaVelocityVectorArray)[i]);
-        *((OutputValues->MinPosExtremaAccelerationVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MinPosExtremaAccelerationVectorArray)[i]);
-
-        *((OutputValues->MaxPosExtremaPositionVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MaxPosExtremaPositionVectorArray)[i]);
-        *((OutputValues->MaxPosExtremaVelocityVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MaxPosExtremaVelocityVectorArray)[i]);
-        *((OutputValues->MaxPosExtremaAccelerationVectorArray)[i])
-            =   *((this->VelocityOutputParameters->MaxPosExtremaAccelerationVectorArray)[i]);
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            *((OutputValues->MinPosExtremaPositionVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MinPosExtremaPositionVectorArray)[i]);
+            *((OutputValues->MinPosExtremaVelocityVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MinPosExtremaVelocityVectorArray)[i]);
+            *((OutputValues->MinPosExtremaAccelerationVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MinPosExtremaAccelerationVectorArray)[i]);
+
+            *((OutputValues->MaxPosExtremaPositionVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MaxPosExtremaPositionVectorArray)[i]);
+            *((OutputValues->MaxPosExtremaVelocityVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MaxPosExtremaVelocityVectorArray)[i]);
+            *((OutputValues->MaxPosExtremaAccelerationVectorArray)[i])
+                =   *((this->VelocityOutputParameters->MaxPosExtremaAccelerationVectorArray)[i]);
+        }
+
+        OutputValues->SetPosExtremaVectorArraysModified();
     }
 }
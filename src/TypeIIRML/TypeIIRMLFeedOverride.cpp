@@ -0,0 +1,236 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLFeedOverride.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <ReflexxesAPI.h>
+
+using namespace TypeIIRMLMath;
+
+
+//****************************************************************************
+// SetFeedOverride()
+
+int TypeIIRMLPosition::SetFeedOverride(const double &Factor)
+{
+    if (    (!(Factor   >=  0.0         ))
+        ||  (Factor     >   RML_INFINITY    )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    this->FeedOverride  =   Factor;
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// SetMaxFeedOverrideRate()
+
+int TypeIIRMLPosition::SetMaxFeedOverrideRate(const double &Rate)
+{
+    if (    (!(Rate >   0.0         ))
+        ||  (Rate   >   RML_INFINITY    )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    this->MaxFeedOverrideRate   =   Rate;
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// GetScaledKinematicLimits()
+
+void TypeIIRMLPosition::GetScaledKinematicLimits(       const RMLPositionInputParameters    &InputValues
+                                                    ,   RMLDoubleVector                     *MaxVelocityVector
+                                                    ,   RMLDoubleVector                     *MaxAccelerationVector
+                                                    ,   RMLDoubleVector                     *MaxJerkVector          ) const
+{
+    unsigned int                i           =   0;
+
+    double                      Factor      =   this->AppliedFeedOverride
+                            ,   Rate        =   fabs(this->FeedOverrideRate)    ;
+
+    for (i = 0; i < InputValues.GetNumberOfDOFs(); i++)
+    {
+        if (MaxVelocityVector != NULL)
+        {
+            (MaxVelocityVector->VecData)[i]     =   Factor * (InputValues.MaxVelocityVector->VecData)[i];
+        }
+
+        if (MaxAccelerationVector != NULL)
+        {
+            (MaxAccelerationVector->VecData)[i] =       Factor * Factor * (InputValues.MaxAccelerationVector->VecData)[i]
+                                                    +   Rate * (InputValues.MaxVelocityVector->VecData)[i];
+        }
+
+        if (MaxJerkVector != NULL)
+        {
+            (MaxJerkVector->VecData)[i]         =       Factor * Factor * Factor * (InputValues.MaxJerkVector->VecData)[i]
+                                                    +   3.0 * Factor * Rate * (InputValues.MaxAccelerationVector->VecData)[i];
+        }
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// AdvanceFeedOverride()
+
+double TypeIIRMLPosition::AdvanceFeedOverride(const double &ElapsedTimeInSeconds)
+{
+    double                      PreviousFactor  =   this->AppliedFeedOverride
+                            ,   Difference      =   this->FeedOverride - this->AppliedFeedOverride
+                            ,   TimeToTarget    =   0.0
+                            ,   TrajectoryTime  =   0.0                                             ;
+
+    if (Difference == 0.0)
+    {
+        this->FeedOverrideRate  =   0.0;
+        return(this->AppliedFeedOverride * ElapsedTimeInSeconds);
+    }
+
+    TimeToTarget    =   fabs(Difference) / this->MaxFeedOverrideRate;
+
+    if (TimeToTarget <= ElapsedTimeInSeconds)
+    {
+        // The desired factor is reached within this cycle.
+        TrajectoryTime              =       0.5 * (PreviousFactor + this->FeedOverride) * TimeToTarget
+                                        +   this->FeedOverride * (ElapsedTimeInSeconds - TimeToTarget);
+
+        this->AppliedFeedOverride   =   this->FeedOverride  ;
+        this->FeedOverrideRate      =   0.0                 ;
+    }
+    else
+    {
+        this->FeedOverrideRate      =   (Difference > 0.0)?(this->MaxFeedOverrideRate):(-this->MaxFeedOverrideRate);
+        this->AppliedFeedOverride   =   PreviousFactor + this->FeedOverrideRate * ElapsedTimeInSeconds;
+
+        TrajectoryTime              =   0.5 * (PreviousFactor + this->AppliedFeedOverride) * ElapsedTimeInSeconds;
+    }
+
+    return(TrajectoryTime);
+}
+
+
+//****************************************************************************
+// TransformInputValuesToTrajectoryTime()
+
+void TypeIIRMLPosition::TransformInputValuesToTrajectoryTime(       const double    &Factor
+                                                                ,   const double    &Rate   )
+{
+    unsigned int                i                   =   0;
+
+    double                      Velocity            =   0.0
+                            ,   Acceleration        =   0.0 ;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (!(this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            continue;
+        }
+
+        Velocity        =   (this->OutputParameters->NewVelocityVector->VecData)[i];
+        Acceleration    =   (this->OutputParameters->NewAccelerationVector->VecData)[i];
+
+        if (    (IsInputEpsilonEqual(       (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                                        ,   Factor * Velocity                                                   ))
+            &&  (IsInputEpsilonEqual(       (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i]
+                                        ,   Factor * Factor * Acceleration + Rate * Velocity                    ))  )
+        {
+            // The output values of the last cycle were fed back.
+            (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]       =   Velocity        ;
+            (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i]   =   Acceleration    ;
+        }
+        else
+        {
+            if (Factor > 0.0)
+            {
+                Velocity        =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i] / Factor;
+                Acceleration    =       ((this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i]
+                                    -   Rate * Velocity) / (Factor * Factor);
+
+                (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]       =   Velocity        ;
+                (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i]   =   Acceleration    ;
+            }
+        }
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// TransformOutputValuesToRealTime()
+
+void TypeIIRMLPosition::TransformOutputValuesToRealTime(RMLPositionOutputParameters *OP) const
+{
+    unsigned int                i                   =   0;
+
+    double                      Factor              =   this->AppliedFeedOverride
+                            ,   Rate                =   this->FeedOverrideRate
+                            ,   Velocity            =   0.0                         ;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            Velocity                                =   (OP->NewVelocityVector->VecData)[i];
+
+            (OP->NewVelocityVector->VecData)[i]     =   Factor * Velocity;
+            (OP->NewAccelerationVector->VecData)[i] =       Factor * Factor * (OP->NewAccelerationVector->VecData)[i]
+                                                        +   Rate * Velocity;
+        }
+    }
+
+    return;
+}
@@ -0,0 +1,309 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLGetMinimumExecutionTime.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLPosition.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLPositionCandidates.h>
+#include <TypeIIRMLMath.h>
+#include <ReflexxesAPI.h>
+#include <RMLValidityMask.h>
+
+#include <math.h>
+
+
+//****************************************************************************
+// defines
+
+// Failure reasons of RMLPositionInputParameters::CheckForValidity(), for
+// which TypeIIRMLPosition::GetNextStateOfMotion() does not execute Step 1
+#define RML_INVALID_MOTION_CONSTRAINTS  (       RMLValidityMask::MAX_VELOCITY_NOT_POSITIVE              \
+                                            |   RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE          \
+                                            |   RMLValidityMask::TARGET_VELOCITY_EXCEEDS_MAX_VELOCITY   )
+
+
+//****************************************************************************
+// GetMinimumExecutionTime()
+
+int TypeIIRMLPosition::GetMinimumExecutionTime(     const RMLPositionInputParameters    &InputValues
+                                                ,   const RMLPositionFlags              &Flags
+                                                ,   double                              *ExecutionTime
+                                                ,   bool                                *IsPhaseSynchronized)
+{
+    if (ExecutionTime == NULL)
+    {
+        return(ReflexxesAPI::RML_ERROR_NULL_POINTER);
+    }
+
+    *ExecutionTime  =   0.0;
+
+    if (IsPhaseSynchronized != NULL)
+    {
+        *IsPhaseSynchronized    =   false;
+    }
+
+    if (this->NumberOfDOFs != InputValues.GetNumberOfDOFs())
+    {
+        return(ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS);
+    }
+
+    // The internal state of Step 1 is shared with GetNextStateOfMotion(),
+    // such that the trajectory computed before becomes invalid, and the
+    // next call of GetNextStateOfMotion() starts a new calculation.
+    this->ReturnValue               =   ReflexxesAPI::RML_ERROR;
+
+    *(this->CurrentInputParameters) =   InputValues;
+
+    // The input values are classified in the same way as by
+    // GetNextStateOfMotion(): invalid kinematic motion constraints and
+    // target velocities are rejected before Step 1, and the remaining
+    // requirements of RMLPositionInputParameters::CheckForValidity() only
+    // specify the error code, if Step 1 fails
+    // (cf. TypeIIRMLPosition::ComputeMinimumExecutionTime()).
+    if ((this->CurrentInputParameters->CheckForValidity((RMLValidityMask *)NULL) & RML_INVALID_MOTION_CONSTRAINTS) != 0)
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    return(this->ComputeMinimumExecutionTime(       Flags
+                                                ,   ExecutionTime
+                                                ,   IsPhaseSynchronized ));
+}
+
+
+//****************************************************************************
+// GetMinimumExecutionTimes()
+
+int TypeIIRMLPosition::GetMinimumExecutionTimes(        const RMLPositionInputParameters    &InputValues
+                                                    ,   const RMLPositionFlags              &Flags
+                                                    ,   const RMLPositionCandidateTargets   &Candidates
+                                                    ,   RMLPositionCandidateResults         *Results)
+{
+    bool                        PhaseSync                       =   false;
+
+    int                         CandidateResult                 =   ReflexxesAPI::RML_ERROR
+                            ,   Result                          =   ReflexxesAPI::RML_ERROR;
+
+    unsigned int                i                               =   0
+                            ,   k                               =   0;
+
+    double                      CandidateTime                   =   0.0
+                            ,   FastestTime                     =   RML_INFINITY;
+
+    if  (   (Results                    ==  NULL)
+        ||  (Results->ExecutionTimes    ==  NULL)
+        ||  (   (Candidates.TargetPosition      ==  NULL)
+            &&  (Candidates.NumberOfCandidates  >   0   )   )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_NULL_POINTER);
+    }
+
+    Results->IndexOfFastestCandidate    =   Candidates.NumberOfCandidates;
+
+    for (k = 0; k < Candidates.NumberOfCandidates; k++)
+    {
+        (Results->ExecutionTimes)[k]    =   RML_INFINITY;
+
+        if (Results->ResultValues != NULL)
+        {
+            (Results->ResultValues)[k]  =   ReflexxesAPI::RML_ERROR;
+        }
+        if (Results->IsPhaseSynchronized != NULL)
+        {
+            (Results->IsPhaseSynchronized)[k]   =   false;
+        }
+    }
+
+    if (this->NumberOfDOFs != InputValues.GetNumberOfDOFs())
+    {
+        return(ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS);
+    }
+
+    this->ReturnValue               =   ReflexxesAPI::RML_ERROR;
+
+    *(this->CurrentInputParameters) =   InputValues;
+
+    // The kinematic limits and the selection vector are the same for all
+    // candidates, such that they are checked only once.
+    if (    (this->CurrentInputParameters->CheckForValidity((RMLValidityMask *)NULL)
+            &   (RMLValidityMask::MAX_VELOCITY_NOT_POSITIVE | RMLValidityMask::MAX_ACCELERATION_NOT_POSITIVE))
+            !=  0   )
+    {
+        for (k = 0; k < Candidates.NumberOfCandidates; k++)
+        {
+            if (Results->ResultValues != NULL)
+            {
+                (Results->ResultValues)[k]  =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
+            }
+        }
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    for (k = 0; k < Candidates.NumberOfCandidates; k++)
+    {
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                =   (Candidates.TargetPosition)[i * Candidates.NumberOfCandidates + k];
+
+            if (Candidates.TargetVelocity != NULL)
+            {
+                (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
+                    =   (Candidates.TargetVelocity)[i * Candidates.NumberOfCandidates + k];
+            }
+        }
+
+        if ((this->CurrentInputParameters->CheckForValidity((RMLValidityMask *)NULL) & RML_INVALID_MOTION_CONSTRAINTS) == 0)
+        {
+            CandidateResult =   this->ComputeMinimumExecutionTime(      Flags
+                                                                    ,   &CandidateTime
+                                                                    ,   &PhaseSync      );
+        }
+        else
+        {
+            CandidateResult =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
+        }
+
+        if (Results->ResultValues != NULL)
+        {
+            (Results->ResultValues)[k]  =   CandidateResult;
+        }
+
+        if (CandidateResult >= 0)
+        {
+            (Results->ExecutionTimes)[k]    =   CandidateTime;
+
+            if (Results->IsPhaseSynchronized != NULL)
+            {
+                (Results->IsPhaseSynchronized)[k]   =   PhaseSync;
+            }
+
+            if (CandidateTime < FastestTime)
+            {
+                FastestTime                         =   CandidateTime;
+                Results->IndexOfFastestCandidate    =   k;
+                Result                              =   CandidateResult;
+            }
+        }
+        else
+        {
+            if (k == 0)
+            {
+                Result  =   CandidateResult;
+            }
+        }
+    }
+
+    return(Result);
+}
+
+
+//****************************************************************************
+// ComputeMinimumExecutionTime()
+
+int TypeIIRMLPosition::ComputeMinimumExecutionTime(     const RMLPositionFlags  &Flags
+                                                    ,   double                  *ExecutionTime
+                                                    ,   bool                    *IsPhaseSynchronized)
+{
+    this->UseStep1Cache                         =   !(Flags.EnableDeterministicTiming);
+
+    this->CompareInitialAndTargetStateofMotion();
+
+    this->CurrentTrajectoryIsPhaseSynchronized  =       ((  Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION           )
+                                                    ||  (   Flags.SynchronizationBehavior == RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE    ));
+
+    this->CurrentTrajectoryIsNotSynchronized    =       (   Flags.SynchronizationBehavior == RMLFlags::NO_SYNCHRONIZATION                   );
+
+    Step1();
+
+    // As in GetNextStateOfMotion(), the error code depends on the validity
+    // of the input values.
+    if (    (Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
+        &&  (!(this->CurrentTrajectoryIsPhaseSynchronized)) )
+    {
+        if (this->CurrentInputParameters->CheckForValidity((RMLValidityMask *)NULL) == 0)
+        {
+            return(ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION);
+        }
+        else
+        {
+            return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+        }
+    }
+
+    if ( this->SynchronizationTime > RML_MAX_EXECUTION_TIME)
+    {
+        if (this->CurrentInputParameters->CheckForValidity((RMLValidityMask *)NULL) == 0)
+        {
+            return(ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG);
+        }
+        else
+        {
+            return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+        }
+    }
+
+    this->ApplyMinimumSynchronizationTime(Flags);
+
+    if (this->NumberOfModifiedDOFs == 0)
+    {
+        this->SynchronizationTime                   =   0.0;
+        this->CurrentTrajectoryIsPhaseSynchronized  =   (Flags.SynchronizationBehavior != RMLFlags::ONLY_TIME_SYNCHRONIZATION);
+    }
+
+    *ExecutionTime  =   this->SynchronizationTime;
+
+    if (IsPhaseSynchronized != NULL)
+    {
+        *IsPhaseSynchronized    =   this->CurrentTrajectoryIsPhaseSynchronized;
+    }
+
+    if (this->SynchronizationTime > 0.0)
+    {
+        return(ReflexxesAPI::RML_WORKING);
+    }
+    else
+    {
+        return(ReflexxesAPI::RML_FINAL_STATE_REACHED);
+    }
+}
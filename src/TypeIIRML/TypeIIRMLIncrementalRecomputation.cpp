@@ -0,0 +1,165 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLIncrementalRecomputation.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <TypeIIRMLStep2WithoutSynchronization.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionFlags.h>
+#include <ReflexxesAPI.h>
+
+using namespace TypeIIRMLMath;
+
+
+//****************************************************************************
+// IsIncrementalRecomputationPossible()
+
+bool TypeIIRMLPosition::IsIncrementalRecomputationPossible(const RMLPositionFlags &Flags) const
+{
+    return(     (Flags.SynchronizationBehavior  ==  RMLFlags::NO_SYNCHRONIZATION)
+            &&  (this->CurrentTrajectoryIsNotSynchronized                       )
+            &&  (!(Flags.EnableDeterministicTiming)                             )
+            &&  (Flags.NumberOfRecomputationCycles  <=  1                       )
+            &&  (Flags                          ==  this->OldFlags              )
+            &&  (   (this->ReturnValue  ==  ReflexxesAPI::RML_WORKING               )
+                ||  (this->ReturnValue  ==  ReflexxesAPI::RML_FINAL_STATE_REACHED   )   )   );
+}
+
+
+//****************************************************************************
+// RecomputeChangedDOFs()
+
+void TypeIIRMLPosition::RecomputeChangedDOFs(void)
+{
+    unsigned int                i                               =   0
+                            ,   j                               =   0;
+
+    double                      TimeShift                       =   this->InternalClockInSeconds
+                            ,   MaximalMinimalExecutionTime     =   0.0;
+
+    this->CompareInitialAndTargetStateofMotion();
+
+    if (this->NumberOfSelectedDOFs > 0)
+    {
+        this->GreatestDOFForPhaseSynchronization    =   (this->SelectedDOFs->VecData)[0];
+    }
+    else
+    {
+        this->GreatestDOFForPhaseSynchronization    =   0;
+    }
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (!(this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            (this->ModifiedSelectionVector->VecData)[i] =   false;
+            continue;
+        }
+
+        if (    ((this->MinimumExecutionTimes->VecData)[i]  <=  TimeShift   )
+            ||  (!(this->ModifiedSelectionVector->VecData)[i]               )   )
+        {
+            // The trajectory of this degree of freedom has ended, and the
+            // current state of motion may differ from the target state of
+            // motion (e.g., in case of a non-zero target velocity). A
+            // complete calculation would start a new trajectory from here.
+            (this->ChangedDOFsVector->VecData)[i]   =   true;
+        }
+
+        if ((this->ChangedDOFsVector->VecData)[i])
+        {
+            (this->StoredTargetPosition->VecData)[i]    =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i];
+
+            this->Step1MinimumExecutionTimes(       i
+                                                ,   i + 1   );
+
+            this->SetupModifiedSelectionVector(     i
+                                                ,   i + 1   );
+
+            (this->Polynomials)[i].ValidPolynomials = 0;
+
+            if ((this->ModifiedSelectionVector->VecData)[i])
+            {
+                Step2WithoutSynchronization(        (this->CurrentInputParameters->CurrentPositionVector->VecData)      [i]
+                                                ,   (this->CurrentInputParameters->CurrentVelocityVector->VecData)      [i]
+                                                ,   (this->CurrentInputParameters->TargetPositionVector->VecData)       [i]
+                                                ,   (this->CurrentInputParameters->TargetVelocityVector->VecData)       [i]
+                                                ,   (this->CurrentInputParameters->MaxVelocityVector->VecData)          [i]
+                                                ,   (this->CurrentInputParameters->MaxAccelerationVector->VecData)      [i]
+                                                ,   (this->UsedStep1AProfiles->VecData)                                 [i]
+                                                ,   (this->MinimumExecutionTimes->VecData)                              [i]
+                                                ,   &((this->Polynomials)[i])   );
+            }
+        }
+        else
+        {
+            // The trajectory of this degree of freedom is kept, and the
+            // current state of motion becomes the time origin as for the
+            // recalculated ones.
+            (this->MinimumExecutionTimes->VecData)[i]   -=  TimeShift;
+
+            for (j = 0; j < (unsigned int)((this->Polynomials)[i].ValidPolynomials); j++)
+            {
+                (this->Polynomials)[i].PolynomialTimes[j]               -=  TimeShift;
+                (this->Polynomials)[i].PositionPolynomial[j].DeltaT     -=  TimeShift;
+                (this->Polynomials)[i].VelocityPolynomial[j].DeltaT     -=  TimeShift;
+                (this->Polynomials)[i].AccelerationPolynomial[j].DeltaT -=  TimeShift;
+            }
+        }
+
+        if ((this->MinimumExecutionTimes->VecData)[i] > MaximalMinimalExecutionTime)
+        {
+            MaximalMinimalExecutionTime                 =   (this->MinimumExecutionTimes->VecData)[i];
+            this->GreatestDOFForPhaseSynchronization    =   i;
+        }
+    }
+
+    this->SetupModifiedDOFs();
+
+    this->SynchronizationTime       =   MaximalMinimalExecutionTime;
+
+    this->InternalClockInSeconds    =   this->CycleTime;
+
+    return;
+}
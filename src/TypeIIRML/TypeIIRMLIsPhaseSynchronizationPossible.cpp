@@ -58,7 +58,8 @@ bool TypeIIRMLPosition::IsPhaseSynchronizationPossible(RMLDoubleVector* Referenc
     bool                    Result                          =   true
                         ,   SignSwitch                      =   false;
 
-    unsigned int            i                               =   0;
+    unsigned int            i                               =   0
+                        ,   k                               =   0;
 
     double                  LengthOfDirectionVector         =   0.0
                         ,   LengthOfCurrentVelocityVector   =   0.0
@@ -66,28 +67,27 @@ bool TypeIIRMLPosition::IsPhaseSynchronizationPossible(RMLDoubleVector* Referenc
                         ,   LengthOfReferenceVector         =   0.0;
 
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    // The elements of all degrees of freedom that are not selected by
+    // TypeIIRMLPosition::ModifiedSelectionVector remain zero.
+    this->PhaseSynchronizationPositionDifferenceVector->Set(0.0);
+    this->PhaseSynchronizationCurrentVelocityVector->Set(0.0);
+    this->PhaseSynchronizationTargetVelocityVector->Set(0.0);
+
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if ((this->ModifiedSelectionVector->VecData)[i])
-        {
-            (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]
-                =       (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
-                     -  (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
-            (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
-            (this->PhaseSynchronizationTargetVelocityVector->VecData)[i]
-                =   (this->CurrentInputParameters->TargetVelocityVector->VecData)[i];
-
-            LengthOfDirectionVector         += pow2((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]);
-            LengthOfCurrentVelocityVector   += pow2((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]);
-            LengthOfTargetVelocityVector    += pow2((this->PhaseSynchronizationTargetVelocityVector->VecData)[i]);
-        }
-        else
-        {
-            (this->PhaseSynchronizationPositionDifferenceVector->VecData)   [i]     =   0.0;
-            (this->PhaseSynchronizationCurrentVelocityVector->VecData)      [i]     =   0.0;
-            (this->PhaseSynchronizationTargetVelocityVector->VecData)       [i]     =   0.0;
-        }
+        i   =   (this->ModifiedDOFs->VecData)[k];
+
+        (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]
+            =       (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                 -  (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
+        (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
+        (this->PhaseSynchronizationTargetVelocityVector->VecData)[i]
+            =   (this->CurrentInputParameters->TargetVelocityVector->VecData)[i];
+
+        LengthOfDirectionVector         += pow2((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]);
+        LengthOfCurrentVelocityVector   += pow2((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]);
+        LengthOfTargetVelocityVector    += pow2((this->PhaseSynchronizationTargetVelocityVector->VecData)[i]);
     }
 
     LengthOfDirectionVector         =   RMLSqrt(LengthOfDirectionVector);
@@ -97,64 +97,58 @@ bool TypeIIRMLPosition::IsPhaseSynchronizationPossible(RMLDoubleVector* Referenc
 
     if ( (LengthOfDirectionVector != POSITIVE_ZERO) && (LengthOfDirectionVector != 0.0) )
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i] /= LengthOfDirectionVector;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i] /= LengthOfDirectionVector;
         }
     }
     else
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i] = 0.0;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i] = 0.0;
         }
     }
 
     if ( (LengthOfCurrentVelocityVector != POSITIVE_ZERO) && (LengthOfCurrentVelocityVector != 0.0) )
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i] /= LengthOfCurrentVelocityVector;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i] /= LengthOfCurrentVelocityVector;
         }
     }
     else
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i] = 0.0;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i] = 0.0;
         }
     }
 
     if ( (LengthOfTargetVelocityVector != POSITIVE_ZERO) && (LengthOfTargetVelocityVector != 0.0) )
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationTargetVelocityVector->VecData)[i] /= LengthOfTargetVelocityVector;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationTargetVelocityVector->VecData)[i] /= LengthOfTargetVelocityVector;
         }
     }
     else
     {
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationTargetVelocityVector->VecData)[i] = 0.0;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            (this->PhaseSynchronizationTargetVelocityVector->VecData)[i] = 0.0;
         }
     }
 
@@ -195,110 +189,103 @@ bool TypeIIRMLPosition::IsPhaseSynchronizationPossible(RMLDoubleVector* Referenc
 
         SignSwitch = true;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            if ((Sign((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
+                        == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
+                && (fabs((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
+                        > ABSOLUTE_PHASE_SYNC_EPSILON))
             {
-                if ((Sign((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
-                            == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
-                    && (fabs((this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
-                            > ABSOLUTE_PHASE_SYNC_EPSILON))
-                {
-                    SignSwitch = false;
-                    break;
-                }
+                SignSwitch = false;
+                break;
             }
         }
 
         if (SignSwitch)
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if ((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]
-                        =   -(this->PhaseSynchronizationPositionDifferenceVector->VecData)[i];
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i]
+                    =   -(this->PhaseSynchronizationPositionDifferenceVector->VecData)[i];
             }
         }
 
         SignSwitch = true;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            if ((Sign((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
+                        == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
+                && (fabs((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
+                        > ABSOLUTE_PHASE_SYNC_EPSILON))
             {
-                if ((Sign((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
-                            == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
-                    && (fabs((this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
-                            > ABSOLUTE_PHASE_SYNC_EPSILON))
-                {
-                    SignSwitch = false;
-                    break;
-                }
+                SignSwitch = false;
+                break;
             }
         }
 
         if (SignSwitch)
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if ((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]
-                        =   -(this->PhaseSynchronizationCurrentVelocityVector->VecData)[i];
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i]
+                    =   -(this->PhaseSynchronizationCurrentVelocityVector->VecData)[i];
             }
         }
 
         SignSwitch = true;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            if ((Sign((this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
+                        == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
+                && (fabs((this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
+                        > ABSOLUTE_PHASE_SYNC_EPSILON))
             {
-                if ((Sign((this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
-                            == Sign((this->PhaseSynchronizationCheckVector->VecData)[i]))
-                    && (fabs((this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
-                            > ABSOLUTE_PHASE_SYNC_EPSILON))
-                {
-                    SignSwitch = false;
-                    break;
-                }
+                SignSwitch = false;
+                break;
             }
         }
 
         if (SignSwitch)
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if ((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    (this->PhaseSynchronizationTargetVelocityVector->VecData)[i]
-                        =   -(this->PhaseSynchronizationTargetVelocityVector->VecData)[i];
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                (this->PhaseSynchronizationTargetVelocityVector->VecData)[i]
+                    =   -(this->PhaseSynchronizationTargetVelocityVector->VecData)[i];
             }
         }
 
         // Check for collinearity
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ( (this->ModifiedSelectionVector->VecData)[i] )
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            if (    ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
+                        > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
+                    &&  (   LengthOfDirectionVector     >=  ABSOLUTE_PHASE_SYNC_EPSILON         ))
+                ||  ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
+                        > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
+                    &&  (   LengthOfCurrentVelocityVector   >=  ABSOLUTE_PHASE_SYNC_EPSILON     ))
+                ||  ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
+                        > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
+                    &&  (   LengthOfTargetVelocityVector    >=  ABSOLUTE_PHASE_SYNC_EPSILON     )))
             {
-                if (    ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationPositionDifferenceVector->VecData)[i])
-                            > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
-                        &&  (   LengthOfDirectionVector     >=  ABSOLUTE_PHASE_SYNC_EPSILON         ))
-                    ||  ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationCurrentVelocityVector->VecData)[i])
-                            > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
-                        &&  (   LengthOfCurrentVelocityVector   >=  ABSOLUTE_PHASE_SYNC_EPSILON     ))
-                    ||  ((fabs((this->PhaseSynchronizationCheckVector->VecData)[i] - (this->PhaseSynchronizationTargetVelocityVector->VecData)[i])
-                            > (PHASE_SYNC_COLLINEARITY_REL_EPSILON * fabs((this->PhaseSynchronizationCheckVector->VecData)[i]) ) )
-                        &&  (   LengthOfTargetVelocityVector    >=  ABSOLUTE_PHASE_SYNC_EPSILON     )))
-                {
-                    Result  =   false;
-                    break;
-                }
+                Result  =   false;
+                break;
             }
         }
     }
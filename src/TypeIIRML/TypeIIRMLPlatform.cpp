@@ -0,0 +1,842 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLPlatform.cpp
+//!
+//! \brief
+//! Implementation file for operating-system-dependent helper functions
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPlatform.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLPlatform.h>
+
+#if defined(WIN32) || defined(_WIN32)
+#include <windows.h>
+#else
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <pthread.h>
+#if defined(__MACOS__)
+#include <mach/mach_time.h>
+#endif
+#endif
+
+
+//****************************************************************************
+// InitializeMappedFile()
+
+void TypeIIRMLPlatform::InitializeMappedFile(MappedFile *File)
+{
+    File->Data              =   NULL    ;
+    File->Size              =   0       ;
+    File->Writable          =   false   ;
+    File->FileDescriptor    =   -1      ;
+    File->FileHandle        =   NULL    ;
+    File->MappingHandle     =   NULL    ;
+
+    return;
+}
+
+
+//****************************************************************************
+// MapFile()
+
+bool TypeIIRMLPlatform::MapFile(        const char      *FileName
+                                    ,   const size_t    &Size
+                                    ,   const bool      &Writable
+                                    ,   MappedFile      *File)
+{
+    if ((FileName == NULL) || (File == NULL))
+    {
+        return(false);
+    }
+
+    InitializeMappedFile(File);
+
+    File->Writable  =   Writable;
+
+#if defined(WIN32) || defined(_WIN32)
+
+    LARGE_INTEGER       FileSize;
+
+    File->FileHandle    =   (void*)CreateFileA(     FileName
+                                                ,   (Writable)?(GENERIC_READ | GENERIC_WRITE):(GENERIC_READ)
+                                                ,   FILE_SHARE_READ | FILE_SHARE_WRITE
+                                                ,   NULL
+                                                ,   (Writable)?(CREATE_ALWAYS):(OPEN_EXISTING)
+                                                ,   FILE_ATTRIBUTE_NORMAL
+                                                ,   NULL                                                );
+
+    if ((HANDLE)File->FileHandle == INVALID_HANDLE_VALUE)
+    {
+        File->FileHandle    =   NULL;
+        return(false);
+    }
+
+    if (Writable)
+    {
+        FileSize.QuadPart   =   (LONGLONG)Size;
+    }
+    else
+    {
+        if (!GetFileSizeEx((HANDLE)File->FileHandle, &FileSize))
+        {
+            UnmapFile(File);
+            return(false);
+        }
+    }
+
+    if (FileSize.QuadPart == 0)
+    {
+        UnmapFile(File);
+        return(false);
+    }
+
+    File->MappingHandle =   (void*)CreateFileMappingA(      (HANDLE)File->FileHandle
+                                                        ,   NULL
+                                                        ,   (Writable)?(PAGE_READWRITE):(PAGE_READONLY)
+                                                        ,   (DWORD)(FileSize.QuadPart >> 32)
+                                                        ,   (DWORD)(FileSize.QuadPart & 0xFFFFFFFF)
+                                                        ,   NULL                                        );
+
+    if (File->MappingHandle == NULL)
+    {
+        UnmapFile(File);
+        return(false);
+    }
+
+    File->Data  =   MapViewOfFile(      (HANDLE)File->MappingHandle
+                                    ,   (Writable)?(FILE_MAP_WRITE):(FILE_MAP_READ)
+                                    ,   0
+                                    ,   0
+                                    ,   (SIZE_T)FileSize.QuadPart               );
+
+    if (File->Data == NULL)
+    {
+        UnmapFile(File);
+        return(false);
+    }
+
+    File->Size  =   (size_t)FileSize.QuadPart;
+
+#else
+
+    struct stat         FileStatus;
+
+    File->FileDescriptor    =   open(       FileName
+                                        ,   (Writable)?(O_RDWR | O_CREAT | O_TRUNC):(O_RDONLY)
+                                        ,   0644                                                );
+
+    if (File->FileDescriptor < 0)
+    {
+        return(false);
+    }
+
+    if (Writable)
+    {
+        if (ftruncate(File->FileDescriptor, (off_t)Size) != 0)
+        {
+            UnmapFile(File);
+            return(false);
+        }
+        File->Size  =   Size;
+    }
+    else
+    {
+        if (fstat(File->FileDescriptor, &FileStatus) != 0)
+        {
+            UnmapFile(File);
+            return(false);
+        }
+        File->Size  =   (size_t)FileStatus.st_size;
+    }
+
+    if (File->Size == 0)
+    {
+        UnmapFile(File);
+        return(false);
+    }
+
+    File->Data  =   mmap(       NULL
+                            ,   File->Size
+                            ,   (Writable)?(PROT_READ | PROT_WRITE):(PROT_READ)
+                            ,   MAP_SHARED
+                            ,   File->FileDescriptor
+                            ,   0                                               );
+
+    if (File->Data == MAP_FAILED)
+    {
+        File->Data  =   NULL;
+        UnmapFile(File);
+        return(false);
+    }
+
+#endif
+
+    return(true);
+}
+
+
+//****************************************************************************
+// FlushMappedFile()
+
+bool TypeIIRMLPlatform::FlushMappedFile(        const MappedFile    &File
+                                            ,   const bool          &Synchronous)
+{
+    if ((File.Data == NULL) || (!File.Writable))
+    {
+        return(false);
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+
+    if (!FlushViewOfFile(File.Data, File.Size))
+    {
+        return(false);
+    }
+
+    if (Synchronous)
+    {
+        return(FlushFileBuffers((HANDLE)File.FileHandle) != 0);
+    }
+
+    return(true);
+
+#else
+
+    return(msync(File.Data, File.Size, (Synchronous)?(MS_SYNC):(MS_ASYNC)) == 0);
+
+#endif
+}
+
+
+//****************************************************************************
+// UnmapFile()
+
+void TypeIIRMLPlatform::UnmapFile(MappedFile *File)
+{
+    if (File == NULL)
+    {
+        return;
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+
+    if (File->Data != NULL)
+    {
+        UnmapViewOfFile(File->Data);
+    }
+
+    if (File->MappingHandle != NULL)
+    {
+        CloseHandle((HANDLE)File->MappingHandle);
+    }
+
+    if (File->FileHandle != NULL)
+    {
+        CloseHandle((HANDLE)File->FileHandle);
+    }
+
+#else
+
+    if (File->Data != NULL)
+    {
+        munmap(File->Data, File->Size);
+    }
+
+    if (File->FileDescriptor >= 0)
+    {
+        close(File->FileDescriptor);
+    }
+
+#endif
+
+    InitializeMappedFile(File);
+
+    return;
+}
+
+
+//****************************************************************************
+// RenameFile()
+
+bool TypeIIRMLPlatform::RenameFile(     const char      *OldFileName
+                                    ,   const char      *NewFileName)
+{
+    if ((OldFileName == NULL) || (NewFileName == NULL))
+    {
+        return(false);
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+
+    return(MoveFileExA(     OldFileName
+                        ,   NewFileName
+                        ,   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH  ) != 0);
+
+#else
+
+    return(rename(OldFileName, NewFileName) == 0);
+
+#endif
+}
+
+
+//****************************************************************************
+// AtomicFetchAndAdd()
+
+unsigned long long TypeIIRMLPlatform::AtomicFetchAndAdd(        volatile unsigned long long     *Value
+                                                            ,   const unsigned long long        &Increment)
+{
+#if defined(WIN32) || defined(_WIN32)
+    return((unsigned long long)InterlockedExchangeAdd64(       (volatile LONGLONG*)Value
+                                                            ,   (LONGLONG)Increment         ));
+#else
+    return(__sync_fetch_and_add(Value, Increment));
+#endif
+}
+
+
+//****************************************************************************
+// AtomicCompareAndSwap()
+
+bool TypeIIRMLPlatform::AtomicCompareAndSwap(       volatile unsigned long long     *Value
+                                                ,   const unsigned long long        &ExpectedValue
+                                                ,   const unsigned long long        &NewValue       )
+{
+#if defined(WIN32) || defined(_WIN32)
+    return((unsigned long long)InterlockedCompareExchange64(       (volatile LONGLONG*)Value
+                                                                ,   (LONGLONG)NewValue
+                                                                ,   (LONGLONG)ExpectedValue     ) == ExpectedValue);
+#else
+    return(__sync_bool_compare_and_swap(Value, ExpectedValue, NewValue));
+#endif
+}
+
+
+//****************************************************************************
+// FullMemoryBarrier()
+
+void TypeIIRMLPlatform::FullMemoryBarrier(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+
+    return;
+}
+
+
+//****************************************************************************
+// GetMonotonicTimeInSeconds()
+
+double TypeIIRMLPlatform::GetMonotonicTimeInSeconds(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+
+    LARGE_INTEGER       Counter
+                    ,   Frequency;
+
+    QueryPerformanceCounter     (&Counter   );
+    QueryPerformanceFrequency   (&Frequency );
+
+    return((double)Counter.QuadPart / (double)Frequency.QuadPart);
+
+#elif defined(__MACOS__)
+
+    static mach_timebase_info_data_t    TimeBase    =   {0, 0};
+
+    if (TimeBase.denom == 0)
+    {
+        mach_timebase_info(&TimeBase);
+    }
+
+    return(1.0e-9 * (double)mach_absolute_time() * (double)TimeBase.numer / (double)TimeBase.denom);
+
+#else
+
+    struct timespec     CurrentTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &CurrentTime);
+
+    return((double)CurrentTime.tv_sec + 1.0e-9 * (double)CurrentTime.tv_nsec);
+
+#endif
+}
+
+
+//****************************************************************************
+// ThreadStartData
+//
+// Function and argument of a new thread, which are passed to the
+// operating-system-specific start routine
+
+struct ThreadStartData
+{
+    TypeIIRMLPlatform::ThreadFunction   Function    ;
+    void                                *Argument   ;
+};
+
+
+#if defined(WIN32) || defined(_WIN32)
+static DWORD WINAPI ThreadStartRoutine(LPVOID Data)
+#else
+static void *ThreadStartRoutine(void *Data)
+#endif
+{
+    ThreadStartData     StartData   =   *((ThreadStartData*)Data);
+
+    delete (ThreadStartData*)Data;
+
+    (StartData.Function)(StartData.Argument);
+
+#if defined(WIN32) || defined(_WIN32)
+    return(0);
+#else
+    return(NULL);
+#endif
+}
+
+
+#if !defined(WIN32) && !defined(_WIN32)
+//****************************************************************************
+// PosixSemaphore
+//
+// Unnamed POSIX semaphores are not available on Mac OS X, so a mutex
+// and a condition variable are used on all POSIX systems.
+
+struct PosixSemaphore
+{
+    pthread_mutex_t     Mutex       ;
+    pthread_cond_t      Condition   ;
+    unsigned int        Value       ;
+};
+#endif
+
+
+//****************************************************************************
+// GetNumberOfProcessors()
+
+unsigned int TypeIIRMLPlatform::GetNumberOfProcessors(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+
+    SYSTEM_INFO         SystemInfo;
+
+    GetSystemInfo(&SystemInfo);
+
+    return((SystemInfo.dwNumberOfProcessors > 0)?((unsigned int)SystemInfo.dwNumberOfProcessors):(1));
+
+#else
+
+    long                NumberOfProcessors  =   sysconf(_SC_NPROCESSORS_ONLN);
+
+    return((NumberOfProcessors > 0)?((unsigned int)NumberOfProcessors):(1));
+
+#endif
+}
+
+
+//****************************************************************************
+// StartThread()
+
+bool TypeIIRMLPlatform::StartThread(        ThreadFunction      Function
+                                        ,   void                *Argument
+                                        ,   const int           &Processor
+                                        ,   Thread              *NewThread  )
+{
+    ThreadStartData     *StartData  =   NULL;
+
+    if ((Function == NULL) || (NewThread == NULL))
+    {
+        return(false);
+    }
+
+    NewThread->Handle       =   NULL;
+
+    StartData               =   new ThreadStartData;
+    StartData->Function     =   Function;
+    StartData->Argument     =   Argument;
+
+#if defined(WIN32) || defined(_WIN32)
+
+    HANDLE              ThreadHandle    =   CreateThread(       NULL
+                                                            ,   0
+                                                            ,   ThreadStartRoutine
+                                                            ,   (LPVOID)StartData
+                                                            ,   CREATE_SUSPENDED
+                                                            ,   NULL                );
+
+    if (ThreadHandle == NULL)
+    {
+        delete StartData;
+        return(false);
+    }
+
+    if (Processor >= 0)
+    {
+        SetThreadAffinityMask(ThreadHandle, ((DWORD_PTR)1) << (Processor % (8 * sizeof(DWORD_PTR))));
+    }
+
+    ResumeThread(ThreadHandle);
+
+    NewThread->Handle   =   (void*)ThreadHandle;
+
+#else
+
+    pthread_t           *ThreadHandle   =   new pthread_t;
+
+    if (pthread_create(ThreadHandle, NULL, ThreadStartRoutine, (void*)StartData) != 0)
+    {
+        delete StartData;
+        delete ThreadHandle;
+        return(false);
+    }
+
+#if !defined(__MACOS__)
+    if (Processor >= 0)
+    {
+        cpu_set_t       ProcessorSet;
+
+        CPU_ZERO(&ProcessorSet);
+        CPU_SET(Processor % CPU_SETSIZE, &ProcessorSet);
+
+        pthread_setaffinity_np(*ThreadHandle, sizeof(cpu_set_t), &ProcessorSet);
+    }
+#endif
+
+    NewThread->Handle   =   (void*)ThreadHandle;
+
+#endif
+
+    return(true);
+}
+
+
+//****************************************************************************
+// JoinThread()
+
+void TypeIIRMLPlatform::JoinThread(Thread *ThreadToJoin)
+{
+    if ((ThreadToJoin == NULL) || (ThreadToJoin->Handle == NULL))
+    {
+        return;
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+    WaitForSingleObject((HANDLE)ThreadToJoin->Handle, INFINITE);
+    CloseHandle((HANDLE)ThreadToJoin->Handle);
+#else
+    pthread_join(*((pthread_t*)ThreadToJoin->Handle), NULL);
+    delete (pthread_t*)ThreadToJoin->Handle;
+#endif
+
+    ThreadToJoin->Handle    =   NULL;
+
+    return;
+}
+
+
+//****************************************************************************
+// InitializeSemaphore()
+
+bool TypeIIRMLPlatform::InitializeSemaphore(Semaphore *NewSemaphore)
+{
+    if (NewSemaphore == NULL)
+    {
+        return(false);
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+
+    NewSemaphore->Handle    =   (void*)CreateSemaphoreA(NULL, 0, 0x7FFFFFFF, NULL);
+
+    return(NewSemaphore->Handle != NULL);
+
+#else
+
+    PosixSemaphore      *NewPosixSemaphore  =   new PosixSemaphore;
+
+    NewPosixSemaphore->Value    =   0;
+
+    pthread_mutex_init  (&(NewPosixSemaphore->Mutex)        , NULL);
+    pthread_cond_init   (&(NewPosixSemaphore->Condition)    , NULL);
+
+    NewSemaphore->Handle    =   (void*)NewPosixSemaphore;
+
+    return(true);
+
+#endif
+}
+
+
+//****************************************************************************
+// DestroySemaphore()
+
+void TypeIIRMLPlatform::DestroySemaphore(Semaphore *SemaphoreToDestroy)
+{
+    if ((SemaphoreToDestroy == NULL) || (SemaphoreToDestroy->Handle == NULL))
+    {
+        return;
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+    CloseHandle((HANDLE)SemaphoreToDestroy->Handle);
+#else
+    PosixSemaphore      *ThisSemaphore  =   (PosixSemaphore*)SemaphoreToDestroy->Handle;
+
+    pthread_cond_destroy    (&(ThisSemaphore->Condition)    );
+    pthread_mutex_destroy   (&(ThisSemaphore->Mutex)        );
+
+    delete ThisSemaphore;
+#endif
+
+    SemaphoreToDestroy->Handle  =   NULL;
+
+    return;
+}
+
+
+//****************************************************************************
+// PostSemaphore()
+
+void TypeIIRMLPlatform::PostSemaphore(Semaphore *SemaphoreToPost)
+{
+#if defined(WIN32) || defined(_WIN32)
+    ReleaseSemaphore((HANDLE)SemaphoreToPost->Handle, 1, NULL);
+#else
+    PosixSemaphore      *ThisSemaphore  =   (PosixSemaphore*)SemaphoreToPost->Handle;
+
+    pthread_mutex_lock      (&(ThisSemaphore->Mutex)        );
+    ThisSemaphore->Value++;
+    pthread_cond_signal     (&(ThisSemaphore->Condition)    );
+    pthread_mutex_unlock    (&(ThisSemaphore->Mutex)        );
+#endif
+
+    return;
+}
+
+
+//****************************************************************************
+// WaitForSemaphore()
+
+void TypeIIRMLPlatform::WaitForSemaphore(Semaphore *SemaphoreToWaitFor)
+{
+#if defined(WIN32) || defined(_WIN32)
+    WaitForSingleObject((HANDLE)SemaphoreToWaitFor->Handle, INFINITE);
+#else
+    PosixSemaphore      *ThisSemaphore  =   (PosixSemaphore*)SemaphoreToWaitFor->Handle;
+
+    pthread_mutex_lock      (&(ThisSemaphore->Mutex)        );
+    while (ThisSemaphore->Value == 0)
+    {
+        pthread_cond_wait(      &(ThisSemaphore->Condition)
+                            ,   &(ThisSemaphore->Mutex)     );
+    }
+    ThisSemaphore->Value--;
+    pthread_mutex_unlock    (&(ThisSemaphore->Mutex)        );
+#endif
+
+    return;
+}
+
+
+//****************************************************************************
+// GetPageSize()
+
+size_t TypeIIRMLPlatform::GetPageSize(void)
+{
+#if defined(WIN32) || defined(_WIN32)
+    SYSTEM_INFO         SystemInfo;
+
+    GetSystemInfo(&SystemInfo);
+
+    return((size_t)SystemInfo.dwPageSize);
+#else
+    return((size_t)sysconf(_SC_PAGESIZE));
+#endif
+}
+
+
+//****************************************************************************
+// AllocateMemoryRegion()
+
+void *TypeIIRMLPlatform::AllocateMemoryRegion(      const size_t    &Size
+                                                ,   const bool      &UseHugePages
+                                                ,   bool            *HugePagesUsed  )
+{
+    void                *Region         =   NULL;
+
+    if (HugePagesUsed != NULL)
+    {
+        *HugePagesUsed  =   false;
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+    if (UseHugePages)
+    {
+        Region  =   VirtualAlloc(       NULL
+                                    ,   Size
+                                    ,   MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES
+                                    ,   PAGE_READWRITE                              );
+    }
+
+    if (Region == NULL)
+    {
+        Region  =   VirtualAlloc(       NULL
+                                    ,   Size
+                                    ,   MEM_RESERVE | MEM_COMMIT
+                                    ,   PAGE_READWRITE              );
+    }
+    else
+    {
+        if (HugePagesUsed != NULL)
+        {
+            *HugePagesUsed  =   true;
+        }
+    }
+#else
+#if defined(MAP_HUGETLB)
+    if (UseHugePages)
+    {
+        Region  =   mmap(       NULL
+                            ,   Size
+                            ,   PROT_READ | PROT_WRITE
+                            ,   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+                            ,   -1
+                            ,   0                                           );
+
+        if (Region == MAP_FAILED)
+        {
+            Region  =   NULL;
+        }
+        else
+        {
+            if (HugePagesUsed != NULL)
+            {
+                *HugePagesUsed  =   true;
+            }
+        }
+    }
+#endif
+
+    if (Region == NULL)
+    {
+        Region  =   mmap(       NULL
+                            ,   Size
+                            ,   PROT_READ | PROT_WRITE
+                            ,   MAP_PRIVATE | MAP_ANONYMOUS
+                            ,   -1
+                            ,   0                               );
+
+        if (Region == MAP_FAILED)
+        {
+            return(NULL);
+        }
+
+#if defined(MADV_HUGEPAGE)
+        // Transparent huge pages as a fall-back
+        if (UseHugePages)
+        {
+            madvise(    Region
+                    ,   Size
+                    ,   MADV_HUGEPAGE   );
+        }
+#endif
+    }
+#endif
+
+    return(Region);
+}
+
+
+//****************************************************************************
+// FreeMemoryRegion()
+
+void TypeIIRMLPlatform::FreeMemoryRegion(       void            *Region
+                                            ,   const size_t    &Size   )
+{
+    if (Region == NULL)
+    {
+        return;
+    }
+
+#if defined(WIN32) || defined(_WIN32)
+    VirtualFree(    Region
+                ,   0
+                ,   MEM_RELEASE );
+#else
+    munmap(     Region
+            ,   Size    );
+#endif
+
+    return;
+}
+
+
+//****************************************************************************
+// LockMemory()
+
+bool TypeIIRMLPlatform::LockMemory(     void            *Address
+                                    ,   const size_t    &Size       )
+{
+#if defined(WIN32) || defined(_WIN32)
+    return(VirtualLock(Address, Size) != 0);
+#else
+    return(mlock(Address, Size) == 0);
+#endif
+}
+
+
+//****************************************************************************
+// UnlockMemory()
+
+void TypeIIRMLPlatform::UnlockMemory(       void            *Address
+                                        ,   const size_t    &Size       )
+{
+#if defined(WIN32) || defined(_WIN32)
+    VirtualUnlock(Address, Size);
+#else
+    munlock(Address, Size);
+#endif
+
+    return;
+}
@@ -57,61 +57,111 @@ using namespace TypeIIRMLMath;
 // TypeIIRMLPosition()
 
 TypeIIRMLPosition::TypeIIRMLPosition(       const unsigned int  &DegreesOfFreedom
-                                       ,    const double        &CycleTimeInSeconds)
+                                       ,    const double        &CycleTimeInSeconds
+                                       ,    const unsigned int  &MaxNumberOfDOFs)
 {
     this->CurrentTrajectoryIsPhaseSynchronized          =   false                                               ;
     this->CurrentTrajectoryIsNotSynchronized            =   false                                               ;
     this->CalculatePositionalExtremsFlag                =   false                                               ;
+    this->FullCalculationWasPerformed                   =   false                                               ;
+    this->UseStep1Cache                                 =   true                                                ;
 
     this->ReturnValue                                   =   ReflexxesAPI::RML_ERROR                             ;
 
+    this->AmortizedRecomputationStage                   =   0                                                   ;
     this->NumberOfDOFs                                  =   DegreesOfFreedom                                    ;
+    this->MaxNumberOfDOFs                               =   (MaxNumberOfDOFs > DegreesOfFreedom)?(MaxNumberOfDOFs):(DegreesOfFreedom);
+    this->NumberOfSelectedDOFs                          =   0                                                   ;
+    this->NumberOfModifiedDOFs                          =   0                                                   ;
+    this->NumberOfInoperativeTimeIntervals              =   0                                                   ;
     this->GreatestDOFForPhaseSynchronization            =   0                                                   ;
     this->MotionProfileForPhaseSynchronization          =   TypeIIRMLMath::Step1_Undefined                      ;
 
     this->CycleTime                                     =   CycleTimeInSeconds                                  ;
+    this->NominalCycleTime                              =   CycleTimeInSeconds                                  ;
     this->SynchronizationTime                           =   0.0                                                 ;
     this->InternalClockInSeconds                        =   0.0                                                 ;
 
     this->PhaseSynchronizationMagnitude                 =   TypeIIRMLPosition::UNDEFINED                        ;
 
-    this->ModifiedSelectionVector                       =   new RMLBoolVector               (this->NumberOfDOFs);
+    this->ModifiedSelectionVector                       =   new RMLBoolVector               (this->MaxNumberOfDOFs);
+    this->ChangedDOFsVector                             =   new RMLBoolVector               (this->MaxNumberOfDOFs);
+    this->IndexedSelectionVector                        =   new RMLBoolVector               (this->MaxNumberOfDOFs);
 
-    this->UsedStep1AProfiles                            =   new RMLVector<Step1_Profile>    (this->NumberOfDOFs);
+    this->SelectedDOFs                                  =   new RMLVector<unsigned int>     (this->MaxNumberOfDOFs);
+    this->ModifiedDOFs                                  =   new RMLVector<unsigned int>     (this->MaxNumberOfDOFs);
 
-    this->StoredTargetPosition                          =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->MinimumExecutionTimes                         =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->BeginningsOfInoperativeTimeIntervals          =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->EndingsOfInoperativeTimeIntervals             =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationCurrentPositionVector     =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationTargetPositionVector      =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationPositionDifferenceVector  =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationMaxVelocityVector         =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationTimeVector                =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationCheckVector               =   new RMLDoubleVector             (this->NumberOfDOFs);
+    this->UsedStep1AProfiles                            =   new RMLVector<Step1_Profile>    (this->MaxNumberOfDOFs);
 
-    this->ArrayOfSortedTimes                            =   new RMLDoubleVector         (2 * this->NumberOfDOFs);
-    this->ZeroVector                                    =   new RMLDoubleVector             (this->NumberOfDOFs);
+    this->StoredTargetPosition                          =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->MinimumExecutionTimes                         =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->BeginningsOfInoperativeTimeIntervals          =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->EndingsOfInoperativeTimeIntervals             =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationCurrentPositionVector     =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationTargetPositionVector      =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationPositionDifferenceVector  =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationMaxVelocityVector         =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationTimeVector                =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationCheckVector               =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
 
-    this->OldInputParameters                            =   new RMLPositionInputParameters  (this->NumberOfDOFs);
-    this->CurrentInputParameters                        =   new RMLPositionInputParameters  (this->NumberOfDOFs);
+    this->ArrayOfSortedTimes                            =   new RMLDoubleVector      (2 * this->MaxNumberOfDOFs);
+    this->SortedBeginningsOfInoperativeTimeIntervals    =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->SortedEndingsOfInoperativeTimeIntervals       =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->ZeroVector                                    =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
 
-    this->OutputParameters                              =   new RMLPositionOutputParameters (this->NumberOfDOFs);
+    this->OldInputParameters                            =   new RMLPositionInputParameters  (this->MaxNumberOfDOFs);
+    this->CurrentInputParameters                        =   new RMLPositionInputParameters  (this->MaxNumberOfDOFs);
 
-    this->VelocityInputParameters                       =   new RMLVelocityInputParameters  (this->NumberOfDOFs);
+    this->OutputParameters                              =   new RMLPositionOutputParameters (this->MaxNumberOfDOFs);
 
-    this->VelocityOutputParameters                      =   new RMLVelocityOutputParameters (this->NumberOfDOFs);
+    this->VelocityInputParameters                       =   new RMLVelocityInputParameters  (this->MaxNumberOfDOFs);
+
+    this->VelocityOutputParameters                      =   new RMLVelocityOutputParameters (this->MaxNumberOfDOFs);
 
     this->RMLVelocityObject                             =   new TypeIIRMLVelocity(      this->NumberOfDOFs
-                                                                                    ,   this->CycleTime     )   ;
+                                                                                    ,   this->CycleTime
+                                                                                    ,   this->MaxNumberOfDOFs   )   ;
+
+    this->Polynomials                                   =   new MotionPolynomials           [this->MaxNumberOfDOFs];
+    this->Step1Cache                                    =   new Step1CacheEntry             [this->MaxNumberOfDOFs];
+
+    // allocated by the first call with RMLPositionFlags::EnableDeterministicTiming
+    this->DeterministicTimingInstance                   =   NULL;
+
+    // allocated by the first call with RMLPositionFlags::NumberOfRecomputationCycles > 1
+    this->AmortizedRecomputationInstance                =   NULL;
+
+    this->MemoryResource                                =   RMLMemoryResource::GetActiveResource();
+
+    this->FeedOverride                                  =   1.0                                                 ;
+    this->AppliedFeedOverride                           =   1.0                                                 ;
+    this->FeedOverrideRate                              =   0.0                                                 ;
+    this->MaxFeedOverrideRate                           =   RML_DEFAULT_MAX_FEED_OVERRIDE_RATE                  ;
 
-    this->Polynomials                                   =   new MotionPolynomials           [this->NumberOfDOFs];
+    // set up by TypeIIRMLPosition::SetTrajectoryCache()
+    this->TrajectoryCache                               =   NULL                                                ;
+    this->TrajectoryCacheKeyValues                      =   NULL                                                ;
+    this->NumberOfTrajectoryCacheEntries                =   0                                                   ;
+    this->TrajectoryCacheResolution                     =   0.0                                                 ;
+    this->TrajectoryCacheHashValue                      =   0                                                   ;
+    this->TrajectoryCacheClock                          =   0                                                   ;
+    this->TrajectoryCacheHits                           =   0                                                   ;
+    this->TrajectoryCacheMisses                         =   0                                                   ;
+
+    // set up by TypeIIRMLPosition::MapTrajectoryCacheFile()
+    this->TrajectoryCacheFileHeader                     =   NULL                                                ;
+    this->TrajectoryCacheFileRecords                    =   NULL                                                ;
+    this->TrajectoryCacheFileNumberOfRecords            =   0                                                   ;
+
+    TypeIIRMLPlatform::InitializeMappedFile(&(this->TrajectoryCacheFile));
 
     this->ZeroVector->Set(0.0);
+
+    this->SetInternalNumberOfDOFs(this->NumberOfDOFs);
 }
 
 
@@ -125,6 +175,10 @@ TypeIIRMLPosition::~TypeIIRMLPosition(void)
     delete      this->OutputParameters                              ;
     delete      this->RMLVelocityObject                             ;
     delete      this->ModifiedSelectionVector                       ;
+    delete      this->ChangedDOFsVector                             ;
+    delete      this->IndexedSelectionVector                        ;
+    delete      this->SelectedDOFs                                  ;
+    delete      this->ModifiedDOFs                                  ;
     delete      this->UsedStep1AProfiles                            ;
     delete      this->StoredTargetPosition                          ;
     delete      this->MinimumExecutionTimes                         ;
@@ -141,17 +195,32 @@ TypeIIRMLPosition::~TypeIIRMLPosition(void)
     delete      this->PhaseSynchronizationTimeVector                ;
     delete      this->PhaseSynchronizationCheckVector               ;
     delete      this->ArrayOfSortedTimes                            ;
+    delete      this->SortedBeginningsOfInoperativeTimeIntervals    ;
+    delete      this->SortedEndingsOfInoperativeTimeIntervals       ;
     delete      this->ZeroVector                                    ;
     delete      this->VelocityInputParameters                       ;
     delete      this->VelocityOutputParameters                      ;
 
     delete[]    (MotionPolynomials*)this->Polynomials               ;
+    delete[]    (Step1CacheEntry*)this->Step1Cache                  ;
+
+    delete      this->DeterministicTimingInstance                   ;
+    delete      this->AmortizedRecomputationInstance                ;
+
+    this->UnmapTrajectoryCacheFile();
+
+    delete[]    (TrajectoryCacheEntry*)this->TrajectoryCache        ;
+    delete      this->TrajectoryCacheKeyValues                      ;
 
     this->OldInputParameters                            =   NULL    ;
     this->CurrentInputParameters                        =   NULL    ;
     this->OutputParameters                              =   NULL    ;
     this->RMLVelocityObject                             =   NULL    ;
     this->ModifiedSelectionVector                       =   NULL    ;
+    this->ChangedDOFsVector                             =   NULL    ;
+    this->IndexedSelectionVector                        =   NULL    ;
+    this->SelectedDOFs                                  =   NULL    ;
+    this->ModifiedDOFs                                  =   NULL    ;
     this->UsedStep1AProfiles                            =   NULL    ;
     this->StoredTargetPosition                          =   NULL    ;
     this->MinimumExecutionTimes                         =   NULL    ;
@@ -168,11 +237,20 @@ TypeIIRMLPosition::~TypeIIRMLPosition(void)
     this->PhaseSynchronizationTimeVector                =   NULL    ;
     this->PhaseSynchronizationCheckVector               =   NULL    ;
     this->ArrayOfSortedTimes                            =   NULL    ;
+    this->SortedBeginningsOfInoperativeTimeIntervals    =   NULL    ;
+    this->SortedEndingsOfInoperativeTimeIntervals       =   NULL    ;
     this->ZeroVector                                    =   NULL    ;
     this->VelocityInputParameters                       =   NULL    ;
     this->VelocityOutputParameters                      =   NULL    ;
 
     this->Polynomials                                   =   NULL    ;
+    this->Step1Cache                                    =   NULL    ;
+
+    this->DeterministicTimingInstance                   =   NULL    ;
+    this->AmortizedRecomputationInstance                =   NULL    ;
+
+    this->TrajectoryCache                               =   NULL    ;
+    this->TrajectoryCacheKeyValues                      =   NULL    ;
 }
 
 
@@ -183,9 +261,25 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
                                              ,  RMLPositionOutputParameters         *OutputValues
                                              ,  const RMLPositionFlags              &Flags)
 {
-    bool                        StartANewCalculation            =   false;
+    return(this->GetNextStateOfMotion(      InputValues
+                                        ,   OutputValues
+                                        ,   Flags
+                                        ,   this->NominalCycleTime  ));
+}
+
+
+//****************************************************************************
+// GetNextStateOfMotion()
+
+int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters    &InputValues
+                                             ,  RMLPositionOutputParameters         *OutputValues
+                                             ,  const RMLPositionFlags              &Flags
+                                             ,  const double                        &ElapsedTimeInSeconds)
+{
+    bool                        FeedOverrideIsApplied       =   false;
 
-    unsigned int                i                               =   0;
+    double                      PreviousFeedOverride        =   this->AppliedFeedOverride
+                            ,   PreviousFeedOverrideRate    =   this->FeedOverrideRate      ;
 
     if  (   (OutputValues   ==  NULL)
         ||  (&InputValues   ==  NULL)
@@ -195,9 +289,17 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         return(this->ReturnValue);
     }
 
+    if (!(ElapsedTimeInSeconds > 0.0))
+    {
+        this->ReturnValue   =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
+        return(this->ReturnValue);
+    }
+
     if (    (this->NumberOfDOFs != InputValues.GetNumberOfDOFs())
         ||  (this->NumberOfDOFs != OutputValues->GetNumberOfDOFs()) )
     {
+        this->CycleTime     =   ElapsedTimeInSeconds;
+
         FallBackStrategy(       InputValues
                             ,   this->OutputParameters
                             ,   Flags);
@@ -209,8 +311,79 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 
     *(this->CurrentInputParameters) =   InputValues;
 
+    // With a feed override factor other than one, the trajectory time
+    // advances slower or faster than the time of the user, and the input
+    // and output values are transformed accordingly
+    // (cf. TypeIIRMLPosition::SetFeedOverride()).
+    if (    (this->FeedOverride         ==  1.0)
+        &&  (this->AppliedFeedOverride  ==  1.0)    )
+    {
+        this->CycleTime =   ElapsedTimeInSeconds;
+    }
+    else
+    {
+        FeedOverrideIsApplied   =   true;
+
+        this->CycleTime =   this->AdvanceFeedOverride(ElapsedTimeInSeconds);
+
+        this->TransformInputValuesToTrajectoryTime(     PreviousFeedOverride
+                                                    ,   PreviousFeedOverrideRate    );
+    }
+
+    this->ComputeNextStateOfMotion(Flags);
+
+    this->ExecuteDeterministicTimingPath(Flags);
+
+    *OutputValues   =   *(this->OutputParameters);
+
+    if (FeedOverrideIsApplied)
+    {
+        this->TransformOutputValuesToRealTime(OutputValues);
+    }
+
+    // The new position values are still in the cache, such that the
+    // conversion into encoder counts does not require another pass over
+    // the process image (cf. RMLEncoderOutputStage).
+    OutputValues->WriteEncoderCounts();
+
+    return(this->ReturnValue);
+}
+
+
+//****************************************************************************
+// ComputeNextStateOfMotion()
+
+int TypeIIRMLPosition::ComputeNextStateOfMotion(const RMLPositionFlags &Flags)
+{
+    bool                        StartANewCalculation            =   false
+                            ,   IncrementalRecomputation        =   false
+                            ,   SelectionChanged                =   false;
+
+    unsigned int                i                               =   0
+                            ,   k                               =   0;
+
+    this->SetupSelectedDOFs();
+
     this->CalculatePositionalExtremsFlag    = Flags.EnableTheCalculationOfTheExtremumMotionStates;
 
+    this->FullCalculationWasPerformed       = false;
+
+    this->UseStep1Cache                     = !(Flags.EnableDeterministicTiming);
+
+    if (this->AmortizedRecomputationStage > 0)
+    {
+        if (this->ContinueAmortizedRecomputation(       Flags
+                                                    ,   &StartANewCalculation   ))
+        {
+            return(this->ComputeOutputValues(       Flags
+                                                ,   StartANewCalculation    ));
+        }
+
+        // The pending calculation was discarded, and a new trajectory
+        // has to be calculated within this cycle.
+        this->ReturnValue   =   ReflexxesAPI::RML_ERROR;
+    }
+
     if (    (this->ReturnValue                              ==  ReflexxesAPI::RML_FINAL_STATE_REACHED)
         &&  (Flags.BehaviorAfterFinalStateOfMotionIsReached ==  RMLPositionFlags::RECOMPUTE_TRAJECTORY) )
     {
@@ -230,39 +403,71 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 
     if (!StartANewCalculation)
     {
-        if (        *(this->CurrentInputParameters->SelectionVector)
-                !=
-                    *(this->OldInputParameters->SelectionVector) )
+        // In case of independent degrees of freedom, all changes are
+        // detected, and only the changed degrees of freedom are recalculated
+        // (cf. TypeIIRMLPosition::RecomputeChangedDOFs()).
+        IncrementalRecomputation    =   this->IsIncrementalRecomputationPossible(Flags);
+
+        if (IncrementalRecomputation)
+        {
+            this->ChangedDOFsVector->Set(false);
+        }
+
+        SelectionChanged    =   (       *(this->CurrentInputParameters->SelectionVector)
+                                    !=
+                                        *(this->OldInputParameters->SelectionVector)    );
+
+        if (    (!IncrementalRecomputation)
+            &&  (SelectionChanged)  )
         {
             StartANewCalculation = true;
         }
         else
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfSelectedDOFs; k++)
             {
-                if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+                i   =   (this->SelectedDOFs->VecData)[k];
+
+                if ((!(this->OldInputParameters->SelectionVector->VecData)[i])
+                    ||  !(  IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                    ,   (this->OutputParameters->NewVelocityVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
+                    ,   (this->OldInputParameters->MaxAccelerationVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->MaxVelocityVector->VecData)[i]
+                    ,   (this->OldInputParameters->MaxVelocityVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                        (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
+                    ,   (this->OldInputParameters->TargetVelocityVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                        ((this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                            -   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i])
+                    ,   ((this->OldInputParameters->TargetPositionVector->VecData)[i]
+                            -   (this->OutputParameters->NewPositionVector->VecData)[i]))))
                 {
-                    if (!(  IsInputEpsilonEqual(
-                            (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
-                        ,   (this->OutputParameters->NewVelocityVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                            (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
-                        ,   (this->OldInputParameters->MaxAccelerationVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                            (this->CurrentInputParameters->MaxVelocityVector->VecData)[i]
-                        ,   (this->OldInputParameters->MaxVelocityVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                            (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
-                        ,   (this->OldInputParameters->TargetVelocityVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                            ((this->CurrentInputParameters->TargetPositionVector->VecData)[i]
-                                -   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i])
-                        ,   ((this->OldInputParameters->TargetPositionVector->VecData)[i]
-                                -   (this->OutputParameters->NewPositionVector->VecData)[i]))))
+                    StartANewCalculation = true;
+
+                    if (!IncrementalRecomputation)
                     {
-                        StartANewCalculation = true;
                         break;
                     }
+
+                    (this->ChangedDOFsVector->VecData)[i]   =   true;
+                }
+            }
+
+            if (SelectionChanged)
+            {
+                for (i = 0; i < this->NumberOfDOFs; i++)
+                {
+                    if (    (!(this->CurrentInputParameters->SelectionVector->VecData)[i])
+                        &&  ((this->OldInputParameters->SelectionVector->VecData)[i])     )
+                    {
+                        // This degree of freedom was deselected.
+                        StartANewCalculation = true;
+                    }
                 }
             }
         }
@@ -272,6 +477,52 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         ||  ( ( this->ReturnValue != ReflexxesAPI::RML_WORKING)
                 &&  ( this->ReturnValue != ReflexxesAPI::RML_FINAL_STATE_REACHED) ) )
     {
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
+        {
+            i   =   (this->SelectedDOFs->VecData)[k];
+
+            // The comparisons are negated, such that NaN values are
+            // invalid (cf. RMLPositionInputParameters::CheckForValidity()).
+            if  (   (!( fabs((this->CurrentInputParameters->TargetVelocityVector->VecData)[i])
+                        <=
+                        (this->CurrentInputParameters->MaxVelocityVector->VecData)[i]       ))
+                ||  (!( (this->CurrentInputParameters->MaxVelocityVector->VecData)[i]
+                        >
+                        0.0))
+                ||  (!( (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
+                        >
+                        0.0))   )
+            {
+                FallBackStrategy(       *(this->CurrentInputParameters)
+                                    ,   this->OutputParameters
+                                    ,   Flags);
+
+                this->ReturnValue   =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
+                return(this->ReturnValue);
+            }
+        }
+
+        if (IncrementalRecomputation)
+        {
+            *(this->OldInputParameters)     =   *(this->CurrentInputParameters) ;
+            this->OldFlags                  =   Flags                           ;
+
+            this->RecomputeChangedDOFs();
+
+            return(this->ComputeOutputValues(       Flags
+                                                ,   true    ));
+        }
+
+        // The trajectory of the last cycle is continued, while the new one
+        // is calculated over several cycles
+        // (cf. RMLPositionFlags::NumberOfRecomputationCycles).
+        if (    (this->IsAmortizedRecomputationPossible(Flags))
+            &&  (this->StartAmortizedRecomputation(Flags))  )
+        {
+            return(this->ComputeOutputValues(       Flags
+                                                ,   false   ));
+        }
+
         this->InternalClockInSeconds = this->CycleTime;
 
         // if the values have changed, we have to start a
@@ -279,31 +530,6 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         StartANewCalculation = true;
 
         this->SynchronizationTime = 0.0;
-
-        for (i = 0; i < this->NumberOfDOFs; i++)
-        {
-            if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
-            {
-                if  (   (   fabs((this->CurrentInputParameters->TargetVelocityVector->VecData)[i])
-                        >
-                        (this->CurrentInputParameters->MaxVelocityVector->VecData)[i]       )
-                    ||  ((this->CurrentInputParameters->MaxVelocityVector->VecData)[i]
-                        <=
-                        0.0)
-                    ||  ((this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
-                        <=
-                        0.0)    )
-                {
-                    FallBackStrategy(       InputValues
-                                        ,   this->OutputParameters
-                                        ,   Flags);
-
-                    *OutputValues       =   *(this->OutputParameters);
-                    this->ReturnValue   =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
-                    return(this->ReturnValue);
-                }
-            }
-        }
     }
     else
     {
@@ -312,8 +538,8 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 
     // From here on, we know whether a new calculation has to be performed or not
 
-    *(this->OldInputParameters)     =   InputValues ;
-    this->OldFlags                  =   Flags       ;
+    *(this->OldInputParameters)     =   *(this->CurrentInputParameters) ;
+    this->OldFlags                  =   Flags                           ;
 
     if (StartANewCalculation)
     {
@@ -326,6 +552,14 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 
         this->CurrentTrajectoryIsNotSynchronized    =       (   Flags.SynchronizationBehavior == RMLFlags::NO_SYNCHRONIZATION                   );
 
+        // Steps 1 and 2 are skipped, if the same trajectory was calculated
+        // before (cf. TypeIIRMLPosition::SetTrajectoryCache()).
+        if (this->LookUpTrajectoryCache(Flags))
+        {
+            return(this->ComputeOutputValues(       Flags
+                                                ,   true    ));
+        }
+
         // Within the call of the next method, the selection vector
         // (TypeIIRMLPosition::CurrentInputParameters->SelectionVector)
         // becomes modified to (TypeIIRMLPosition::ModifiedSelectionVector),
@@ -340,12 +574,11 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         if (    (Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
             &&  (!(this->CurrentTrajectoryIsPhaseSynchronized)) )
         {
-            FallBackStrategy(       InputValues
+            FallBackStrategy(       *(this->OldInputParameters)
                                 ,   this->OutputParameters
                                 ,   Flags);
 
-            *OutputValues       =   *(this->OutputParameters);
-            if (InputValues.CheckForValidity())
+            if (this->OldInputParameters->CheckForValidity())
             {
                 this->ReturnValue   =   ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION;
             }
@@ -358,12 +591,11 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 
         if ( this->SynchronizationTime > RML_MAX_EXECUTION_TIME)
         {
-            FallBackStrategy(       InputValues
+            FallBackStrategy(       *(this->OldInputParameters)
                                 ,   this->OutputParameters
                                 ,   Flags);
 
-            *OutputValues       =   *(this->OutputParameters);
-            if (InputValues.CheckForValidity())
+            if (this->OldInputParameters->CheckForValidity())
             {
                 this->ReturnValue   =   ReflexxesAPI::RML_ERROR_EXECUTION_TIME_TOO_BIG;
             }
@@ -379,31 +611,13 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
             (this->Polynomials)[i].ValidPolynomials = 0;
         }
 
-        if  (   (Flags.SynchronizationBehavior          !=  RMLFlags::NO_SYNCHRONIZATION)
-            &&  (InputValues.MinimumSynchronizationTime >   this->SynchronizationTime   ))
-        {
-            for (i = 0; i < 2 * this->NumberOfDOFs; i++)
-            {
-                if ((this->ArrayOfSortedTimes->VecData)[i] > InputValues.MinimumSynchronizationTime)
-                {
-                    break;
-                }
-            }
+        this->ApplyMinimumSynchronizationTime(Flags);
 
-            this->SynchronizationTime = InputValues.MinimumSynchronizationTime;
+        Step2();
 
-            //calculate the minimal time, which is not in death-zone
-            while((IsWithinAnInoperativeTimeInterval(   this->SynchronizationTime
-                                                    ,   *(this->BeginningsOfInoperativeTimeIntervals)
-                                                    ,   *(this->EndingsOfInoperativeTimeIntervals)      ) )
-                    && (i < 2 * this->NumberOfDOFs) )
-            {
-                this->SynchronizationTime = (this->ArrayOfSortedTimes->VecData)[i];
-                i++;
-            }
-        }
+        this->StoreInTrajectoryCache(Flags);
 
-        Step2();
+        this->FullCalculationWasPerformed   =   true;
     }
     else
     {
@@ -416,7 +630,21 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         }
     }
 
-    if (this->GetNumberOfSelectedDOFs(*(this->ModifiedSelectionVector)) == 0)
+    return(this->ComputeOutputValues(       Flags
+                                        ,   StartANewCalculation    ));
+}
+
+
+//****************************************************************************
+// ComputeOutputValues()
+
+int TypeIIRMLPosition::ComputeOutputValues(     const RMLPositionFlags  &Flags
+                                            ,   const bool              &ANewCalculationWasPerformed)
+{
+    unsigned int                i                               =   0
+                            ,   k                               =   0;
+
+    if (this->NumberOfModifiedDOFs == 0)
     {
         this->SynchronizationTime   =   0.0;
         if (Flags.SynchronizationBehavior == RMLFlags::ONLY_TIME_SYNCHRONIZATION)
@@ -432,7 +660,7 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
     this->ReturnValue   =   Step3(      this->InternalClockInSeconds
                                     ,   this->OutputParameters      );
 
-    this->OutputParameters->ANewCalculationWasPerformed =    StartANewCalculation;
+    this->OutputParameters->ANewCalculationWasPerformed =    ANewCalculationWasPerformed;
 
     this->OutputParameters->TrajectoryIsPhaseSynchronized   =   this->CurrentTrajectoryIsPhaseSynchronized;
 
@@ -441,20 +669,17 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         this->OutputParameters->SynchronizationTime             =   0.0;
         this->OutputParameters->DOFWithTheGreatestExecutionTime =   this->GreatestDOFForPhaseSynchronization;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        this->OutputParameters->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   (this->MinimumExecutionTimes->VecData)[i]
-                                                                        -   this->InternalClockInSeconds
-                                                                        +   this->CycleTime;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (this->OutputParameters->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
-                }
-            }
-            else
+            this->OutputParameters->ExecutionTimes->VecData[i]  =   (this->MinimumExecutionTimes->VecData)[i]
+                                                                    -   this->InternalClockInSeconds
+                                                                    +   this->CycleTime;
+
+            if (this->OutputParameters->ExecutionTimes->VecData[i] < 0.0)
             {
                 this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
             }
@@ -465,16 +690,11 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         this->OutputParameters->SynchronizationTime             =   this->SynchronizationTime;
         this->OutputParameters->DOFWithTheGreatestExecutionTime =   0;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        this->OutputParameters->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   this->SynchronizationTime;
-            }
-            else
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
-            }
+            this->OutputParameters->ExecutionTimes->VecData[(this->SelectedDOFs->VecData)[k]]   =   this->SynchronizationTime;
         }
     }
 
@@ -488,24 +708,21 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
         this->SetPositionalExtremsToZero(this->OutputParameters);
     }
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if ( (this->ModifiedSelectionVector->VecData)[i] )
-        {
-                (this->OutputParameters->NewPositionVector->VecData)[i]
-                    =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
-                            -   ((this->StoredTargetPosition->VecData)[i]
-                            -   (this->OutputParameters->NewPositionVector->VecData)[i] );
-        }
+        i   =   (this->ModifiedDOFs->VecData)[k];
+
+        (this->OutputParameters->NewPositionVector->VecData)[i]
+            =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                    -   ((this->StoredTargetPosition->VecData)[i]
+                    -   (this->OutputParameters->NewPositionVector->VecData)[i] );
     }
 
-    if ((this->ReturnValue == ReflexxesAPI::RML_FINAL_STATE_REACHED) && (StartANewCalculation))
+    if ((this->ReturnValue == ReflexxesAPI::RML_FINAL_STATE_REACHED) && (ANewCalculationWasPerformed))
     {
         this->OutputParameters->SynchronizationTime =   this->MinimumExecutionTimes->VecData[this->GreatestDOFForPhaseSynchronization];
     }
 
-    *OutputValues   =   *(this->OutputParameters);
-
     return(this->ReturnValue);
 }
 
@@ -516,7 +733,8 @@ int TypeIIRMLPosition::GetNextStateOfMotion(    const RMLPositionInputParameters
 int TypeIIRMLPosition::GetNextStateOfMotionAtTime(      const double                        &TimeValueInSeconds
                                                     ,   RMLPositionOutputParameters         *OutputValues       ) const
 {
-    unsigned int                i               =   0;
+    unsigned int                i               =   0
+                            ,   k               =   0;
 
     int                         ReturnValue     =   ReflexxesAPI::RML_ERROR;
 
@@ -558,19 +776,16 @@ int TypeIIRMLPosition::GetNextStateOfMotionAtTime(      const double
         OutputValues->SynchronizationTime               =   0.0;
         OutputValues->DOFWithTheGreatestExecutionTime   =   this->GreatestDOFForPhaseSynchronization;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        OutputValues->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                OutputValues->ExecutionTimes->VecData[i]    =   (this->MinimumExecutionTimes->VecData)[i]
-                                                                -   TimeValueInSeconds;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    OutputValues->ExecutionTimes->VecData[i]    =   0.0;
-                }
-            }
-            else
+            OutputValues->ExecutionTimes->VecData[i]    =   (this->MinimumExecutionTimes->VecData)[i]
+                                                            -   TimeValueInSeconds;
+
+            if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
             {
                 OutputValues->ExecutionTimes->VecData[i]    =   0.0;
             }
@@ -581,19 +796,16 @@ int TypeIIRMLPosition::GetNextStateOfMotionAtTime(      const double
         OutputValues->SynchronizationTime               =   this->SynchronizationTime - TimeValueInSeconds;
         OutputValues->DOFWithTheGreatestExecutionTime   =   0;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        OutputValues->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                OutputValues->ExecutionTimes->VecData[i]    =   this->SynchronizationTime
-                                                                -   TimeValueInSeconds;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    OutputValues->ExecutionTimes->VecData[i]    =   0.0;
-                }
-            }
-            else
+            OutputValues->ExecutionTimes->VecData[i]    =   this->SynchronizationTime
+                                                            -   TimeValueInSeconds;
+
+            if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
             {
                 OutputValues->ExecutionTimes->VecData[i]    =   0.0;
             }
@@ -610,15 +822,14 @@ int TypeIIRMLPosition::GetNextStateOfMotionAtTime(      const double
         this->SetPositionalExtremsToZero(OutputValues);
     }
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if ( (this->ModifiedSelectionVector->VecData)[i] )
-        {
-            (OutputValues->NewPositionVector->VecData)[i]
-                =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
-                    -   ((this->StoredTargetPosition->VecData)[i]
-                    -   (OutputValues->NewPositionVector->VecData)[i] );
-        }
+        i   =   (this->ModifiedDOFs->VecData)[k];
+
+        (OutputValues->NewPositionVector->VecData)[i]
+            =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                -   ((this->StoredTargetPosition->VecData)[i]
+                -   (OutputValues->NewPositionVector->VecData)[i] );
     }
 
     return(ReturnValue);
@@ -0,0 +1,135 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLPrepareForRealTime.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLVelocity.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLPositionFlags.h>
+#include <RMLVelocityFlags.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// PrepareForRealTime()
+
+int TypeIIRMLPosition::PrepareForRealTime(const RMLPositionFlags &Flags)
+{
+    unsigned int                    Cycle                               =   0
+                                ,   i                                   =   0
+                                ,   UserNumberOfTrajectoryCacheEntries  =   this->NumberOfTrajectoryCacheEntries    ;
+
+    int                             Result                              =   ReflexxesAPI::RML_ERROR
+                                ,   Velocity                            =   ReflexxesAPI::RML_ERROR                 ;
+
+    double                          UserFeedOverride                    =   this->FeedOverride
+                                ,   UserAppliedFeedOverride             =   this->AppliedFeedOverride
+                                ,   UserFeedOverrideRate                =   this->FeedOverrideRate                  ;
+
+    const RMLTrajectoryCacheHeader  *UserTrajectoryCacheFileHeader      =   this->TrajectoryCacheFileHeader         ;
+
+    RMLPositionInputParameters      IP(this->NumberOfDOFs);
+
+    RMLPositionOutputParameters     OP(this->NumberOfDOFs);
+
+    RMLVelocityFlags                VelocityFlags;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        (IP.SelectionVector->VecData)           [i] =   true;
+        (IP.MaxVelocityVector->VecData)         [i] =   1.0;
+        (IP.MaxAccelerationVector->VecData)     [i] =   1.0;
+        (IP.MaxJerkVector->VecData)             [i] =   1.0;
+        (IP.TargetPositionVector->VecData)      [i] =   1.0;
+    }
+
+    // The synthetic input values must neither be stored in nor looked up
+    // from the trajectory cache of the user, and the feed override must
+    // neither be applied nor advanced by the warm-up. The cache and the
+    // feed override are therefore disabled until the end of this method.
+    this->NumberOfTrajectoryCacheEntries    =   0       ;
+    this->TrajectoryCacheFileHeader         =   NULL    ;
+    this->FeedOverride                      =   1.0     ;
+    this->AppliedFeedOverride               =   1.0     ;
+    this->FeedOverrideRate                  =   0.0     ;
+
+    Result  =   this->GetNextStateOfMotion(     IP
+                                            ,   &OP
+                                            ,   Flags   );
+
+    // The target changes during the motion, which starts an amortized
+    // recomputation that takes RMLPositionFlags::NumberOfRecomputationCycles
+    // cycles to complete.
+    IP.TargetPositionVector->Set(-1.0);
+
+    for (Cycle = 0; (Cycle <= Flags.NumberOfRecomputationCycles) && (Result >= 0); Cycle++)
+    {
+        *(IP.CurrentPositionVector)     =   *(OP.NewPositionVector)     ;
+        *(IP.CurrentVelocityVector)     =   *(OP.NewVelocityVector)     ;
+        *(IP.CurrentAccelerationVector) =   *(OP.NewAccelerationVector) ;
+
+        Result  =   this->GetNextStateOfMotion(     IP
+                                                ,   &OP
+                                                ,   Flags   );
+    }
+
+    Velocity    =   this->RMLVelocityObject->PrepareForRealTime(VelocityFlags);
+
+    this->NumberOfTrajectoryCacheEntries    =   UserNumberOfTrajectoryCacheEntries  ;
+    this->TrajectoryCacheFileHeader         =   UserTrajectoryCacheFileHeader       ;
+    this->FeedOverride                      =   UserFeedOverride                    ;
+    this->AppliedFeedOverride               =   UserAppliedFeedOverride             ;
+    this->FeedOverrideRate                  =   UserFeedOverrideRate                ;
+
+    // The trajectory of the warm-up, the pending amortized recomputation,
+    // and the contents of the Step 1 cache are discarded.
+    this->Reset();
+
+    if (Result < 0)
+    {
+        return(Result);
+    }
+
+    return(Velocity);
+}
@@ -46,12 +46,83 @@
 
 
 //************************************************************************************
-// Quicksort()
+// Heapsort()
+//
+// Fallback for Quicksort(), if the recursion depth exceeds its limit
 
+static void Heapsort(       const int   &LeftBound
+                        ,   const int   &RightBound
+                        ,   double      *ArrayOfValues)
+{
+    int             NumberOfValues      =   RightBound - LeftBound + 1
+                ,   FirstLoopVariable   =   0
+                ,   Parent              =   0
+                ,   Child               =   0;
 
-void TypeIIRMLMath::Quicksort(      const int   &LeftBound
-                                ,   const int   &RightBound
-                                ,   double      *ArrayOfValues)
+    double          *Values             =   ArrayOfValues + LeftBound
+                ,   HelpVariable        =   0.0;
+
+    // Build the heap by sifting down every inner node...
+    for (FirstLoopVariable = NumberOfValues / 2 - 1; FirstLoopVariable >= 0; FirstLoopVariable--)
+    {
+        Parent  =   FirstLoopVariable;
+
+        while ((Child = 2 * Parent + 1) < NumberOfValues)
+        {
+            if ((Child + 1 < NumberOfValues) && (Values[Child] < Values[Child + 1]))
+            {
+                Child++;
+            }
+
+            if (!(Values[Parent] < Values[Child]))
+            {
+                break;
+            }
+
+            HelpVariable    =   Values[Parent]  ;
+            Values[Parent]  =   Values[Child]   ;
+            Values[Child]   =   HelpVariable    ;
+            Parent          =   Child           ;
+        }
+    }
+
+    // ...and move the maximum to the end of the remaining range.
+    for (FirstLoopVariable = NumberOfValues - 1; FirstLoopVariable > 0; FirstLoopVariable--)
+    {
+        HelpVariable                    =   Values[0]                   ;
+        Values[0]                       =   Values[FirstLoopVariable]   ;
+        Values[FirstLoopVariable]       =   HelpVariable                ;
+        Parent                          =   0                           ;
+
+        while ((Child = 2 * Parent + 1) < FirstLoopVariable)
+        {
+            if ((Child + 1 < FirstLoopVariable) && (Values[Child] < Values[Child + 1]))
+            {
+                Child++;
+            }
+
+            if (!(Values[Parent] < Values[Child]))
+            {
+                break;
+            }
+
+            HelpVariable    =   Values[Parent]  ;
+            Values[Parent]  =   Values[Child]   ;
+            Values[Child]   =   HelpVariable    ;
+            Parent          =   Child           ;
+        }
+    }
+}
+
+
+//************************************************************************************
+// QuicksortWithDepthLimit()
+
+
+static void QuicksortWithDepthLimit(        const int   &LeftBound
+                                        ,   const int   &RightBound
+                                        ,   double      *ArrayOfValues
+                                        ,   const int   &DepthLimit)
 {
     int             FirstLoopVariable
                 ,   SecondLoopVariable;
@@ -59,6 +130,16 @@ void TypeIIRMLMath::Quicksort(      const int   &LeftBound
     double          CurrentValue
                 ,   HelpVariable;
 
+    // Degenerated partitions: switch to Heapsort() to guarantee
+    // O(N log N) in the worst case.
+    if ( DepthLimit <= 0 )
+    {
+        Heapsort(       LeftBound
+                    ,   RightBound
+                    ,   ArrayOfValues   );
+        return;
+    }
+
     CurrentValue        =   ArrayOfValues[(LeftBound + RightBound) / 2] ;
     FirstLoopVariable   =   LeftBound                                   ;
     SecondLoopVariable  =   RightBound                                  ;
@@ -90,16 +171,42 @@ void TypeIIRMLMath::Quicksort(      const int   &LeftBound
     // Recursive call for both subsections
     if ( LeftBound < SecondLoopVariable )
     {
-        Quicksort(      LeftBound
-                    ,   SecondLoopVariable
-                    ,   ArrayOfValues       );
+        QuicksortWithDepthLimit(        LeftBound
+                                    ,   SecondLoopVariable
+                                    ,   ArrayOfValues
+                                    ,   DepthLimit - 1      );
     }
 
     if ( FirstLoopVariable < RightBound )
     {
-        Quicksort(      FirstLoopVariable
-                    ,   RightBound
-                    ,   ArrayOfValues       );
+        QuicksortWithDepthLimit(        FirstLoopVariable
+                                    ,   RightBound
+                                    ,   ArrayOfValues
+                                    ,   DepthLimit - 1      );
     }
 }
 
+
+//************************************************************************************
+// Quicksort()
+
+
+void TypeIIRMLMath::Quicksort(      const int   &LeftBound
+                                ,   const int   &RightBound
+                                ,   double      *ArrayOfValues)
+{
+    int             DepthLimit      =   0
+                ,   NumberOfValues  =   RightBound - LeftBound + 1;
+
+    // 2 * floor(log2(N)) levels, as for introsort
+    while ( NumberOfValues > 1 )
+    {
+        DepthLimit      +=  2;
+        NumberOfValues  /=  2;
+    }
+
+    QuicksortWithDepthLimit(        LeftBound
+                                ,   RightBound
+                                ,   ArrayOfValues
+                                ,   DepthLimit      );
+}
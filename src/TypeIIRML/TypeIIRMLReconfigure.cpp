@@ -0,0 +1,176 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLReconfigure.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLVelocity.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// Reset()
+
+void TypeIIRMLPosition::Reset(void)
+{
+    unsigned int        i   =   0;
+
+    this->ReturnValue                   =   ReflexxesAPI::RML_ERROR ;
+    this->AmortizedRecomputationStage   =   0                       ;
+    this->InternalClockInSeconds        =   0.0                     ;
+    this->SynchronizationTime           =   0.0                     ;
+
+    for (i = 0; i < this->MaxNumberOfDOFs; i++)
+    {
+        this->Step1Cache[i].Invalidate();
+    }
+
+    this->RMLVelocityObject->Reset();
+
+    return;
+}
+
+
+//****************************************************************************
+// Reconfigure()
+
+int TypeIIRMLPosition::Reconfigure(     const unsigned int  &DegreesOfFreedom
+                                   ,    const double        &CycleTimeInSeconds)
+{
+    if (    (DegreesOfFreedom   ==  0                       )
+        ||  (DegreesOfFreedom   >   this->MaxNumberOfDOFs   )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS);
+    }
+
+    if (!(CycleTimeInSeconds > 0.0))
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    this->SetInternalNumberOfDOFs(DegreesOfFreedom);
+
+    this->CycleTime         =   CycleTimeInSeconds;
+    this->NominalCycleTime  =   CycleTimeInSeconds;
+
+    this->RMLVelocityObject->Reconfigure(       DegreesOfFreedom
+                                            ,   CycleTimeInSeconds  );
+
+    // The lazily allocated instances were created with the same number of
+    // reserved degrees of freedom (cf. TypeIIRMLPosition::MaxNumberOfDOFs).
+    if (this->DeterministicTimingInstance != NULL)
+    {
+        this->DeterministicTimingInstance->Reconfigure(     DegreesOfFreedom
+                                                        ,   CycleTimeInSeconds  );
+    }
+
+    if (this->AmortizedRecomputationInstance != NULL)
+    {
+        this->AmortizedRecomputationInstance->Reconfigure(      DegreesOfFreedom
+                                                            ,   CycleTimeInSeconds  );
+    }
+
+    this->Reset();
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// SetInternalNumberOfDOFs()
+
+void TypeIIRMLPosition::SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+{
+    this->NumberOfDOFs  =   DegreesOfFreedom;
+
+    this->ModifiedSelectionVector->SetVecDim                        (DegreesOfFreedom);
+    this->ChangedDOFsVector->SetVecDim                              (DegreesOfFreedom);
+    this->IndexedSelectionVector->SetVecDim                         (DegreesOfFreedom);
+
+    // The index lists are rebuilt by the next call of
+    // TypeIIRMLPosition::SetupSelectedDOFs().
+    this->IndexedSelectionVector->Set(false);
+    this->NumberOfSelectedDOFs  =   0;
+    this->NumberOfModifiedDOFs  =   0;
+
+    this->UsedStep1AProfiles->SetVecDim                             (DegreesOfFreedom);
+
+    this->StoredTargetPosition->SetVecDim                           (DegreesOfFreedom);
+    this->MinimumExecutionTimes->SetVecDim                          (DegreesOfFreedom);
+    this->BeginningsOfInoperativeTimeIntervals->SetVecDim           (DegreesOfFreedom);
+    this->EndingsOfInoperativeTimeIntervals->SetVecDim              (DegreesOfFreedom);
+    this->PhaseSynchronizationReferenceVector->SetVecDim            (DegreesOfFreedom);
+    this->PhaseSynchronizationCurrentPositionVector->SetVecDim      (DegreesOfFreedom);
+    this->PhaseSynchronizationTargetPositionVector->SetVecDim       (DegreesOfFreedom);
+    this->PhaseSynchronizationPositionDifferenceVector->SetVecDim   (DegreesOfFreedom);
+    this->PhaseSynchronizationCurrentVelocityVector->SetVecDim      (DegreesOfFreedom);
+    this->PhaseSynchronizationTargetVelocityVector->SetVecDim       (DegreesOfFreedom);
+    this->PhaseSynchronizationMaxVelocityVector->SetVecDim          (DegreesOfFreedom);
+    this->PhaseSynchronizationMaxAccelerationVector->SetVecDim      (DegreesOfFreedom);
+    this->PhaseSynchronizationTimeVector->SetVecDim                 (DegreesOfFreedom);
+    this->PhaseSynchronizationCheckVector->SetVecDim                (DegreesOfFreedom);
+
+    this->ArrayOfSortedTimes->SetVecDim                         (2 * DegreesOfFreedom);
+    this->SortedBeginningsOfInoperativeTimeIntervals->SetVecDim     (DegreesOfFreedom);
+    this->SortedEndingsOfInoperativeTimeIntervals->SetVecDim        (DegreesOfFreedom);
+    this->ZeroVector->SetVecDim                                     (DegreesOfFreedom);
+
+    this->OldInputParameters->SetNumberOfDOFs                       (DegreesOfFreedom);
+    this->CurrentInputParameters->SetNumberOfDOFs                   (DegreesOfFreedom);
+
+    this->OutputParameters->SetNumberOfDOFs                         (DegreesOfFreedom);
+
+    this->VelocityInputParameters->SetNumberOfDOFs                  (DegreesOfFreedom);
+
+    this->VelocityOutputParameters->SetNumberOfDOFs                 (DegreesOfFreedom);
+
+    if (this->GreatestDOFForPhaseSynchronization >= DegreesOfFreedom)
+    {
+        this->GreatestDOFForPhaseSynchronization    =   0;
+    }
+
+    return;
+}
@@ -51,12 +51,37 @@
 
 void TypeIIRMLPosition::SetupModifiedSelectionVector(void)
 {
-    unsigned int                i                               =   0;
+    unsigned int                i                               =   0
+                            ,   k                               =   0;
 
-    *(this->ModifiedSelectionVector)    =   *(this->CurrentInputParameters->SelectionVector);
+    this->ModifiedSelectionVector->Set(false);
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    for (k = 0; k < this->NumberOfSelectedDOFs; k++)
     {
+        i   =   (this->SelectedDOFs->VecData)[k];
+
+        this->SetupModifiedSelectionVector(     i
+                                            ,   i + 1   );
+    }
+
+    this->SetupModifiedDOFs();
+
+    return;
+}
+
+
+//****************************************************************************
+// SetupModifiedSelectionVector()
+
+void TypeIIRMLPosition::SetupModifiedSelectionVector(       const unsigned int  &FirstDOF
+                                                        ,   const unsigned int  &LastDOF    )
+{
+    unsigned int                i                               =   0;
+
+    for (i = FirstDOF; i < LastDOF; i++)
+    {
+        (this->ModifiedSelectionVector->VecData)[i] =   (this->CurrentInputParameters->SelectionVector->VecData)[i];
+
         if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
         {
             if  (   ((this->CurrentInputParameters->TargetVelocityVector->VecData)[i] == 0.0)
@@ -79,3 +104,66 @@ void TypeIIRMLPosition::SetupModifiedSelectionVector(void)
         }
     }
 }
+
+
+//****************************************************************************
+// SetupSelectedDOFs()
+
+void TypeIIRMLPosition::SetupSelectedDOFs(void)
+{
+    unsigned int                i                               =   0;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (    (this->CurrentInputParameters->SelectionVector->VecData)[i]
+            !=  (this->IndexedSelectionVector->VecData)[i]                  )
+        {
+            break;
+        }
+    }
+
+    if (i == this->NumberOfDOFs)
+    {
+        return;
+    }
+
+    this->NumberOfSelectedDOFs  =   0;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        (this->IndexedSelectionVector->VecData)[i]  =   (this->CurrentInputParameters->SelectionVector->VecData)[i];
+
+        if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            (this->SelectedDOFs->VecData)[this->NumberOfSelectedDOFs]   =   i;
+            this->NumberOfSelectedDOFs++;
+        }
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// SetupModifiedDOFs()
+
+void TypeIIRMLPosition::SetupModifiedDOFs(void)
+{
+    unsigned int                i                               =   0
+                            ,   k                               =   0;
+
+    this->NumberOfModifiedDOFs  =   0;
+
+    for (k = 0; k < this->NumberOfSelectedDOFs; k++)
+    {
+        i   =   (this->SelectedDOFs->VecData)[k];
+
+        if ((this->ModifiedSelectionVector->VecData)[i])
+        {
+            (this->ModifiedDOFs->VecData)[this->NumberOfModifiedDOFs]   =   i;
+            this->NumberOfModifiedDOFs++;
+        }
+    }
+
+    return;
+}
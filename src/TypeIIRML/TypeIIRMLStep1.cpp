@@ -61,20 +61,40 @@ using namespace TypeIIRMLMath;
 
 void TypeIIRMLPosition::Step1(void)
 {
-    double                      MaximalMinimalExecutionTime                     =   0.0
-                            ,   VectorStretchFactorMaxAcceleration              =   0.0
-                            ,   VectorStretchFactorMaxVelocity                  =   0.0
-                            ,   PhaseSyncTimeAverage                            =   0.0;
+    this->Step1MinimumExecutionTimes(   0
+                                    ,   this->NumberOfDOFs  );
 
-    unsigned int                i                                               =   0
-                            ,   Counter                                         =   0
-                            ,   PhaseSyncDOFCounter                             =   0;
+    this->Step1SynchronizationTime();
 
+    return;
+}
+
+
+//*******************************************************************************************
+// Step1MinimumExecutionTimes
+
+void TypeIIRMLPosition::Step1MinimumExecutionTimes(     const unsigned int  &FirstDOF
+                                                    ,   const unsigned int  &LastDOF    )
+{
+    unsigned int                i                                               =   0;
 
-    for(i = 0; i < this->NumberOfDOFs; i++)
+    for(i = FirstDOF; i < LastDOF; i++)
     {
         if(this->CurrentInputParameters->SelectionVector->VecData[i])
         {
+            if (    (this->UseStep1Cache)
+                &&  (this->Step1Cache[i].Matches(       this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
+                                                    ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
+                                                    ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
+                                                    ,   this->CurrentInputParameters->TargetVelocityVector->VecData         [i]
+                                                    ,   this->CurrentInputParameters->MaxVelocityVector->VecData            [i]
+                                                    ,   this->CurrentInputParameters->MaxAccelerationVector->VecData        [i] )) )
+            {
+                this->UsedStep1AProfiles->VecData       [i] =   this->Step1Cache[i].Profile                 ;
+                this->MinimumExecutionTimes->VecData    [i] =   this->Step1Cache[i].MinimumExecutionTime    ;
+                continue;
+            }
+
             TypeIIRMLDecisionTree1A(        this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
                                         ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
                                         ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
@@ -84,14 +104,54 @@ void TypeIIRMLPosition::Step1(void)
                                         ,   &(this->UsedStep1AProfiles->VecData                                 [i])
                                         ,   &(this->MinimumExecutionTimes->VecData                              [i]));
 
-            if((this->MinimumExecutionTimes->VecData)[i] > MaximalMinimalExecutionTime)
+            if (this->UseStep1Cache)
             {
-                MaximalMinimalExecutionTime = (this->MinimumExecutionTimes->VecData)[i];
-                this->GreatestDOFForPhaseSynchronization = i;
+                this->Step1Cache[i].Store(      this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
+                                            ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
+                                            ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
+                                            ,   this->CurrentInputParameters->TargetVelocityVector->VecData         [i]
+                                            ,   this->CurrentInputParameters->MaxVelocityVector->VecData            [i]
+                                            ,   this->CurrentInputParameters->MaxAccelerationVector->VecData        [i]
+                                            ,   this->UsedStep1AProfiles->VecData                                   [i]
+                                            ,   this->MinimumExecutionTimes->VecData                                [i] );
             }
         }
     }
 
+    return;
+}
+
+
+//*******************************************************************************************
+// Step1SynchronizationTime
+
+void TypeIIRMLPosition::Step1SynchronizationTime(void)
+{
+    double                      MaximalMinimalExecutionTime                     =   0.0
+                            ,   VectorStretchFactorMaxAcceleration              =   0.0
+                            ,   VectorStretchFactorMaxVelocity                  =   0.0
+                            ,   PhaseSyncTimeAverage                            =   0.0;
+
+    unsigned int                i                                               =   0
+                            ,   k                                               =   0
+                            ,   Counter                                         =   0
+                            ,   PhaseSyncDOFCounter                             =   0
+                            ,   NumberOfPassedBeginnings                        =   0
+                            ,   NumberOfPassedEndings                           =   0;
+
+    this->SetupSelectedDOFs();
+
+    for(k = 0; k < this->NumberOfSelectedDOFs; k++)
+    {
+        i   =   (this->SelectedDOFs->VecData)[k];
+
+        if((this->MinimumExecutionTimes->VecData)[i] > MaximalMinimalExecutionTime)
+        {
+            MaximalMinimalExecutionTime = (this->MinimumExecutionTimes->VecData)[i];
+            this->GreatestDOFForPhaseSynchronization = i;
+        }
+    }
+
     this->SetupModifiedSelectionVector();
     // From now on, we only use the modified selection vector.
 
@@ -118,25 +178,24 @@ void TypeIIRMLPosition::Step1(void)
         VectorStretchFactorMaxVelocity      =   (this->CurrentInputParameters->MaxVelocityVector->VecData)[this->GreatestDOFForPhaseSynchronization]
                                                 / fabs((this->PhaseSynchronizationReferenceVector->VecData)[this->GreatestDOFForPhaseSynchronization]);
 
-        for(i = 0; i < this->NumberOfDOFs; i++)
+        for(k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if((this->ModifiedSelectionVector->VecData)[i])
-            {
-                (this->PhaseSynchronizationTimeVector->VecData)[i]              =   0.0;
+            i   =   (this->ModifiedDOFs->VecData)[k];
 
-                (this->PhaseSynchronizationMaxAccelerationVector->VecData)[i]   =   fabs(VectorStretchFactorMaxAcceleration
-                                                                                            * (this->PhaseSynchronizationReferenceVector->VecData)[i]);
-                (this->PhaseSynchronizationMaxVelocityVector->VecData)[i]       =   fabs(VectorStretchFactorMaxVelocity
-                                                                                            * (this->PhaseSynchronizationReferenceVector->VecData)[i]);
+            (this->PhaseSynchronizationTimeVector->VecData)[i]              =   0.0;
 
-                if  (   ( (this->PhaseSynchronizationMaxAccelerationVector->VecData)[i]
-                        > ( (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i] * ( 1.0 + RELATIVE_PHASE_SYNC_EPSILON ) + ABSOLUTE_PHASE_SYNC_EPSILON ) )
-                    ||  ( (this->PhaseSynchronizationMaxVelocityVector->VecData)[i]
-                        > ( (this->CurrentInputParameters->MaxVelocityVector->VecData)[i] * ( 1.0 + RELATIVE_PHASE_SYNC_EPSILON ) + ABSOLUTE_PHASE_SYNC_EPSILON ) ) )
-                {
-                    this->CurrentTrajectoryIsPhaseSynchronized = false;
-                    break;
-                }
+            (this->PhaseSynchronizationMaxAccelerationVector->VecData)[i]   =   fabs(VectorStretchFactorMaxAcceleration
+                                                                                        * (this->PhaseSynchronizationReferenceVector->VecData)[i]);
+            (this->PhaseSynchronizationMaxVelocityVector->VecData)[i]       =   fabs(VectorStretchFactorMaxVelocity
+                                                                                        * (this->PhaseSynchronizationReferenceVector->VecData)[i]);
+
+            if  (   ( (this->PhaseSynchronizationMaxAccelerationVector->VecData)[i]
+                    > ( (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i] * ( 1.0 + RELATIVE_PHASE_SYNC_EPSILON ) + ABSOLUTE_PHASE_SYNC_EPSILON ) )
+                ||  ( (this->PhaseSynchronizationMaxVelocityVector->VecData)[i]
+                    > ( (this->CurrentInputParameters->MaxVelocityVector->VecData)[i] * ( 1.0 + RELATIVE_PHASE_SYNC_EPSILON ) + ABSOLUTE_PHASE_SYNC_EPSILON ) ) )
+            {
+                this->CurrentTrajectoryIsPhaseSynchronized = false;
+                break;
             }
         }
     }
@@ -154,8 +213,10 @@ void TypeIIRMLPosition::Step1(void)
 
         // check, whether all DOFs can be reached with the profile of the this->GreatestDOFForPhaseSynchronization
 
-        for(i = 0; i < this->NumberOfDOFs; i++)
+        for(k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
             if (!Decision_1A__001(this->PhaseSynchronizationCurrentVelocityVector->VecData[i]))
             {
                 NegateStep1(        &(this->PhaseSynchronizationCurrentPositionVector->VecData      [i] )
@@ -194,77 +255,73 @@ void TypeIIRMLPosition::Step1(void)
         {
         case Step1_Profile_PosLinHldNegLin:
         case Step1_Profile_NegLinHldPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                if (!IsSolutionForProfile_PosLinHldNegLin_Possible(     this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
                 {
-                    if (!IsSolutionForProfile_PosLinHldNegLin_Possible(     this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                                        ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
-                    {
-                        this->CurrentTrajectoryIsPhaseSynchronized = false;
-                        break;
-                    }
+                    this->CurrentTrajectoryIsPhaseSynchronized = false;
+                    break;
                 }
             }
             break;
         case Step1_Profile_PosLinNegLin:
         case Step1_Profile_NegLinPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                if (!IsSolutionForProfile_PosLinNegLin_Possible(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                                ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                                ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                                ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                                ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                                ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
                 {
-                    if (!IsSolutionForProfile_PosLinNegLin_Possible(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
-                    {
-                        this->CurrentTrajectoryIsPhaseSynchronized = false;
-                        break;
-                    }
+                    this->CurrentTrajectoryIsPhaseSynchronized = false;
+                    break;
                 }
             }
             break;
         case Step1_Profile_PosTrapNegLin:
         case Step1_Profile_NegTrapPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                if (!IsSolutionForProfile_PosTrapNegLin_Possible(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
                 {
-                    if (!IsSolutionForProfile_PosTrapNegLin_Possible(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                                        ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
-                    {
-                        this->CurrentTrajectoryIsPhaseSynchronized = false;
-                        break;
-                    }
+                    this->CurrentTrajectoryIsPhaseSynchronized = false;
+                    break;
                 }
             }
             break;
         case Step1_Profile_PosTriNegLin:
         case Step1_Profile_NegTriPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                if (!IsSolutionForProfile_PosTriNegLin_Possible(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                                ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                                ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                                ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                                ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                                ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
                 {
-                    if (!IsSolutionForProfile_PosTriNegLin_Possible(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] ))
-                    {
-                        this->CurrentTrajectoryIsPhaseSynchronized = false;
-                        break;
-                    }
+                    this->CurrentTrajectoryIsPhaseSynchronized = false;
+                    break;
                 }
             }
             break;
@@ -288,64 +345,60 @@ void TypeIIRMLPosition::Step1(void)
         {
         case Step1_Profile_PosLinHldNegLin:
         case Step1_Profile_NegLinHldPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    this->PhaseSynchronizationTimeVector->VecData[i]
-                        +=  ProfileStep1PosLinHldNegLin(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                this->PhaseSynchronizationTimeVector->VecData[i]
+                    +=  ProfileStep1PosLinHldNegLin(    this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
             }
             break;
         case Step1_Profile_PosLinNegLin:
         case Step1_Profile_NegLinPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    this->PhaseSynchronizationTimeVector->VecData[i]
-                        +=  ProfileStep1PosLinNegLin(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                this->PhaseSynchronizationTimeVector->VecData[i]
+                    +=  ProfileStep1PosLinNegLin(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
             }
             break;
         case Step1_Profile_PosTrapNegLin:
         case Step1_Profile_NegTrapPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    this->PhaseSynchronizationTimeVector->VecData[i]
-                        +=  ProfileStep1PosTrapNegLin(      this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
-                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                this->PhaseSynchronizationTimeVector->VecData[i]
+                    +=  ProfileStep1PosTrapNegLin(      this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationMaxVelocityVector->VecData        [i]
+                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
             }
             break;
         case Step1_Profile_PosTriNegLin:
         case Step1_Profile_NegTriPosLin:
-            for(i = 0; i < this->NumberOfDOFs; i++)
+            for(k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    this->PhaseSynchronizationTimeVector->VecData[i]
-                        +=  ProfileStep1PosTriNegLin(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
-                                                        ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
-                                                        ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                this->PhaseSynchronizationTimeVector->VecData[i]
+                    +=  ProfileStep1PosTriNegLin(       this->PhaseSynchronizationCurrentPositionVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationCurrentVelocityVector->VecData    [i]
+                                                    ,   this->PhaseSynchronizationTargetPositionVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationTargetVelocityVector->VecData     [i]
+                                                    ,   this->PhaseSynchronizationMaxAccelerationVector->VecData    [i] );
             }
             break;
         default:
@@ -356,13 +409,12 @@ void TypeIIRMLPosition::Step1(void)
         PhaseSyncTimeAverage    =   0.0;
         PhaseSyncDOFCounter     =   0;
 
-        for(i = 0; i < this->NumberOfDOFs; i++)
+        for(k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if((this->ModifiedSelectionVector->VecData)[i])
-            {
-                PhaseSyncTimeAverage    +=  (this->PhaseSynchronizationTimeVector->VecData)[i];
-                PhaseSyncDOFCounter++;
-            }
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            PhaseSyncTimeAverage    +=  (this->PhaseSynchronizationTimeVector->VecData)[i];
+            PhaseSyncDOFCounter++;
         }
 
         if (PhaseSyncDOFCounter == 0)
@@ -372,16 +424,15 @@ void TypeIIRMLPosition::Step1(void)
 
         PhaseSyncTimeAverage /= ((double)PhaseSyncDOFCounter);
 
-        for(i = 0; i < this->NumberOfDOFs; i++)
+        for(k = 0; k < this->NumberOfModifiedDOFs; k++)
         {
-            if ((this->ModifiedSelectionVector->VecData)[i])
+            i   =   (this->ModifiedDOFs->VecData)[k];
+
+            if ( fabs((this->PhaseSynchronizationTimeVector->VecData)[i] - PhaseSyncTimeAverage)
+                > (ABSOLUTE_PHASE_SYNC_EPSILON + RELATIVE_PHASE_SYNC_EPSILON * PhaseSyncTimeAverage) )
             {
-                if ( fabs((this->PhaseSynchronizationTimeVector->VecData)[i] - PhaseSyncTimeAverage)
-                    > (ABSOLUTE_PHASE_SYNC_EPSILON + RELATIVE_PHASE_SYNC_EPSILON * PhaseSyncTimeAverage) )
-                {
-                        this->CurrentTrajectoryIsPhaseSynchronized = false;
-                        break;
-                }
+                    this->CurrentTrajectoryIsPhaseSynchronized = false;
+                    break;
             }
         }
     }
@@ -395,72 +446,84 @@ void TypeIIRMLPosition::Step1(void)
     // ******************************************************************
     // Decision trees 1B and 1C
 
-    for(i = 0; i < this->NumberOfDOFs; i++)
+    // The inoperative time intervals of degrees of freedom that are not
+    // part of TypeIIRMLPosition::ModifiedDOFs are never read.
+    for(k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if ((this->ModifiedSelectionVector->VecData)[i])
+        i   =   (this->ModifiedDOFs->VecData)[k];
+
+        // The cache entry of this DOF was matched or stored by
+        // Step1MinimumExecutionTimes() for the current input values.
+        if (    (this->UseStep1Cache)
+            &&  (this->Step1Cache[i].InoperativeTimeIntervalIsValid)   )
+        {
+            this->BeginningsOfInoperativeTimeIntervals->VecData [i] =   this->Step1Cache[i].BeginningOfInoperativeTimeInterval  ;
+            this->EndingsOfInoperativeTimeIntervals->VecData    [i] =   this->Step1Cache[i].EndingOfInoperativeTimeInterval     ;
+            continue;
+        }
+
+        TypeIIRMLDecisionTree1B(        this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
+                                    ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
+                                    ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
+                                    ,   this->CurrentInputParameters->TargetVelocityVector->VecData         [i]
+                                    ,   this->CurrentInputParameters->MaxVelocityVector->VecData            [i]
+                                    ,   this->CurrentInputParameters->MaxAccelerationVector->VecData        [i]
+                                    ,   &(this->BeginningsOfInoperativeTimeIntervals->VecData               [i]));
+
+        if (this->BeginningsOfInoperativeTimeIntervals->VecData[i] != RML_INFINITY)
         {
-            TypeIIRMLDecisionTree1B(        this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
+            TypeIIRMLDecisionTree1C(        this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
                                         ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
                                         ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
                                         ,   this->CurrentInputParameters->TargetVelocityVector->VecData         [i]
                                         ,   this->CurrentInputParameters->MaxVelocityVector->VecData            [i]
                                         ,   this->CurrentInputParameters->MaxAccelerationVector->VecData        [i]
-                                        ,   &(this->BeginningsOfInoperativeTimeIntervals->VecData               [i]));
-
-            if (this->BeginningsOfInoperativeTimeIntervals->VecData[i] != RML_INFINITY)
-            {
-                TypeIIRMLDecisionTree1C(        this->CurrentInputParameters->CurrentPositionVector->VecData        [i]
-                                            ,   this->CurrentInputParameters->CurrentVelocityVector->VecData        [i]
-                                            ,   this->CurrentInputParameters->TargetPositionVector->VecData         [i]
-                                            ,   this->CurrentInputParameters->TargetVelocityVector->VecData         [i]
-                                            ,   this->CurrentInputParameters->MaxVelocityVector->VecData            [i]
-                                            ,   this->CurrentInputParameters->MaxAccelerationVector->VecData        [i]
-                                            ,   &(this->EndingsOfInoperativeTimeIntervals->VecData                  [i]));
-            }
-            else
-            {
-                this->EndingsOfInoperativeTimeIntervals->VecData[i] =   RML_INFINITY;
-            }
+                                        ,   &(this->EndingsOfInoperativeTimeIntervals->VecData                  [i]));
         }
         else
         {
-            this->BeginningsOfInoperativeTimeIntervals->VecData [i] =   RML_INFINITY;
-            this->EndingsOfInoperativeTimeIntervals->VecData    [i] =   RML_INFINITY;
+            this->EndingsOfInoperativeTimeIntervals->VecData[i] =   RML_INFINITY;
+        }
+
+        if (this->UseStep1Cache)
+        {
+            this->Step1Cache[i].BeginningOfInoperativeTimeInterval  =   this->BeginningsOfInoperativeTimeIntervals->VecData [i] ;
+            this->Step1Cache[i].EndingOfInoperativeTimeInterval     =   this->EndingsOfInoperativeTimeIntervals->VecData    [i] ;
+            this->Step1Cache[i].InoperativeTimeIntervalIsValid      =   true                                                    ;
         }
     }
 
-    for(i = 0; i < this->NumberOfDOFs; i++)
+    for(k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if((this->ModifiedSelectionVector->VecData)[i])
-        {
-            if ( (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
-            {
-                (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
-                    =   (this->MinimumExecutionTimes->VecData)[i];
-            }
+        i   =   (this->ModifiedDOFs->VecData)[k];
 
-            if ( (this->EndingsOfInoperativeTimeIntervals->VecData)[i] < (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] )
-            {
-                (this->EndingsOfInoperativeTimeIntervals->VecData)[i]
-                    =   (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
-                    =   ((this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
-                        +   (this->EndingsOfInoperativeTimeIntervals->VecData)[i]) * 0.5;
+        if ( (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
+        {
+            (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
+                =   (this->MinimumExecutionTimes->VecData)[i];
+        }
 
-                if ( (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
-                {
-                    (this->MinimumExecutionTimes->VecData)[i]
-                        =   (this->EndingsOfInoperativeTimeIntervals->VecData)[i];
-                    (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]    =   RML_INFINITY;
-                    (this->EndingsOfInoperativeTimeIntervals->VecData)[i]       =   RML_INFINITY;
-                }
-            }
+        if ( (this->EndingsOfInoperativeTimeIntervals->VecData)[i] < (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] )
+        {
+            (this->EndingsOfInoperativeTimeIntervals->VecData)[i]
+                =   (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
+                =   ((this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
+                    +   (this->EndingsOfInoperativeTimeIntervals->VecData)[i]) * 0.5;
 
-            if ( (this->EndingsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
+            if ( (this->BeginningsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
             {
+                (this->MinimumExecutionTimes->VecData)[i]
+                    =   (this->EndingsOfInoperativeTimeIntervals->VecData)[i];
                 (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]    =   RML_INFINITY;
                 (this->EndingsOfInoperativeTimeIntervals->VecData)[i]       =   RML_INFINITY;
             }
         }
+
+        if ( (this->EndingsOfInoperativeTimeIntervals->VecData)[i] < (this->MinimumExecutionTimes->VecData)[i] )
+        {
+            (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]    =   RML_INFINITY;
+            (this->EndingsOfInoperativeTimeIntervals->VecData)[i]       =   RML_INFINITY;
+        }
     }
 
 
@@ -468,26 +531,30 @@ void TypeIIRMLPosition::Step1(void)
     // Calculate tsync
 
     // Determine the maximum of the minimal execution times
-    for(i = 0; i < this->NumberOfDOFs; i++)
+    for(k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if(!(this->ModifiedSelectionVector->VecData)[i])
-        {
-            (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]        = RML_INFINITY;
-            (this->EndingsOfInoperativeTimeIntervals->VecData)[i]           = RML_INFINITY;
-        }
+        i   =   (this->ModifiedDOFs->VecData)[k];
 
-        (this->ArrayOfSortedTimes->VecData)[i]
+        (this->ArrayOfSortedTimes->VecData)[k]
                 =   (this->BeginningsOfInoperativeTimeIntervals->VecData)[i];
 
-        (this->ArrayOfSortedTimes->VecData)[i + this->NumberOfDOFs]
+        (this->ArrayOfSortedTimes->VecData)[k + this->NumberOfModifiedDOFs]
                 =   (this->EndingsOfInoperativeTimeIntervals->VecData)[i];
     }
 
-    // Quicksort sorts all values of AlternativeExecutuionTime independent of the SelectionVector
-    // because of that the alternative execution times of all no selected DOFs are set to infinity
+    // The alternative execution times of all DOFs that are not selected by
+    // the modified selection vector are set to infinity, such that only the
+    // first 2 * NumberOfModifiedDOFs values have to be sorted.
+    for(i = 2 * this->NumberOfModifiedDOFs; i < 2 * this->NumberOfDOFs; i++)
+    {
+        (this->ArrayOfSortedTimes->VecData)[i]  =   RML_INFINITY;
+    }
 
     // Sort the alternative execution times
-    Quicksort(0, (2 * this->NumberOfDOFs - 1), &((this->ArrayOfSortedTimes->VecData)[0]));
+    if (this->NumberOfModifiedDOFs > 0)
+    {
+        Quicksort(0, (2 * this->NumberOfModifiedDOFs - 1), &((this->ArrayOfSortedTimes->VecData)[0]));
+    }
 
     // Which alternative execution times are bigger than the maximum of the minimal execution times
     for (Counter = 0; Counter < 2 * this->NumberOfDOFs; Counter++)
@@ -500,10 +567,12 @@ void TypeIIRMLPosition::Step1(void)
 
     this->SynchronizationTime = MaximalMinimalExecutionTime;
 
+    this->SortInoperativeTimeIntervals();
+
     //calculate the minimal time, which is not in death-zone
     while((IsWithinAnInoperativeTimeInterval(   this->SynchronizationTime
-                                            ,   *(this->BeginningsOfInoperativeTimeIntervals)
-                                            ,   *(this->EndingsOfInoperativeTimeIntervals)      ) )
+                                            ,   &NumberOfPassedBeginnings
+                                            ,   &NumberOfPassedEndings          ) )
             && (Counter < 2 * this->NumberOfDOFs) )
     {
         this->SynchronizationTime = (this->ArrayOfSortedTimes->VecData)[Counter];
@@ -514,26 +583,158 @@ void TypeIIRMLPosition::Step1(void)
 }
 
 
+//************************************************************************************
+// SortInoperativeTimeIntervals
+
+void TypeIIRMLPosition::SortInoperativeTimeIntervals(void)
+{
+    unsigned int            i
+                        ,   k;
+
+    this->NumberOfInoperativeTimeIntervals  =   0;
+
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
+    {
+        i   =   (this->ModifiedDOFs->VecData)[k];
+
+        // Empty intervals cannot contain any candidate.
+        if (    (this->BeginningsOfInoperativeTimeIntervals->VecData)[i]
+            <   (this->EndingsOfInoperativeTimeIntervals->VecData)[i]       )
+        {
+            (this->SortedBeginningsOfInoperativeTimeIntervals->VecData)[this->NumberOfInoperativeTimeIntervals]
+                =   (this->BeginningsOfInoperativeTimeIntervals->VecData)[i];
+            (this->SortedEndingsOfInoperativeTimeIntervals->VecData)[this->NumberOfInoperativeTimeIntervals]
+                =   (this->EndingsOfInoperativeTimeIntervals->VecData)[i];
+            this->NumberOfInoperativeTimeIntervals++;
+        }
+    }
+
+    if (this->NumberOfInoperativeTimeIntervals > 1)
+    {
+        Quicksort(      0
+                    ,   (int)this->NumberOfInoperativeTimeIntervals - 1
+                    ,   this->SortedBeginningsOfInoperativeTimeIntervals->VecData   );
+        Quicksort(      0
+                    ,   (int)this->NumberOfInoperativeTimeIntervals - 1
+                    ,   this->SortedEndingsOfInoperativeTimeIntervals->VecData      );
+    }
+
+    return;
+}
+
+
 //************************************************************************************
 // IsWithinAnInoperativeTimeInterval
 
 bool TypeIIRMLPosition::IsWithinAnInoperativeTimeInterval(      const double            &SynchronizationTimeCandidate
-                                                            ,   const RMLDoubleVector   &MaximalExecutionTime
-                                                            ,   const RMLDoubleVector   &AlternativeExecutionTime) const
+                                                            ,   unsigned int            *NumberOfPassedBeginnings
+                                                            ,   unsigned int            *NumberOfPassedEndings      ) const
+{
+    while (     (*NumberOfPassedBeginnings < this->NumberOfInoperativeTimeIntervals)
+            &&  ((this->SortedBeginningsOfInoperativeTimeIntervals->VecData)[*NumberOfPassedBeginnings] < SynchronizationTimeCandidate) )
+    {
+        (*NumberOfPassedBeginnings)++;
+    }
+
+    while (     (*NumberOfPassedEndings < this->NumberOfInoperativeTimeIntervals)
+            &&  ((this->SortedEndingsOfInoperativeTimeIntervals->VecData)[*NumberOfPassedEndings] <= SynchronizationTimeCandidate) )
+    {
+        (*NumberOfPassedEndings)++;
+    }
+
+    // Each interval, whose ending was passed, was also begun before, such
+    // that the difference is the number of intervals containing the
+    // candidate.
+    return(*NumberOfPassedBeginnings > *NumberOfPassedEndings);
+}
+
+
+
+//************************************************************************************
+// ApplyMinimumSynchronizationTime
+
+void TypeIIRMLPosition::ApplyMinimumSynchronizationTime(const RMLPositionFlags &Flags)
 {
-    unsigned int            i;
+    bool                    MinimumTimeIsRelevant           =   false
+                        ,   CandidateIsFinal                =   false
+                        ,   CandidateIsInoperative          =   false;
+
+    unsigned int            i                               =   0
+                        ,   FirstCandidate                  =   2 * this->NumberOfDOFs
+                        ,   NumberOfPassedBeginnings        =   0
+                        ,   NumberOfPassedEndings           =   0;
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    double                  Candidate                       =   this->CurrentInputParameters->MinimumSynchronizationTime;
+
+    MinimumTimeIsRelevant   =       (Flags.SynchronizationBehavior                              !=  RMLFlags::NO_SYNCHRONIZATION)
+                                &&  (this->CurrentInputParameters->MinimumSynchronizationTime   >   this->SynchronizationTime   );
+
+    if (!Flags.EnableDeterministicTiming)
     {
-        if ((this->ModifiedSelectionVector->VecData)[i])
+        if (MinimumTimeIsRelevant)
         {
-            if (    ((MaximalExecutionTime.VecData)[i] < SynchronizationTimeCandidate)
-                &&  (SynchronizationTimeCandidate < (AlternativeExecutionTime.VecData)[i]) )
+            for (i = 0; i < 2 * this->NumberOfDOFs; i++)
             {
-                return(true);
+                if ((this->ArrayOfSortedTimes->VecData)[i] > this->CurrentInputParameters->MinimumSynchronizationTime)
+                {
+                    break;
+                }
+            }
+
+            this->SynchronizationTime = this->CurrentInputParameters->MinimumSynchronizationTime;
+
+            this->SortInoperativeTimeIntervals();
+
+            //calculate the minimal time, which is not in death-zone
+            while((IsWithinAnInoperativeTimeInterval(   this->SynchronizationTime
+                                                    ,   &NumberOfPassedBeginnings
+                                                    ,   &NumberOfPassedEndings          ) )
+                    && (i < 2 * this->NumberOfDOFs) )
+            {
+                this->SynchronizationTime = (this->ArrayOfSortedTimes->VecData)[i];
+                i++;
             }
         }
     }
-    return(false);
-}
+    else
+    {
+        // Same result as above, but with a fixed number of iterations
+        // (cf. RMLPositionFlags::EnableDeterministicTiming)
+        this->SortInoperativeTimeIntervals();
 
+        for (i = 0; i < 2 * this->NumberOfDOFs; i++)
+        {
+            if (    ((this->ArrayOfSortedTimes->VecData)[i] > this->CurrentInputParameters->MinimumSynchronizationTime)
+                &&  (FirstCandidate == 2 * this->NumberOfDOFs)  )
+            {
+                FirstCandidate  =   i;
+            }
+        }
+
+        for (i = 0; i < 2 * this->NumberOfDOFs; i++)
+        {
+            CandidateIsInoperative  =   IsWithinAnInoperativeTimeInterval(      Candidate
+                                                                            ,   &NumberOfPassedBeginnings
+                                                                            ,   &NumberOfPassedEndings          );
+
+            if ((i >= FirstCandidate) && (!CandidateIsFinal))
+            {
+                if (CandidateIsInoperative)
+                {
+                    Candidate           =   (this->ArrayOfSortedTimes->VecData)[i];
+                }
+                else
+                {
+                    CandidateIsFinal    =   true;
+                }
+            }
+        }
+
+        if (MinimumTimeIsRelevant)
+        {
+            this->SynchronizationTime = Candidate;
+        }
+    }
+
+    return;
+}
@@ -56,7 +56,8 @@ using namespace TypeIIRMLMath;
 
 void TypeIIRMLPosition::Step2(void)
 {
-    unsigned int        i                   =   0;
+    unsigned int        i                   =   0
+                    ,   k                   =   0;
 
     if (this->CurrentTrajectoryIsPhaseSynchronized)
     {
@@ -69,37 +70,35 @@ void TypeIIRMLPosition::Step2(void)
     {
         if (this->CurrentTrajectoryIsNotSynchronized)
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    Step2WithoutSynchronization(        (this->CurrentInputParameters->CurrentPositionVector->VecData)      [i]
-                                                    ,   (this->CurrentInputParameters->CurrentVelocityVector->VecData)      [i]
-                                                    ,   (this->CurrentInputParameters->TargetPositionVector->VecData)       [i]
-                                                    ,   (this->CurrentInputParameters->TargetVelocityVector->VecData)       [i]
-                                                    ,   (this->CurrentInputParameters->MaxVelocityVector->VecData)          [i]
-                                                    ,   (this->CurrentInputParameters->MaxAccelerationVector->VecData)      [i]
-                                                    ,   (this->UsedStep1AProfiles->VecData)                                 [i]
-                                                    ,   (this->MinimumExecutionTimes->VecData)                              [i]
-                                                    ,   &((this->Polynomials)[i])   );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                Step2WithoutSynchronization(        (this->CurrentInputParameters->CurrentPositionVector->VecData)      [i]
+                                                ,   (this->CurrentInputParameters->CurrentVelocityVector->VecData)      [i]
+                                                ,   (this->CurrentInputParameters->TargetPositionVector->VecData)       [i]
+                                                ,   (this->CurrentInputParameters->TargetVelocityVector->VecData)       [i]
+                                                ,   (this->CurrentInputParameters->MaxVelocityVector->VecData)          [i]
+                                                ,   (this->CurrentInputParameters->MaxAccelerationVector->VecData)      [i]
+                                                ,   (this->UsedStep1AProfiles->VecData)                                 [i]
+                                                ,   (this->MinimumExecutionTimes->VecData)                              [i]
+                                                ,   &((this->Polynomials)[i])   );
             }
         }
         else
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfModifiedDOFs; k++)
             {
-                if((this->ModifiedSelectionVector->VecData)[i])
-                {
-                    TypeIIRMLDecisionTree2(     (this->CurrentInputParameters->CurrentPositionVector->VecData)      [i]
-                                            ,   (this->CurrentInputParameters->CurrentVelocityVector->VecData)      [i]
-                                            ,   (this->CurrentInputParameters->TargetPositionVector->VecData)       [i]
-                                            ,   (this->CurrentInputParameters->TargetVelocityVector->VecData)       [i]
-                                            ,   (this->CurrentInputParameters->MaxVelocityVector->VecData)          [i]
-                                            ,   (this->CurrentInputParameters->MaxAccelerationVector->VecData)      [i]
-                                            ,   this->SynchronizationTime
-                                            ,   &((this->Polynomials)[i])   );
-                }
+                i   =   (this->ModifiedDOFs->VecData)[k];
+
+                TypeIIRMLDecisionTree2(     (this->CurrentInputParameters->CurrentPositionVector->VecData)      [i]
+                                        ,   (this->CurrentInputParameters->CurrentVelocityVector->VecData)      [i]
+                                        ,   (this->CurrentInputParameters->TargetPositionVector->VecData)       [i]
+                                        ,   (this->CurrentInputParameters->TargetVelocityVector->VecData)       [i]
+                                        ,   (this->CurrentInputParameters->MaxVelocityVector->VecData)          [i]
+                                        ,   (this->CurrentInputParameters->MaxAccelerationVector->VecData)      [i]
+                                        ,   this->SynchronizationTime
+                                        ,   &((this->Polynomials)[i])   );
             }
         }
     }
@@ -53,7 +53,8 @@ using namespace TypeIIRMLMath;
 void TypeIIRMLPosition::Step2PhaseSynchronization(void)
 {
     unsigned int        i                                   =   0
-                    ,   j                                   =   0   ;
+                    ,   j                                   =   0
+                    ,   k                                   =   0   ;
 
     double              P_a0                                =   0.0
                     ,   P_a1                                =   0.0
@@ -91,84 +92,88 @@ void TypeIIRMLPosition::Step2PhaseSynchronization(void)
 
     // Calculate the trajectory of all other selected DOFs
 
-    for (i = 0; i < this->NumberOfDOFs; i++)
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
     {
-        if ( (this->ModifiedSelectionVector->VecData)[i] && (i != this->GreatestDOFForPhaseSynchronization) )
-        {
-            ScalingValueFromReferenceVector =   (this->PhaseSynchronizationReferenceVector->VecData)[i]
-                                                    / (this->PhaseSynchronizationReferenceVector->VecData)[this->GreatestDOFForPhaseSynchronization];
-
-            for (j = 0; j < ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).ValidPolynomials; j++)
-            {
-                ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).PositionPolynomial[j].GetCoefficients       (&P_a2, &P_a1,  &P_a0,  &DeltaT);
-                ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).VelocityPolynomial[j].GetCoefficients       (&V_a2, &V_a1,  &V_a0,  &DeltaT);
-                ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).AccelerationPolynomial[j].GetCoefficients   (&A_a2, &A_a1,  &A_a0,  &DeltaT);
+        i   =   (this->ModifiedDOFs->VecData)[k];
 
-                P_a2    *=  ScalingValueFromReferenceVector;
-                P_a1    *=  ScalingValueFromReferenceVector;
-                P_a0    =   ((this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
-                            + (P_a0
-                            - (this->CurrentInputParameters->CurrentPositionVector->VecData)[this->GreatestDOFForPhaseSynchronization])
-                            * ScalingValueFromReferenceVector);
+        if (i == this->GreatestDOFForPhaseSynchronization)
+        {
+            continue;
+        }
 
-                V_a2    *=  ScalingValueFromReferenceVector;
-                V_a1    *=  ScalingValueFromReferenceVector;
-                V_a0    *=  ScalingValueFromReferenceVector;
+        ScalingValueFromReferenceVector =   (this->PhaseSynchronizationReferenceVector->VecData)[i]
+                                                / (this->PhaseSynchronizationReferenceVector->VecData)[this->GreatestDOFForPhaseSynchronization];
 
-                A_a2    *=  ScalingValueFromReferenceVector;
-                A_a1    *=  ScalingValueFromReferenceVector;
-                A_a0    *=  ScalingValueFromReferenceVector;
+        for (j = 0; j < ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).ValidPolynomials; j++)
+        {
+            ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).PositionPolynomial[j].GetCoefficients       (&P_a2, &P_a1,  &P_a0,  &DeltaT);
+            ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).VelocityPolynomial[j].GetCoefficients       (&V_a2, &V_a1,  &V_a0,  &DeltaT);
+            ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).AccelerationPolynomial[j].GetCoefficients   (&A_a2, &A_a1,  &A_a0,  &DeltaT);
+
+            P_a2    *=  ScalingValueFromReferenceVector;
+            P_a1    *=  ScalingValueFromReferenceVector;
+            P_a0    =   ((this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                        + (P_a0
+                        - (this->CurrentInputParameters->CurrentPositionVector->VecData)[this->GreatestDOFForPhaseSynchronization])
+                        * ScalingValueFromReferenceVector);
+
+            V_a2    *=  ScalingValueFromReferenceVector;
+            V_a1    *=  ScalingValueFromReferenceVector;
+            V_a0    *=  ScalingValueFromReferenceVector;
+
+            A_a2    *=  ScalingValueFromReferenceVector;
+            A_a1    *=  ScalingValueFromReferenceVector;
+            A_a0    *=  ScalingValueFromReferenceVector;
+
+            ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
+            ((this->Polynomials)[i]).VelocityPolynomial[j].SetCoefficients      (V_a2, V_a1, V_a0, DeltaT);
+            ((this->Polynomials)[i]).AccelerationPolynomial[j].SetCoefficients  (A_a2, A_a1, A_a0, DeltaT);
+
+            ((this->Polynomials)[i]).PolynomialTimes[j] = ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).PolynomialTimes[j];
+        }
 
-                ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
-                ((this->Polynomials)[i]).VelocityPolynomial[j].SetCoefficients      (V_a2, V_a1, V_a0, DeltaT);
-                ((this->Polynomials)[i]).AccelerationPolynomial[j].SetCoefficients  (A_a2, A_a1, A_a0, DeltaT);
+        ((this->Polynomials)[i]).ValidPolynomials   =   ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).ValidPolynomials;
 
-                ((this->Polynomials)[i]).PolynomialTimes[j] = ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).PolynomialTimes[j];
-            }
+        // ----------------------------------------------------------
+        // Correcting numerical errors by adding a polynomial of degree one to the existing polynomials
+        // ----------------------------------------------------------
 
-            ((this->Polynomials)[i]).ValidPolynomials   =   ((this->Polynomials)[this->GreatestDOFForPhaseSynchronization]).ValidPolynomials;
+        if (this->SynchronizationTime > this->CycleTime)
+        {
+            V_ErrorAtBeginning  =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                                    -   ((this->Polynomials)[i]).VelocityPolynomial[0].CalculateValue(0.0);
 
-            // ----------------------------------------------------------
-            // Correcting numerical errors by adding a polynomial of degree one to the existing polynomials
-            // ----------------------------------------------------------
+            V_ErrorAtEnd        =   (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
+                                    -   ((this->Polynomials)[i]).VelocityPolynomial[((this->Polynomials)[i]).ValidPolynomials - 1].CalculateValue(this->SynchronizationTime);
 
-            if (this->SynchronizationTime > this->CycleTime)
+            for (j = 0; j < ((this->Polynomials)[i]).ValidPolynomials; j++)
             {
-                V_ErrorAtBeginning  =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
-                                        -   ((this->Polynomials)[i]).VelocityPolynomial[0].CalculateValue(0.0);
-
-                V_ErrorAtEnd        =   (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
-                                        -   ((this->Polynomials)[i]).VelocityPolynomial[((this->Polynomials)[i]).ValidPolynomials - 1].CalculateValue(this->SynchronizationTime);
+                ((this->Polynomials)[i]).PositionPolynomial[j].GetCoefficients      (&P_a2, &P_a1,  &P_a0,  &DeltaT);
+                ((this->Polynomials)[i]).VelocityPolynomial[j].GetCoefficients      (&V_a2, &V_a1,  &V_a0,  &DeltaT);
 
-                for (j = 0; j < ((this->Polynomials)[i]).ValidPolynomials; j++)
-                {
-                    ((this->Polynomials)[i]).PositionPolynomial[j].GetCoefficients      (&P_a2, &P_a1,  &P_a0,  &DeltaT);
-                    ((this->Polynomials)[i]).VelocityPolynomial[j].GetCoefficients      (&V_a2, &V_a1,  &V_a0,  &DeltaT);
+                V_a1    +=  (V_ErrorAtEnd - V_ErrorAtBeginning) / this->SynchronizationTime;
+                V_a0    +=  V_ErrorAtBeginning - DeltaT * (V_ErrorAtEnd - V_ErrorAtBeginning) / this->SynchronizationTime;
 
-                    V_a1    +=  (V_ErrorAtEnd - V_ErrorAtBeginning) / this->SynchronizationTime;
-                    V_a0    +=  V_ErrorAtBeginning - DeltaT * (V_ErrorAtEnd - V_ErrorAtBeginning) / this->SynchronizationTime;
+                P_a1    =   V_a0;
 
-                    P_a1    =   V_a0;
-
-                    ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
-                    ((this->Polynomials)[i]).VelocityPolynomial[j].SetCoefficients      (V_a2, V_a1, V_a0, DeltaT);
-                }
+                ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
+                ((this->Polynomials)[i]).VelocityPolynomial[j].SetCoefficients      (V_a2, V_a1, V_a0, DeltaT);
+            }
 
-                P_ErrorAtEnd        =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
-                                        -   ((this->Polynomials)[i]).PositionPolynomial[((this->Polynomials)[i]).ValidPolynomials - 1].CalculateValue(this->SynchronizationTime);
+            P_ErrorAtEnd        =   (this->CurrentInputParameters->TargetPositionVector->VecData)[i]
+                                    -   ((this->Polynomials)[i]).PositionPolynomial[((this->Polynomials)[i]).ValidPolynomials - 1].CalculateValue(this->SynchronizationTime);
 
-                for (j = 0; j < ((this->Polynomials)[i]).ValidPolynomials; j++)
-                {
-                    ((this->Polynomials)[i]).PositionPolynomial[j].GetCoefficients      (&P_a2, &P_a1,  &P_a0,  &DeltaT);
+            for (j = 0; j < ((this->Polynomials)[i]).ValidPolynomials; j++)
+            {
+                ((this->Polynomials)[i]).PositionPolynomial[j].GetCoefficients      (&P_a2, &P_a1,  &P_a0,  &DeltaT);
 
-                    P_a1    +=  P_ErrorAtEnd / this->SynchronizationTime;
-                    P_a0    -=  DeltaT * P_ErrorAtEnd / this->SynchronizationTime;
+                P_a1    +=  P_ErrorAtEnd / this->SynchronizationTime;
+                P_a0    -=  DeltaT * P_ErrorAtEnd / this->SynchronizationTime;
 
-                    ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
-                }
+                ((this->Polynomials)[i]).PositionPolynomial[j].SetCoefficients      (P_a2, P_a1, P_a0, DeltaT);
             }
-            // ----------------------------------------------------------
         }
+        // ----------------------------------------------------------
     }
 
 }
@@ -54,42 +54,45 @@
 int TypeIIRMLPosition::Step3(       const double                    &TimeValueInSeconds
                                 ,   RMLPositionOutputParameters     *OP                 ) const
 {
-    unsigned int            i                       =   0;
+    unsigned int            i                       =   0
+                        ,   k                       =   0;
 
     int                     j                       =   0
                         ,   ReturnValueForThisMethod = ReflexxesAPI::RML_FINAL_STATE_REACHED;
 
+    // All degrees of freedom that are not part of
+    // TypeIIRMLPosition::ModifiedDOFs keep their current state of motion.
     for (i = 0; i < this->NumberOfDOFs; i++)
     {
-        if ( (this->ModifiedSelectionVector->VecData)[i] )
-        {
-            j = 0;
+        (OP->NewPositionVector->VecData)    [i]
+            =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
+        (OP->NewVelocityVector->VecData)    [i]
+            =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
+        (OP->NewAccelerationVector->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i];
+    }
 
-            while ( (TimeValueInSeconds > (this->Polynomials)[i].PolynomialTimes[j]) && (j < MAXIMAL_NO_OF_POLYNOMIALS - 1))
-            {
-                j++;
-            }
+    for (k = 0; k < this->NumberOfModifiedDOFs; k++)
+    {
+        i   =   (this->ModifiedDOFs->VecData)[k];
 
-            (OP->NewPositionVector->VecData)    [i]
-                =   (this->Polynomials)[i].PositionPolynomial[j].CalculateValue(TimeValueInSeconds);
-            (OP->NewVelocityVector->VecData)    [i]
-                =   (this->Polynomials)[i].VelocityPolynomial[j].CalculateValue(TimeValueInSeconds);
-            (OP->NewAccelerationVector->VecData)[i]
-                =   (this->Polynomials)[i].AccelerationPolynomial[j].CalculateValue(TimeValueInSeconds);
+        j = 0;
 
-            if ( j < ((this->Polynomials)[i].ValidPolynomials) - 1)
-            {
-                ReturnValueForThisMethod = ReflexxesAPI::RML_WORKING;
-            }
+        while ( (TimeValueInSeconds > (this->Polynomials)[i].PolynomialTimes[j]) && (j < MAXIMAL_NO_OF_POLYNOMIALS - 1))
+        {
+            j++;
         }
-        else
+
+        (OP->NewPositionVector->VecData)    [i]
+            =   (this->Polynomials)[i].PositionPolynomial[j].CalculateValue(TimeValueInSeconds);
+        (OP->NewVelocityVector->VecData)    [i]
+            =   (this->Polynomials)[i].VelocityPolynomial[j].CalculateValue(TimeValueInSeconds);
+        (OP->NewAccelerationVector->VecData)[i]
+            =   (this->Polynomials)[i].AccelerationPolynomial[j].CalculateValue(TimeValueInSeconds);
+
+        if ( j < ((this->Polynomials)[i].ValidPolynomials) - 1)
         {
-            (OP->NewPositionVector->VecData)    [i]
-                =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
-            (OP->NewVelocityVector->VecData)    [i]
-                =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
-            (OP->NewAccelerationVector->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i];
+            ReturnValueForThisMethod = ReflexxesAPI::RML_WORKING;
         }
     }
 
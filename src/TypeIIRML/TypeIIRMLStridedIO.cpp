@@ -0,0 +1,226 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLStridedIO.cpp
+//!
+//! \brief
+//! Implementation file for the variants of the methods
+//! TypeIIRMLPosition::GetNextStateOfMotion() and
+//! TypeIIRMLVelocity::GetNextStateOfMotion() that operate on caller-owned
+//! memory
+//!
+//! \details
+//! The input and output values are described by the views of
+//! ReflexxesCAPI.h. For further information, please refer to the files
+//! TypeIIRMLPosition.h and TypeIIRMLVelocity.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLVelocity.h>
+#include <RMLPositionInputParameters.h>
+#include <RMLPositionOutputParameters.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLVector.h>
+#include <ReflexxesAPI.h>
+#include <ReflexxesCAPI.h>
+
+
+//****************************************************************************
+// ReadView()
+
+static inline void ReadView(        const rml_const_array   &View
+                                ,   RMLDoubleVector         *Vector)
+{
+    unsigned int        i           =   0       ;
+
+    const char          *Element    =   (const char*)View.data;
+
+    if (Element == NULL)
+    {
+        Vector->Set(0.0);
+        return;
+    }
+
+    for (i = 0; i < Vector->GetVecDim(); i++)
+    {
+        Vector->VecData[i]  =   *((const double*)Element);
+        Element             +=  View.stride;
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// WriteView()
+
+static inline void WriteView(       const RMLDoubleVector   &Vector
+                                ,   const rml_array         &View)
+{
+    unsigned int        i           =   0       ;
+
+    char                *Element    =   (char*)View.data;
+
+    if (Element == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < Vector.GetVecDim(); i++)
+    {
+        *((double*)Element) =   Vector.VecData[i];
+        Element             +=  View.stride;
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// ReadInputView()
+
+static void ReadInputView(      const rml_in_view   &InputValues
+                            ,   RMLInputParameters  *InputParameters)
+{
+    unsigned int            i           =   0       ;
+
+    const unsigned char     *Element    =   InputValues.selection;
+
+    ReadView(InputValues.current_position       , InputParameters->CurrentPositionVector        );
+    ReadView(InputValues.current_velocity       , InputParameters->CurrentVelocityVector        );
+    ReadView(InputValues.current_acceleration   , InputParameters->CurrentAccelerationVector    );
+    ReadView(InputValues.max_acceleration       , InputParameters->MaxAccelerationVector        );
+    ReadView(InputValues.max_jerk               , InputParameters->MaxJerkVector                );
+    ReadView(InputValues.target_velocity        , InputParameters->TargetVelocityVector         );
+
+    if (Element == NULL)
+    {
+        InputParameters->SelectionVector->Set(true);
+    }
+    else
+    {
+        for (i = 0; i < InputParameters->GetNumberOfDOFs(); i++)
+        {
+            InputParameters->SelectionVector->VecData[i]    =   (*Element != 0);
+            Element                                         +=  InputValues.selection_stride;
+        }
+    }
+
+    InputParameters->MinimumSynchronizationTime =   InputValues.minimum_synchronization_time;
+
+    return;
+}
+
+
+//****************************************************************************
+// WriteOutputView()
+
+static void WriteOutputView(        const RMLOutputParameters   &OutputParameters
+                                ,   rml_out_view                *OutputValues)
+{
+    WriteView(*(OutputParameters.NewPositionVector)                 , OutputValues->new_position            );
+    WriteView(*(OutputParameters.NewVelocityVector)                 , OutputValues->new_velocity            );
+    WriteView(*(OutputParameters.NewAccelerationVector)             , OutputValues->new_acceleration        );
+    WriteView(*(OutputParameters.ExecutionTimes)                    , OutputValues->execution_times         );
+    WriteView(*(OutputParameters.MinPosExtremaPositionVectorOnly)   , OutputValues->min_position_extrema    );
+    WriteView(*(OutputParameters.MaxPosExtremaPositionVectorOnly)   , OutputValues->max_position_extrema    );
+    WriteView(*(OutputParameters.MinExtremaTimesVector)             , OutputValues->min_extrema_times       );
+    WriteView(*(OutputParameters.MaxExtremaTimesVector)             , OutputValues->max_extrema_times       );
+
+    OutputValues->synchronization_time                  =   OutputParameters.SynchronizationTime               ;
+    OutputValues->a_new_calculation_was_performed       =   OutputParameters.ANewCalculationWasPerformed       ;
+    OutputValues->trajectory_is_phase_synchronized      =   OutputParameters.TrajectoryIsPhaseSynchronized     ;
+    OutputValues->dof_with_the_greatest_execution_time  =   OutputParameters.DOFWithTheGreatestExecutionTime   ;
+
+    return;
+}
+
+
+//****************************************************************************
+// TypeIIRMLPosition::GetNextStateOfMotion()
+
+int TypeIIRMLPosition::GetNextStateOfMotion(    const rml_in_view                   &InputValues
+                                             ,  rml_out_view                        *OutputValues
+                                             ,  const RMLPositionFlags              &Flags)
+{
+    if (OutputValues == NULL)
+    {
+        this->ReturnValue   =   ReflexxesAPI::RML_ERROR_NULL_POINTER;
+        return(this->ReturnValue);
+    }
+
+    this->CycleTime =   this->NominalCycleTime;
+
+    ReadInputView(InputValues, this->CurrentInputParameters);
+
+    ReadView(InputValues.max_velocity                   , this->CurrentInputParameters->MaxVelocityVector               );
+    ReadView(InputValues.target_position                , this->CurrentInputParameters->TargetPositionVector            );
+    ReadView(InputValues.alternative_target_velocity    , this->CurrentInputParameters->AlternativeTargetVelocityVector );
+
+    this->ComputeNextStateOfMotion(Flags);
+
+    this->ExecuteDeterministicTimingPath(Flags);
+
+    WriteOutputView(*(this->OutputParameters), OutputValues);
+
+    return(this->ReturnValue);
+}
+
+
+//****************************************************************************
+// TypeIIRMLVelocity::GetNextStateOfMotion()
+
+int TypeIIRMLVelocity::GetNextStateOfMotion(    const rml_in_view                   &InputValues
+                                             ,  rml_out_view                        *OutputValues
+                                             ,  const RMLVelocityFlags              &Flags)
+{
+    if (OutputValues == NULL)
+    {
+        this->ReturnValue   =   ReflexxesAPI::RML_ERROR_NULL_POINTER;
+        return(this->ReturnValue);
+    }
+
+    this->CycleTime =   this->NominalCycleTime;
+
+    ReadInputView(InputValues, this->CurrentInputParameters);
+
+    this->ComputeNextStateOfMotion(Flags);
+
+    WriteOutputView(*(this->OutputParameters), OutputValues);
+
+    WriteView(      *(this->OutputParameters->PositionValuesAtTargetVelocity)
+                ,   OutputValues->position_values_at_target_velocity        );
+
+    return(this->ReturnValue);
+}
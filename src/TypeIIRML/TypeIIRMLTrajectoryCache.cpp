@@ -0,0 +1,528 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLTrajectoryCache.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <TypeIIRMLTrajectoryCache.h>
+#include <RMLPositionInputParameters.h>
+#include <ReflexxesAPI.h>
+
+#include <math.h>
+#include <string.h>
+
+using namespace TypeIIRMLMath;
+
+
+//****************************************************************************
+// TrajectoryCacheEntry()
+
+TrajectoryCacheEntry::TrajectoryCacheEntry(void)
+{
+    this->IsValid                               =   false   ;
+    this->HashValue                             =   0       ;
+    this->LastUse                               =   0       ;
+    this->NumberOfDOFs                          =   0       ;
+    this->SynchronizationBehavior               =   0       ;
+    this->CycleTime                             =   0.0     ;
+    this->MinimumSynchronizationTime            =   0.0     ;
+    this->KeyValues                             =   NULL    ;
+    this->SelectionVector                       =   NULL    ;
+    this->CurrentPosition                       =   NULL    ;
+    this->Polynomials                           =   NULL    ;
+    this->ModifiedSelectionVector               =   NULL    ;
+    this->MinimumExecutionTimes                 =   NULL    ;
+    this->UsedStep1AProfiles                    =   NULL    ;
+    this->SynchronizationTime                   =   0.0     ;
+    this->GreatestDOFForPhaseSynchronization    =   0       ;
+    this->IsPhaseSynchronized                   =   false   ;
+}
+
+
+//****************************************************************************
+// ~TrajectoryCacheEntry()
+
+TrajectoryCacheEntry::~TrajectoryCacheEntry(void)
+{
+    delete      this->KeyValues                     ;
+    delete      this->SelectionVector               ;
+    delete      this->CurrentPosition               ;
+    delete[]    (MotionPolynomials*)this->Polynomials;
+    delete      this->ModifiedSelectionVector       ;
+    delete      this->MinimumExecutionTimes         ;
+    delete      this->UsedStep1AProfiles            ;
+
+    this->KeyValues                 =   NULL    ;
+    this->SelectionVector           =   NULL    ;
+    this->CurrentPosition           =   NULL    ;
+    this->Polynomials               =   NULL    ;
+    this->ModifiedSelectionVector   =   NULL    ;
+    this->MinimumExecutionTimes     =   NULL    ;
+    this->UsedStep1AProfiles        =   NULL    ;
+}
+
+
+//****************************************************************************
+// Allocate()
+
+void TrajectoryCacheEntry::Allocate(const unsigned int &MaxNumberOfDOFs)
+{
+    this->KeyValues                 =   new RMLDoubleVector             (TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * MaxNumberOfDOFs) ;
+    this->SelectionVector           =   new RMLBoolVector               (MaxNumberOfDOFs)                                       ;
+    this->CurrentPosition           =   new RMLDoubleVector             (MaxNumberOfDOFs)                                       ;
+    this->Polynomials               =   new MotionPolynomials           [MaxNumberOfDOFs]                                       ;
+    this->ModifiedSelectionVector   =   new RMLBoolVector               (MaxNumberOfDOFs)                                       ;
+    this->MinimumExecutionTimes     =   new RMLDoubleVector             (MaxNumberOfDOFs)                                       ;
+    this->UsedStep1AProfiles        =   new RMLVector<Step1_Profile>    (MaxNumberOfDOFs)                                       ;
+
+    this->IsValid                   =   false;
+
+    return;
+}
+
+
+//****************************************************************************
+// GetSize()
+
+size_t TrajectoryCacheEntry::GetSize(const unsigned int &MaxNumberOfDOFs)
+{
+    return(     sizeof(TrajectoryCacheEntry)
+            +   4 * sizeof(RMLDoubleVector)
+            +   2 * sizeof(RMLBoolVector)
+            +   (size_t)MaxNumberOfDOFs * (     (TRAJECTORY_CACHE_KEY_VALUES_PER_DOF + 2) * sizeof(double)
+                                            +   2 * sizeof(bool)
+                                            +   sizeof(Step1_Profile)
+                                            +   sizeof(MotionPolynomials)   )   );
+}
+
+
+//****************************************************************************
+// SetTrajectoryCache()
+
+int TypeIIRMLPosition::SetTrajectoryCache(      const size_t    &MemoryBudgetInBytes
+                                            ,   const double    &Resolution         )
+{
+    unsigned int                i                   =   0
+                            ,   NumberOfEntries     =   0;
+
+    size_t                      EntrySize           =   TrajectoryCacheEntry::GetSize(this->MaxNumberOfDOFs)
+                            ,   KeySize             =       sizeof(RMLDoubleVector)
+                                                        +   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->MaxNumberOfDOFs * sizeof(double);
+
+    if (    (!(Resolution   >=  0.0         ))
+        ||  (Resolution     >   RML_INFINITY    )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    RMLMemoryResourceScope      Scope(this->MemoryResource);
+
+    this->UnmapTrajectoryCacheFile();
+
+    delete[]    (TrajectoryCacheEntry*)this->TrajectoryCache    ;
+    delete      this->TrajectoryCacheKeyValues                  ;
+
+    this->TrajectoryCache           =   NULL;
+    this->TrajectoryCacheKeyValues  =   NULL;
+
+    // The key values of the current input values are part of the budget,
+    // too.
+    if (MemoryBudgetInBytes > KeySize)
+    {
+        NumberOfEntries =   (unsigned int)((MemoryBudgetInBytes - KeySize) / EntrySize);
+    }
+
+    if (NumberOfEntries > 0)
+    {
+        this->TrajectoryCache           =   new TrajectoryCacheEntry    [NumberOfEntries];
+        this->TrajectoryCacheKeyValues  =   new RMLDoubleVector         (TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->MaxNumberOfDOFs);
+
+        for (i = 0; i < NumberOfEntries; i++)
+        {
+            this->TrajectoryCache[i].Allocate(this->MaxNumberOfDOFs);
+        }
+    }
+
+    this->NumberOfTrajectoryCacheEntries    =   NumberOfEntries ;
+    this->TrajectoryCacheResolution         =   Resolution      ;
+    this->TrajectoryCacheHashValue          =   0               ;
+    this->TrajectoryCacheClock              =   0               ;
+    this->TrajectoryCacheHits               =   0               ;
+    this->TrajectoryCacheMisses             =   0               ;
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// GetTrajectoryCacheStatistics()
+
+void TypeIIRMLPosition::GetTrajectoryCacheStatistics(       unsigned long long  *NumberOfHits
+                                                        ,   unsigned long long  *NumberOfMisses
+                                                        ,   unsigned int        *NumberOfEntries    ) const
+{
+    if (NumberOfHits != NULL)
+    {
+        *NumberOfHits       =   this->TrajectoryCacheHits;
+    }
+
+    if (NumberOfMisses != NULL)
+    {
+        *NumberOfMisses     =   this->TrajectoryCacheMisses;
+    }
+
+    if (NumberOfEntries != NULL)
+    {
+        *NumberOfEntries    =   this->NumberOfTrajectoryCacheEntries;
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// QuantizeForTrajectoryCache()
+
+double TypeIIRMLPosition::QuantizeForTrajectoryCache(const double &Value) const
+{
+    // Adding zero turns a negative zero into a positive one, such that
+    // both have the same hash value. With a resolution of zero, the
+    // values have to match bit by bit, and they are not changed.
+    if (this->TrajectoryCacheResolution > 0.0)
+    {
+        return(floor(Value / this->TrajectoryCacheResolution + 0.5) + 0.0);
+    }
+
+    return(Value);
+}
+
+
+//****************************************************************************
+// CalculateTrajectoryCacheKey()
+
+void TypeIIRMLPosition::CalculateTrajectoryCacheKey(void)
+{
+    unsigned int                i               =   0
+                            ,   j               =   0;
+
+    double                      *Key            =   this->TrajectoryCacheKeyValues->VecData;
+
+    const RMLPositionInputParameters    *IP     =   this->CurrentInputParameters;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        j   =   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * i;
+
+        if ((IP->SelectionVector->VecData)[i])
+        {
+            // With a resolution of zero, the current positions have to
+            // match, too (cf. LookUpTrajectoryCache()), and the target
+            // position is used, because the position difference does not
+            // determine it bit by bit.
+            if (this->TrajectoryCacheResolution > 0.0)
+            {
+                Key[j    ]  =   this->QuantizeForTrajectoryCache(       (IP->TargetPositionVector->VecData)[i]
+                                                                    -   (IP->CurrentPositionVector->VecData)[i]     );
+            }
+            else
+            {
+                Key[j    ]  =   (IP->TargetPositionVector->VecData)[i];
+            }
+
+            Key[j + 1]  =   this->QuantizeForTrajectoryCache((IP->CurrentVelocityVector->VecData)[i]    );
+            Key[j + 2]  =   this->QuantizeForTrajectoryCache((IP->TargetVelocityVector->VecData)[i]     );
+            Key[j + 3]  =   this->QuantizeForTrajectoryCache((IP->MaxVelocityVector->VecData)[i]        );
+            Key[j + 4]  =   this->QuantizeForTrajectoryCache((IP->MaxAccelerationVector->VecData)[i]    );
+        }
+        else
+        {
+            Key[j    ]  =   0.0;
+            Key[j + 1]  =   0.0;
+            Key[j + 2]  =   0.0;
+            Key[j + 3]  =   0.0;
+            Key[j + 4]  =   0.0;
+        }
+    }
+
+    this->TrajectoryCacheHashValue  =   HashTrajectoryCacheKey(     Key
+                                                                ,   IP->SelectionVector->VecData
+                                                                ,   this->NumberOfDOFs              );
+
+    return;
+}
+
+
+//****************************************************************************
+// LookUpTrajectoryCache()
+
+bool TypeIIRMLPosition::LookUpTrajectoryCache(const RMLPositionFlags &Flags)
+{
+    unsigned int                i                       =   0
+                            ,   k                       =   0
+                            ,   NumberOfKeyValues       =   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->NumberOfDOFs;
+
+    double                      MinimumTime             =   0.0;
+
+    TrajectoryCacheEntry        *Entry                  =   NULL;
+
+    if (    (   (this->NumberOfTrajectoryCacheEntries   ==  0       )
+            &&  (this->TrajectoryCacheFileHeader        ==  NULL    )   )
+        ||  (Flags.EnableDeterministicTiming                            )   )
+    {
+        return(false);
+    }
+
+    this->CalculateTrajectoryCacheKey();
+
+    MinimumTime =   this->QuantizeForTrajectoryCache(this->CurrentInputParameters->MinimumSynchronizationTime);
+
+    this->TrajectoryCacheClock++;
+
+    for (k = 0; k < this->NumberOfTrajectoryCacheEntries; k++)
+    {
+        Entry   =   &(this->TrajectoryCache[k]);
+
+        if (    (!(Entry->IsValid)                                                  )
+            ||  (Entry->HashValue                   !=  this->TrajectoryCacheHashValue  )
+            ||  (Entry->NumberOfDOFs                !=  this->NumberOfDOFs              )
+            ||  (Entry->SynchronizationBehavior     !=  Flags.SynchronizationBehavior   )
+            ||  (Entry->CycleTime                   !=  this->CycleTime                 )
+            ||  (Entry->MinimumSynchronizationTime  !=  MinimumTime                     )   )
+        {
+            continue;
+        }
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            if ((Entry->SelectionVector->VecData)[i] != (this->CurrentInputParameters->SelectionVector->VecData)[i])
+            {
+                break;
+            }
+        }
+
+        if (i < this->NumberOfDOFs)
+        {
+            continue;
+        }
+
+        if (memcmp(     Entry->KeyValues->VecData
+                    ,   this->TrajectoryCacheKeyValues->VecData
+                    ,   NumberOfKeyValues * sizeof(double)          ) != 0)
+        {
+            continue;
+        }
+
+        // With a resolution of zero, the stored trajectory is only used
+        // for the same current positions, such that it does not have to be
+        // translated, and the output values equal the ones of a new
+        // calculation bit by bit.
+        if (this->TrajectoryCacheResolution == 0.0)
+        {
+            for (i = 0; i < this->NumberOfDOFs; i++)
+            {
+                if (    ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+                    &&  (memcmp(    &((Entry->CurrentPosition->VecData)[i])
+                                ,   &((this->CurrentInputParameters->CurrentPositionVector->VecData)[i])
+                                ,   sizeof(double)                                                          ) != 0) )
+                {
+                    break;
+                }
+            }
+
+            if (i < this->NumberOfDOFs)
+            {
+                continue;
+            }
+        }
+
+        // The stored trajectory is used.
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            (this->ModifiedSelectionVector->VecData)[i] =   (Entry->ModifiedSelectionVector->VecData)[i];
+            (this->MinimumExecutionTimes->VecData)[i]   =   (Entry->MinimumExecutionTimes->VecData)[i]  ;
+            (this->UsedStep1AProfiles->VecData)[i]      =   (Entry->UsedStep1AProfiles->VecData)[i]     ;
+
+            if ((this->ModifiedSelectionVector->VecData)[i])
+            {
+                (this->Polynomials)[i]  =   (Entry->Polynomials)[i];
+
+                this->TranslatePositionPolynomials(     i
+                                                    ,       (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                                                        -   (Entry->CurrentPosition->VecData)[i]                                );
+            }
+            else
+            {
+                (this->Polynomials)[i].ValidPolynomials =   0;
+            }
+        }
+
+        this->SetupModifiedDOFs();
+
+        this->SynchronizationTime                   =   Entry->SynchronizationTime                  ;
+        this->GreatestDOFForPhaseSynchronization    =   Entry->GreatestDOFForPhaseSynchronization   ;
+        this->CurrentTrajectoryIsPhaseSynchronized  =   Entry->IsPhaseSynchronized                  ;
+
+        Entry->LastUse  =   this->TrajectoryCacheClock;
+
+        this->TrajectoryCacheHits++;
+
+        return(true);
+    }
+
+    // The trajectories of a mapped file are only used, if the trajectory
+    // is not contained in the memory.
+    if (this->LookUpTrajectoryCacheFile(        Flags
+                                            ,   MinimumTime ))
+    {
+        this->TrajectoryCacheHits++;
+
+        return(true);
+    }
+
+    this->TrajectoryCacheMisses++;
+
+    return(false);
+}
+
+
+//****************************************************************************
+// TranslatePositionPolynomials()
+
+void TypeIIRMLPosition::TranslatePositionPolynomials(       const unsigned int  &DOF
+                                                        ,   const double        &Offset )
+{
+    unsigned int                j               =   0;
+
+    double                      Coefficient2    =   0.0
+                            ,   Coefficient1    =   0.0
+                            ,   Coefficient0    =   0.0
+                            ,   DeltaT          =   0.0;
+
+    if (Offset == 0.0)
+    {
+        return;
+    }
+
+    for (j = 0; j < (unsigned int)((this->Polynomials)[DOF].ValidPolynomials); j++)
+    {
+        (this->Polynomials)[DOF].PositionPolynomial[j].GetCoefficients(     &Coefficient2
+                                                                        ,   &Coefficient1
+                                                                        ,   &Coefficient0
+                                                                        ,   &DeltaT         );
+
+        (this->Polynomials)[DOF].PositionPolynomial[j].SetCoefficients(     Coefficient2
+                                                                        ,   Coefficient1
+                                                                        ,   Coefficient0 + Offset
+                                                                        ,   DeltaT          );
+    }
+
+    return;
+}
+
+
+//****************************************************************************
+// StoreInTrajectoryCache()
+
+void TypeIIRMLPosition::StoreInTrajectoryCache(const RMLPositionFlags &Flags)
+{
+    unsigned int                i               =   0
+                            ,   k               =   0;
+
+    TrajectoryCacheEntry        *Entry          =   NULL;
+
+    if (    (this->NumberOfTrajectoryCacheEntries   ==  0)
+        ||  (Flags.EnableDeterministicTiming            )   )
+    {
+        return;
+    }
+
+    // least recently used entry
+    Entry   =   &(this->TrajectoryCache[0]);
+
+    for (k = 0; k < this->NumberOfTrajectoryCacheEntries; k++)
+    {
+        if (!(this->TrajectoryCache[k].IsValid))
+        {
+            Entry   =   &(this->TrajectoryCache[k]);
+            break;
+        }
+
+        if (this->TrajectoryCache[k].LastUse < Entry->LastUse)
+        {
+            Entry   =   &(this->TrajectoryCache[k]);
+        }
+    }
+
+    Entry->HashValue                            =   this->TrajectoryCacheHashValue                                                          ;
+    Entry->LastUse                              =   this->TrajectoryCacheClock                                                              ;
+    Entry->NumberOfDOFs                         =   this->NumberOfDOFs                                                                      ;
+    Entry->SynchronizationBehavior              =   Flags.SynchronizationBehavior                                                           ;
+    Entry->CycleTime                            =   this->CycleTime                                                                         ;
+    Entry->MinimumSynchronizationTime           =   this->QuantizeForTrajectoryCache(this->CurrentInputParameters->MinimumSynchronizationTime);
+    Entry->SynchronizationTime                  =   this->SynchronizationTime                                                               ;
+    Entry->GreatestDOFForPhaseSynchronization   =   this->GreatestDOFForPhaseSynchronization                                                ;
+    Entry->IsPhaseSynchronized                  =   this->CurrentTrajectoryIsPhaseSynchronized                                              ;
+
+    memcpy(     Entry->KeyValues->VecData
+            ,   this->TrajectoryCacheKeyValues->VecData
+            ,   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->NumberOfDOFs * sizeof(double)   );
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        (Entry->SelectionVector->VecData)[i]            =   (this->CurrentInputParameters->SelectionVector->VecData)[i]         ;
+        (Entry->CurrentPosition->VecData)[i]            =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]   ;
+        (Entry->ModifiedSelectionVector->VecData)[i]    =   (this->ModifiedSelectionVector->VecData)[i]                         ;
+        (Entry->MinimumExecutionTimes->VecData)[i]      =   (this->MinimumExecutionTimes->VecData)[i]                           ;
+        (Entry->UsedStep1AProfiles->VecData)[i]         =   (this->UsedStep1AProfiles->VecData)[i]                              ;
+
+        if ((this->ModifiedSelectionVector->VecData)[i])
+        {
+            (Entry->Polynomials)[i] =   (this->Polynomials)[i];
+        }
+    }
+
+    Entry->IsValid  =   true;
+
+    return;
+}
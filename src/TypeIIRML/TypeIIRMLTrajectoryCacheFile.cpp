@@ -0,0 +1,639 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLTrajectoryCacheFile.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLPosition.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLPosition.h>
+#include <TypeIIRMLMath.h>
+#include <TypeIIRMLTrajectoryCache.h>
+#include <TypeIIRMLPlatform.h>
+#include <RMLTrajectoryCacheFormat.h>
+#include <RMLPositionInputParameters.h>
+#include <ReflexxesAPI.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace TypeIIRMLMath;
+
+
+//****************************************************************************
+// CalculateTrajectoryCacheRecordChecksum()
+
+static unsigned long long CalculateTrajectoryCacheRecordChecksum(       const unsigned char *Record
+                                                                    ,   const size_t        &RecordSize )
+{
+    // FNV-1a over the library version and all bytes of the record
+    // except the checksum itself
+    size_t                      i               =   0;
+
+    unsigned long long          Checksum        =   14695981039346656037ULL;
+
+    const char                  *Version        =   RML_TRAJECTORY_CACHE_LIBRARY_VERSION;
+
+    for (i = 0; Version[i] != '\0'; i++)
+    {
+        Checksum    =   (Checksum ^ (unsigned char)Version[i]) * 1099511628211ULL;
+    }
+
+    for (i = sizeof(unsigned long long); i < RecordSize; i++)
+    {
+        Checksum    =   (Checksum ^ Record[i]) * 1099511628211ULL;
+    }
+
+    return(Checksum);
+}
+
+
+//****************************************************************************
+// GetTrajectoryCacheRecordBlocks()
+
+static void GetTrajectoryCacheRecordBlocks(     unsigned char       *Record
+                                            ,   const unsigned int  &NumberOfDOFs
+                                            ,   double              **KeyValues
+                                            ,   double              **CurrentPosition
+                                            ,   double              **MinimumExecutionTimes
+                                            ,   double              **PolynomialValues
+                                            ,   unsigned char       **SelectionVector
+                                            ,   unsigned char       **ModifiedSelectionVector
+                                            ,   unsigned char       **ValidPolynomials
+                                            ,   unsigned char       **UsedStep1AProfiles        )
+{
+    // cf. RMLTrajectoryCacheRecordSize()
+    *KeyValues                  =   (double*)(Record + sizeof(RMLTrajectoryCacheRecordHeader))                          ;
+    *CurrentPosition            =   *KeyValues                  +   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * NumberOfDOFs  ;
+    *MinimumExecutionTimes      =   *CurrentPosition            +   NumberOfDOFs                                        ;
+    *PolynomialValues           =   *MinimumExecutionTimes      +   NumberOfDOFs                                        ;
+    *SelectionVector            =   (unsigned char*)(   *PolynomialValues
+                                                    +   RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL
+                                                        * MAXIMAL_NO_OF_POLYNOMIALS * NumberOfDOFs  )                   ;
+    *ModifiedSelectionVector    =   *SelectionVector            +   NumberOfDOFs                                        ;
+    *ValidPolynomials           =   *ModifiedSelectionVector    +   NumberOfDOFs                                        ;
+    *UsedStep1AProfiles         =   *ValidPolynomials           +   NumberOfDOFs                                        ;
+
+    return;
+}
+
+
+//****************************************************************************
+// CompareTrajectoryCacheEntries()
+
+static int CompareTrajectoryCacheEntries(       const void  *Entry1
+                                            ,   const void  *Entry2 )
+{
+    unsigned int                HashValue1      =   (*((const TrajectoryCacheEntry* const*)Entry1))->HashValue
+                            ,   HashValue2      =   (*((const TrajectoryCacheEntry* const*)Entry2))->HashValue;
+
+    if (HashValue1 < HashValue2)
+    {
+        return(-1);
+    }
+
+    if (HashValue1 > HashValue2)
+    {
+        return(1);
+    }
+
+    return(0);
+}
+
+
+//****************************************************************************
+// WriteTrajectoryCacheFile()
+
+int TypeIIRMLPosition::WriteTrajectoryCacheFile(const char *FileName) const
+{
+    bool                            Success                 =   false;
+
+    unsigned int                    i                       =   0
+                                ,   j                       =   0
+                                ,   k                       =   0
+                                ,   NumberOfRecords         =   0;
+
+    size_t                          RecordSize              =   RMLTrajectoryCacheRecordSize(       this->MaxNumberOfDOFs
+                                                                                                ,   MAXIMAL_NO_OF_POLYNOMIALS   );
+
+    char                            *TemporaryFileName      =   NULL;
+
+    double                          *KeyValues              =   NULL
+                                ,   *CurrentPosition        =   NULL
+                                ,   *MinimumExecutionTimes  =   NULL
+                                ,   *PolynomialValues       =   NULL
+                                ,   *Values                 =   NULL;
+
+    unsigned char                   *Record                 =   NULL
+                                ,   *SelectionVector        =   NULL
+                                ,   *ModifiedSelectionVector=   NULL
+                                ,   *ValidPolynomials       =   NULL
+                                ,   *UsedStep1AProfiles     =   NULL;
+
+    const TrajectoryCacheEntry      **SortedEntries         =   NULL
+                                ,   *Entry                  =   NULL;
+
+    const MotionPolynomials         *Polynomial             =   NULL;
+
+    RMLTrajectoryCacheHeader        *FileHeader             =   NULL;
+
+    RMLTrajectoryCacheRecordHeader  *RecordHeader           =   NULL;
+
+    TypeIIRMLPlatform::MappedFile   File;
+
+    if (    (FileName                               ==  NULL)
+        ||  (this->NumberOfTrajectoryCacheEntries   ==  0   )   )
+    {
+        return(ReflexxesAPI::RML_ERROR);
+    }
+
+    // The records are sorted by their hash values for the binary search
+    // of TypeIIRMLPosition::LookUpTrajectoryCacheFile().
+    SortedEntries   =   new const TrajectoryCacheEntry*[this->NumberOfTrajectoryCacheEntries];
+
+    for (k = 0; k < this->NumberOfTrajectoryCacheEntries; k++)
+    {
+        if (this->TrajectoryCache[k].IsValid)
+        {
+            SortedEntries[NumberOfRecords]  =   &(this->TrajectoryCache[k]);
+            NumberOfRecords++;
+        }
+    }
+
+    qsort(      SortedEntries
+            ,   NumberOfRecords
+            ,   sizeof(const TrajectoryCacheEntry*)
+            ,   CompareTrajectoryCacheEntries       );
+
+    // The file is written under a temporary name and renamed afterwards,
+    // such that processes that have mapped a previous version of the file
+    // keep using it, and no process maps an incomplete file.
+    TemporaryFileName   =   new char[strlen(FileName) + sizeof(RML_TRAJECTORY_CACHE_TEMPORARY_SUFFIX)];
+
+    strcpy(TemporaryFileName, FileName);
+    strcat(TemporaryFileName, RML_TRAJECTORY_CACHE_TEMPORARY_SUFFIX);
+
+    TypeIIRMLPlatform::InitializeMappedFile(&File);
+
+    if (!TypeIIRMLPlatform::MapFile(        TemporaryFileName
+                                        ,   RML_TRAJECTORY_CACHE_ALIGNMENT + (size_t)NumberOfRecords * RecordSize
+                                        ,   true
+                                        ,   &File                                                                   ))
+    {
+        remove(TemporaryFileName);
+        delete[]    TemporaryFileName;
+        delete[]    SortedEntries;
+        return(ReflexxesAPI::RML_ERROR);
+    }
+
+    memset(File.Data, 0, File.Size);
+
+    FileHeader  =   (RMLTrajectoryCacheHeader*)File.Data;
+
+    memcpy(FileHeader->MagicNumber, RML_TRAJECTORY_CACHE_MAGIC_NUMBER, sizeof(FileHeader->MagicNumber));
+    strncpy(FileHeader->LibraryVersion, RML_TRAJECTORY_CACHE_LIBRARY_VERSION, sizeof(FileHeader->LibraryVersion) - 1);
+
+    FileHeader->FormatVersion               =   RML_TRAJECTORY_CACHE_FORMAT_VERSION ;
+    FileHeader->EndiannessTag               =   RML_TRAJECTORY_CACHE_ENDIANNESS_TAG ;
+    FileHeader->HeaderSize                  =   sizeof(RMLTrajectoryCacheHeader)    ;
+    FileHeader->RecordSize                  =   (unsigned int)RecordSize            ;
+    FileHeader->NumberOfDOFs                =   this->MaxNumberOfDOFs               ;
+    FileHeader->MaximalNumberOfPolynomials  =   MAXIMAL_NO_OF_POLYNOMIALS           ;
+    FileHeader->NumberOfRecords             =   NumberOfRecords                     ;
+    FileHeader->Resolution                  =   this->TrajectoryCacheResolution     ;
+
+    for (k = 0; k < NumberOfRecords; k++)
+    {
+        Entry           =   SortedEntries[k];
+        Record          =   (unsigned char*)File.Data + RML_TRAJECTORY_CACHE_ALIGNMENT + (size_t)k * RecordSize;
+        RecordHeader    =   (RMLTrajectoryCacheRecordHeader*)Record;
+
+        GetTrajectoryCacheRecordBlocks(     Record
+                                        ,   this->MaxNumberOfDOFs
+                                        ,   &KeyValues
+                                        ,   &CurrentPosition
+                                        ,   &MinimumExecutionTimes
+                                        ,   &PolynomialValues
+                                        ,   &SelectionVector
+                                        ,   &ModifiedSelectionVector
+                                        ,   &ValidPolynomials
+                                        ,   &UsedStep1AProfiles     );
+
+        RecordHeader->HashValue                             =   Entry->HashValue                                ;
+        RecordHeader->NumberOfDOFs                          =   Entry->NumberOfDOFs                             ;
+        RecordHeader->SynchronizationBehavior               =   Entry->SynchronizationBehavior                  ;
+        RecordHeader->GreatestDOFForPhaseSynchronization    =   Entry->GreatestDOFForPhaseSynchronization       ;
+        RecordHeader->CycleTime                             =   Entry->CycleTime                                ;
+        RecordHeader->MinimumSynchronizationTime            =   Entry->MinimumSynchronizationTime               ;
+        RecordHeader->SynchronizationTime                   =   Entry->SynchronizationTime                      ;
+        RecordHeader->IsPhaseSynchronized                   =   (Entry->IsPhaseSynchronized)?(1):(0)            ;
+
+        memcpy(     KeyValues
+                ,   Entry->KeyValues->VecData
+                ,   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * Entry->NumberOfDOFs * sizeof(double)  );
+
+        for (i = 0; i < Entry->NumberOfDOFs; i++)
+        {
+            CurrentPosition         [i] =   (Entry->CurrentPosition->VecData)[i]                        ;
+            MinimumExecutionTimes   [i] =   (Entry->MinimumExecutionTimes->VecData)[i]                  ;
+            SelectionVector         [i] =   ((Entry->SelectionVector->VecData)[i])?(1):(0)              ;
+            ModifiedSelectionVector [i] =   ((Entry->ModifiedSelectionVector->VecData)[i])?(1):(0)      ;
+            UsedStep1AProfiles      [i] =   (unsigned char)((Entry->UsedStep1AProfiles->VecData)[i])    ;
+
+            if (!((Entry->ModifiedSelectionVector->VecData)[i]))
+            {
+                continue;
+            }
+
+            Polynomial          =   &((Entry->Polynomials)[i]);
+            ValidPolynomials[i] =   Polynomial->ValidPolynomials;
+
+            for (j = 0; j < (unsigned int)(Polynomial->ValidPolynomials); j++)
+            {
+                Values      =       PolynomialValues
+                                +   RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL * (MAXIMAL_NO_OF_POLYNOMIALS * i + j);
+
+                Values[0]   =   Polynomial->PolynomialTimes[j];
+
+                Polynomial->PositionPolynomial      [j].GetCoefficients(&(Values[ 1]), &(Values[ 2]), &(Values[ 3]), &(Values[ 4]));
+                Polynomial->VelocityPolynomial      [j].GetCoefficients(&(Values[ 5]), &(Values[ 6]), &(Values[ 7]), &(Values[ 8]));
+                Polynomial->AccelerationPolynomial  [j].GetCoefficients(&(Values[ 9]), &(Values[10]), &(Values[11]), &(Values[12]));
+            }
+        }
+
+        RecordHeader->Checksum  =   CalculateTrajectoryCacheRecordChecksum(     Record
+                                                                            ,   RecordSize  );
+    }
+
+    Success =   TypeIIRMLPlatform::FlushMappedFile(     File
+                                                    ,   true    );
+
+    TypeIIRMLPlatform::UnmapFile(&File);
+
+    if (Success)
+    {
+        Success =   TypeIIRMLPlatform::RenameFile(      TemporaryFileName
+                                                    ,   FileName            );
+    }
+
+    if (!Success)
+    {
+        remove(TemporaryFileName);
+    }
+
+    delete[]    TemporaryFileName;
+    delete[]    SortedEntries;
+
+    return((Success)?(ReflexxesAPI::RML_WORKING):(ReflexxesAPI::RML_ERROR));
+}
+
+
+//****************************************************************************
+// MapTrajectoryCacheFile()
+
+int TypeIIRMLPosition::MapTrajectoryCacheFile(const char *FileName)
+{
+    unsigned int                            i                       =   0
+                                        ,   PreviousHashValue       =   0;
+
+    unsigned long long                      k                       =   0;
+
+    double                                  *KeyValues              =   NULL
+                                        ,   *CurrentPosition        =   NULL
+                                        ,   *MinimumExecutionTimes  =   NULL
+                                        ,   *PolynomialValues       =   NULL;
+
+    unsigned char                           *Record                 =   NULL
+                                        ,   *SelectionVector        =   NULL
+                                        ,   *ModifiedSelectionVector=   NULL
+                                        ,   *ValidPolynomials       =   NULL
+                                        ,   *UsedStep1AProfiles     =   NULL;
+
+    const RMLTrajectoryCacheHeader          *FileHeader             =   NULL;
+
+    const RMLTrajectoryCacheRecordHeader    *RecordHeader           =   NULL;
+
+    this->UnmapTrajectoryCacheFile();
+
+    if (FileName == NULL)
+    {
+        return(ReflexxesAPI::RML_ERROR_NULL_POINTER);
+    }
+
+    if (!TypeIIRMLPlatform::MapFile(    FileName
+                                    ,   0
+                                    ,   false
+                                    ,   &(this->TrajectoryCacheFile)    ))
+    {
+        return(ReflexxesAPI::RML_ERROR);
+    }
+
+    FileHeader  =   (const RMLTrajectoryCacheHeader*)this->TrajectoryCacheFile.Data;
+
+    if (    (this->TrajectoryCacheFile.Size             <   RML_TRAJECTORY_CACHE_ALIGNMENT                          )
+        ||  (memcmp(FileHeader->MagicNumber, RML_TRAJECTORY_CACHE_MAGIC_NUMBER, sizeof(FileHeader->MagicNumber)) != 0)
+        ||  (FileHeader->EndiannessTag                  !=  RML_TRAJECTORY_CACHE_ENDIANNESS_TAG                     )
+        ||  (FileHeader->FormatVersion                  !=  RML_TRAJECTORY_CACHE_FORMAT_VERSION                     )
+        ||  (FileHeader->HeaderSize                     !=  sizeof(RMLTrajectoryCacheHeader)                        )
+        ||  (FileHeader->MaximalNumberOfPolynomials     !=  MAXIMAL_NO_OF_POLYNOMIALS                               )
+        ||  (FileHeader->RecordSize                     !=  RMLTrajectoryCacheRecordSize(       FileHeader->NumberOfDOFs
+                                                                                            ,   MAXIMAL_NO_OF_POLYNOMIALS   ))
+        ||  (strncmp(FileHeader->LibraryVersion, RML_TRAJECTORY_CACHE_LIBRARY_VERSION, sizeof(FileHeader->LibraryVersion)) != 0)
+        ||  (FileHeader->Resolution                     !=  this->TrajectoryCacheResolution                         )
+        ||  (   (this->TrajectoryCacheFile.Size - RML_TRAJECTORY_CACHE_ALIGNMENT) / FileHeader->RecordSize
+                <   FileHeader->NumberOfRecords                                                                     )   )
+    {
+        this->UnmapTrajectoryCacheFile();
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    // Only the integrity of the records is checked here; no trajectory is
+    // calculated.
+    for (k = 0; k < FileHeader->NumberOfRecords; k++)
+    {
+        Record          =       (unsigned char*)this->TrajectoryCacheFile.Data
+                            +   RML_TRAJECTORY_CACHE_ALIGNMENT
+                            +   (size_t)k * FileHeader->RecordSize;
+        RecordHeader    =   (const RMLTrajectoryCacheRecordHeader*)Record;
+
+        if (    (RecordHeader->Checksum     !=  CalculateTrajectoryCacheRecordChecksum(     Record
+                                                                                        ,   FileHeader->RecordSize  ))
+            ||  (RecordHeader->NumberOfDOFs >   FileHeader->NumberOfDOFs                )
+            ||  (RecordHeader->HashValue    <   PreviousHashValue                       )   )
+        {
+            this->UnmapTrajectoryCacheFile();
+            return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+        }
+
+        GetTrajectoryCacheRecordBlocks(     Record
+                                        ,   FileHeader->NumberOfDOFs
+                                        ,   &KeyValues
+                                        ,   &CurrentPosition
+                                        ,   &MinimumExecutionTimes
+                                        ,   &PolynomialValues
+                                        ,   &SelectionVector
+                                        ,   &ModifiedSelectionVector
+                                        ,   &ValidPolynomials
+                                        ,   &UsedStep1AProfiles     );
+
+        if (RecordHeader->HashValue != HashTrajectoryCacheKey(      KeyValues
+                                                                ,   SelectionVector
+                                                                ,   RecordHeader->NumberOfDOFs  ))
+        {
+            this->UnmapTrajectoryCacheFile();
+            return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+        }
+
+        for (i = 0; i < RecordHeader->NumberOfDOFs; i++)
+        {
+            if (ValidPolynomials[i] > MAXIMAL_NO_OF_POLYNOMIALS)
+            {
+                this->UnmapTrajectoryCacheFile();
+                return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+            }
+        }
+
+        PreviousHashValue   =   RecordHeader->HashValue;
+    }
+
+    if (this->TrajectoryCacheKeyValues == NULL)
+    {
+        RMLMemoryResourceScope      Scope(this->MemoryResource);
+
+        this->TrajectoryCacheKeyValues  =   new RMLDoubleVector(TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->MaxNumberOfDOFs);
+    }
+
+    this->TrajectoryCacheFileHeader             =   FileHeader;
+    this->TrajectoryCacheFileRecords            =       (const unsigned char*)this->TrajectoryCacheFile.Data
+                                                    +   RML_TRAJECTORY_CACHE_ALIGNMENT;
+    this->TrajectoryCacheFileNumberOfRecords    =   FileHeader->NumberOfRecords;
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// UnmapTrajectoryCacheFile()
+
+void TypeIIRMLPosition::UnmapTrajectoryCacheFile(void)
+{
+    TypeIIRMLPlatform::UnmapFile(&(this->TrajectoryCacheFile));
+
+    this->TrajectoryCacheFileHeader             =   NULL;
+    this->TrajectoryCacheFileRecords            =   NULL;
+    this->TrajectoryCacheFileNumberOfRecords    =   0;
+
+    return;
+}
+
+
+//****************************************************************************
+// LookUpTrajectoryCacheFile()
+
+bool TypeIIRMLPosition::LookUpTrajectoryCacheFile(      const RMLPositionFlags  &Flags
+                                                    ,   const double            &MinimumSynchronizationTime )
+{
+    unsigned int                            i                       =   0
+                                        ,   j                       =   0
+                                        ,   NumberOfKeyValues       =   TRAJECTORY_CACHE_KEY_VALUES_PER_DOF * this->NumberOfDOFs;
+
+    unsigned long long                      k                       =   0
+                                        ,   LowerIndex              =   0
+                                        ,   UpperIndex              =   0
+                                        ,   MiddleIndex             =   0;
+
+    double                                  *KeyValues              =   NULL
+                                        ,   *CurrentPosition        =   NULL
+                                        ,   *MinimumExecutionTimes  =   NULL
+                                        ,   *PolynomialValues       =   NULL
+                                        ,   *Values                 =   NULL;
+
+    unsigned char                           *Record                 =   NULL
+                                        ,   *SelectionVector        =   NULL
+                                        ,   *ModifiedSelectionVector=   NULL
+                                        ,   *ValidPolynomials       =   NULL
+                                        ,   *UsedStep1AProfiles     =   NULL;
+
+    const RMLTrajectoryCacheRecordHeader    *RecordHeader           =   NULL;
+
+    MotionPolynomials                       *Polynomial             =   NULL;
+
+    if (    (this->TrajectoryCacheFileHeader                    ==  NULL                )
+        ||  (this->TrajectoryCacheFileHeader->NumberOfDOFs      <   this->NumberOfDOFs  )   )
+    {
+        return(false);
+    }
+
+    // first record whose hash value is not less than the one of the
+    // current input values
+    UpperIndex  =   this->TrajectoryCacheFileNumberOfRecords;
+
+    while (LowerIndex < UpperIndex)
+    {
+        MiddleIndex     =   LowerIndex + (UpperIndex - LowerIndex) / 2;
+        RecordHeader    =   (const RMLTrajectoryCacheRecordHeader*)(    this->TrajectoryCacheFileRecords
+                                                                    +   (size_t)MiddleIndex * this->TrajectoryCacheFileHeader->RecordSize   );
+
+        if (RecordHeader->HashValue < this->TrajectoryCacheHashValue)
+        {
+            LowerIndex  =   MiddleIndex + 1;
+        }
+        else
+        {
+            UpperIndex  =   MiddleIndex;
+        }
+    }
+
+    for (k = LowerIndex; k < this->TrajectoryCacheFileNumberOfRecords; k++)
+    {
+        Record          =   (unsigned char*)(       this->TrajectoryCacheFileRecords
+                                                +   (size_t)k * this->TrajectoryCacheFileHeader->RecordSize );
+        RecordHeader    =   (const RMLTrajectoryCacheRecordHeader*)Record;
+
+        if (RecordHeader->HashValue != this->TrajectoryCacheHashValue)
+        {
+            break;
+        }
+
+        if (    (RecordHeader->NumberOfDOFs                 !=  this->NumberOfDOFs              )
+            ||  (RecordHeader->SynchronizationBehavior      !=  Flags.SynchronizationBehavior   )
+            ||  (RecordHeader->CycleTime                    !=  this->CycleTime                 )
+            ||  (RecordHeader->MinimumSynchronizationTime   !=  MinimumSynchronizationTime      )   )
+        {
+            continue;
+        }
+
+        GetTrajectoryCacheRecordBlocks(     Record
+                                        ,   this->TrajectoryCacheFileHeader->NumberOfDOFs
+                                        ,   &KeyValues
+                                        ,   &CurrentPosition
+                                        ,   &MinimumExecutionTimes
+                                        ,   &PolynomialValues
+                                        ,   &SelectionVector
+                                        ,   &ModifiedSelectionVector
+                                        ,   &ValidPolynomials
+                                        ,   &UsedStep1AProfiles     );
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            if ((SelectionVector[i] != 0) != (this->CurrentInputParameters->SelectionVector->VecData)[i])
+            {
+                break;
+            }
+        }
+
+        if (i < this->NumberOfDOFs)
+        {
+            continue;
+        }
+
+        if (memcmp(     KeyValues
+                    ,   this->TrajectoryCacheKeyValues->VecData
+                    ,   NumberOfKeyValues * sizeof(double)      ) != 0)
+        {
+            continue;
+        }
+
+        // cf. TypeIIRMLPosition::LookUpTrajectoryCache()
+        if (this->TrajectoryCacheResolution == 0.0)
+        {
+            for (i = 0; i < this->NumberOfDOFs; i++)
+            {
+                if (    ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+                    &&  (memcmp(    &(CurrentPosition[i])
+                                ,   &((this->CurrentInputParameters->CurrentPositionVector->VecData)[i])
+                                ,   sizeof(double)                                                          ) != 0) )
+                {
+                    break;
+                }
+            }
+
+            if (i < this->NumberOfDOFs)
+            {
+                continue;
+            }
+        }
+
+        // The trajectory of the record is used.
+
+        for (i = 0; i < this->NumberOfDOFs; i++)
+        {
+            Polynomial  =   &((this->Polynomials)[i]);
+
+            (this->ModifiedSelectionVector->VecData)[i] =   (ModifiedSelectionVector[i] != 0)           ;
+            (this->MinimumExecutionTimes->VecData)[i]   =   MinimumExecutionTimes[i]                    ;
+            (this->UsedStep1AProfiles->VecData)[i]      =   (Step1_Profile)(UsedStep1AProfiles[i])      ;
+
+            if (!((this->ModifiedSelectionVector->VecData)[i]))
+            {
+                Polynomial->ValidPolynomials    =   0;
+                continue;
+            }
+
+            Polynomial->ValidPolynomials    =   ValidPolynomials[i];
+
+            for (j = 0; j < (unsigned int)(Polynomial->ValidPolynomials); j++)
+            {
+                Values      =       PolynomialValues
+                                +   RML_TRAJECTORY_CACHE_VALUES_PER_POLYNOMIAL * (MAXIMAL_NO_OF_POLYNOMIALS * i + j);
+
+                Polynomial->PolynomialTimes[j]  =   Values[0];
+
+                Polynomial->PositionPolynomial      [j].SetCoefficients(Values[ 1], Values[ 2], Values[ 3], Values[ 4]);
+                Polynomial->VelocityPolynomial      [j].SetCoefficients(Values[ 5], Values[ 6], Values[ 7], Values[ 8]);
+                Polynomial->AccelerationPolynomial  [j].SetCoefficients(Values[ 9], Values[10], Values[11], Values[12]);
+            }
+
+            this->TranslatePositionPolynomials(     i
+                                                ,       (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                                                    -   CurrentPosition[i]                                                  );
+        }
+
+        this->SetupModifiedDOFs();
+
+        this->SynchronizationTime                   =   RecordHeader->SynchronizationTime                   ;
+        this->GreatestDOFForPhaseSynchronization    =   RecordHeader->GreatestDOFForPhaseSynchronization    ;
+        this->CurrentTrajectoryIsPhaseSynchronized  =   (RecordHeader->IsPhaseSynchronized != 0)            ;
+
+        return(true);
+    }
+
+    return(false);
+}
@@ -59,7 +59,8 @@ using namespace TypeIIRMLMath;
 // TypeIIRMLVelocity()
 
 TypeIIRMLVelocity::TypeIIRMLVelocity(       const unsigned int  &DegreesOfFreedom
-                                       ,    const double        &CycleTimeInSeconds)
+                                       ,    const double        &CycleTimeInSeconds
+                                       ,    const unsigned int  &MaxNumberOfDOFs)
 {
     this->CurrentTrajectoryIsPhaseSynchronized          =   false                                               ;
     this->CalculatePositionalExtremsFlag                =   false                                               ;
@@ -69,24 +70,31 @@ TypeIIRMLVelocity::TypeIIRMLVelocity(       const unsigned int  &DegreesOfFreedo
     this->DOFWithGreatestExecutionTime                  =   0                                                   ;
 
     this->NumberOfDOFs                                  =   DegreesOfFreedom                                    ;
+    this->MaxNumberOfDOFs                               =   (MaxNumberOfDOFs > DegreesOfFreedom)?(MaxNumberOfDOFs):(DegreesOfFreedom);
     this->CycleTime                                     =   CycleTimeInSeconds                                  ;
+    this->NominalCycleTime                              =   CycleTimeInSeconds                                  ;
     this->InternalClockInSeconds                        =   0.0                                                 ;
     this->SynchronizationTime                           =   0.0                                                 ;
+    this->NumberOfSelectedDOFs                          =   0                                                   ;
 
-    this->PhaseSyncSelectionVector                      =   new RMLBoolVector               (this->NumberOfDOFs);
+    this->PhaseSyncSelectionVector                      =   new RMLBoolVector               (this->MaxNumberOfDOFs);
+    this->IndexedSelectionVector                        =   new RMLBoolVector               (this->MaxNumberOfDOFs);
+    this->SelectedDOFs                                  =   new RMLVector<unsigned int>     (this->MaxNumberOfDOFs);
 
-    this->ExecutionTimes                                =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (this->NumberOfDOFs);
-    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (this->NumberOfDOFs);
+    this->ExecutionTimes                                =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
+    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (this->MaxNumberOfDOFs);
 
-    this->OldInputParameters                            =   new RMLVelocityInputParameters  (this->NumberOfDOFs);
-    this->CurrentInputParameters                        =   new RMLVelocityInputParameters  (this->NumberOfDOFs);
+    this->OldInputParameters                            =   new RMLVelocityInputParameters  (this->MaxNumberOfDOFs);
+    this->CurrentInputParameters                        =   new RMLVelocityInputParameters  (this->MaxNumberOfDOFs);
 
-    this->OutputParameters                              =   new RMLVelocityOutputParameters (this->NumberOfDOFs);
+    this->OutputParameters                              =   new RMLVelocityOutputParameters (this->MaxNumberOfDOFs);
 
-    this->Polynomials                                   =   new MotionPolynomials           [this->NumberOfDOFs];
+    this->Polynomials                                   =   new MotionPolynomials           [this->MaxNumberOfDOFs];
+
+    this->SetInternalNumberOfDOFs(this->NumberOfDOFs);
 }
 
 
@@ -96,6 +104,8 @@ TypeIIRMLVelocity::TypeIIRMLVelocity(       const unsigned int  &DegreesOfFreedo
 TypeIIRMLVelocity::~TypeIIRMLVelocity(void)
 {
     delete      this->PhaseSyncSelectionVector                      ;
+    delete      this->IndexedSelectionVector                        ;
+    delete      this->SelectedDOFs                                  ;
 
     delete      this->ExecutionTimes                                ;
     delete      this->PhaseSynchronizationReferenceVector           ;
@@ -110,6 +120,8 @@ TypeIIRMLVelocity::~TypeIIRMLVelocity(void)
     delete[]    this->Polynomials                                   ;
 
     this->PhaseSyncSelectionVector                      =   NULL    ;
+    this->IndexedSelectionVector                        =   NULL    ;
+    this->SelectedDOFs                                  =   NULL    ;
     this->ExecutionTimes                                =   NULL    ;
     this->PhaseSynchronizationReferenceVector           =   NULL    ;
     this->PhaseSynchronizationCurrentVelocityVector     =   NULL    ;
@@ -131,11 +143,21 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
                                              ,  RMLVelocityOutputParameters         *OutputValues
                                              ,  const RMLVelocityFlags              &Flags)
 {
-    bool                    ErroneousInputValues                =   false
-                        ,   StartANewCalculation                =   false   ;
+    return(this->GetNextStateOfMotion(      InputValues
+                                        ,   OutputValues
+                                        ,   Flags
+                                        ,   this->NominalCycleTime  ));
+}
+
 
-    unsigned int            i                                   =   0       ;
+//****************************************************************************
+// GetNextStateOfMotion()
 
+int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters    &InputValues
+                                             ,  RMLVelocityOutputParameters         *OutputValues
+                                             ,  const RMLVelocityFlags              &Flags
+                                             ,  const double                        &ElapsedTimeInSeconds)
+{
     if  (   (OutputValues   ==  NULL)
         ||  (&InputValues   ==  NULL)
         ||  (&Flags         ==  NULL)   )
@@ -144,6 +166,14 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         return(this->ReturnValue);
     }
 
+    if (!(ElapsedTimeInSeconds > 0.0))
+    {
+        this->ReturnValue   =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
+        return(this->ReturnValue);
+    }
+
+    this->CycleTime =   ElapsedTimeInSeconds;
+
     if (    (this->NumberOfDOFs != InputValues.GetNumberOfDOFs())
         ||  (this->NumberOfDOFs != OutputValues->GetNumberOfDOFs()) )
     {
@@ -151,10 +181,31 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         return(this->ReturnValue);
     }
 
-    this->CalculatePositionalExtremsFlag    =   Flags.EnableTheCalculationOfTheExtremumMotionStates;
-
     *(this->CurrentInputParameters) =   InputValues;
 
+    this->ComputeNextStateOfMotion(Flags);
+
+    *OutputValues   =   *(this->OutputParameters);
+
+    return(this->ReturnValue);
+}
+
+
+//****************************************************************************
+// ComputeNextStateOfMotion()
+
+int TypeIIRMLVelocity::ComputeNextStateOfMotion(const RMLVelocityFlags &Flags)
+{
+    bool                    ErroneousInputValues                =   false
+                        ,   StartANewCalculation                =   false   ;
+
+    unsigned int            i                                   =   0
+                        ,   k                                   =   0       ;
+
+    this->SetupSelectedDOFs();
+
+    this->CalculatePositionalExtremsFlag    =   Flags.EnableTheCalculationOfTheExtremumMotionStates;
+
     if (Flags   !=  this->OldFlags)
     {
         StartANewCalculation    =   true;
@@ -171,26 +222,25 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         }
         else
         {
-            for (i = 0; i < this->NumberOfDOFs; i++)
+            for (k = 0; k < this->NumberOfSelectedDOFs; k++)
             {
-                if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+                i   =   (this->SelectedDOFs->VecData)[k];
+
+                if (!(      IsInputEpsilonEqual(
+                                    (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
+                                ,   (this->OutputParameters->NewVelocityVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                                    (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
+                                ,   (this->OldInputParameters->MaxAccelerationVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                                    (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
+                                ,   (this->OldInputParameters->TargetVelocityVector->VecData)[i])
+                        &&  IsInputEpsilonEqual(
+                                    (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
+                                ,   (this->OutputParameters->NewPositionVector->VecData)[i])))
                 {
-                    if (!(      IsInputEpsilonEqual(
-                                        (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i]
-                                    ,   (this->OutputParameters->NewVelocityVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                                        (this->CurrentInputParameters->MaxAccelerationVector->VecData)[i]
-                                    ,   (this->OldInputParameters->MaxAccelerationVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                                        (this->CurrentInputParameters->TargetVelocityVector->VecData)[i]
-                                    ,   (this->OldInputParameters->TargetVelocityVector->VecData)[i])
-                            &&  IsInputEpsilonEqual(
-                                        (this->CurrentInputParameters->CurrentPositionVector->VecData)[i]
-                                    ,   (this->OutputParameters->NewPositionVector->VecData)[i])))
-                    {
-                        StartANewCalculation    =   true;
-                        break;
-                    }
+                    StartANewCalculation    =   true;
+                    break;
                 }
             }
         }
@@ -218,22 +268,21 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         }
     }
 
-    *(this->OldInputParameters)     =   InputValues ;
-    this->OldFlags                  =   Flags       ;
+    *(this->OldInputParameters)     =   *(this->CurrentInputParameters) ;
+    this->OldFlags                  =   Flags                           ;
 
     if (StartANewCalculation)
     {
         this->CurrentTrajectoryIsPhaseSynchronized  =       (Flags.SynchronizationBehavior == RMLFlags::ONLY_PHASE_SYNCHRONIZATION)
                                                         ||  (Flags.SynchronizationBehavior == RMLFlags::PHASE_SYNCHRONIZATION_IF_POSSIBLE);
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+            i   =   (this->SelectedDOFs->VecData)[k];
+
+            if (this->CurrentInputParameters->MaxAccelerationVector->VecData[i] <=  0.0)
             {
-                if (this->CurrentInputParameters->MaxAccelerationVector->VecData[i] <=  0.0)
-                {
-                    ErroneousInputValues    =   true;
-                }
+                ErroneousInputValues    =   true;
             }
         }
 
@@ -242,7 +291,6 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
             this->FallBackStrategy(     *(this->CurrentInputParameters)
                                     ,   this->OutputParameters      );
 
-            *OutputValues       =   *(this->OutputParameters);
             this->ReturnValue   =   ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES;
             return(this->ReturnValue);
         }
@@ -257,22 +305,21 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
 
         this->SynchronizationTime   =   0.0;
 
-        for(i = 0; i < this->NumberOfDOFs; i++)
+        for(k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if(this->CurrentInputParameters->SelectionVector->VecData[i])
+            i   =   (this->SelectedDOFs->VecData)[k];
+
+            if ( (this->ExecutionTimes->VecData)[i] > this->SynchronizationTime )
             {
-                if ( (this->ExecutionTimes->VecData)[i] > this->SynchronizationTime )
-                {
-                    this->SynchronizationTime           =   (this->ExecutionTimes->VecData)[i];
-                    this->DOFWithGreatestExecutionTime  =   i;
-                }
+                this->SynchronizationTime           =   (this->ExecutionTimes->VecData)[i];
+                this->DOFWithGreatestExecutionTime  =   i;
             }
         }
 
-        if  (   (Flags.SynchronizationBehavior          !=  RMLFlags::NO_SYNCHRONIZATION)
-            &&  (InputValues.MinimumSynchronizationTime >   this->SynchronizationTime   ))
+        if  (   (Flags.SynchronizationBehavior                          !=  RMLFlags::NO_SYNCHRONIZATION)
+            &&  (this->OldInputParameters->MinimumSynchronizationTime   >   this->SynchronizationTime   ))
         {
-            this->SynchronizationTime   =   InputValues.MinimumSynchronizationTime;
+            this->SynchronizationTime   =   this->OldInputParameters->MinimumSynchronizationTime;
         }
 
         if (this->CurrentTrajectoryIsPhaseSynchronized)
@@ -286,8 +333,7 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
             this->FallBackStrategy(     *(this->CurrentInputParameters)
                                     ,   this->OutputParameters          );
 
-            *OutputValues       =   *(this->OutputParameters);
-            if (InputValues.CheckForValidity())
+            if (this->OldInputParameters->CheckForValidity())
             {
                 this->ReturnValue   =   ReflexxesAPI::RML_ERROR_NO_PHASE_SYNCHRONIZATION;
             }
@@ -326,20 +372,17 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         this->OutputParameters->SynchronizationTime             =   0.0;
         this->OutputParameters->DOFWithTheGreatestExecutionTime =   this->DOFWithGreatestExecutionTime;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        this->OutputParameters->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   (this->ExecutionTimes->VecData)[i]
-                                                                        -   this->InternalClockInSeconds
-                                                                        +   this->CycleTime;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (this->OutputParameters->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
-                }
-            }
-            else
+            this->OutputParameters->ExecutionTimes->VecData[i]  =   (this->ExecutionTimes->VecData)[i]
+                                                                    -   this->InternalClockInSeconds
+                                                                    +   this->CycleTime;
+
+            if (this->OutputParameters->ExecutionTimes->VecData[i] < 0.0)
             {
                 this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
             }
@@ -350,16 +393,13 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         this->OutputParameters->SynchronizationTime             =   this->SynchronizationTime;
         this->OutputParameters->DOFWithTheGreatestExecutionTime =   0;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        this->OutputParameters->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   this->SynchronizationTime;
-            }
-            else
-            {
-                this->OutputParameters->ExecutionTimes->VecData[i]  =   0.0;
-            }
+            i   =   (this->SelectedDOFs->VecData)[k];
+
+            this->OutputParameters->ExecutionTimes->VecData[i]  =   this->SynchronizationTime;
         }
     }
 
@@ -373,8 +413,6 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
         this->SetPositionalExtremsToZero(this->OutputParameters);
     }
 
-    *OutputValues   =   *(this->OutputParameters);
-
     return(this->ReturnValue);
 }
 
@@ -385,7 +423,8 @@ int TypeIIRMLVelocity::GetNextStateOfMotion(    const RMLVelocityInputParameters
 int TypeIIRMLVelocity::GetNextStateOfMotionAtTime(      const double                        &TimeValueInSeconds
                                                     ,   RMLVelocityOutputParameters         *OutputValues       ) const
 {
-    unsigned int            i                           =   0;
+    unsigned int            i                           =   0
+                        ,   k                           =   0;
 
     int                     ReturnValueOfThisMethod     =   ReflexxesAPI::RML_FINAL_STATE_REACHED;
 
@@ -427,21 +466,18 @@ int TypeIIRMLVelocity::GetNextStateOfMotionAtTime(      const double
         OutputValues->SynchronizationTime               =   0.0;
         OutputValues->DOFWithTheGreatestExecutionTime   =   this->DOFWithGreatestExecutionTime;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        OutputValues->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                OutputValues->ExecutionTimes->VecData[i]    =   (this->ExecutionTimes->VecData)[i]
-                                                                -   this->InternalClockInSeconds
-                                                                +   this->CycleTime
-                                                                -   InternalTime;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    OutputValues->ExecutionTimes->VecData[i]    =   0.0;
-                }
-            }
-            else
+            OutputValues->ExecutionTimes->VecData[i]    =   (this->ExecutionTimes->VecData)[i]
+                                                            -   this->InternalClockInSeconds
+                                                            +   this->CycleTime
+                                                            -   InternalTime;
+
+            if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
             {
                 OutputValues->ExecutionTimes->VecData[i]    =   0.0;
             }
@@ -452,19 +488,16 @@ int TypeIIRMLVelocity::GetNextStateOfMotionAtTime(      const double
         OutputValues->SynchronizationTime               =   this->SynchronizationTime - InternalTime;
         OutputValues->DOFWithTheGreatestExecutionTime   =   this->DOFWithGreatestExecutionTime;
 
-        for (i = 0; i < this->NumberOfDOFs; i++)
+        OutputValues->ExecutionTimes->Set(0.0);
+
+        for (k = 0; k < this->NumberOfSelectedDOFs; k++)
         {
-            if (this->CurrentInputParameters->SelectionVector->VecData[i])
-            {
-                OutputValues->ExecutionTimes->VecData[i]    =   this->SynchronizationTime
-                                                                -   InternalTime;
+            i   =   (this->SelectedDOFs->VecData)[k];
 
-                if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
-                {
-                    OutputValues->ExecutionTimes->VecData[i]    =   0.0;
-                }
-            }
-            else
+            OutputValues->ExecutionTimes->VecData[i]    =   this->SynchronizationTime
+                                                            -   InternalTime;
+
+            if (OutputValues->ExecutionTimes->VecData[i] < 0.0)
             {
                 OutputValues->ExecutionTimes->VecData[i]    =   0.0;
             }
@@ -499,12 +532,17 @@ TypeIIRMLVelocity &TypeIIRMLVelocity::operator = (const TypeIIRMLVelocity &TypeI
     this->ReturnValue                                           =   TypeIIRMLObject.ReturnValue                                         ;
     this->DOFWithGreatestExecutionTime                          =   TypeIIRMLObject.DOFWithGreatestExecutionTime                        ;
 
-    this->NumberOfDOFs                                          =   TypeIIRMLObject.NumberOfDOFs                                        ;
+    this->SetInternalNumberOfDOFs(TypeIIRMLObject.NumberOfDOFs);
+
     this->CycleTime                                             =   TypeIIRMLObject.CycleTime                                           ;
+    this->NominalCycleTime                                      =   TypeIIRMLObject.NominalCycleTime                                    ;
     this->InternalClockInSeconds                                =   TypeIIRMLObject.InternalClockInSeconds                              ;
     this->SynchronizationTime                                   =   TypeIIRMLObject.SynchronizationTime                                 ;
 
     *(this->PhaseSyncSelectionVector                        )   =   *(TypeIIRMLObject.PhaseSyncSelectionVector                      )   ;
+    *(this->IndexedSelectionVector                          )   =   *(TypeIIRMLObject.IndexedSelectionVector                        )   ;
+    *(this->SelectedDOFs                                    )   =   *(TypeIIRMLObject.SelectedDOFs                                  )   ;
+    this->NumberOfSelectedDOFs                                  =   TypeIIRMLObject.NumberOfSelectedDOFs                                ;
 
     *(this->ExecutionTimes                                  )   =   *(TypeIIRMLObject.ExecutionTimes                                )   ;
     *(this->PhaseSynchronizationReferenceVector             )   =   *(TypeIIRMLObject.PhaseSynchronizationReferenceVector           )   ;
@@ -532,20 +570,24 @@ TypeIIRMLVelocity &TypeIIRMLVelocity::operator = (const TypeIIRMLVelocity &TypeI
 
 TypeIIRMLVelocity::TypeIIRMLVelocity(const TypeIIRMLVelocity &TypeIIRMLObject)
 {
-    this->PhaseSyncSelectionVector                      =   new RMLBoolVector               (TypeIIRMLObject.NumberOfDOFs)  ;
+    this->MaxNumberOfDOFs                               =   TypeIIRMLObject.MaxNumberOfDOFs                                 ;
+
+    this->PhaseSyncSelectionVector                      =   new RMLBoolVector               (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->IndexedSelectionVector                        =   new RMLBoolVector               (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->SelectedDOFs                                  =   new RMLVector<unsigned int>     (TypeIIRMLObject.MaxNumberOfDOFs);
 
-    this->ExecutionTimes                                =   new RMLDoubleVector             (TypeIIRMLObject.NumberOfDOFs)  ;
-    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (TypeIIRMLObject.NumberOfDOFs)  ;
-    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (TypeIIRMLObject.NumberOfDOFs)  ;
-    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (TypeIIRMLObject.NumberOfDOFs)  ;
-    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (TypeIIRMLObject.NumberOfDOFs)  ;
+    this->ExecutionTimes                                =   new RMLDoubleVector             (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->PhaseSynchronizationReferenceVector           =   new RMLDoubleVector             (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->PhaseSynchronizationCurrentVelocityVector     =   new RMLDoubleVector             (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->PhaseSynchronizationTargetVelocityVector      =   new RMLDoubleVector             (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->PhaseSynchronizationMaxAccelerationVector     =   new RMLDoubleVector             (TypeIIRMLObject.MaxNumberOfDOFs);
 
-    this->OldInputParameters                            =   new RMLVelocityInputParameters  (TypeIIRMLObject.NumberOfDOFs)  ;
-    this->CurrentInputParameters                        =   new RMLVelocityInputParameters  (TypeIIRMLObject.NumberOfDOFs)  ;
+    this->OldInputParameters                            =   new RMLVelocityInputParameters  (TypeIIRMLObject.MaxNumberOfDOFs);
+    this->CurrentInputParameters                        =   new RMLVelocityInputParameters  (TypeIIRMLObject.MaxNumberOfDOFs);
 
-    this->OutputParameters                              =   new RMLVelocityOutputParameters (TypeIIRMLObject.NumberOfDOFs)  ;
+    this->OutputParameters                              =   new RMLVelocityOutputParameters (TypeIIRMLObject.MaxNumberOfDOFs);
 
-    this->Polynomials                                   =   new MotionPolynomials           [TypeIIRMLObject.NumberOfDOFs]  ;
+    this->Polynomials                                   =   new MotionPolynomials           [TypeIIRMLObject.MaxNumberOfDOFs];
 
     *this                                               =   TypeIIRMLObject                                                 ;
 }
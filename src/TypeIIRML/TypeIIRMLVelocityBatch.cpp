@@ -0,0 +1,362 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLVelocityBatch.cpp
+//!
+//! \brief
+//! Implementation file for the class TypeIIRMLVelocityBatch
+//!
+//! \details
+//! For further information, please refer to the file
+//! TypeIIRMLVelocityBatch.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+#include <TypeIIRMLVelocityBatch.h>
+#include <TypeIIRMLMath.h>
+#include <TypeIIRMLDecisions.h>
+#include <ReflexxesAPI.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define RML_VELOCITY_BATCH_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+//****************************************************************************
+// TypeIIRMLVelocityBatch()
+
+TypeIIRMLVelocityBatch::TypeIIRMLVelocityBatch(const double &CycleTimeInSeconds)
+{
+    this->CycleTime =   CycleTimeInSeconds;
+}
+
+
+//****************************************************************************
+// ~TypeIIRMLVelocityBatch()
+
+TypeIIRMLVelocityBatch::~TypeIIRMLVelocityBatch(void)
+{
+}
+
+
+//****************************************************************************
+// ComputeOneAxis()
+
+int TypeIIRMLVelocityBatch::ComputeOneAxis(     const size_t                        &Index
+                                            ,   const RMLVelocityBatchInputValues   &InputValues
+                                            ,   RMLVelocityBatchOutputValues        *OutputValues   ) const
+{
+    double      P                               =   InputValues.CurrentPosition[Index]
+            ,   V                               =   InputValues.CurrentVelocity[Index]
+            ,   MaxAcceleration                 =   InputValues.MaxAcceleration[Index]
+            ,   TargetVelocity                  =   InputValues.TargetVelocity[Index]
+            ,   Sign                            =   0.0
+            ,   SignedAcceleration              =   0.0
+            ,   TimeForFirstSegment             =   0.0
+            ,   PositionAtTargetVelocity        =   0.0
+            ,   VelocityAtTargetVelocity        =   0.0 ;
+
+    if (    (InputValues.Selection != NULL)
+        &&  (InputValues.Selection[Index] == 0) )
+    {
+        OutputValues->NewPosition[Index]        =   P;
+        OutputValues->NewVelocity[Index]        =   V;
+        OutputValues->NewAcceleration[Index]    =   InputValues.CurrentAcceleration[Index];
+
+        if (OutputValues->ExecutionTimes != NULL)
+        {
+            OutputValues->ExecutionTimes[Index]                 =   0.0;
+        }
+        if (OutputValues->PositionValuesAtTargetVelocity != NULL)
+        {
+            OutputValues->PositionValuesAtTargetVelocity[Index] =   P;
+        }
+        return(ReflexxesAPI::RML_FINAL_STATE_REACHED);
+    }
+
+    if (MaxAcceleration <= 0.0)
+    {
+        // keep the current velocity (cf. TypeIIRMLVelocity::FallBackStrategy())
+        OutputValues->NewPosition[Index]        =   P + this->CycleTime * V;
+        OutputValues->NewVelocity[Index]        =   V;
+        OutputValues->NewAcceleration[Index]    =   0.0;
+
+        if (OutputValues->ExecutionTimes != NULL)
+        {
+            OutputValues->ExecutionTimes[Index]                 =   0.0;
+        }
+        if (OutputValues->PositionValuesAtTargetVelocity != NULL)
+        {
+            OutputValues->PositionValuesAtTargetVelocity[Index] =   P;
+        }
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    // The arithmetic operations equal the ones of
+    // TypeIIRMLVelocity::ComputeTrajectoryParameters() and
+    // TypeIIRMLPolynomial::CalculateValue(), such that the results are
+    // bitwise identical.
+
+    Sign                        =   (TypeIIRMLMath::Decision_V___001(V, TargetVelocity))?(1.0):(-1.0);
+    SignedAcceleration          =   Sign * MaxAcceleration;
+
+    TimeForFirstSegment         =   fabs(V - TargetVelocity) / MaxAcceleration;
+
+    PositionAtTargetVelocity    =   P + (V * TimeForFirstSegment + Sign * (0.5 * MaxAcceleration * pow2(TimeForFirstSegment)));
+    VelocityAtTargetVelocity    =   V + SignedAcceleration * TimeForFirstSegment;
+
+    if (OutputValues->ExecutionTimes != NULL)
+    {
+        // TypeIIRMLVelocity subtracts the internal clock, which equals
+        // the cycle time after a recomputation, and adds the cycle time.
+        OutputValues->ExecutionTimes[Index]                 =       TimeForFirstSegment
+                                                                -   this->CycleTime
+                                                                +   this->CycleTime;
+
+        if (OutputValues->ExecutionTimes[Index] < 0.0)
+        {
+            OutputValues->ExecutionTimes[Index]             =   0.0;
+        }
+    }
+    if (OutputValues->PositionValuesAtTargetVelocity != NULL)
+    {
+        OutputValues->PositionValuesAtTargetVelocity[Index] =   PositionAtTargetVelocity;
+    }
+
+    if (!(this->CycleTime > TimeForFirstSegment))
+    {
+        OutputValues->NewPosition[Index]        =       Sign * (0.5 * MaxAcceleration) * this->CycleTime * this->CycleTime
+                                                    +   V * this->CycleTime
+                                                    +   P;
+        OutputValues->NewVelocity[Index]        =   SignedAcceleration * this->CycleTime + V;
+        OutputValues->NewAcceleration[Index]    =   SignedAcceleration;
+
+        return(ReflexxesAPI::RML_WORKING);
+    }
+
+    if (VelocityAtTargetVelocity != 0.0)
+    {
+        OutputValues->NewPosition[Index]    =       VelocityAtTargetVelocity * (this->CycleTime - TimeForFirstSegment)
+                                                +   PositionAtTargetVelocity;
+    }
+    else
+    {
+        OutputValues->NewPosition[Index]    =   PositionAtTargetVelocity;
+    }
+    OutputValues->NewVelocity[Index]        =   VelocityAtTargetVelocity;
+    OutputValues->NewAcceleration[Index]    =   0.0;
+
+    return(ReflexxesAPI::RML_FINAL_STATE_REACHED);
+}
+
+
+//****************************************************************************
+// GetNextStatesOfMotion()
+
+int TypeIIRMLVelocityBatch::GetNextStatesOfMotion(      const size_t                        &NumberOfAxes
+                                                    ,   const RMLVelocityBatchInputValues   &InputValues
+                                                    ,   RMLVelocityBatchOutputValues        *OutputValues   ) const
+{
+    bool            AxisIsWorking       =   false
+                ,   ErrorOccurred       =   false;
+
+    int             ResultValue         =   ReflexxesAPI::RML_FINAL_STATE_REACHED;
+
+    size_t          i                   =   0;
+
+    if (    (OutputValues                       ==  NULL)
+        ||  (InputValues.CurrentPosition        ==  NULL)
+        ||  (InputValues.CurrentVelocity        ==  NULL)
+        ||  (InputValues.CurrentAcceleration    ==  NULL)
+        ||  (InputValues.MaxAcceleration        ==  NULL)
+        ||  (InputValues.TargetVelocity         ==  NULL)   )
+    {
+        return(ReflexxesAPI::RML_ERROR_NULL_POINTER);
+    }
+
+    if (    (OutputValues->NewPosition          ==  NULL)
+        ||  (OutputValues->NewVelocity          ==  NULL)
+        ||  (OutputValues->NewAcceleration      ==  NULL)   )
+    {
+        return(ReflexxesAPI::RML_ERROR_NULL_POINTER);
+    }
+
+#if defined(RML_VELOCITY_BATCH_USE_SSE2)
+
+    const __m128d   CycleTime2          =   _mm_set1_pd(this->CycleTime)
+                ,   Zero2               =   _mm_setzero_pd()
+                ,   Half2               =   _mm_set1_pd(0.5)
+                ,   One2                =   _mm_set1_pd(1.0)
+                ,   MinusOne2           =   _mm_set1_pd(-1.0)
+                ,   SignBit2            =   _mm_set1_pd(-0.0);
+
+    __m128d         P2
+                ,   V2
+                ,   MaxAcceleration2
+                ,   TargetVelocity2
+                ,   Mask2
+                ,   Sign2
+                ,   SignedAcceleration2
+                ,   TimeForFirstSegment2
+                ,   PositionAtTargetVelocity2
+                ,   VelocityAtTargetVelocity2
+                ,   FirstSegment2
+                ,   Position2
+                ,   HoldPosition2;
+
+    int             WorkingMask         =   0;
+
+    size_t          j                   =   0;
+
+    for (i = 0; i + 1 < NumberOfAxes; i += 2)
+    {
+        MaxAcceleration2    =   _mm_loadu_pd(InputValues.MaxAcceleration + i);
+
+        // axes that are not selected or that have invalid input values
+        // are handled by the scalar code
+        if (    (   (InputValues.Selection != NULL)
+                &&  ((InputValues.Selection[i] == 0) || (InputValues.Selection[i + 1] == 0)))
+            ||  (_mm_movemask_pd(_mm_cmpgt_pd(MaxAcceleration2, Zero2)) != 0x3) )
+        {
+            for (j = i; j < i + 2; j++)
+            {
+                ResultValue     =   this->ComputeOneAxis(j, InputValues, OutputValues);
+
+                if (ResultValue == ReflexxesAPI::RML_WORKING)
+                {
+                    WorkingMask     |=  0x1;
+                }
+                if (ResultValue == ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES)
+                {
+                    ErrorOccurred   =   true;
+                }
+                if (OutputValues->ResultValues != NULL)
+                {
+                    OutputValues->ResultValues[j]   =   ResultValue;
+                }
+            }
+            continue;
+        }
+
+        P2                          =   _mm_loadu_pd(InputValues.CurrentPosition + i);
+        V2                          =   _mm_loadu_pd(InputValues.CurrentVelocity + i);
+        TargetVelocity2             =   _mm_loadu_pd(InputValues.TargetVelocity + i);
+
+        Mask2                       =   _mm_cmple_pd(V2, TargetVelocity2);
+        Sign2                       =   _mm_or_pd(_mm_and_pd(Mask2, One2), _mm_andnot_pd(Mask2, MinusOne2));
+        SignedAcceleration2         =   _mm_mul_pd(Sign2, MaxAcceleration2);
+
+        TimeForFirstSegment2        =   _mm_div_pd(     _mm_andnot_pd(SignBit2, _mm_sub_pd(V2, TargetVelocity2))
+                                                    ,   MaxAcceleration2);
+
+        PositionAtTargetVelocity2   =   _mm_add_pd(     P2
+                                                    ,   _mm_add_pd(     _mm_mul_pd(V2, TimeForFirstSegment2)
+                                                                    ,   _mm_mul_pd(     Sign2
+                                                                                    ,   _mm_mul_pd(     _mm_mul_pd(Half2, MaxAcceleration2)
+                                                                                                    ,   _mm_mul_pd(TimeForFirstSegment2, TimeForFirstSegment2)))));
+        VelocityAtTargetVelocity2   =   _mm_add_pd(V2, _mm_mul_pd(SignedAcceleration2, TimeForFirstSegment2));
+
+        // first segment: !(CycleTime > TimeForFirstSegment)
+        FirstSegment2               =   _mm_cmpngt_pd(CycleTime2, TimeForFirstSegment2);
+
+        Position2                   =   _mm_add_pd(     _mm_add_pd(     _mm_mul_pd(     _mm_mul_pd(     _mm_mul_pd(Sign2, _mm_mul_pd(Half2, MaxAcceleration2))
+                                                                                                    ,   CycleTime2)
+                                                                                    ,   CycleTime2)
+                                                                    ,   _mm_mul_pd(V2, CycleTime2))
+                                                    ,   P2);
+
+        HoldPosition2               =   _mm_add_pd(     _mm_mul_pd(VelocityAtTargetVelocity2, _mm_sub_pd(CycleTime2, TimeForFirstSegment2))
+                                                    ,   PositionAtTargetVelocity2);
+        Mask2                       =   _mm_cmpneq_pd(VelocityAtTargetVelocity2, Zero2);
+        HoldPosition2               =   _mm_or_pd(_mm_and_pd(Mask2, HoldPosition2), _mm_andnot_pd(Mask2, PositionAtTargetVelocity2));
+
+        _mm_storeu_pd(  OutputValues->NewPosition + i
+                    ,   _mm_or_pd(_mm_and_pd(FirstSegment2, Position2), _mm_andnot_pd(FirstSegment2, HoldPosition2)));
+        _mm_storeu_pd(  OutputValues->NewVelocity + i
+                    ,   _mm_or_pd(      _mm_and_pd(FirstSegment2, _mm_add_pd(_mm_mul_pd(SignedAcceleration2, CycleTime2), V2))
+                                    ,   _mm_andnot_pd(FirstSegment2, VelocityAtTargetVelocity2)));
+        _mm_storeu_pd(  OutputValues->NewAcceleration + i
+                    ,   _mm_and_pd(FirstSegment2, SignedAcceleration2));
+
+        if (OutputValues->ExecutionTimes != NULL)
+        {
+            // (cf. TypeIIRMLVelocityBatch::ComputeOneAxis(); the result
+            // is never negative, as TimeForFirstSegment2 is not negative)
+            _mm_storeu_pd(  OutputValues->ExecutionTimes + i
+                        ,   _mm_add_pd(_mm_sub_pd(TimeForFirstSegment2, CycleTime2), CycleTime2));
+        }
+        if (OutputValues->PositionValuesAtTargetVelocity != NULL)
+        {
+            _mm_storeu_pd(OutputValues->PositionValuesAtTargetVelocity + i, PositionAtTargetVelocity2);
+        }
+
+        ResultValue =   _mm_movemask_pd(FirstSegment2);
+        WorkingMask |=  ResultValue;
+
+        if (OutputValues->ResultValues != NULL)
+        {
+            OutputValues->ResultValues[i]       =   (ResultValue & 0x1)?(ReflexxesAPI::RML_WORKING):(ReflexxesAPI::RML_FINAL_STATE_REACHED);
+            OutputValues->ResultValues[i + 1]   =   (ResultValue & 0x2)?(ReflexxesAPI::RML_WORKING):(ReflexxesAPI::RML_FINAL_STATE_REACHED);
+        }
+    }
+
+    AxisIsWorking   =   (WorkingMask != 0);
+
+#endif
+
+    for (; i < NumberOfAxes; i++)
+    {
+        ResultValue     =   this->ComputeOneAxis(i, InputValues, OutputValues);
+
+        if (ResultValue == ReflexxesAPI::RML_WORKING)
+        {
+            AxisIsWorking   =   true;
+        }
+        if (ResultValue == ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES)
+        {
+            ErrorOccurred   =   true;
+        }
+        if (OutputValues->ResultValues != NULL)
+        {
+            OutputValues->ResultValues[i]   =   ResultValue;
+        }
+    }
+
+    if (ErrorOccurred)
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    return((AxisIsWorking)?(ReflexxesAPI::RML_WORKING):(ReflexxesAPI::RML_FINAL_STATE_REACHED));
+}
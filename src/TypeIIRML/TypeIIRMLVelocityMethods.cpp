@@ -282,50 +282,53 @@ void TypeIIRMLVelocity::ComputePhaseSynchronizationParameters(void)
 int TypeIIRMLVelocity::ComputeAndSetOutputParameters(       const double                    &TimeValueInSeconds
                                                         ,   RMLVelocityOutputParameters     *OP                 ) const
 {
-    unsigned int            i                           =   0;
+    unsigned int            i                           =   0
+                        ,   k                           =   0;
 
     int                     j                           =   0
                         ,   ReturnValueForThisMethod    =   ReflexxesAPI::RML_FINAL_STATE_REACHED;
 
     // calculate the new state of motion
 
+    // All degrees of freedom that are not part of
+    // TypeIIRMLVelocity::SelectedDOFs keep their current state of motion.
     for (i = 0; i < this->NumberOfDOFs; i++)
     {
-        if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
-        {
-            j = 0;
-
-            while ( (TimeValueInSeconds > (((this->Polynomials)[i].PolynomialTimes)[j])) && (j < MAXIMAL_NO_OF_POLYNOMIALS))
-            {
-                j++;
-            }
+        (OP->NewPositionVector->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
+        (OP->NewVelocityVector->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
+        (OP->NewAccelerationVector->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i];
+        (OP->PositionValuesAtTargetVelocity->VecData)[i]
+            =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
+    }
 
-            (OP->NewPositionVector->VecData)[i]
-                =   (this->Polynomials)[i].PositionPolynomial[j].CalculateValue(TimeValueInSeconds);
-            (OP->NewVelocityVector->VecData)[i]
-                =   (this->Polynomials)[i].VelocityPolynomial[j].CalculateValue(TimeValueInSeconds);
-            (OP->NewAccelerationVector->VecData)[i]
-                =   (this->Polynomials)[i].AccelerationPolynomial[j].CalculateValue(TimeValueInSeconds);
+    for (k = 0; k < this->NumberOfSelectedDOFs; k++)
+    {
+        i   =   (this->SelectedDOFs->VecData)[k];
 
-            if ( j < ((this->Polynomials)[i].ValidPolynomials) - 1)
-            {
-                ReturnValueForThisMethod = ReflexxesAPI::RML_WORKING;
-            }
+        j = 0;
 
-            (OP->PositionValuesAtTargetVelocity->VecData)[i]
-                =   (this->Polynomials)[i].PositionPolynomial[(this->Polynomials)[i].ValidPolynomials - 1].a0;
+        while ( (TimeValueInSeconds > (((this->Polynomials)[i].PolynomialTimes)[j])) && (j < MAXIMAL_NO_OF_POLYNOMIALS))
+        {
+            j++;
         }
-        else
+
+        (OP->NewPositionVector->VecData)[i]
+            =   (this->Polynomials)[i].PositionPolynomial[j].CalculateValue(TimeValueInSeconds);
+        (OP->NewVelocityVector->VecData)[i]
+            =   (this->Polynomials)[i].VelocityPolynomial[j].CalculateValue(TimeValueInSeconds);
+        (OP->NewAccelerationVector->VecData)[i]
+            =   (this->Polynomials)[i].AccelerationPolynomial[j].CalculateValue(TimeValueInSeconds);
+
+        if ( j < ((this->Polynomials)[i].ValidPolynomials) - 1)
         {
-            (OP->NewPositionVector->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
-            (OP->NewVelocityVector->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentVelocityVector->VecData)[i];
-            (OP->NewAccelerationVector->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentAccelerationVector->VecData)[i];
-            (OP->PositionValuesAtTargetVelocity->VecData)[i]
-                =   (this->CurrentInputParameters->CurrentPositionVector->VecData)[i];
+            ReturnValueForThisMethod = ReflexxesAPI::RML_WORKING;
         }
+
+        (OP->PositionValuesAtTargetVelocity->VecData)[i]
+            =   (this->Polynomials)[i].PositionPolynomial[(this->Polynomials)[i].ValidPolynomials - 1].a0;
     }
 
     return(ReturnValueForThisMethod);
@@ -0,0 +1,99 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLVelocityPrepareForRealTime.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLVelocity.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLVelocity.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <RMLVelocityFlags.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// PrepareForRealTime()
+
+int TypeIIRMLVelocity::PrepareForRealTime(const RMLVelocityFlags &Flags)
+{
+    unsigned int                    i           =   0;
+
+    int                             Result      =   ReflexxesAPI::RML_ERROR;
+
+    RMLVelocityInputParameters      IP(this->NumberOfDOFs);
+
+    RMLVelocityOutputParameters     OP(this->NumberOfDOFs);
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        (IP.SelectionVector->VecData)           [i] =   true;
+        (IP.MaxAccelerationVector->VecData)     [i] =   1.0;
+        (IP.MaxJerkVector->VecData)             [i] =   1.0;
+        (IP.TargetVelocityVector->VecData)      [i] =   1.0;
+    }
+
+    Result  =   this->GetNextStateOfMotion(     IP
+                                            ,   &OP
+                                            ,   Flags   );
+
+    // change of the target velocity during the motion
+    if (Result >= 0)
+    {
+        *(IP.CurrentPositionVector)     =   *(OP.NewPositionVector)     ;
+        *(IP.CurrentVelocityVector)     =   *(OP.NewVelocityVector)     ;
+        *(IP.CurrentAccelerationVector) =   *(OP.NewAccelerationVector) ;
+
+        IP.TargetVelocityVector->Set(-1.0);
+
+        Result  =   this->GetNextStateOfMotion(     IP
+                                                ,   &OP
+                                                ,   Flags   );
+    }
+
+    this->Reset();
+
+    if (Result < 0)
+    {
+        return(Result);
+    }
+
+    return(ReflexxesAPI::RML_WORKING);
+}
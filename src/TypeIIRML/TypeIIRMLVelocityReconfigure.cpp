@@ -0,0 +1,125 @@
+//  ---------------------- Doxygen info ----------------------
+//! \file TypeIIRMLVelocityReconfigure.cpp
+//!
+//! \brief
+//! Implementation file for the Type II On-Line Trajectory
+//! Generation algorithm
+//!
+//! \details
+//! For further information, please refer to the file TypeIIRMLVelocity.h.
+//!
+//! \date October 2026
+//!
+//! \version 1.2.8 (development version)
+//!
+//! \author Reflexxes Motion Libraries contributors \n
+//!
+//! \copyright Copyright (C) 2026 the Reflexxes Motion Libraries contributors
+//! \n
+//! \n
+//! <b>GNU Lesser General Public License</b>
+//! \n
+//! \n
+//! This file is part of the Type II Reflexxes Motion Library.
+//! \n\n
+//! The Type II Reflexxes Motion Library is free software: you can redistribute
+//! it and/or modify it under the terms of the GNU Lesser General Public License
+//! as published by the Free Software Foundation, either version 3 of the
+//! License, or (at your option) any later version.
+//! \n\n
+//! The Type II Reflexxes Motion Library is distributed in the hope that it
+//! will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//! warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See
+//! the GNU Lesser General Public License for more details.
+//! \n\n
+//! You should have received a copy of the GNU Lesser General Public License
+//! along with the Type II Reflexxes Motion Library. If not, see
+//! <http://www.gnu.org/licenses/>.
+//  ----------------------------------------------------------
+//   For a convenient reading of this file's source code,
+//   please use a tab width of four characters.
+//  ----------------------------------------------------------
+
+
+
+#include <TypeIIRMLVelocity.h>
+#include <RMLVelocityInputParameters.h>
+#include <RMLVelocityOutputParameters.h>
+#include <ReflexxesAPI.h>
+
+
+//****************************************************************************
+// Reset()
+
+void TypeIIRMLVelocity::Reset(void)
+{
+    this->ReturnValue               =   ReflexxesAPI::RML_ERROR ;
+    this->InternalClockInSeconds    =   0.0                     ;
+    this->SynchronizationTime       =   0.0                     ;
+
+    return;
+}
+
+
+//****************************************************************************
+// Reconfigure()
+
+int TypeIIRMLVelocity::Reconfigure(     const unsigned int  &DegreesOfFreedom
+                                   ,    const double        &CycleTimeInSeconds)
+{
+    if (    (DegreesOfFreedom   ==  0                       )
+        ||  (DegreesOfFreedom   >   this->MaxNumberOfDOFs   )   )
+    {
+        return(ReflexxesAPI::RML_ERROR_NUMBER_OF_DOFS);
+    }
+
+    if (!(CycleTimeInSeconds > 0.0))
+    {
+        return(ReflexxesAPI::RML_ERROR_INVALID_INPUT_VALUES);
+    }
+
+    this->SetInternalNumberOfDOFs(DegreesOfFreedom);
+
+    this->CycleTime         =   CycleTimeInSeconds;
+    this->NominalCycleTime  =   CycleTimeInSeconds;
+
+    this->Reset();
+
+    return(ReflexxesAPI::RML_WORKING);
+}
+
+
+//****************************************************************************
+// SetInternalNumberOfDOFs()
+
+void TypeIIRMLVelocity::SetInternalNumberOfDOFs(const unsigned int &DegreesOfFreedom)
+{
+    this->NumberOfDOFs  =   DegreesOfFreedom;
+
+    this->PhaseSyncSelectionVector->SetVecDim                   (DegreesOfFreedom);
+    this->IndexedSelectionVector->SetVecDim                     (DegreesOfFreedom);
+    this->SelectedDOFs->SetVecDim                               (DegreesOfFreedom);
+
+    // The index list is rebuilt by the next call of
+    // TypeIIRMLVelocity::SetupSelectedDOFs().
+    this->IndexedSelectionVector->Set(false);
+    this->NumberOfSelectedDOFs  =   0;
+
+    this->ExecutionTimes->SetVecDim                             (DegreesOfFreedom);
+    this->PhaseSynchronizationReferenceVector->SetVecDim        (DegreesOfFreedom);
+    this->PhaseSynchronizationCurrentVelocityVector->SetVecDim  (DegreesOfFreedom);
+    this->PhaseSynchronizationTargetVelocityVector->SetVecDim   (DegreesOfFreedom);
+    this->PhaseSynchronizationMaxAccelerationVector->SetVecDim  (DegreesOfFreedom);
+
+    this->OldInputParameters->SetNumberOfDOFs                   (DegreesOfFreedom);
+    this->CurrentInputParameters->SetNumberOfDOFs               (DegreesOfFreedom);
+
+    this->OutputParameters->SetNumberOfDOFs                     (DegreesOfFreedom);
+
+    if (this->DOFWithGreatestExecutionTime >= DegreesOfFreedom)
+    {
+        this->DOFWithGreatestExecutionTime  =   0;
+    }
+
+    return;
+}
@@ -74,3 +74,41 @@ void TypeIIRMLVelocity::SetupPhaseSyncSelectionVector(void)
         }
     }
 }
+
+
+//****************************************************************************
+// SetupSelectedDOFs()
+
+void TypeIIRMLVelocity::SetupSelectedDOFs(void)
+{
+    unsigned int                i                               =   0;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        if (    (this->CurrentInputParameters->SelectionVector->VecData)[i]
+            !=  (this->IndexedSelectionVector->VecData)[i]                  )
+        {
+            break;
+        }
+    }
+
+    if (i == this->NumberOfDOFs)
+    {
+        return;
+    }
+
+    this->NumberOfSelectedDOFs  =   0;
+
+    for (i = 0; i < this->NumberOfDOFs; i++)
+    {
+        (this->IndexedSelectionVector->VecData)[i]  =   (this->CurrentInputParameters->SelectionVector->VecData)[i];
+
+        if ((this->CurrentInputParameters->SelectionVector->VecData)[i])
+        {
+            (this->SelectedDOFs->VecData)[this->NumberOfSelectedDOFs]   =   i;
+            this->NumberOfSelectedDOFs++;
+        }
+    }
+
+    return;
+}